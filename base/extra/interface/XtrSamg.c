@@ -116,16 +116,16 @@ INT dCSRmat2SAMGInput (dCSRmat *A,
     /* write the *.frm file */
     fp = fopen(filefrm, "w");
     fprintf(fp, "%s   %d\n", "f", 4);
-    fprintf(fp, "%d %d %d %d %d\n", num_nonzeros, num_rowsA, matrix_type, 1, 0);
+    fprintf(fp, INTFMT " " INTFMT " " INTFMT " %d %d\n", num_nonzeros, num_rowsA, matrix_type, 1, 0);
     fclose(fp);
     
     /* write the *.amg file */
     fp = fopen(fileamg, "w");
     for (j = 0; j <= num_rowsA; ++j) {
-        fprintf(fp, "%d\n", A_i[j] + file_base);
+        fprintf(fp, INTFMT "\n", A_i[j] + file_base);
     }
     for (j = 0; j < num_nonzeros; ++j) {
-        fprintf(fp, "%d\n", A_j[j] + file_base);
+        fprintf(fp, INTFMT "\n", A_j[j] + file_base);
     }
     if (A_data) {
         for (j = 0; j < num_nonzeros; ++j) {
@@ -59,12 +59,27 @@
 
 /**
  * \brief FASP integer and floating point numbers
+ *
+ * \note  When FASP_INT64 is ON (cmake -DUSE_INT64=ON), INT is 64-bit and it is used
+ *        for row pointers, column indices, and sizes alike. INTFMT is the printf and
+ *        scanf conversion for INT and should be used in all I/O of INT values;
+ *        INTMOD is its length modifier for conversions with a field width, such
+ *        as "%6" INTMOD "d".
  */
 #define SHORT            short      /**< short integer type */
+#if FASP_INT64
+#define INT              long long  /**< signed integer types: 64-bit indices */
+#define INTFMT           "%lld"     /**< printf/scanf conversion for INT */
+#define INTMOD           "ll"       /**< printf/scanf length modifier for INT */
+#else
 #define INT              int        /**< signed integer types: signed, long enough */
+#define INTFMT           "%d"       /**< printf/scanf conversion for INT */
+#define INTMOD           ""         /**< printf/scanf length modifier for INT */
+#endif
 #define LONG             long       /**< long integer type */
 #define LONGLONG         long long  /**< long long integer type */
 #define REAL             double     /**< float type */
+#define SREAL            float      /**< single precision float type */
 #define STRLEN           256        /**< length of strings */
 
 /**
@@ -86,7 +101,7 @@
 /**
  * \brief Definition of print command in DEBUG mode
  */
-#define PUT_INT(A)  printf("### DEBUG: %s = %d\n", #A, (A)) /**< print integer  */
+#define PUT_INT(A)  printf("### DEBUG: %s = " INTFMT "\n", #A, (A)) /**< print integer  */
 #define PUT_REAL(A) printf("### DEBUG: %s = %e\n", #A, (A)) /**< print real num */
 
 /*---------------------------*/
@@ -296,6 +311,144 @@ typedef struct dCSRLmat{
 
 } dCSRLmat; /**< Sparse matrix of REAL type in CSRL format */
 
+/*!
+ * \struct dSELLmat
+ * \brief  Sparse matrix of REAL type in SELL-C-sigma format
+ *
+ * Rows are sorted by length within windows of sigma rows and grouped into chunks
+ * of C rows. Each chunk is padded to its longest row and stored column-major,
+ * so that the C rows of a chunk can be processed by SIMD lanes simultaneously.
+ *
+ * \note The starting index of A is 0.
+ */
+typedef struct dSELLmat{
+
+    //! number of rows
+    INT row;
+
+    //! number of cols
+    INT col;
+
+    //! number of nonzero entries (without padding)
+    INT nnz;
+
+    //! chunk height C
+    INT C;
+
+    //! sorting window sigma (a multiple of C)
+    INT sigma;
+
+    //! number of chunks, ceil(row/C)
+    INT nchunk;
+
+    //! cs[c]: starting position of chunk c in ja and val, the size is nchunk+1
+    INT *cs;
+
+    //! cl[c]: width (length of the longest row) of chunk c, the size is nchunk
+    INT *cl;
+
+    //! perm[i]: original row index of the i-th sorted row, the size is nchunk*C
+    INT *perm;
+
+    //! column indices of all entries including padding, the size is cs[nchunk]
+    INT *ja;
+
+    //! values of all entries including padding (zeros), the size is cs[nchunk]
+    REAL *val;
+
+} dSELLmat; /**< Sparse matrix of REAL type in SELL-C-sigma format */
+
+/*!
+ * \struct dSymCSRmat
+ * \brief  Symmetric sparse matrix of REAL type in SymCSR format
+ *
+ * Only the diagonal and the strictly upper triangular part of a symmetric matrix
+ * are stored; the lower triangular part is implied by symmetry. The column indices
+ * in each row are in increasing order.
+ *
+ * \note The starting index of A is 0.
+ * \note The threaded SpMV partition and buffers are built at the first threaded
+ *       SpMV for the sparsity pattern of A and are kept until fasp_dsymcsr_free.
+ */
+typedef struct dSymCSRmat{
+
+    //! number of rows
+    INT row;
+
+    //! number of cols (equal to row)
+    INT col;
+
+    //! number of nonzero entries in the strictly upper triangular part
+    INT nnz;
+
+    //! diagonal entries, the size is row
+    REAL *diag;
+
+    //! row pointers of the strictly upper triangular part, the size is row+1
+    INT *IA;
+
+    //! column indices of the strictly upper triangular part, the size is nnz
+    INT *JA;
+
+    //! nonzero entries of the strictly upper triangular part, the size is nnz
+    REAL *val;
+
+    //! number of threads of the cached threaded SpMV partition (0 if not built)
+    INT nthreads;
+
+    //! row blocks, scatter ranges and buffer offsets of the threaded SpMV
+    INT *part;
+
+    //! scatter buffers of the threaded SpMV
+    REAL *work;
+
+} dSymCSRmat; /**< Symmetric sparse matrix of REAL type in SymCSR format */
+
+/*!
+ * \struct dCSR16mat
+ * \brief  Sparse matrix of REAL type in CSR format with compressed column indices
+ *
+ * The column index of the k-th entry of row i is base[i] + JD[k], where base[i] is
+ * the column index of the first entry of the row and JD holds signed 16-bit deltas.
+ * An entry whose delta does not fit in 16 bits is marked by CSR16_ESCAPE in JD and
+ * its column index is stored in JE. For a row with escapes, base[i] = -(p+1), JE[p]
+ * is the column index of the first entry of the row, and JE[p+1], JE[p+2], ... are
+ * the column indices of its escaped entries. The entries are kept in the same order
+ * as in the dCSRmat.
+ *
+ * \note The starting index of A is 0.
+ */
+typedef struct dCSR16mat{
+
+    //! number of rows
+    INT row;
+
+    //! number of cols
+    INT col;
+
+    //! number of nonzero entries
+    INT nnz;
+
+    //! number of entries in JE
+    INT nesc;
+
+    //! integer array of row pointers, the size is row+1
+    INT *IA;
+
+    //! first column index of each row (or position in JE if negative), size is row
+    INT *base;
+
+    //! column index deltas to the first column of the row, the size is nnz
+    SHORT *JD;
+
+    //! column indices of rows with escapes, the size is nesc
+    INT *JE;
+
+    //! nonzero entries of A, the size is nnz
+    REAL *val;
+
+} dCSR16mat; /**< Sparse matrix of REAL type in CSR format with 16-bit indices */
+
 /**
  * \struct dSTRmat
  * \brief  Structure matrix of REAL type
@@ -366,6 +519,77 @@ typedef struct ivector{
 
 } ivector; /**< Vector of INT type */
 
+/**
+ * \struct dCSRplan
+ * \brief  Execution plan for repeated SpMV with a fixed dCSRmat
+ *
+ * The plan caches the decisions which the plain CSR kernels take at every call
+ * (OpenMP or not, number of threads, row partition) together with the row-length
+ * histogram used to choose a kernel variant.
+ *
+ * \note A plan is only valid for the matrix (sparsity pattern) it was built for.
+ */
+typedef struct dCSRplan{
+
+    //! number of rows of the matrix
+    INT row;
+
+    //! number of nonzeros of the matrix
+    INT nnz;
+
+    //! whether the threaded kernel is used
+    SHORT use_openmp;
+
+    //! number of row blocks (threads)
+    INT nthreads;
+
+    //! part[k]: first row of block k, balanced by nonzeros, the size is nthreads+1
+    INT *part;
+
+    //! maximal number of nonzeros in a row
+    INT maxnzr;
+
+    //! hist[k]: number of rows with k nonzeros, the size is maxnzr+1
+    INT *hist;
+
+    //! row length if all rows have the same length (fixed-length kernel), or 0
+    INT fixlen;
+
+} dCSRplan; /**< Execution plan for CSR SpMV */
+
+/**
+ * \struct dCSRrap
+ * \brief  Plan for repeated Galerkin products R*A*P with a fixed sparsity
+ *
+ * The sparsity pattern of R*A*P is kept in the product matrix built by the
+ * symbolic phase; the plan keeps the row partition of the numeric phase, which
+ * is balanced by the number of multiplications in each row.
+ *
+ * \note A plan is only valid for the sparsity patterns of R, A, and P it was
+ *       built for.
+ */
+typedef struct dCSRrap{
+
+    //! number of rows of R*A*P
+    INT row;
+
+    //! number of columns of R*A*P
+    INT col;
+
+    //! number of nonzeros of R*A*P
+    INT nnz;
+
+    //! whether the threaded kernel is used
+    SHORT use_openmp;
+
+    //! number of row blocks (threads)
+    INT nthreads;
+
+    //! part[k]: first row of block k, balanced by multiplications, size nthreads+1
+    INT *part;
+
+} dCSRrap; /**< Plan for the Galerkin product R*A*P */
+
 /*---------------------------*/
 /*--- Parameter structures --*/
 /*---------------------------*/
@@ -382,6 +606,7 @@ typedef struct {
     SHORT precond_type;    /**< preconditioner type */
     SHORT stop_type;       /**< stopping type */
     INT   restart;         /**< number of steps for restarting: for GMRES etc */
+    INT   ell;             /**< number of BiCG steps per MR step in BiCGstab(l) */
     INT   maxit;           /**< max number of iterations */
     REAL  tol;             /**< convergence tolerance */
     
@@ -504,7 +729,8 @@ typedef struct {
     //! coarsening type
     SHORT coarsening_type;
     
-    //! aggregation type
+    //! aggregation type: PAIRWISE, VMB, or MIS2 (parallel setup, but larger
+    //! aggregates and more iterations than VMB)
     SHORT aggregation_type;
     
     //! interpolation type
@@ -576,12 +802,53 @@ typedef struct {
     //! type of Schwarz block solver
     INT SWZ_blksolver;
     
+    //! store P, R, and coarse level A in single precision: ON or OFF
+    SHORT mixed_precision;
+    
+    //! store the column indices of A in 16-bit deltas for the cycles: ON or OFF
+    SHORT compress_index;
+    
 } AMG_param; /**< Parameters for AMG methods */
 
 /*---------------------------*/
 /*--- Work data structures --*/
 /*---------------------------*/
 
+/**
+ * \struct Arena_data
+ * \brief  Memory arena for temporary work space
+ *
+ * Memory is drawn from one block by bumping an offset and given back in LIFO
+ * order with fasp_arena_release. When the block is full, extra blocks are taken
+ * from the heap; once the arena is empty again, they are merged into one block
+ * large enough for the peak usage, so that repeated solves do not call malloc.
+ * The default arena (NULL) is thread-local and frees its block when it becomes
+ * empty; any other arena must not be used by several threads at once.
+ *
+ * Added on 10/16/2026
+ */
+typedef struct {
+
+    //! memory block
+    char   *base;
+
+    //! size of the block in bytes
+    size_t  size;
+
+    //! bytes in use in the block
+    size_t  used;
+
+    //! bytes in use in the extra blocks
+    size_t  nextra;
+
+    //! peak bytes in use since the arena was empty
+    size_t  peak;
+
+    //! extra blocks from the heap, most recent first
+    void   *extra;
+
+} Arena_data; /**< Data for memory arena */
+
 /**
  * \struct Mumps_data
  * \brief  Data for MUMPS interface
@@ -864,6 +1131,40 @@ typedef struct {
     //! weight for smoother
     REAL weight;
 
+    //! SpMV plan for A at level level_num
+    dCSRplan *Aplan;
+
+    //! SpMV plan for R at level level_num
+    dCSRplan *Rplan;
+
+    //! SpMV plan for P at level level_num
+    dCSRplan *Pplan;
+
+    //! Galerkin product plan of R*A*P at level level_num
+    dCSRrap *RAPplan;
+
+    //! single precision values of A at level level_num (mixed precision AMG)
+    SREAL *Aval_sp;
+
+    //! single precision values of R at level level_num (mixed precision AMG)
+    SREAL *Rval_sp;
+
+    //! single precision values of P at level level_num (mixed precision AMG)
+    SREAL *Pval_sp;
+
+    //! A with compressed column indices at level level_num (shares A.val)
+    dCSR16mat *A16;
+
+    //! upper bound of the spectrum of inv(D)*A at level level_num
+    REAL eig_max;
+
+    //! smallest Ritz value of inv(D)*A at level level_num (an upper bound of
+    //! the smallest eigenvalue)
+    REAL eig_min;
+
+    //! AMLI coefficients of the AMG parameters are set by the setup (level 0 only)
+    SHORT amli_coef_setup;
+
 #if MULTI_COLOR_ORDER    
     //! Gauss-Seidel Multicoloring factors. zhaoli,2021.08.25
     REAL GS_Theta; 
@@ -1070,6 +1371,35 @@ typedef struct {
     
 } precond_diag_str; /**< Data for diagonal preconditioners of STR matrices */
 
+/**
+ * \struct precond_cheby
+ * \brief  Data for Chebyshev polynomial preconditioners
+ *
+ * \note The polynomial in inv(D)*A is fixed by the spectrum bounds, so applying
+ *       it needs no inner products.
+ */
+typedef struct {
+    
+    //! coefficient matrix
+    dCSRmat *A;
+    
+    //! SpMV plan of A
+    dCSRplan *plan;
+    
+    //! inverse of the diagonal of A
+    dvector diag;
+    
+    //! degree of the polynomial
+    INT degree;
+    
+    //! lower bound of the spectrum of inv(D)*A
+    REAL emin;
+    
+    //! upper bound of the spectrum of inv(D)*A
+    REAL emax;
+    
+} precond_cheby; /**< Data for Chebyshev polynomial preconditioners */
+
 /**
  * \struct precond
  * \brief  Preconditioner data and action
@@ -1086,6 +1416,46 @@ typedef struct {
     
 } precond; /**< Data for general preconditioner passed to iterative solvers */
 
+/**
+ * \struct precond_mv
+ * \brief  Preconditioner data and action for a block of vectors
+ *
+ * \note This is the preconditioner structure for block iterative methods. The
+ *       vectors are stored interleaved: entry i of vector j is r[i*nrhs+j].
+ */
+typedef struct {
+    
+    //! data for preconditioner, void pointer
+    void *data;
+    
+    //! action for preconditioner: fct(r, z, nrhs, data)
+    void (*fct)(REAL *, REAL *, const INT, void *);
+    
+} precond_mv; /**< Data for preconditioner passed to block iterative solvers */
+
+/**
+ * \struct recycle_data
+ * \brief  Recycled Krylov subspace kept between successive solves
+ *
+ * \note Used by GCRO-DR: U spans the recycled search space. The space is reused
+ *       by the next call, e.g., for the next time step or Newton iteration.
+ */
+typedef struct {
+    
+    //! length of the vectors
+    INT n;
+    
+    //! maximal number of recycled vectors
+    INT kmax;
+    
+    //! current number of recycled vectors
+    INT k;
+    
+    //! recycled vectors, vector j is U+j*n
+    REAL *U;
+    
+} recycle_data; /**< Recycled subspace for Krylov methods */
+
 /**
  * \struct mxv_matfree
  * \brief  Matrix-vector multiplication, replace the actual matrix
@@ -1125,6 +1495,7 @@ typedef struct {
     REAL itsolver_tol;   /**< tolerance for iterative linear solver */
     INT itsolver_maxit;  /**< maximal number of iterations for iterative solvers */
     INT restart;         /**< restart number used in GMRES */
+    INT itsolver_ell;    /**< number of BiCG steps per MR step in BiCGstab(l) */
 
     // parameters for ILU
     SHORT ILU_type;      /**< ILU type for decomposition*/
@@ -1158,6 +1529,8 @@ typedef struct {
     SHORT AMG_amli_degree;         /**< degree of the polynomial used by AMLI cycle */
     SHORT AMG_nl_amli_krylov_type; /**< type of Krylov method used by nonlinear AMLI cycle */
     INT AMG_SWZ_levels;            /**< number of levels use Schwarz smoother */
+    SHORT AMG_mixed_precision;     /**< store P, R, and coarse A in single precision or not */
+    SHORT AMG_compress_index;      /**< store column indices of A in 16 bits or not */
 
     // parameters for classical AMG
     SHORT AMG_coarsening_type;     /**< coarsening type */
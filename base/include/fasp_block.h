@@ -230,6 +230,12 @@ typedef struct {
     //! data for MUMPS
     Mumps_data mumps;
 
+    //! single precision values of R at level level_num (mixed precision AMG)
+    SREAL *Rval_sp;
+
+    //! single precision values of P at level level_num (mixed precision AMG)
+    SREAL *Pval_sp;
+
 } AMG_data_bsr; /**< AMG data for BSR matrices */
 
 /**
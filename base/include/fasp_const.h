@@ -77,6 +77,23 @@
 #define PRINT_MOST              8  /**< most:   maximal printouts, no files */
 #define PRINT_ALL              10  /**< all:    all printouts, including files */
 
+/**
+ * \brief Categories of memory usage
+ */
+#define MEM_TAG_ALL            -1  /**< all categories together */
+#define MEM_TAG_OTHER           0  /**< not in any category below */
+#define MEM_TAG_AMG             1  /**< AMG hierarchy */
+#define MEM_TAG_ILU             2  /**< ILU factors */
+#define MEM_TAG_WORK            3  /**< Krylov and setup work space (arena) */
+#define MEM_TAG_NUM             4  /**< number of categories */
+
+/**
+ * \brief Thread affinity policies
+ */
+#define BIND_NONE               0  /**< threads may run on all allowed cores */
+#define BIND_CLOSE              1  /**< thread t is pinned to the t-th allowed core */
+#define BIND_SPREAD             2  /**< threads are spread evenly over allowed cores */
+
 /**
  * \brief Definition of matrix format
  **/
@@ -88,6 +105,8 @@
 #define MAT_CSRL                6  /**< modified CSR to reduce cache missing */
 #define MAT_SymCSR              7  /**< symmetric CSR format */
 #define MAT_BLC                 8  /**< block CSR matrix */
+#define MAT_SELL                9  /**< sliced ELLPACK (SELL-C-sigma) format */
+#define MAT_CSR16              10  /**< CSR with 16-bit column index deltas */
 //---------------------------------------------------------------------------------
 //    For bordered systems in reservoir simulation
 //---------------------------------------------------------------------------------
@@ -108,6 +127,8 @@
 #define SOLVER_VFGMRES          6  /**< Variable Restarting Flexible GMRES */
 #define SOLVER_GCG              7  /**< Generalized Conjugate Gradient */
 #define SOLVER_GCR              8  /**< Generalized Conjugate Residual */
+#define SOLVER_PipeCG           9  /**< Pipelined Conjugate Gradient */
+#define SOLVER_CAGMRES         10  /**< s-step (Communication-Avoiding) GMRES */
 //---------------------------------------------------------------------------------
 #define SOLVER_SCG             11  /**< Conjugate Gradient with safety net */
 #define SOLVER_SBiCGstab       12  /**< BiCGstab with safety net */
@@ -117,6 +138,10 @@
 #define SOLVER_SVFGMRES        16  /**< Variable-restart FGMRES with safety net */
 #define SOLVER_SGCG            17  /**< GCG with safety net */
 //---------------------------------------------------------------------------------
+#define SOLVER_GCRODR          18  /**< GCRO with Deflated Restarting */
+#define SOLVER_BiCGstabL       19  /**< BiCGstab(l) */
+#define SOLVER_CHEBY           20  /**< Chebyshev semi-iterative method */
+//---------------------------------------------------------------------------------
 #define SOLVER_AMG             21  /**< AMG as an iterative solver */
 #define SOLVER_FMG             22  /**< Full AMG as an solver */
 //---------------------------------------------------------------------------------
@@ -141,6 +166,7 @@
 #define PREC_FMG                3  /**< with full AMG precond */
 #define PREC_ILU                4  /**< with ILU precond */
 #define PREC_SCHWARZ            5  /**< with Schwarz preconditioner */
+#define PREC_CHEBY              6  /**< with Chebyshev polynomial precond */
 
 /**
  * \brief Type of ILU methods
@@ -170,6 +196,8 @@
 #define VMB                     2  /**< VMB aggregation */
 #define NPAIR                   3  /**< non-symmetric pairwise aggregation */
 #define SPAIR                   4  /**< symmetric pairwise aggregation */
+#define MIS2                    5  /**< distance-2 MIS aggregation (OpenMP), larger
+                                        aggregates and more iterations than VMB */
 
 /**
  * \brief Definition of cycle types
@@ -209,6 +237,16 @@
 #define COARSE_CR               3  /**< Compatible relaxation */
 #define COARSE_AC               4  /**< Aggressive coarsening */
 #define COARSE_MIS              5  /**< Aggressive coarsening based on MIS */
+#define COARSE_PMIS             6  /**< Parallel modified independent set */
+#define COARSE_HMIS             7  /**< RS first pass in blocks followed by PMIS */
+
+/**
+ * \brief Definition of strength-of-connection types
+ */
+#define STRENGTH_CLS            1  /**< Classical: strong negative couplings */
+#define STRENGTH_ABS            2  /**< Classical: strong couplings in abs value */
+#define STRENGTH_SYM            3  /**< Symmetric: scaled by the diagonal */
+#define STRENGTH_SUM            4  /**< Absolute value: scaled by the row sum */
 
 /**
  * \brief Definition of interpolation types
@@ -257,6 +295,24 @@
 #define MAX_STAG               20  /**< Maximal number of stagnation times */
 #define STAG_RATIO           1e-4  /**< Stagnation tolerance = tol*STAGRATIO */
 #define OPENMP_HOLDS         2000  /**< Smallest size for OpenMP version */
+#define SELL_CHUNK              8  /**< Default chunk height C of SELL format */
+#define SPMM_PANEL              8  /**< Panel width of vectors in SpMM kernels */
+#define CAGMRES_STEP            5  /**< Krylov vectors per block of s-step GMRES */
+#define CAGMRES_CHUNK         256  /**< Rows per chunk in s-step GMRES kernels */
+#define GCRODR_RECYCLE         10  /**< Default number of recycled vectors of GCRO-DR */
+#define BICGSTABL_ELL           2  /**< Default degree l of BiCGstab(l) */
+#define BICGSTABL_MAXELL       16  /**< Maximal degree l of BiCGstab(l) */
+#define CHEBY_LANCZOS          30  /**< Lanczos steps for Chebyshev spectrum bounds */
+#define CHEBY_UPPER           1.1  /**< Safety factor on the upper spectrum bound */
+#define CHEBY_CHECK            10  /**< Residual check interval of Chebyshev method */
+#define CHEBY_DEGREE            4  /**< Degree of Chebyshev polynomial precond */
+#define IR_INNER_TOL         1e-4  /**< Tolerance of inner solves of iterative refinement */
+#define IR_MAXIT               20  /**< Max number of iterative refinement steps */
+#define SELL_MAX_CHUNK         64  /**< Maximal chunk height C of SELL format */
+#define SELL_SIGMA            256  /**< Default sorting window of SELL format */
+#define CSR16_ESCAPE       -32768  /**< Escape of a long jump in CSR16 format */
+#define CSR16_MAXDELTA      32767  /**< Maximal column delta stored in CSR16 format */
+#define ARENA_ALIGN            64  /**< Alignment of memory drawn from an arena */
 
 #endif                             /* end if for __FASP_CONST__ */
 
@@ -91,18 +91,61 @@ FASP_API void fasp_param_input (const char   *fname,
 
 /*-------- In file: AuxMemory.c --------*/
 
-FASP_API void * fasp_mem_calloc (const unsigned int  size,
-                                 const unsigned int  type);
+FASP_API void * fasp_mem_calloc (const size_t  size,
+                                 const size_t  type);
 
-FASP_API void * fasp_mem_realloc (void           *oldmem,
-                                  const LONGLONG  tsize);
+FASP_API void * fasp_mem_malloc (const size_t  size,
+                                 const size_t  type);
+
+FASP_API void * fasp_mem_calloc_numa (const size_t  size,
+                                      const size_t  type);
+
+FASP_API void * fasp_mem_calloc_numa_rows (const INT      m,
+                                           const INT     *ia,
+                                           const size_t   type);
+
+FASP_API void * fasp_mem_calloc_numa_nnz (const INT      m,
+                                          const INT     *ia,
+                                          const size_t   type);
+
+FASP_API void * fasp_mem_realloc (void          *oldmem,
+                                  const size_t   tsize);
 
 FASP_API void fasp_mem_free (void *mem);
 
 FASP_API void fasp_mem_usage ( void );
 
+FASP_API SHORT fasp_mem_set_tag (const SHORT tag);
+
+FASP_API SHORT fasp_mem_set_first_touch (const SHORT flag);
+
+FASP_API size_t fasp_mem_live (const SHORT tag);
+
+FASP_API size_t fasp_mem_peak (const SHORT tag);
+
+FASP_API void fasp_mem_reset_peak ( void );
+
 FASP_API SHORT fasp_mem_iludata_check (const ILU_data *iludata);
 
+FASP_API Arena_data * fasp_arena_create (const size_t size);
+
+FASP_API void fasp_arena_free (Arena_data *arena);
+
+FASP_API void * fasp_arena_alloc (Arena_data    *arena,
+                                  const size_t   size,
+                                  const size_t   type);
+
+FASP_API void * fasp_arena_calloc (Arena_data    *arena,
+                                   const size_t   size,
+                                   const size_t   type);
+
+FASP_API size_t fasp_arena_mark (const Arena_data *arena);
+
+FASP_API void fasp_arena_release (Arena_data    *arena,
+                                  const size_t   mark);
+
+FASP_API void fasp_arena_reset (Arena_data *arena);
+
 
 /*-------- In file: AuxMessage.c --------*/
 
@@ -235,6 +278,17 @@ FASP_API void fasp_get_start_end (const INT  procid,
                                   INT       *start,
                                   INT       *end);
 
+FASP_API void fasp_get_start_end_nnz (const INT  procid,
+                                      const INT  nprocs,
+                                      const INT  n,
+                                      const INT *ia,
+                                      INT       *start,
+                                      INT       *end);
+
+FASP_API INT fasp_set_thread_affinity (const SHORT policy);
+
+FASP_API void fasp_print_thread_affinity ( void );
+
 FASP_API void fasp_set_gs_threads (const INT mythreads,
                                    const INT its);
 
@@ -250,6 +304,8 @@ FASP_API SHORT fasp_dvec_isnan (const dvector *u);
 
 FASP_API dvector fasp_dvec_create (const INT m);
 
+FASP_API dvector fasp_dvec_create_rows (const dCSRmat *A);
+
 FASP_API ivector fasp_ivec_create (const INT m);
 
 FASP_API void fasp_dvec_alloc (const INT  m,
@@ -355,6 +411,66 @@ FASP_API REAL fasp_blas_darray_dotprod (const INT    n,
                                         const REAL  *x,
                                         const REAL  *y);
 
+FASP_API void fasp_blas_darray_axpy2_norm2 (const INT    n,
+                                            const REAL   a1,
+                                            const REAL  *x1,
+                                            REAL        *y1,
+                                            const REAL   a2,
+                                            const REAL  *x2,
+                                            REAL        *y2,
+                                            REAL        *norms);
+
+FASP_API void fasp_blas_darray_axpyz2_norm2 (const INT    n,
+                                             const REAL   a1,
+                                             const REAL  *x1,
+                                             const REAL  *y1,
+                                             REAL        *z1,
+                                             const REAL   a2,
+                                             const REAL  *x2,
+                                             const REAL  *y2,
+                                             REAL        *z2,
+                                             REAL        *norms);
+
+FASP_API void fasp_blas_darray_axpbypcz (const INT    n,
+                                         const REAL   a,
+                                         const REAL  *x,
+                                         const REAL   b,
+                                         const REAL  *y,
+                                         const REAL   c,
+                                         const REAL  *z,
+                                         REAL        *w);
+
+FASP_API void fasp_blas_darray_dotprod2 (const INT    n,
+                                         const REAL  *x,
+                                         const REAL  *y,
+                                         const REAL  *z,
+                                         REAL        *dots);
+
+FASP_API void fasp_blas_darray_mv_gram (const INT    n,
+                                        const INT    k,
+                                        const INT    l,
+                                        const REAL  *x,
+                                        const REAL  *y,
+                                        REAL        *G);
+
+FASP_API void fasp_blas_darray_mv_axpy (const INT    n,
+                                        const INT    k,
+                                        const INT    l,
+                                        const REAL   a,
+                                        const REAL  *x,
+                                        const REAL  *C,
+                                        REAL        *y);
+
+FASP_API void fasp_blas_darray_mv_norm2 (const INT    n,
+                                         const INT    k,
+                                         const REAL  *x,
+                                         REAL        *norms);
+
+FASP_API INT fasp_blas_darray_mv_cholqr (const INT    n,
+                                         const INT    k,
+                                         REAL        *x,
+                                         REAL        *R);
+
 
 /*-------- In file: BlaEigen.c --------*/
 
@@ -362,6 +478,12 @@ FASP_API REAL fasp_dcsr_maxeig (const dCSRmat  *A,
                                 const REAL      tol,
                                 const INT       maxit);
 
+FASP_API void fasp_dcsr_eig_bounds (const dCSRmat  *A,
+                                    precond        *pc,
+                                    const INT       maxit,
+                                    REAL           *emin,
+                                    REAL           *emax);
+
 
 /*-------- In file: BlaFormat.c --------*/
 
@@ -378,6 +500,18 @@ FASP_API dCSRmat fasp_format_dblc_dcsr (const dBLCmat *Ab);
 
 FASP_API dCSRLmat * fasp_format_dcsrl_dcsr (const dCSRmat *A);
 
+FASP_API dSELLmat * fasp_format_dcsr_dsell (const dCSRmat  *A,
+                                            const INT       C,
+                                            const INT       sigma);
+
+FASP_API dSymCSRmat * fasp_format_dcsr_dsymcsr (const dCSRmat *A);
+
+FASP_API dCSRmat fasp_format_dsymcsr_dcsr (const dSymCSRmat *A);
+
+FASP_API dCSR16mat * fasp_format_dcsr_dcsr16 (const dCSRmat *A);
+
+FASP_API dCSRmat fasp_format_dcsr16_dcsr (const dCSR16mat *A);
+
 FASP_API dCSRmat fasp_format_dbsr_dcsr (const dBSRmat *B);
 
 FASP_API dBSRmat fasp_format_dcsr_dbsr (const dCSRmat  *A,
@@ -480,6 +614,10 @@ FASP_API SHORT fasp_ilu_dcsr_setup (dCSRmat    *A,
                                     ILU_data   *iludata,
                                     ILU_param  *iluparam);
 
+FASP_API SHORT fasp_ilu_dsymcsr_setup (const dSymCSRmat  *A,
+                                       ILU_data          *iludata,
+                                       ILU_param         *iluparam);
+
 
 /*-------- In file: BlaILUSetupSTR.c --------*/
 
@@ -908,6 +1046,8 @@ FASP_API void fasp_dcsr_alloc (const INT  m,
 
 FASP_API void fasp_dcsr_free (dCSRmat *A);
 
+FASP_API void fasp_dcsr_first_touch (dCSRmat *A);
+
 FASP_API void fasp_icsr_free (iCSRmat *A);
 
 FASP_API INT fasp_dcsr_bandwidth (const dCSRmat  *A);
@@ -988,6 +1128,12 @@ FASP_API void dCSRmat_Multicoloring(dCSRmat *A,
                                     INT *rowmax,
                                     INT *groups);
 
+FASP_API dCSRplan * fasp_dcsr_plan_create (const dCSRmat *A);
+
+FASP_API void fasp_dcsr_plan_free (dCSRplan *plan);
+
+FASP_API void fasp_dcsr_rap_free (dCSRrap *plan);
+
 FASP_API void dCSRmat_Multicoloring_Strong_Coupled(dCSRmat *A,
                                                    iCSRmat *S,
                                                    INT *flags,
@@ -1005,6 +1151,16 @@ FASP_API void fasp_smoother_dcsr_gs_multicolor (dvector *u,
                                                 const INT order);
 
 
+/*-------- In file: BlaSparseCSR16.c --------*/
+
+FASP_API dCSR16mat * fasp_dcsr16_create (const INT num_rows,
+                                         const INT num_cols,
+                                         const INT num_nonzeros,
+                                         const INT num_escapes);
+
+FASP_API void fasp_dcsr16_free (dCSR16mat *A);
+
+
 /*-------- In file: BlaSparseCSRL.c --------*/
 
 FASP_API dCSRLmat * fasp_dcsrl_create (const INT num_rows,
@@ -1031,6 +1187,17 @@ FASP_API SHORT fasp_check_iCSRmat (const iCSRmat *A);
 FASP_API void fasp_check_ordering (dCSRmat *A);
 
 
+/*-------- In file: BlaSparseSELL.c --------*/
+
+FASP_API dSELLmat * fasp_dsell_create (const INT num_rows,
+                                       const INT num_cols,
+                                       const INT num_nonzeros,
+                                       const INT C,
+                                       const INT sigma);
+
+FASP_API void fasp_dsell_free (dSELLmat *A);
+
+
 /*-------- In file: BlaSparseSTR.c --------*/
 
 FASP_API dSTRmat fasp_dstr_create (const INT  nx,
@@ -1056,6 +1223,14 @@ FASP_API void fasp_dstr_cp (const dSTRmat *A,
                             dSTRmat       *B);
 
 
+/*-------- In file: BlaSparseSymCSR.c --------*/
+
+FASP_API dSymCSRmat * fasp_dsymcsr_create (const INT num_rows,
+                                           const INT num_nonzeros);
+
+FASP_API void fasp_dsymcsr_free (dSymCSRmat *A);
+
+
 /*-------- In file: BlaSparseUtil.c --------*/
 
 FASP_API void fasp_sparse_abybms_ (INT *ia,
@@ -1225,6 +1400,28 @@ FASP_API void fasp_blas_dbsr_mxv_agg (const dBSRmat  *A,
                                       const REAL     *x,
                                       REAL           *y);
 
+FASP_API void fasp_blas_dbsr_mxv_sp (const dBSRmat  *A,
+                                     const SREAL    *val,
+                                     const REAL     *x,
+                                     REAL           *y);
+
+FASP_API void fasp_blas_dbsr_aAxpy_sp (const REAL      alpha,
+                                       const dBSRmat  *A,
+                                       const SREAL    *val,
+                                       const REAL     *x,
+                                       REAL           *y);
+
+FASP_API void fasp_blas_dbsr_mxm_dense (const dBSRmat  *A,
+                                        const INT       nrhs,
+                                        const REAL     *x,
+                                        REAL           *y);
+
+FASP_API void fasp_blas_dbsr_aAxpy_dense (const REAL      alpha,
+                                          const dBSRmat  *A,
+                                          const INT       nrhs,
+                                          const REAL     *x,
+                                          REAL           *y);
+
 FASP_API void fasp_blas_dbsr_mxm (const dBSRmat  *A,
                                   const dBSRmat  *B,
                                   dBSRmat        *C);
@@ -1274,6 +1471,69 @@ FASP_API void fasp_blas_dcsr_aAxpy_agg (const REAL      alpha,
                                         const REAL     *x,
                                         REAL           *y);
 
+FASP_API void fasp_blas_dcsr_mxv_plan (const dCSRmat   *A,
+                                       const dCSRplan  *plan,
+                                       const REAL      *x,
+                                       REAL            *y);
+
+FASP_API void fasp_blas_dcsr_aAxpy_plan (const REAL       alpha,
+                                         const dCSRmat   *A,
+                                         const dCSRplan  *plan,
+                                         const REAL      *x,
+                                         REAL            *y);
+
+FASP_API REAL fasp_blas_dcsr_mxv_plan_dot (const dCSRmat   *A,
+                                           const dCSRplan  *plan,
+                                           const REAL      *x,
+                                           REAL            *y,
+                                           const REAL      *z);
+
+FASP_API void fasp_blas_dcsr_mxv_sp (const dCSRmat  *A,
+                                     const SREAL    *val,
+                                     const REAL     *x,
+                                     REAL           *y);
+
+FASP_API void fasp_blas_dcsr_aAxpy_sp (const REAL      alpha,
+                                       const dCSRmat  *A,
+                                       const SREAL    *val,
+                                       const REAL     *x,
+                                       REAL           *y);
+
+FASP_API void fasp_blas_dcsr_mxm_dense (const dCSRmat  *A,
+                                        const INT       nrhs,
+                                        const REAL     *x,
+                                        REAL           *y);
+
+FASP_API void fasp_blas_dcsr_aAxpy_dense (const REAL      alpha,
+                                          const dCSRmat  *A,
+                                          const INT       nrhs,
+                                          const REAL     *x,
+                                          REAL           *y);
+
+FASP_API void fasp_blas_dcsr_mxm_dense_sp (const dCSRmat  *A,
+                                           const SREAL    *val,
+                                           const INT       nrhs,
+                                           const REAL     *x,
+                                           REAL           *y);
+
+FASP_API void fasp_blas_dcsr_aAxpy_dense_sp (const REAL      alpha,
+                                             const dCSRmat  *A,
+                                             const SREAL    *val,
+                                             const INT       nrhs,
+                                             const REAL     *x,
+                                             REAL           *y);
+
+FASP_API void fasp_blas_dcsr_mxm_dense_agg (const dCSRmat  *A,
+                                            const INT       nrhs,
+                                            const REAL     *x,
+                                            REAL           *y);
+
+FASP_API void fasp_blas_dcsr_aAxpy_dense_agg (const REAL      alpha,
+                                              const dCSRmat  *A,
+                                              const INT       nrhs,
+                                              const REAL     *x,
+                                              REAL           *y);
+
 FASP_API REAL fasp_blas_dcsr_vmv (const dCSRmat  *A,
                                   const REAL     *x,
                                   const REAL     *y);
@@ -1292,6 +1552,19 @@ FASP_API void fasp_blas_dcsr_rap_agg (const dCSRmat  *R,
                                       const dCSRmat  *P,
                                       dCSRmat        *RAP);
 
+FASP_API dCSRrap * fasp_blas_dcsr_rap_symbolic (const dCSRmat  *R,
+                                                const dCSRmat  *A,
+                                                const dCSRmat  *P,
+                                                dCSRmat        *RAP);
+
+FASP_API SHORT fasp_blas_dcsr_rap_numeric (const dCSRmat  *R,
+                                           const REAL     *Rval,
+                                           const dCSRmat  *A,
+                                           const dCSRmat  *P,
+                                           const REAL     *Pval,
+                                           const dCSRrap  *plan,
+                                           dCSRmat        *RAP);
+
 FASP_API void fasp_blas_dcsr_rap_agg1 (const dCSRmat  *R,
                                        const dCSRmat  *A,
                                        const dCSRmat  *P,
@@ -1324,6 +1597,18 @@ FASP_API void fasp_blas_dcsr_rap4 (dCSRmat   *R,
                                    INT       *icor_ysk);
 
 
+/*-------- In file: BlaSpmvCSR16.c --------*/
+
+FASP_API void fasp_blas_dcsr16_mxv (const dCSR16mat  *A,
+                                    const REAL       *x,
+                                    REAL             *y);
+
+FASP_API void fasp_blas_dcsr16_aAxpy (const REAL        alpha,
+                                      const dCSR16mat  *A,
+                                      const REAL       *x,
+                                      REAL             *y);
+
+
 /*-------- In file: BlaSpmvCSRL.c --------*/
 
 FASP_API void fasp_blas_dcsrl_mxv (const dCSRLmat  *A,
@@ -1331,6 +1616,18 @@ FASP_API void fasp_blas_dcsrl_mxv (const dCSRLmat  *A,
                                    REAL            *y);
 
 
+/*-------- In file: BlaSpmvSELL.c --------*/
+
+FASP_API void fasp_blas_dsell_mxv (const dSELLmat  *A,
+                                   const REAL      *x,
+                                   REAL            *y);
+
+FASP_API void fasp_blas_dsell_aAxpy (const REAL       alpha,
+                                     const dSELLmat  *A,
+                                     const REAL      *x,
+                                     REAL            *y);
+
+
 /*-------- In file: BlaSpmvSTR.c --------*/
 
 FASP_API void fasp_blas_dstr_aAxpy (const REAL      alpha,
@@ -1342,10 +1639,43 @@ FASP_API void fasp_blas_dstr_mxv (const dSTRmat  *A,
                                   const REAL     *x,
                                   REAL           *y);
 
+FASP_API void fasp_blas_dstr_mxm_dense (const dSTRmat  *A,
+                                        const INT       nrhs,
+                                        const REAL     *x,
+                                        REAL           *y);
+
+FASP_API void fasp_blas_dstr_aAxpy_dense (const REAL      alpha,
+                                          const dSTRmat  *A,
+                                          const INT       nrhs,
+                                          const REAL     *x,
+                                          REAL           *y);
+
 FASP_API INT fasp_blas_dstr_diagscale (const dSTRmat  *A,
                                        dSTRmat        *B);
 
 
+/*-------- In file: BlaSpmvSymCSR.c --------*/
+
+FASP_API void fasp_blas_dsymcsr_mxv (const dSymCSRmat  *A,
+                                     const REAL        *x,
+                                     REAL              *y);
+
+FASP_API void fasp_blas_dsymcsr_aAxpy (const REAL         alpha,
+                                       const dSymCSRmat  *A,
+                                       const REAL        *x,
+                                       REAL              *y);
+
+
+/*-------- In file: BlaStrengthCSR.c --------*/
+
+FASP_API SHORT fasp_dcsr_strength (const dCSRmat  *A,
+                                   const SHORT     type,
+                                   const REAL      theta,
+                                   const REAL      max_row_sum,
+                                   iCSRmat        *S,
+                                   iCSRmat        *ST);
+
+
 /*-------- In file: BlaVector.c --------*/
 
 FASP_API void fasp_blas_dvec_axpy (const REAL     a,
@@ -1537,6 +1867,44 @@ FASP_API void fasp_smoother_dcsr_L1diag (dvector    *u,
                                          dvector    *b,
                                          INT         L);
 
+FASP_API void fasp_smoother_dcsr_jacobi_mv (const INT    nrhs,
+                                            REAL        *u,
+                                            dCSRmat     *A,
+                                            const REAL  *b,
+                                            INT          L,
+                                            const REAL   w);
+
+FASP_API void fasp_smoother_dcsr_gs_mv (const INT    nrhs,
+                                        REAL        *u,
+                                        dCSRmat     *A,
+                                        const REAL  *b,
+                                        INT          L,
+                                        const INT   *mark,
+                                        const INT    order);
+
+
+/*-------- In file: ItrSmootherCSR16.c --------*/
+
+FASP_API void fasp_smoother_dcsr16_gs (dvector          *u,
+                                       const INT         i_1,
+                                       const INT         i_n,
+                                       const INT         s,
+                                       const dCSR16mat  *A,
+                                       const dvector    *b,
+                                       INT               L);
+
+FASP_API void fasp_smoother_dcsr16_gs_cf (dvector          *u,
+                                          const dCSR16mat  *A,
+                                          const dvector    *b,
+                                          INT               L,
+                                          const INT        *mark,
+                                          const INT         order);
+
+FASP_API void fasp_smoother_dcsr16_sgs (dvector          *u,
+                                        const dCSR16mat  *A,
+                                        const dvector    *b,
+                                        INT               L);
+
 
 /*-------- In file: ItrSmootherCSRcr.c --------*/
 
@@ -1560,6 +1928,14 @@ FASP_API void fasp_smoother_dcsr_poly (dCSRmat *Amat,
                                        INT      ndeg,
                                        INT      L);
 
+FASP_API void fasp_smoother_dcsr_poly_eig (dCSRmat    *Amat,
+                                           dvector    *brhs,
+                                           dvector    *usol,
+                                           INT         n,
+                                           INT         ndeg,
+                                           INT         L,
+                                           const REAL  emax);
+
 FASP_API void fasp_smoother_dcsr_poly_old (dCSRmat *Amat, 
                                            dvector *brhs, 
                                            dvector *usol, 
@@ -1568,6 +1944,42 @@ FASP_API void fasp_smoother_dcsr_poly_old (dCSRmat *Amat,
                                            INT      L);
 
 
+/*-------- In file: ItrSmootherCSRsp.c --------*/
+
+FASP_API void fasp_smoother_dcsr_jacobi_sp (dvector          *u,
+                                            const INT         i_1,
+                                            const INT         i_n,
+                                            const INT         s,
+                                            const dCSRmat    *A,
+                                            const SREAL      *val,
+                                            const dvector    *b,
+                                            INT               L,
+                                            const REAL        w);
+
+FASP_API void fasp_smoother_dcsr_gs_sp (dvector          *u,
+                                        const INT         i_1,
+                                        const INT         i_n,
+                                        const INT         s,
+                                        const dCSRmat    *A,
+                                        const SREAL      *val,
+                                        const dvector    *b,
+                                        INT               L);
+
+FASP_API void fasp_smoother_dcsr_gs_cf_sp (dvector          *u,
+                                           const dCSRmat    *A,
+                                           const SREAL      *val,
+                                           const dvector    *b,
+                                           INT               L,
+                                           const INT        *mark,
+                                           const INT         order);
+
+FASP_API void fasp_smoother_dcsr_sgs_sp (dvector          *u,
+                                         const dCSRmat    *A,
+                                         const SREAL      *val,
+                                         const dvector    *b,
+                                         INT               L);
+
+
 /*-------- In file: ItrSmootherSTR.c --------*/
 
 FASP_API void fasp_smoother_dstr_jacobi (dSTRmat *A, 
@@ -1671,6 +2083,48 @@ FASP_API void fasp_smoother_dstr_swz (dSTRmat *A,
                                       ivector *order);
 
 
+/*-------- In file: ItrSmootherSymCSR.c --------*/
+
+FASP_API void fasp_smoother_dsymcsr_gs (dvector           *u,
+                                        const SHORT        order,
+                                        const dSymCSRmat  *A,
+                                        const dvector     *b,
+                                        INT                L);
+
+FASP_API void fasp_smoother_dsymcsr_sgs (dvector           *u,
+                                         const dSymCSRmat  *A,
+                                         const dvector     *b,
+                                         INT                L);
+
+FASP_API void fasp_smoother_dsymcsr_ilu (const dSymCSRmat  *A,
+                                         dvector           *b,
+                                         dvector           *x,
+                                         void              *data);
+
+
+/*-------- In file: KryPbcg.c --------*/
+
+FASP_API INT fasp_solver_dcsr_pbcg (dCSRmat     *A,
+                                    dvector     *b,
+                                    dvector     *u,
+                                    const INT    nrhs,
+                                    precond_mv  *pc,
+                                    const REAL   tol,
+                                    const INT    MaxIt,
+                                    const SHORT  StopType,
+                                    const SHORT  PrtLvl);
+
+FASP_API INT fasp_solver_dbsr_pbcg (dBSRmat     *A,
+                                    dvector     *b,
+                                    dvector     *u,
+                                    const INT    nrhs,
+                                    precond_mv  *pc,
+                                    const REAL   tol,
+                                    const INT    MaxIt,
+                                    const SHORT  StopType,
+                                    const SHORT  PrtLvl);
+
+
 /*-------- In file: KryPbcgs.c --------*/
 
 FASP_API INT fasp_solver_dcsr_pbcgs (dCSRmat     *A,
@@ -1719,6 +2173,77 @@ FASP_API INT fasp_solver_pbcgs (mxv_matfree *mf,
                                 const SHORT  PrtLvl);
 
 
+/*-------- In file: KryPbcgsl.c --------*/
+
+FASP_API INT fasp_solver_dcsr_pbcgsl (dCSRmat     *A,
+                                      dvector     *b,
+                                      dvector     *u,
+                                      precond     *pc,
+                                      const REAL   tol,
+                                      const INT    MaxIt,
+                                      const SHORT  ell,
+                                      const SHORT  StopType,
+                                      const SHORT  PrtLvl);
+
+FASP_API INT fasp_solver_dbsr_pbcgsl (dBSRmat     *A,
+                                      dvector     *b,
+                                      dvector     *u,
+                                      precond     *pc,
+                                      const REAL   tol,
+                                      const INT    MaxIt,
+                                      const SHORT  ell,
+                                      const SHORT  StopType,
+                                      const SHORT  PrtLvl);
+
+FASP_API INT fasp_solver_pbcgsl (mxv_matfree *mf,
+                                 dvector     *b,
+                                 dvector     *u,
+                                 precond     *pc,
+                                 const REAL   tol,
+                                 const INT    MaxIt,
+                                 const SHORT  ell,
+                                 const SHORT  StopType,
+                                 const SHORT  PrtLvl);
+
+
+/*-------- In file: KryPbgmres.c --------*/
+
+FASP_API INT fasp_solver_dcsr_pbgmres (dCSRmat     *A,
+                                       dvector     *b,
+                                       dvector     *x,
+                                       const INT    nrhs,
+                                       precond_mv  *pc,
+                                       const REAL   tol,
+                                       const INT    MaxIt,
+                                       const SHORT  restart,
+                                       const SHORT  StopType,
+                                       const SHORT  PrtLvl);
+
+FASP_API INT fasp_solver_dbsr_pbgmres (dBSRmat     *A,
+                                       dvector     *b,
+                                       dvector     *x,
+                                       const INT    nrhs,
+                                       precond_mv  *pc,
+                                       const REAL   tol,
+                                       const INT    MaxIt,
+                                       const SHORT  restart,
+                                       const SHORT  StopType,
+                                       const SHORT  PrtLvl);
+
+
+/*-------- In file: KryPcagmres.c --------*/
+
+FASP_API INT fasp_solver_dcsr_pcagmres (dCSRmat     *A,
+                                        dvector     *b,
+                                        dvector     *x,
+                                        precond     *pc,
+                                        const REAL   tol,
+                                        const INT    MaxIt,
+                                        const SHORT  restart,
+                                        const SHORT  StopType,
+                                        const SHORT  PrtLvl);
+
+
 /*-------- In file: KryPcg.c --------*/
 
 FASP_API INT fasp_solver_dcsr_pcg (dCSRmat     *A,
@@ -1767,6 +2292,18 @@ FASP_API INT fasp_solver_pcg (mxv_matfree *mf,
                               const SHORT  PrtLvl);
 
 
+/*-------- In file: KryPcheby.c --------*/
+
+FASP_API INT fasp_solver_dcsr_pcheby (dCSRmat     *A,
+                                      dvector     *b,
+                                      dvector     *x,
+                                      precond     *pc,
+                                      const REAL   tol,
+                                      const INT    MaxIt,
+                                      const SHORT  StopType,
+                                      const SHORT  PrtLvl);
+
+
 /*-------- In file: KryPgcg.c --------*/
 
 FASP_API INT fasp_solver_dcsr_pgcg (dCSRmat     *A,
@@ -1811,6 +2348,25 @@ FASP_API INT fasp_solver_dblc_pgcr (dBLCmat     *A,
                                     const SHORT  PrtLvl);
 
 
+/*-------- In file: KryPgcrodr.c --------*/
+
+FASP_API void fasp_recycle_init (recycle_data  *rec,
+                                 const INT      kmax);
+
+FASP_API void fasp_recycle_free (recycle_data  *rec);
+
+FASP_API INT fasp_solver_dcsr_pgcrodr (dCSRmat       *A,
+                                       dvector       *b,
+                                       dvector       *x,
+                                       precond       *pc,
+                                       const REAL     tol,
+                                       const INT      MaxIt,
+                                       const SHORT    restart,
+                                       recycle_data  *rec,
+                                       const SHORT    StopType,
+                                       const SHORT    PrtLvl);
+
+
 /*-------- In file: KryPgmres.c --------*/
 
 FASP_API INT fasp_solver_dcsr_pgmres (dCSRmat     *A,
@@ -1903,6 +2459,18 @@ FASP_API INT fasp_solver_pminres (mxv_matfree  *mf,
                                   const SHORT   PrtLvl);
 
 
+/*-------- In file: KryPpipecg.c --------*/
+
+FASP_API INT fasp_solver_dcsr_ppipecg (dCSRmat     *A,
+                                       dvector     *b,
+                                       dvector     *u,
+                                       precond     *pc,
+                                       const REAL   tol,
+                                       const INT    MaxIt,
+                                       const SHORT  StopType,
+                                       const SHORT  PrtLvl);
+
+
 /*-------- In file: KryPvfgmres.c --------*/
 
 FASP_API INT fasp_solver_dcsr_pvfgmres (dCSRmat      *A,
@@ -2225,6 +2793,14 @@ FASP_API SHORT fasp_amg_setup_cr (AMG_data   *mgl,
                                   AMG_param  *param);
 
 
+/*-------- In file: PreAMGSetupNumeric.c --------*/
+
+FASP_API SHORT fasp_amg_setup_numeric (AMG_data       *mgl,
+                                       const dCSRmat  *A,
+                                       AMG_param      *param,
+                                       const SHORT     freeze_P);
+
+
 /*-------- In file: PreAMGSetupRS.c --------*/
 
 FASP_API SHORT fasp_amg_setup_rs (AMG_data   *mgl,
@@ -2360,6 +2936,10 @@ FASP_API void fasp_precond_diag (REAL *r,
                                  REAL *z, 
                                  void *data);
 
+FASP_API void fasp_precond_cheby (REAL *r,
+                                  REAL *z,
+                                  void *data);
+
 FASP_API void fasp_precond_ilu (REAL *r, 
                                 REAL *z, 
                                 void *data);
@@ -2380,6 +2960,11 @@ FASP_API void fasp_precond_amg (REAL *r,
                                 REAL *z, 
                                 void *data);
 
+FASP_API void fasp_precond_amg_mv (REAL       *r,
+                                   REAL       *z,
+                                   const INT   nrhs,
+                                   void       *data);
+
 FASP_API void fasp_precond_famg (REAL *r, 
                                  REAL *z, 
                                  void *data);
@@ -2406,10 +2991,24 @@ FASP_API AMG_data * fasp_amg_data_create (SHORT max_levels);
 FASP_API void fasp_amg_data_free (AMG_data   *mgl,
                                   AMG_param  *param);
 
+FASP_API void fasp_amg_data_mixed_precision (AMG_data         *mgl,
+                                             const AMG_param  *param);
+
+FASP_API SHORT fasp_amg_data_sp_level (AMG_data         *mgl,
+                                       const AMG_param  *param,
+                                       const INT         lvl);
+
+FASP_API void fasp_amg_data_compress_index (AMG_data *mgl);
+
+FASP_API void fasp_amg_data_eig_bounds (AMG_data   *mgl,
+                                        AMG_param  *param);
+
 FASP_API AMG_data_bsr * fasp_amg_data_bsr_create (SHORT max_levels);
 
 FASP_API void fasp_amg_data_bsr_free (AMG_data_bsr *mgl);
 
+FASP_API void fasp_amg_data_bsr_mixed_precision (AMG_data_bsr *mgl);
+
 FASP_API void fasp_ilu_data_create (const INT   iwk,
                                     const INT   nwork,
                                     ILU_data   *iludata);
@@ -2418,12 +3017,24 @@ FASP_API void fasp_ilu_data_free (ILU_data *iludata);
 
 FASP_API void fasp_swz_data_free (SWZ_data *swzdata);
 
+FASP_API void fasp_cheby_data_create (dCSRmat        *A,
+                                      const INT       degree,
+                                      precond_cheby  *chebydata);
+
+FASP_API void fasp_cheby_data_free (precond_cheby *chebydata);
+
 
 /*-------- In file: PreMGCycle.c --------*/
 
 FASP_API void fasp_solver_mgcycle (AMG_data   *mgl,
                                    AMG_param  *param);
 
+FASP_API void fasp_solver_mgcycle_mv (AMG_data   *mgl,
+                                      AMG_param  *param,
+                                      const INT   nrhs,
+                                      REAL       *b,
+                                      REAL       *x);
+
 FASP_API void fasp_solver_mgcycle_bsr (AMG_data_bsr  *mgl,
                                        AMG_param     *param);
 
@@ -2635,6 +3246,11 @@ FASP_API INT fasp_solver_dcsr_krylov_diag (dCSRmat    *A,
                                            dvector    *x,
                                            ITS_param  *itparam);
 
+FASP_API INT fasp_solver_dcsr_krylov_cheby (dCSRmat    *A,
+                                            dvector    *b,
+                                            dvector    *x,
+                                            ITS_param  *itparam);
+
 FASP_API INT fasp_solver_dcsr_krylov_swz (dCSRmat    *A,
                                           dvector    *b,
                                           dvector    *x,
@@ -2647,6 +3263,19 @@ FASP_API INT fasp_solver_dcsr_krylov_amg (dCSRmat    *A,
                                           ITS_param  *itparam,
                                           AMG_param  *amgparam);
 
+FASP_API INT fasp_solver_dcsr_krylov_amg_ir (dCSRmat    *A,
+                                             dvector    *b,
+                                             dvector    *x,
+                                             ITS_param  *itparam,
+                                             AMG_param  *amgparam);
+
+FASP_API INT fasp_solver_dcsr_krylov_amg_mrhs (dCSRmat    *A,
+                                               dvector    *b,
+                                               dvector    *x,
+                                               const INT   nrhs,
+                                               ITS_param  *itparam,
+                                               AMG_param  *amgparam);
+
 FASP_API INT fasp_solver_dcsr_krylov_ilu (dCSRmat    *A,
                                           dvector    *b,
                                           dvector    *x,
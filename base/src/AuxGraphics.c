@@ -133,10 +133,10 @@ void fasp_dcsr_plot (const dCSRmat  *A,
     memset(map, 0x0F, size);
     
     if (!(1 <= m && m <= 32767))
-        printf("### ERROR: Invalid num of rows %d! [%s]\n", m, __FUNCTION__);
+        printf("### ERROR: Invalid num of rows " INTFMT "! [%s]\n", m, __FUNCTION__);
     
     if (!(1 <= n && n <= 32767))
-        printf("### ERROR: Invalid num of cols %d! [%s]\n", n, __FUNCTION__);
+        printf("### ERROR: Invalid num of cols " INTFMT "! [%s]\n", n, __FUNCTION__);
     
     fp = fopen(fname, "wb");
     if (fp == NULL) {
@@ -356,10 +356,10 @@ void fasp_dbsr_plot (const dBSRmat  *A,
     memset((void *)map, 0x0F, size);
     
     if (!(1 <= m && m <= 32767))
-        printf("### ERROR: Invalid num of rows %d! [%s]\n", m, __FUNCTION__);
+        printf("### ERROR: Invalid num of rows " INTFMT "! [%s]\n", m, __FUNCTION__);
 
     if (!(1 <= n && n <= 32767))
-        printf("### ERROR: Invalid num of cols %d! [%s]\n", n, __FUNCTION__);
+        printf("### ERROR: Invalid num of cols " INTFMT "! [%s]\n", n, __FUNCTION__);
 
     fp = fopen(fname, "wb");
     if (fp == NULL) {
@@ -524,14 +524,14 @@ void fasp_grid2d_plot (pgrid2d  pg,
         xmid = pg->p[i][0]*450.0;
         ymid = pg->p[i][1]*450.0;
         fprintf(datei,"%.1f %.1f m ",xmid,ymid);
-        fprintf(datei,"(%d) show\n ",i);
+        fprintf(datei,"(" INTFMT ") show\n ",i);
     }
     fprintf(datei,"u\n");
     for(i=0; i<pg->edges; ++i) {
         xmid = 0.5*(pg->p[pg->e[i][0]][0]+pg->p[pg->e[i][1]][0])*450.0;
         ymid = 0.5*(pg->p[pg->e[i][0]][1]+pg->p[pg->e[i][1]][1])*450.0;
         fprintf(datei,"%.1f %.1f m ",xmid,ymid);
-        fprintf(datei,"(%d) show\n ",i);
+        fprintf(datei,"(" INTFMT ") show\n ",i);
         
         xmid = pg->p[pg->e[i][0]][0]*450.0;
         ymid = pg->p[pg->e[i][0]][1]*450.0;
@@ -546,7 +546,7 @@ void fasp_grid2d_plot (pgrid2d  pg,
         xmid = (pg->p[pg->t[i][0]][0]+pg->p[pg->t[i][1]][0]+pg->p[pg->t[i][2]][0])*150.0;
         ymid = (pg->p[pg->t[i][0]][1]+pg->p[pg->t[i][1]][1]+pg->p[pg->t[i][2]][1])*150.0;
         fprintf(datei,"%.1f %.1f m ",xmid,ymid);
-        fprintf(datei,"(%d) show\n ",i);
+        fprintf(datei,"(" INTFMT ") show\n ",i);
     }
     fprintf(datei, "showpage\n");
     fclose(datei);
@@ -29,6 +29,9 @@
  *
  * \author Chensong Zhang
  * \date   09/29/2013
+ *
+ * Modified by FASP team on 10/16/2026: BiCGstab(l)
+ * Modified by FASP team on 10/16/2026: PMIS and HMIS coarsening
  */
 SHORT fasp_param_check (input_param  *inparam)
 {
@@ -44,6 +47,7 @@ SHORT fasp_param_check (input_param  *inparam)
         || inparam->stop_type<=0
         || inparam->stop_type>3
         || inparam->restart<0
+        || inparam->itsolver_ell<=0
         || inparam->ILU_type<=0
         || inparam->ILU_type>3
         || inparam->ILU_lfil<0
@@ -63,7 +67,7 @@ SHORT fasp_param_check (input_param  *inparam)
         || inparam->AMG_tol<0
         || inparam->AMG_maxit<0
         || inparam->AMG_coarsening_type<=0
-        || inparam->AMG_coarsening_type>4
+        || inparam->AMG_coarsening_type>7
         || inparam->AMG_coarse_solver<0
         || inparam->AMG_interpolation_type<0
         || inparam->AMG_interpolation_type>5
@@ -108,6 +112,9 @@ SHORT fasp_param_check (input_param  *inparam)
  * Modified by Chensong Zhang on 03/23/2015: skip unknown keyword;
  * Modified by Chensong Zhang on 03/27/2017: check unexpected error;
  * Modified by Chensong Zhang on 09/20/2017: new skip the line;
+ * Modified by FASP team on 10/16/2026: add AMG_mixed_precision;
+ * Modified by FASP team on 10/16/2026: add AMG_compress_index;
+ * Modified by FASP team on 10/16/2026: add itsolver_ell;
  */
 void fasp_param_input (const char   *fname,
                        input_param  *inparam)
@@ -283,6 +290,17 @@ void fasp_param_input (const char   *fname,
             if (fscanf(fp, "%*[^\n]")) {/* skip rest of line and do nothing */ };
         }
     
+        else if (strcmp(buffer,"itsolver_ell")==0) {
+            val = fscanf(fp,"%s",buffer);
+            if (val!=1 || strcmp(buffer,"=")!=0) {
+                status = ERROR_INPUT_PAR; break;
+            }
+            val = fscanf(fp,"%d",&ibuff);
+            if (val!=1) { status = ERROR_INPUT_PAR; break; }
+            inparam->itsolver_ell = ibuff;
+            if (fscanf(fp, "%*[^\n]")) {/* skip rest of line and do nothing */ };
+        }
+    
         else if (strcmp(buffer,"AMG_type")==0) {
             val = fscanf(fp,"%s",buffer);
             if (val!=1 || strcmp(buffer,"=")!=0) {
@@ -414,6 +432,52 @@ void fasp_param_input (const char   *fname,
                 { status = ERROR_INPUT_PAR; break; }
             if (fscanf(fp, "%*[^\n]")) {/* skip rest of line and do nothing */ };
         }
+
+        else if (strcmp(buffer,"AMG_mixed_precision")==0) {
+            val = fscanf(fp,"%s",buffer);
+            if (val!=1 || strcmp(buffer,"=")!=0) {
+                status = ERROR_INPUT_PAR; break;
+            }
+            val = fscanf(fp,"%s",buffer);
+            if (val!=1) { status = ERROR_INPUT_PAR; break; }
+    
+            if ((strcmp(buffer,"ON")==0)||(strcmp(buffer,"on")==0)||
+                (strcmp(buffer,"On")==0)||(strcmp(buffer,"oN")==0)) {
+                inparam->AMG_mixed_precision = ON;
+            }
+            else if ((strcmp(buffer,"OFF")==0)||(strcmp(buffer,"off")==0)||
+                     (strcmp(buffer,"ofF")==0)||(strcmp(buffer,"oFf")==0)||
+                     (strcmp(buffer,"Off")==0)||(strcmp(buffer,"oFF")==0)||
+                     (strcmp(buffer,"OfF")==0)||(strcmp(buffer,"OFf")==0)) {
+                inparam->AMG_mixed_precision = OFF;
+            }
+            else
+                { status = ERROR_INPUT_PAR; break; }
+            if (fscanf(fp, "%*[^\n]")) {/* skip rest of line and do nothing */ };
+        }
+
+        else if (strcmp(buffer,"AMG_compress_index")==0) {
+            val = fscanf(fp,"%s",buffer);
+            if (val!=1 || strcmp(buffer,"=")!=0) {
+                status = ERROR_INPUT_PAR; break;
+            }
+            val = fscanf(fp,"%s",buffer);
+            if (val!=1) { status = ERROR_INPUT_PAR; break; }
+    
+            if ((strcmp(buffer,"ON")==0)||(strcmp(buffer,"on")==0)||
+                (strcmp(buffer,"On")==0)||(strcmp(buffer,"oN")==0)) {
+                inparam->AMG_compress_index = ON;
+            }
+            else if ((strcmp(buffer,"OFF")==0)||(strcmp(buffer,"off")==0)||
+                     (strcmp(buffer,"ofF")==0)||(strcmp(buffer,"oFf")==0)||
+                     (strcmp(buffer,"Off")==0)||(strcmp(buffer,"oFF")==0)||
+                     (strcmp(buffer,"OfF")==0)||(strcmp(buffer,"OFf")==0)) {
+                inparam->AMG_compress_index = OFF;
+            }
+            else
+                { status = ERROR_INPUT_PAR; break; }
+            if (fscanf(fp, "%*[^\n]")) {/* skip rest of line and do nothing */ };
+        }
     
         else if (strcmp(buffer,"AMG_levels")==0) {
             val = fscanf(fp,"%s",buffer);
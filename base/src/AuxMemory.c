@@ -4,6 +4,31 @@
  *
  *  \note  This file contains Level-0 (Aux) functions.
  *
+ *  \note  Temporary work space of solvers and setup routines is drawn from a
+ *         memory arena (Arena_data). Passing NULL to the fasp_arena_* functions
+ *         uses the default arena of the library. A typical use is
+ *
+ *             const size_t mark = fasp_arena_mark(NULL);
+ *             REAL *work = (REAL *)fasp_arena_alloc(NULL, 4*m, sizeof(REAL));
+ *             ...
+ *             fasp_arena_release(NULL, mark);
+ *
+ *         The default arena is private to each OpenMP thread, and its memory is
+ *         returned to the system when the outermost user (a solver call or an
+ *         AMG setup) releases it; the next user gets one block of the previous
+ *         peak size. Arena blocks are aligned to ARENA_ALIGN bytes.
+ *
+ *  \note  Blocks from fasp_mem_calloc and fasp_mem_realloc are recorded with their
+ *         sizes and the current category (see fasp_mem_set_tag) in a hash table,
+ *         so that the live and peak memory usage of each category is available at
+ *         any time. Pointers unknown to the table are freed without accounting.
+ *
+ *  \note  With fasp_mem_set_first_touch(ON), fasp_mem_calloc_numa sets the memory
+ *         to zero by all OpenMP threads, each thread its own part. The pages then
+ *         reside on the NUMA node of the thread which works on them in the kernels.
+ *         For arrays of a CSR matrix with known row pointers, the parts are the
+ *         nnz-balanced rows of SpMV (fasp_mem_calloc_numa_rows/_nnz).
+ *
  *---------------------------------------------------------------------------------
  *  Copyright (C) 2009--Present by the FASP team. All rights reserved.
  *  Released under the terms of the GNU Lesser General Public License 3.0 or later.
@@ -24,17 +49,16 @@
 #ifdef __cplusplus
 extern "C" {
 #endif
+    void * nedmalloc(size_t size);
     void * nedcalloc(size_t no, size_t size);
     void * nedrealloc(void *mem, size_t size);
+    void * nedmemalign(size_t alignment, size_t bytes);
     void   nedfree(void *mem);
 #ifdef __cplusplus
 }
 #endif
-#endif
-
-#if DEBUG_MODE > 1
-extern unsigned long total_alloc_mem;
-extern unsigned long total_alloc_count;
+#elif defined(_WIN32)
+#include <malloc.h> // _aligned_malloc
 #endif
 
 /*---------------------------------*/
@@ -43,12 +67,62 @@ extern unsigned long total_alloc_count;
 
 const int  Million = 1048576;  //! 1M = 1024*1024
 
+/**
+ * \struct Arena_block
+ * \brief  Extra block of an arena taken from the heap
+ */
+typedef struct Arena_block {
+    struct Arena_block *next;  //! previous extra block
+    size_t              start; //! arena position where this block starts
+    size_t              bytes; //! size of the payload in bytes
+} Arena_block;
+
+static Arena_data  fasp_work_arena = {NULL, 0, 0, 0, 0, NULL}; //! default arena
+#ifdef _OPENMP
+#pragma omp threadprivate(fasp_work_arena)
+#endif
+
+/**
+ * \struct Mem_entry
+ * \brief  Size and category of a live memory block
+ */
+typedef struct Mem_entry {
+    void   *ptr;   //! address of the block (NULL for an empty slot)
+    size_t  bytes; //! size of the block in bytes
+    SHORT   tag;   //! category of the block
+} Mem_entry;
+
+static Mem_entry  *mem_table      = NULL; //! hash table of live blocks
+static size_t      mem_table_size = 0;    //! number of slots (a power of 2)
+static size_t      mem_table_used = 0;    //! number of occupied slots
+static size_t      mem_live[MEM_TAG_NUM]; //! live bytes of each category
+static size_t      mem_peak[MEM_TAG_NUM]; //! peak bytes of each category
+static size_t      mem_live_all   = 0;    //! live bytes of all categories
+static size_t      mem_peak_all   = 0;    //! peak bytes of all categories
+static SHORT       mem_tag = MEM_TAG_OTHER; //! category of new blocks
+static SHORT       mem_first_touch = OFF;   //! first touch by all threads
+
+static const char *mem_tag_name[MEM_TAG_NUM] = {"Others", "AMG hierarchy",
+                                                "ILU factors", "Krylov workspace"};
+
+/*---------------------------------*/
+/*--  Declare Private Functions  --*/
+/*---------------------------------*/
+
+static void * arena_draw(Arena_data *, const size_t);
+static void * arena_block_alloc(const size_t);
+static void   arena_block_free(void *);
+static void   mem_track_add(void *, const size_t, const SHORT);
+static SHORT  mem_track_remove(void *, size_t *);
+static size_t mem_hash(const void *);
+static void   mem_table_grow(void);
+
 /*---------------------------------*/
 /*--      Public Functions       --*/
 /*---------------------------------*/
 
 /**
- * \fn void * fasp_mem_calloc (const LONGLONG size, const int type)
+ * \fn void * fasp_mem_calloc (const size_t size, const size_t type)
  *
  * \brief Allocate, initiate, and check memory
  *
@@ -61,11 +135,13 @@ const int  Million = 1048576;  //! 1M = 1024*1024
  * \date   2010/08/12
  *
  * Modified by Chensong Zhang on 07/30/2013: print warnings if failed
+ * Modified by FASP team on 10/16/2026: use size_t to allow more than 4GB RAM
+ * Modified by FASP team on 10/16/2026: record size and category of the block
  */
-void * fasp_mem_calloc (const unsigned int  size,
-                        const unsigned int  type)
+void * fasp_mem_calloc (const size_t  size,
+                        const size_t  type)
 {
-    const LONGLONG tsize = size*type;
+    const size_t tsize = size*type;
     void * mem = NULL;
     
 #if DEBUG_MODE > 1
@@ -82,14 +158,11 @@ void * fasp_mem_calloc (const unsigned int  size,
         mem = calloc(size,type);
 #endif
         
-#if DEBUG_MODE > 1
-        total_alloc_mem += tsize;
-        total_alloc_count++;
-#endif
+        if ( mem != NULL ) mem_track_add(mem, tsize, mem_tag);
     }
 
     if ( mem == NULL ) {
-        printf("### WARNING: Trying to allocate %lldB RAM...\n", tsize);
+        printf("### WARNING: Trying to allocate %lluB RAM...\n", (unsigned LONGLONG)tsize);
         printf("### WARNING: Cannot allocate %.4fMB RAM!\n", (REAL)tsize/Million);
     }
     
@@ -97,7 +170,189 @@ void * fasp_mem_calloc (const unsigned int  size,
 }
 
 /**
- * \fn void * fasp_mem_realloc (void * oldmem, const LONGLONG tsize)
+ * \fn void * fasp_mem_malloc (const size_t size, const size_t type)
+ *
+ * \brief Allocate and check memory without initialization
+ *
+ * \param size    Number of memory blocks
+ * \param type    Size of memory blocks
+ *
+ * \return        Void pointer to the allocated memory
+ *
+ * \author FASP team
+ * \date   10/16/2026
+ *
+ * \note No page of the memory is touched, so they are placed on the NUMA node of
+ *       the thread which writes them first.
+ */
+void * fasp_mem_malloc (const size_t  size,
+                        const size_t  type)
+{
+    const size_t tsize = size*type;
+    void * mem = NULL;
+
+    if ( tsize > 0 ) {
+
+#if DLMALLOC
+        mem = dlmalloc(tsize);
+#elif NEDMALLOC
+        mem = nedmalloc(tsize);
+#else
+        mem = malloc(tsize);
+#endif
+
+        if ( mem != NULL ) mem_track_add(mem, tsize, mem_tag);
+    }
+
+    if ( mem == NULL ) {
+        printf("### WARNING: Trying to allocate %lluB RAM...\n", (unsigned LONGLONG)tsize);
+        printf("### WARNING: Cannot allocate %.4fMB RAM!\n", (REAL)tsize/Million);
+    }
+
+    return mem;
+}
+
+/**
+ * \fn void * fasp_mem_calloc_numa (const size_t size, const size_t type)
+ *
+ * \brief Allocate memory and set it to zero by all threads if first touch is on
+ *
+ * \param size    Number of memory blocks
+ * \param type    Size of memory blocks
+ *
+ * \return        Void pointer to the allocated memory
+ *
+ * \author FASP team
+ * \date   10/16/2026
+ *
+ * \note Thread myid zeros the blocks [start, end) from fasp_get_start_end, which is
+ *       the partition of the vector kernels. Without OpenMP or with first touch off,
+ *       this is the same as fasp_mem_calloc. When the row pointers of the matrix
+ *       are known, fasp_mem_calloc_numa_rows and fasp_mem_calloc_numa_nnz follow
+ *       the partition of SpMV instead.
+ */
+void * fasp_mem_calloc_numa (const size_t  size,
+                             const size_t  type)
+{
+#ifdef _OPENMP
+    if ( mem_first_touch == ON && size > OPENMP_HOLDS ) {
+        const INT nthreads = fasp_get_num_threads();
+        char     *mem      = NULL;
+        INT       myid, mybegin, myend;
+
+        if ( nthreads > 1 ) {
+            mem = (char *)fasp_mem_malloc(size, type);
+            if ( mem == NULL ) return NULL;
+#pragma omp parallel for private(myid, mybegin, myend)
+            for ( myid = 0; myid < nthreads; myid++ ) {
+                fasp_get_start_end(myid, nthreads, (INT)size, &mybegin, &myend);
+                memset(mem + (size_t)mybegin*type, 0, (size_t)(myend-mybegin)*type);
+            }
+            return mem;
+        }
+    }
+#endif
+
+    return fasp_mem_calloc(size, type);
+}
+
+/**
+ * \fn void * fasp_mem_calloc_numa_rows (const INT m, const INT *ia,
+ *                                       const size_t type)
+ *
+ * \brief Allocate an array over the rows of a CSR matrix and set it to zero by
+ *        all threads if first touch is on
+ *
+ * \param m       Number of rows
+ * \param ia      Row pointers of the CSR matrix (size m+1)
+ * \param type    Size of the entry of each row
+ *
+ * \return        Void pointer to the allocated memory
+ *
+ * \author FASP team
+ * \date   10/16/2026
+ *
+ * \note Thread myid zeros the rows [start, end) from fasp_get_start_end_nnz, which
+ *       are the rows it works on in fasp_blas_dcsr_mxv. Use it for vectors which
+ *       are mainly read or written by SpMV with the matrix.
+ */
+void * fasp_mem_calloc_numa_rows (const INT      m,
+                                  const INT     *ia,
+                                  const size_t   type)
+{
+#ifdef _OPENMP
+    if ( mem_first_touch == ON && m > OPENMP_HOLDS ) {
+        const INT nthreads = fasp_get_num_threads();
+        char     *mem      = NULL;
+        INT       myid, mybegin, myend;
+
+        if ( nthreads > 1 ) {
+            mem = (char *)fasp_mem_malloc(m, type);
+            if ( mem == NULL ) return NULL;
+#pragma omp parallel for private(myid, mybegin, myend)
+            for ( myid = 0; myid < nthreads; myid++ ) {
+                fasp_get_start_end_nnz(myid, nthreads, m, ia, &mybegin, &myend);
+                memset(mem + (size_t)mybegin*type, 0, (size_t)(myend-mybegin)*type);
+            }
+            return mem;
+        }
+    }
+#endif
+
+    return fasp_mem_calloc(m, type);
+}
+
+/**
+ * \fn void * fasp_mem_calloc_numa_nnz (const INT m, const INT *ia,
+ *                                      const size_t type)
+ *
+ * \brief Allocate an array over the nonzeros of a CSR matrix and set it to zero
+ *        by all threads if first touch is on
+ *
+ * \param m       Number of rows
+ * \param ia      Row pointers of the CSR matrix (size m+1)
+ * \param type    Size of the entry of each nonzero
+ *
+ * \return        Void pointer to the allocated memory (ia[m] entries, at least one)
+ *
+ * \author FASP team
+ * \date   10/16/2026
+ *
+ * \note Thread myid zeros the nonzeros of the rows [start, end) from
+ *       fasp_get_start_end_nnz, the same as it reads in fasp_blas_dcsr_mxv. Use it
+ *       for the column indices and values when the row pointers are known.
+ */
+void * fasp_mem_calloc_numa_nnz (const INT      m,
+                                 const INT     *ia,
+                                 const size_t   type)
+{
+    const INT nnz = ia[m];
+
+#ifdef _OPENMP
+    if ( mem_first_touch == ON && m > OPENMP_HOLDS && nnz > 0 ) {
+        const INT nthreads = fasp_get_num_threads();
+        char     *mem      = NULL;
+        INT       myid, mybegin, myend;
+
+        if ( nthreads > 1 ) {
+            mem = (char *)fasp_mem_malloc(nnz, type);
+            if ( mem == NULL ) return NULL;
+#pragma omp parallel for private(myid, mybegin, myend)
+            for ( myid = 0; myid < nthreads; myid++ ) {
+                fasp_get_start_end_nnz(myid, nthreads, m, ia, &mybegin, &myend);
+                memset(mem + (size_t)ia[mybegin]*type, 0,
+                       (size_t)(ia[myend]-ia[mybegin])*type);
+            }
+            return mem;
+        }
+    }
+#endif
+
+    return fasp_mem_calloc(MAX(nnz,1), type);
+}
+
+/**
+ * \fn void * fasp_mem_realloc (void * oldmem, const size_t tsize)
  *
  * \brief Reallocate, initiate, and check memory
  *
@@ -110,11 +365,16 @@ void * fasp_mem_calloc (const unsigned int  size,
  * \date   2010/08/12
  *
  * Modified by Chensong Zhang on 07/30/2013: print error if failed
+ * Modified by FASP team on 10/16/2026: use size_t to allow more than 4GB RAM
+ * Modified by FASP team on 10/16/2026: record size and category of the block
+ * Modified by FASP team on 10/16/2026: detach the record before realloc
  */
-void * fasp_mem_realloc (void           *oldmem,
-                         const LONGLONG  tsize)
+void * fasp_mem_realloc (void          *oldmem,
+                         const size_t   tsize)
 {
     void * mem = NULL;
+    size_t bytes = 0;
+    SHORT  tag;
 
 #if DEBUG_MODE > 1
     printf("### DEBUG: Trying to allocate %.3lfMB RAM!\n", (REAL)tsize/Million);
@@ -122,6 +382,9 @@ void * fasp_mem_realloc (void           *oldmem,
     
     if ( tsize > 0 ) {
         
+        // detach the record before oldmem is released by realloc
+        tag = ( oldmem != NULL ) ? mem_track_remove(oldmem, &bytes) : -1;
+        
 #if DLMALLOC
         mem = dlrealloc(oldmem,tsize);
 #elif NEDMALLOC
@@ -130,10 +393,16 @@ void * fasp_mem_realloc (void           *oldmem,
         mem = realloc(oldmem,tsize);
 #endif
         
+        if ( mem != NULL ) { // the block keeps its category
+            mem_track_add(mem, tsize, tag >= 0 ? tag : mem_tag);
+        }
+        else if ( tag >= 0 ) { // oldmem is left untouched
+            mem_track_add(oldmem, bytes, tag);
+        }
     }
     
     if ( mem == NULL ) {
-        printf("### WARNING: Trying to allocate %lldB RAM!\n", tsize);
+        printf("### WARNING: Trying to allocate %lluB RAM!\n", (unsigned LONGLONG)tsize);
         printf("### WARNING: Cannot allocate %.3lfMB RAM!\n", (REAL)tsize/Million);
     }
     
@@ -151,10 +420,12 @@ void * fasp_mem_realloc (void           *oldmem,
  * \date   2010/12/24
  *
  * Modified on 2018/01/10 by Chensong: Add output when mem is NULL
+ * Modified by FASP team on 10/16/2026: remove the block from memory accounting
  */
 void fasp_mem_free (void *mem)
 {
     if ( mem ) {
+        mem_track_remove(mem, NULL);
 #if DLMALLOC
         dlfree(mem);
 #elif NEDMALLOC
@@ -162,10 +433,6 @@ void fasp_mem_free (void *mem)
 #else
         free(mem);
 #endif
-
-#if DEBUG_MODE > 1
-        total_alloc_count--;
-#endif
     }
     else {
 #if DEBUG_MODE > 1
@@ -181,13 +448,126 @@ void fasp_mem_free (void *mem)
  *
  * \author Chensong Zhang
  * \date   2010/08/12
+ *
+ * Modified by FASP team on 10/16/2026: print live and peak memory of each category
  */
 void fasp_mem_usage ( void )
 {
-#if DEBUG_MODE > 1
-    printf("### DEBUG: Number of alloc = %ld, allocated memory = %.3fMB.\n",
-           total_alloc_count, (REAL)total_alloc_mem/Million);
-#endif
+    SHORT tag;
+
+    printf("  Memory usage            Live (MB)      Peak (MB)\n");
+    for ( tag = 0; tag < MEM_TAG_NUM; ++tag ) {
+        printf("  %-18s %12.3f   %12.3f\n", mem_tag_name[tag],
+               (REAL)mem_live[tag]/Million, (REAL)mem_peak[tag]/Million);
+    }
+    printf("  %-18s %12.3f   %12.3f\n", "Total",
+           (REAL)mem_live_all/Million, (REAL)mem_peak_all/Million);
+}
+
+/**
+ * \fn SHORT fasp_mem_set_tag (const SHORT tag)
+ *
+ * \brief Set the category of memory blocks allocated from now on
+ *
+ * \param tag     Category MEM_TAG_OTHER, MEM_TAG_AMG, MEM_TAG_ILU, or MEM_TAG_WORK
+ *
+ * \return        Previous category, to be restored by the caller
+ *
+ * \author FASP team
+ * \date   10/16/2026
+ *
+ * \note A typical use is
+ *
+ *           const SHORT tag = fasp_mem_set_tag(MEM_TAG_AMG);
+ *           ...
+ *           fasp_mem_set_tag(tag);
+ */
+SHORT fasp_mem_set_tag (const SHORT tag)
+{
+    const SHORT oldtag = mem_tag;
+
+    mem_tag = ( tag >= 0 && tag < MEM_TAG_NUM ) ? tag : MEM_TAG_OTHER;
+
+    return oldtag;
+}
+
+/**
+ * \fn SHORT fasp_mem_set_first_touch (const SHORT flag)
+ *
+ * \brief Turn on or off first touch by all threads in fasp_mem_calloc_numa
+ *
+ * \param flag    ON or OFF
+ *
+ * \return        Previous setting
+ *
+ * \author FASP team
+ * \date   10/16/2026
+ *
+ * \note Matrices and vectors from fasp_dcsr_create, fasp_dbsr_create, and
+ *       fasp_dvec_create use fasp_mem_calloc_numa. Threads should be pinned to
+ *       cores (fasp_set_thread_affinity or OMP_PROC_BIND) for this to pay off.
+ */
+SHORT fasp_mem_set_first_touch (const SHORT flag)
+{
+    const SHORT oldflag = mem_first_touch;
+
+    mem_first_touch = ( flag == ON ) ? ON : OFF;
+
+    return oldflag;
+}
+
+/**
+ * \fn size_t fasp_mem_live (const SHORT tag)
+ *
+ * \brief Memory currently allocated in a category
+ *
+ * \param tag     Category (MEM_TAG_ALL for all categories)
+ *
+ * \return        Number of bytes
+ *
+ * \author FASP team
+ * \date   10/16/2026
+ */
+size_t fasp_mem_live (const SHORT tag)
+{
+    if ( tag >= 0 && tag < MEM_TAG_NUM ) return mem_live[tag];
+
+    return mem_live_all;
+}
+
+/**
+ * \fn size_t fasp_mem_peak (const SHORT tag)
+ *
+ * \brief Maximal memory allocated in a category since the last reset
+ *
+ * \param tag     Category (MEM_TAG_ALL for all categories)
+ *
+ * \return        Number of bytes
+ *
+ * \author FASP team
+ * \date   10/16/2026
+ */
+size_t fasp_mem_peak (const SHORT tag)
+{
+    if ( tag >= 0 && tag < MEM_TAG_NUM ) return mem_peak[tag];
+
+    return mem_peak_all;
+}
+
+/**
+ * \fn void fasp_mem_reset_peak ( void )
+ *
+ * \brief Reset the peak memory usage of all categories to the current usage
+ *
+ * \author FASP team
+ * \date   10/16/2026
+ */
+void fasp_mem_reset_peak ( void )
+{
+    SHORT tag;
+
+    for ( tag = 0; tag < MEM_TAG_NUM; ++tag ) mem_peak[tag] = mem_live[tag];
+    mem_peak_all = mem_live_all;
 }
 
 /**
@@ -210,12 +590,488 @@ SHORT fasp_mem_iludata_check (const ILU_data *iludata)
         return FASP_SUCCESS;
     }
     else {
-        printf("### ERROR: ILU needs %d RAM, only %d available!\n",
+        printf("### ERROR: ILU needs " INTFMT " RAM, only " INTFMT " available!\n",
                memneed, iludata->nwork);
         return ERROR_ALLOC_MEM;
     }
 }
 
+/**
+ * \fn Arena_data * fasp_arena_create (const size_t size)
+ *
+ * \brief Create a memory arena
+ *
+ * \param size    Initial size of the arena in bytes (it grows when needed)
+ *
+ * \return        Pointer to the arena
+ *
+ * \author FASP team
+ * \date   10/16/2026
+ */
+Arena_data * fasp_arena_create (const size_t size)
+{
+    Arena_data *arena = (Arena_data *)fasp_mem_calloc(1, sizeof(Arena_data));
+
+    if ( size > 0 ) {
+        arena->base = (char *)arena_block_alloc(size);
+        if ( arena->base != NULL ) {
+            arena->size = size;
+            mem_track_add(arena->base, size, MEM_TAG_WORK);
+        }
+    }
+
+    return arena;
+}
+
+/**
+ * \fn void fasp_arena_free (Arena_data *arena)
+ *
+ * \brief Free up all memory of an arena
+ *
+ * \param arena   Pointer to the arena (NULL for the default arena)
+ *
+ * \author FASP team
+ * \date   10/16/2026
+ *
+ * \note The default arena itself is kept and it can be used again.
+ */
+void fasp_arena_free (Arena_data *arena)
+{
+    Arena_data *ar = ( arena == NULL ) ? &fasp_work_arena : arena;
+
+    fasp_arena_release(ar, 0);
+    if ( ar->base != NULL ) mem_track_remove(ar->base, NULL);
+    arena_block_free(ar->base);
+    ar->base = NULL; ar->size = ar->used = ar->peak = 0;
+
+    if ( arena != NULL ) fasp_mem_free(arena);
+}
+
+/**
+ * \fn void * fasp_arena_alloc (Arena_data *arena, const size_t size,
+ *                              const size_t type)
+ *
+ * \brief Draw memory from an arena without initialization
+ *
+ * \param arena   Pointer to the arena (NULL for the default arena)
+ * \param size    Number of memory blocks
+ * \param type    Size of memory blocks
+ *
+ * \return        Void pointer to the memory (NULL if size*type = 0 or failed)
+ *
+ * \author FASP team
+ * \date   10/16/2026
+ *
+ * \note The memory is valid until fasp_arena_release is called with a mark taken
+ *       before this call. It must not be freed with fasp_mem_free.
+ */
+void * fasp_arena_alloc (Arena_data    *arena,
+                         const size_t   size,
+                         const size_t   type)
+{
+    const size_t tsize = size*type;
+    void * mem = NULL;
+
+    if ( tsize > 0 ) mem = arena_draw(arena == NULL ? &fasp_work_arena : arena, tsize);
+
+    if ( tsize > 0 && mem == NULL ) {
+        printf("### WARNING: Trying to draw %lluB RAM from arena...\n",
+               (unsigned LONGLONG)tsize);
+        printf("### WARNING: Cannot allocate %.4fMB RAM!\n", (REAL)tsize/Million);
+    }
+
+    return mem;
+}
+
+/**
+ * \fn void * fasp_arena_calloc (Arena_data *arena, const size_t size,
+ *                               const size_t type)
+ *
+ * \brief Draw memory from an arena and set it to zero
+ *
+ * \param arena   Pointer to the arena (NULL for the default arena)
+ * \param size    Number of memory blocks
+ * \param type    Size of memory blocks
+ *
+ * \return        Void pointer to the memory (NULL if size*type = 0 or failed)
+ *
+ * \author FASP team
+ * \date   10/16/2026
+ */
+void * fasp_arena_calloc (Arena_data    *arena,
+                          const size_t   size,
+                          const size_t   type)
+{
+    void * mem = fasp_arena_alloc(arena, size, type);
+
+    if ( mem != NULL ) memset(mem, 0, size*type);
+
+    return mem;
+}
+
+/**
+ * \fn size_t fasp_arena_mark (const Arena_data *arena)
+ *
+ * \brief Current position of an arena
+ *
+ * \param arena   Pointer to the arena (NULL for the default arena)
+ *
+ * \return        Mark to be passed to fasp_arena_release
+ *
+ * \author FASP team
+ * \date   10/16/2026
+ */
+size_t fasp_arena_mark (const Arena_data *arena)
+{
+    const Arena_data *ar = ( arena == NULL ) ? &fasp_work_arena : arena;
+
+    return ar->used + ar->nextra;
+}
+
+/**
+ * \fn void fasp_arena_release (Arena_data *arena, const size_t mark)
+ *
+ * \brief Give back all memory drawn from an arena after a mark
+ *
+ * \param arena   Pointer to the arena (NULL for the default arena)
+ * \param mark    Mark from fasp_arena_mark
+ *
+ * \author FASP team
+ * \date   10/16/2026
+ *
+ * \note When the default arena becomes empty, its block is freed. When another
+ *       arena becomes empty and the peak usage did not fit in its block, the block
+ *       is enlarged to the peak usage.
+ *
+ * Modified by FASP team on 10/16/2026: free the block of the default arena
+ */
+void fasp_arena_release (Arena_data    *arena,
+                         const size_t   mark)
+{
+    Arena_data  *ar = ( arena == NULL ) ? &fasp_work_arena : arena;
+    Arena_block *blk;
+
+    while ( ar->extra != NULL && ((Arena_block *)ar->extra)->start >= mark ) {
+        blk = (Arena_block *)ar->extra;
+        ar->extra   = blk->next;
+        ar->nextra -= blk->bytes;
+        mem_track_remove(blk, NULL);
+        arena_block_free(blk);
+    }
+
+    if ( ar->extra == NULL && ar->used > mark ) ar->used = mark;
+
+    if ( ar->used + ar->nextra > 0 ) return;
+
+    // the default arena is empty: give its block back, the peak is kept as the
+    // size of the block for the next user
+    if ( ar == &fasp_work_arena ) {
+        if ( ar->base != NULL ) mem_track_remove(ar->base, NULL);
+        arena_block_free(ar->base);
+        ar->base = NULL; ar->size = 0;
+    }
+
+    // other arenas keep a block large enough for the next solve
+    else if ( ar->peak > ar->size ) {
+        if ( ar->base != NULL ) mem_track_remove(ar->base, NULL);
+        arena_block_free(ar->base);
+        ar->base = (char *)arena_block_alloc(ar->peak);
+        ar->size = ( ar->base != NULL ) ? ar->peak : 0;
+        if ( ar->base != NULL ) mem_track_add(ar->base, ar->size, MEM_TAG_WORK);
+    }
+}
+
+/**
+ * \fn void fasp_arena_reset (Arena_data *arena)
+ *
+ * \brief Give back all memory drawn from an arena
+ *
+ * \param arena   Pointer to the arena (NULL for the default arena)
+ *
+ * \author FASP team
+ * \date   10/16/2026
+ */
+void fasp_arena_reset (Arena_data *arena)
+{
+    fasp_arena_release(arena, 0);
+}
+
+/*---------------------------------*/
+/*--      Private Functions      --*/
+/*---------------------------------*/
+
+/**
+ * \fn static void * arena_draw (Arena_data *ar, const size_t tsize)
+ *
+ * \brief Draw tsize bytes from an arena
+ *
+ * \param ar      Pointer to the arena
+ * \param tsize   Number of bytes
+ *
+ * \return        Void pointer to the memory
+ *
+ * \author FASP team
+ * \date   10/16/2026
+ *
+ * Modified by FASP team on 10/16/2026: aligned blocks; block of peak size
+ */
+static void * arena_draw (Arena_data    *ar,
+                          const size_t   tsize)
+{
+    const size_t bytes = (tsize + ARENA_ALIGN - 1)/ARENA_ALIGN*ARENA_ALIGN;
+    const size_t hsize = (sizeof(Arena_block) + ARENA_ALIGN - 1)/ARENA_ALIGN*ARENA_ALIGN;
+    void        *mem   = NULL;
+    Arena_block *blk;
+
+    // the first draw from an empty arena without a block: take one of peak size
+    if ( ar->base == NULL && ar->used + ar->nextra == 0 ) {
+        ar->size = ( MAX(ar->peak, bytes) + ARENA_ALIGN - 1 )/ARENA_ALIGN*ARENA_ALIGN;
+        ar->base = (char *)arena_block_alloc(ar->size);
+        if ( ar->base != NULL ) mem_track_add(ar->base, ar->size, MEM_TAG_WORK);
+        else ar->size = 0;
+    }
+
+    if ( ar->extra == NULL && ar->used + bytes <= ar->size ) {
+        mem = ar->base + ar->used;
+        ar->used += bytes;
+    }
+    else { // block is full: take an extra block from the heap
+        blk = (Arena_block *)arena_block_alloc(hsize + bytes);
+        if ( blk == NULL ) return NULL;
+        mem_track_add(blk, hsize + bytes, MEM_TAG_WORK);
+        blk->next  = (Arena_block *)ar->extra;
+        blk->start = ar->used + ar->nextra;
+        blk->bytes = bytes;
+        ar->extra  = blk;
+        ar->nextra += bytes;
+        mem = (char *)blk + hsize;
+    }
+
+    ar->peak = MAX(ar->peak, ar->used + ar->nextra);
+
+    return mem;
+}
+
+/**
+ * \fn static void * arena_block_alloc (const size_t bytes)
+ *
+ * \brief Allocate a block of an arena aligned to ARENA_ALIGN bytes
+ *
+ * \param bytes   Size of the block in bytes
+ *
+ * \return        Void pointer to the block (NULL if failed)
+ *
+ * \author FASP team
+ * \date   10/16/2026
+ */
+static void * arena_block_alloc (const size_t bytes)
+{
+    void * mem = NULL;
+
+#if DLMALLOC
+    mem = dlmemalign(ARENA_ALIGN, bytes);
+#elif NEDMALLOC
+    mem = nedmemalign(ARENA_ALIGN, bytes);
+#elif defined(_WIN32)
+    mem = _aligned_malloc(bytes, ARENA_ALIGN);
+#else
+    if ( posix_memalign(&mem, ARENA_ALIGN, bytes) != 0 ) mem = NULL;
+#endif
+
+    return mem;
+}
+
+/**
+ * \fn static void arena_block_free (void *mem)
+ *
+ * \brief Free a block from arena_block_alloc
+ *
+ * \param mem     Pointer to the block (nothing is done if NULL)
+ *
+ * \author FASP team
+ * \date   10/16/2026
+ */
+static void arena_block_free (void *mem)
+{
+    if ( mem == NULL ) return;
+
+#if DLMALLOC
+    dlfree(mem);
+#elif NEDMALLOC
+    nedfree(mem);
+#elif defined(_WIN32)
+    _aligned_free(mem);
+#else
+    free(mem);
+#endif
+}
+
+/**
+ * \fn static void mem_track_add (void *ptr, const size_t bytes, const SHORT tag)
+ *
+ * \brief Record a new memory block
+ *
+ * \param ptr     Address of the block
+ * \param bytes   Size of the block in bytes
+ * \param tag     Category of the block
+ *
+ * \author FASP team
+ * \date   10/16/2026
+ *
+ * \note If ptr is still in the table, it was freed without fasp_mem_free and the
+ *       old record is dropped.
+ */
+static void mem_track_add (void          *ptr,
+                           const size_t   bytes,
+                           const SHORT    tag)
+{
+#ifdef _OPENMP
+#pragma omp critical (fasp_mem_track)
+#endif
+    {
+        size_t i;
+
+        if ( 2*(mem_table_used+1) > mem_table_size ) mem_table_grow();
+
+        if ( mem_table_used+1 < mem_table_size ) {
+            i = mem_hash(ptr);
+            while ( mem_table[i].ptr != NULL && mem_table[i].ptr != ptr ) {
+                i = (i+1) & (mem_table_size-1);
+            }
+
+            if ( mem_table[i].ptr == ptr ) { // stale record
+                mem_live[mem_table[i].tag] -= mem_table[i].bytes;
+                mem_live_all -= mem_table[i].bytes;
+            }
+            else {
+                mem_table_used++;
+            }
+
+            mem_table[i].ptr   = ptr;
+            mem_table[i].bytes = bytes;
+            mem_table[i].tag   = tag;
+
+            mem_live[tag] += bytes;
+            mem_live_all  += bytes;
+            mem_peak[tag]  = MAX(mem_peak[tag], mem_live[tag]);
+            mem_peak_all   = MAX(mem_peak_all, mem_live_all);
+        }
+    }
+}
+
+/**
+ * \fn static SHORT mem_track_remove (void *ptr, size_t *bytes)
+ *
+ * \brief Remove the record of a memory block
+ *
+ * \param ptr     Address of the block
+ * \param bytes   Size of the block in bytes (output; skipped if NULL)
+ *
+ * \return        Category of the block (-1 if ptr is not in the table)
+ *
+ * \author FASP team
+ * \date   10/16/2026
+ *
+ * \note Linear probing: the following entries of the cluster are shifted back
+ *       to close the gap.
+ */
+static SHORT mem_track_remove (void    *ptr,
+                               size_t  *bytes)
+{
+    SHORT tag = -1;
+
+#ifdef _OPENMP
+#pragma omp critical (fasp_mem_track)
+#endif
+    {
+        const size_t mask = mem_table_size-1;
+        size_t i, j, k;
+
+        if ( mem_table_size > 0 ) {
+            i = mem_hash(ptr);
+            while ( mem_table[i].ptr != NULL && mem_table[i].ptr != ptr ) i = (i+1) & mask;
+
+            if ( mem_table[i].ptr == ptr ) {
+                tag = mem_table[i].tag;
+                if ( bytes != NULL ) *bytes = mem_table[i].bytes;
+                mem_live[tag] -= mem_table[i].bytes;
+                mem_live_all  -= mem_table[i].bytes;
+                mem_table_used--;
+
+                for ( j = (i+1) & mask; mem_table[j].ptr != NULL; j = (j+1) & mask ) {
+                    k = mem_hash(mem_table[j].ptr);
+                    // move entry j to the gap i if its home slot k is not in (i,j]
+                    if ( ( i < j && ( k <= i || k > j ) ) ||
+                         ( i > j && ( k <= i && k > j ) ) ) {
+                        mem_table[i] = mem_table[j];
+                        i = j;
+                    }
+                }
+                mem_table[i].ptr = NULL;
+            }
+        }
+    }
+
+    return tag;
+}
+
+/**
+ * \fn static size_t mem_hash (const void *ptr)
+ *
+ * \brief Home slot of an address in the hash table
+ *
+ * \param ptr     Address of the block
+ *
+ * \return        Index of the slot
+ *
+ * \author FASP team
+ * \date   10/16/2026
+ */
+static size_t mem_hash (const void *ptr)
+{
+    size_t h = (size_t)ptr >> 4; // blocks are at least 16-byte aligned
+
+    h ^= h >> 17;
+    h *= (size_t)0x9E3779B1UL;
+    h ^= h >> 15;
+
+    return h & (mem_table_size-1);
+}
+
+/**
+ * \fn static void mem_table_grow ( void )
+ *
+ * \brief Double the size of the hash table
+ *
+ * \author FASP team
+ * \date   10/16/2026
+ *
+ * \note If there is not enough memory, the table is kept and new blocks are not
+ *       recorded once it is full.
+ */
+static void mem_table_grow ( void )
+{
+    Mem_entry   *oldtable = mem_table;
+    const size_t oldsize  = mem_table_size;
+    const size_t newsize  = MAX(2*oldsize, 1024);
+    Mem_entry   *newtable = (Mem_entry *)calloc(newsize, sizeof(Mem_entry));
+    size_t       i, j;
+
+    if ( newtable == NULL ) return;
+
+    mem_table      = newtable;
+    mem_table_size = newsize;
+
+    for ( i = 0; i < oldsize; ++i ) {
+        if ( oldtable[i].ptr == NULL ) continue;
+        j = mem_hash(oldtable[i].ptr);
+        while ( mem_table[j].ptr != NULL ) j = (j+1) & (newsize-1);
+        mem_table[j] = oldtable[i];
+    }
+
+    free(oldtable);
+}
+
 /*---------------------------------*/
 /*--        End of File          --*/
 /*---------------------------------*/
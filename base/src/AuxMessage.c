@@ -48,7 +48,7 @@ void fasp_itinfo (const INT   ptrlvl,
     if ( ptrlvl >= PRINT_SOME ) {
         
         if ( iter > 0 ) {
-            printf("%6d | %13.6e   | %13.6e  | %10.4f\n", iter, relres, absres, factor);
+            printf("%6" INTMOD "d | %13.6e   | %13.6e  | %10.4f\n", iter, relres, absres, factor);
         }
         else { // iter = 0: initial guess
             printf("-----------------------------------------------------------\n");
@@ -64,7 +64,7 @@ void fasp_itinfo (const INT   ptrlvl,
                     break;
             }
             printf("-----------------------------------------------------------\n");
-            printf("%6d | %13.6e   | %13.6e  |     -.-- \n", iter, relres, absres);
+            printf("%6" INTMOD "d | %13.6e   | %13.6e  |     -.-- \n", iter, relres, absres);
         } // end if iter
         
     } // end if ptrlvl
@@ -80,6 +80,8 @@ void fasp_itinfo (const INT   ptrlvl,
  *
  * \author Chensong Zhang
  * \date   11/16/2009
+ *
+ * Modified by FASP team on 10/16/2026: Print memory usage
  */
 void fasp_amgcomplexity (const AMG_data  *mgl,
                          const SHORT      prtlvl)
@@ -96,7 +98,7 @@ void fasp_amgcomplexity (const AMG_data  *mgl,
 
         for ( level = 0; level < max_levels; ++level) {
             const REAL AvgNNZ = (REAL) mgl[level].A.nnz/mgl[level].A.row;
-            printf("%5d %13d %17d %14.2f\n",
+            printf("%5d %13" INTMOD "d %17" INTMOD "d %14.2f\n",
                    level, mgl[level].A.row, mgl[level].A.nnz, AvgNNZ);
             gridcom += mgl[level].A.row;
             opcom   += mgl[level].A.nnz;
@@ -116,8 +118,16 @@ void fasp_amgcomplexity (const AMG_data  *mgl,
         opcom   /= mgl[0].A.nnz;
         printf("  Grid complexity = %.3f  |", gridcom);
         printf("  Operator complexity = %.3f\n", opcom);
+        printf("  AMG memory = %.3fMB  |  Peak total memory = %.3fMB\n",
+               (REAL)fasp_mem_live(MEM_TAG_AMG)/1048576.0,
+               (REAL)fasp_mem_peak(MEM_TAG_ALL)/1048576.0);
         
         printf("-----------------------------------------------------------\n");
+        
+        if ( prtlvl > PRINT_SOME ) {
+            fasp_mem_usage();
+            printf("-----------------------------------------------------------\n");
+        }
     }
 }
 
@@ -132,6 +142,8 @@ void fasp_amgcomplexity (const AMG_data  *mgl,
  *
  * \author Chensong Zhang
  * \date   05/10/2013
+ *
+ * Modified by FASP team on 10/16/2026: Print memory usage
  */
 void fasp_amgcomplexity_bsr (const AMG_data_bsr  *mgl,
                              const SHORT          prtlvl)
@@ -148,7 +160,7 @@ void fasp_amgcomplexity_bsr (const AMG_data_bsr  *mgl,
         
         for ( level = 0; level < max_levels; ++level ) {
             const REAL AvgNNZ = (REAL) mgl[level].A.NNZ/mgl[level].A.ROW;
-            printf("%5d  %13d  %17d  %14.2f\n",
+            printf("%5d  %13" INTMOD "d  %17" INTMOD "d  %14.2f\n",
                    level,mgl[level].A.ROW, mgl[level].A.NNZ, AvgNNZ);
             gridcom += mgl[level].A.ROW;
             opcom   += mgl[level].A.NNZ;
@@ -159,9 +171,17 @@ void fasp_amgcomplexity_bsr (const AMG_data_bsr  *mgl,
         opcom   /= mgl[0].A.NNZ;
         printf("  Grid complexity = %.3f  |", gridcom);
         printf("  Operator complexity = %.3f\n", opcom);
+        printf("  AMG memory = %.3fMB  |  Peak total memory = %.3fMB\n",
+               (REAL)fasp_mem_live(MEM_TAG_AMG)/1048576.0,
+               (REAL)fasp_mem_peak(MEM_TAG_ALL)/1048576.0);
         
         printf("-----------------------------------------------------------\n");
         
+        if ( prtlvl > PRINT_SOME ) {
+            fasp_mem_usage();
+            printf("-----------------------------------------------------------\n");
+        }
+        
     }
 }
 
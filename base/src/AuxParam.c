@@ -16,11 +16,6 @@
 #include "fasp.h"
 #include "fasp_functs.h"
 
-#if DEBUG_MODE > 1
-unsigned long total_alloc_mem;   /**< total allocated memory */
-unsigned long total_alloc_count; /**< total allocation times */
-#endif
-
 /*---------------------------------*/
 /*--      Public Functions       --*/
 /*---------------------------------*/
@@ -286,11 +281,6 @@ void fasp_param_init (const input_param  *iniparam,
                       ILU_param          *iluparam,
                       SWZ_param          *swzparam)
 {
-#if DEBUG_MODE > 1
-    total_alloc_mem   = 0; // initialize total memeory amount
-    total_alloc_count = 0; // initialize alloc count
-#endif
-
     if (itsparam) fasp_param_solver_init(itsparam);
     if (amgparam) fasp_param_amg_init(amgparam);
     if (iluparam) fasp_param_ilu_init(iluparam);
@@ -321,6 +311,8 @@ void fasp_param_init (const input_param  *iniparam,
  *
  * \author Chensong Zhang
  * \date   2010/03/20
+ *
+ * Modified by FASP team on 10/16/2026: BiCGstab(l)
  */
 void fasp_param_input_init (input_param *iniparam)
 {
@@ -341,6 +333,7 @@ void fasp_param_input_init (input_param *iniparam)
     iniparam->itsolver_tol             = 1e-6;
     iniparam->itsolver_maxit           = 500;
     iniparam->restart                  = 25;
+    iniparam->itsolver_ell             = BICGSTABL_ELL;
 
     // ILU method parameters
     iniparam->ILU_type                 = ILUk;
@@ -370,6 +363,8 @@ void fasp_param_input_init (input_param *iniparam)
     iniparam->AMG_maxit                = 1;
     iniparam->AMG_ILU_levels           = 0;
     iniparam->AMG_SWZ_levels           = 0;
+    iniparam->AMG_mixed_precision      = OFF;
+    iniparam->AMG_compress_index       = OFF;
     iniparam->AMG_coarse_scaling       = OFF; // Require investigation --Chensong
     iniparam->AMG_amli_degree          = 1;
     iniparam->AMG_nl_amli_krylov_type  = 2;
@@ -425,6 +420,8 @@ void fasp_param_amg_init (AMG_param *amgparam)
     amgparam->amli_degree          = 2;
     amgparam->amli_coef            = NULL;
     amgparam->nl_amli_krylov_type  = SOLVER_GCG;
+    amgparam->mixed_precision      = OFF;
+    amgparam->compress_index       = OFF;
 
     // Classical AMG specific
     amgparam->coarsening_type      = COARSE_RS;
@@ -469,6 +466,8 @@ void fasp_param_amg_init (AMG_param *amgparam)
  *
  * \author Chensong Zhang
  * \date   2010/03/23
+ *
+ * Modified by FASP team on 10/16/2026: BiCGstab(l)
  */
 void fasp_param_solver_init (ITS_param *itsparam)
 {
@@ -479,6 +478,7 @@ void fasp_param_solver_init (ITS_param *itsparam)
     itsparam->stop_type     = STOP_REL_RES;
     itsparam->maxit         = 500;
     itsparam->restart       = 25;
+    itsparam->ell           = BICGSTABL_ELL;
     itsparam->tol           = 1e-6;
 }
 
@@ -567,6 +567,8 @@ void fasp_param_amg_set (AMG_param          *param,
     param->amli_degree          = iniparam->AMG_amli_degree;
     param->amli_coef            = NULL;
     param->nl_amli_krylov_type  = iniparam->AMG_nl_amli_krylov_type;
+    param->mixed_precision      = iniparam->AMG_mixed_precision;
+    param->compress_index       = iniparam->AMG_compress_index;
 
     param->coarsening_type      = iniparam->AMG_coarsening_type;
     param->interpolation_type   = iniparam->AMG_interpolation_type;
@@ -652,6 +654,8 @@ void fasp_param_swz_set (SWZ_param          *swzparam,
  *
  * \author Chensong Zhang
  * \date   2010/03/23
+ *
+ * Modified by FASP team on 10/16/2026: BiCGstab(l)
  */
 void fasp_param_solver_set (ITS_param          *itsparam,
                             const input_param  *iniparam)
@@ -662,6 +666,7 @@ void fasp_param_solver_set (ITS_param          *itsparam,
     itsparam->precond_type   = iniparam->precond_type;
     itsparam->stop_type      = iniparam->stop_type;
     itsparam->restart        = iniparam->restart;
+    itsparam->ell            = iniparam->itsolver_ell;
 
     if ( itsparam->itsolver_type == SOLVER_AMG ) {
         itsparam->tol   = iniparam->AMG_tol;
@@ -816,6 +821,8 @@ void fasp_param_precbsr_to_amg (AMG_param               *amgparam,
  *
  * \author Chensong Zhang
  * \date   2010/03/22
+ *
+ * Modified by FASP team on 10/16/2026: print MIS2 aggregation parameters
  */
 void fasp_param_amg_print (const AMG_param *param)
 {
@@ -826,7 +833,7 @@ void fasp_param_amg_print (const AMG_param *param)
         printf("-----------------------------------------------\n");
 
         printf("AMG print level:                   %d\n", param->print_level);
-        printf("AMG max num of iter:               %d\n", param->maxit);
+        printf("AMG max num of iter:               " INTFMT "\n", param->maxit);
         printf("AMG type:                          %d\n", param->AMG_type);
         printf("AMG tolerance:                     %.2e\n", param->tol);
         printf("AMG max levels:                    %d\n", param->max_levels);
@@ -861,13 +868,23 @@ void fasp_param_amg_print (const AMG_param *param)
                    param->nl_amli_krylov_type);
         }
 
+        if ( param->mixed_precision == ON ) {
+            printf("AMG single precision P, R, and A:  %d\n",
+                   param->mixed_precision);
+        }
+
+        if ( param->compress_index == ON ) {
+            printf("AMG 16-bit column indices of A:    %d\n",
+                   param->compress_index);
+        }
+
         switch (param->AMG_type) {
                 case CLASSIC_AMG:
                 printf("AMG coarsening type:               %d\n",
                        param->coarsening_type);
                 printf("AMG interpolation type:            %d\n",
                        param->interpolation_type);
-                printf("AMG dof on coarsest grid:          %d\n",
+                printf("AMG dof on coarsest grid:          " INTFMT "\n",
                        param->coarse_dof);
                 printf("AMG strong threshold:              %.4f\n",
                        param->strong_threshold);
@@ -875,9 +892,9 @@ void fasp_param_amg_print (const AMG_param *param)
                        param->truncation_threshold);
                 printf("AMG max row sum:                   %.4f\n",
                        param->max_row_sum);
-                printf("AMG aggressive levels:             %d\n",
+                printf("AMG aggressive levels:             " INTFMT "\n",
                        param->aggressive_level);
-                printf("AMG aggressive path:               %d\n",
+                printf("AMG aggressive path:               " INTFMT "\n",
                        param->aggressive_path);
                 break;
 
@@ -885,15 +902,15 @@ void fasp_param_amg_print (const AMG_param *param)
                 printf("Aggregation type:                  %d\n",
                        param->aggregation_type);
                 if ( param->aggregation_type == PAIRWISE ) {
-                    printf("Aggregation number of pairs:       %d\n",
+                    printf("Aggregation number of pairs:       " INTFMT "\n",
                            param->pair_number);
                     printf("Aggregation quality bound:         %.2f\n",
                            param->quality_bound);
                 }
-                if ( param->aggregation_type == VMB ) {
+                if ( param->aggregation_type == VMB || param->aggregation_type == MIS2 ) {
                     printf("Aggregation strong coupling:       %.4f\n",
                            param->strong_coupled);
-                    printf("Aggregation max aggregation:       %d\n",
+                    printf("Aggregation max aggregation:       " INTFMT "\n",
                            param->max_aggregation);
                     printf("Aggregation tentative smooth:      %.4f\n",
                            param->tentative_smooth);
@@ -909,16 +926,16 @@ void fasp_param_amg_print (const AMG_param *param)
         if (param->ILU_levels>0) {
             printf("AMG ILU smoother level:            %d\n", param->ILU_levels);
             printf("AMG ILU type:                      %d\n", param->ILU_type);
-            printf("AMG ILU level of fill-in:          %d\n", param->ILU_lfil);
+            printf("AMG ILU level of fill-in:          " INTFMT "\n", param->ILU_lfil);
             printf("AMG ILU drop tol:                  %e\n", param->ILU_droptol);
             printf("AMG ILU relaxation:                %f\n", param->ILU_relax);
         }
 
         if (param->SWZ_levels>0){
-            printf("AMG Schwarz smoother level:        %d\n", param->SWZ_levels);
-            printf("AMG Schwarz type:                  %d\n", param->SWZ_type);
-            printf("AMG Schwarz forming block level:   %d\n", param->SWZ_maxlvl);
-            printf("AMG Schwarz maximal block size:    %d\n", param->SWZ_mmsize);
+            printf("AMG Schwarz smoother level:        " INTFMT "\n", param->SWZ_levels);
+            printf("AMG Schwarz type:                  " INTFMT "\n", param->SWZ_type);
+            printf("AMG Schwarz forming block level:   " INTFMT "\n", param->SWZ_maxlvl);
+            printf("AMG Schwarz maximal block size:    " INTFMT "\n", param->SWZ_mmsize);
         }
 
         printf("-----------------------------------------------\n\n");
@@ -948,7 +965,7 @@ void fasp_param_ilu_print (const ILU_param *param)
         printf("-----------------------------------------------\n");
         printf("ILU print level:                   %d\n",   param->print_level);
         printf("ILU type:                          %d\n",   param->ILU_type);
-        printf("ILU level of fill-in:              %d\n",   param->ILU_lfil);
+        printf("ILU level of fill-in:              " INTFMT "\n",   param->ILU_lfil);
         printf("ILU relaxation factor:             %.4f\n", param->ILU_relax);
         printf("ILU drop tolerance:                %.2e\n", param->ILU_droptol);
         printf("ILU permutation tolerance:         %.2e\n", param->ILU_permtol);
@@ -978,9 +995,9 @@ void fasp_param_swz_print (const SWZ_param *param)
         printf("-----------------------------------------------\n");
         printf("Schwarz print level:               %d\n", param->print_level);
         printf("Schwarz type:                      %d\n", param->SWZ_type);
-        printf("Schwarz forming block level:       %d\n", param->SWZ_maxlvl);
-        printf("Schwarz maximal block size:        %d\n", param->SWZ_mmsize);
-        printf("Schwarz block solver type:         %d\n", param->SWZ_blksolver);
+        printf("Schwarz forming block level:       " INTFMT "\n", param->SWZ_maxlvl);
+        printf("Schwarz maximal block size:        " INTFMT "\n", param->SWZ_mmsize);
+        printf("Schwarz block solver type:         " INTFMT "\n", param->SWZ_blksolver);
         printf("-----------------------------------------------\n\n");
 
     }
@@ -998,6 +1015,8 @@ void fasp_param_swz_print (const SWZ_param *param)
  *
  * \author Chensong Zhang
  * \date   2011/12/20
+ *
+ * Modified by FASP team on 10/16/2026: BiCGstab(l)
  */
 void fasp_param_solver_print (const ITS_param *param)
 {
@@ -1009,13 +1028,17 @@ void fasp_param_solver_print (const ITS_param *param)
         printf("Solver print level:                %d\n", param->print_level);
         printf("Solver type:                       %d\n", param->itsolver_type);
         printf("Solver precond type:               %d\n", param->precond_type);
-        printf("Solver max num of iter:            %d\n", param->maxit);
+        printf("Solver max num of iter:            " INTFMT "\n", param->maxit);
         printf("Solver tolerance:                  %.2e\n", param->tol);
         printf("Solver stopping type:              %d\n", param->stop_type);
 
         if (param->itsolver_type==SOLVER_GMRES ||
             param->itsolver_type==SOLVER_VGMRES) {
-            printf("Solver restart number:             %d\n", param->restart);
+            printf("Solver restart number:             " INTFMT "\n", param->restart);
+        }
+
+        if (param->itsolver_type==SOLVER_BiCGstabL) {
+            printf("Solver BiCGstab(l) degree:         " INTFMT "\n", param->ell);
         }
 
         printf("-----------------------------------------------\n\n");
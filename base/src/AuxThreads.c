@@ -4,12 +4,19 @@
  *
  *  \note  This file contains Level-0 (Aux) functions.
  *
+ *  \note  Thread affinity is set with sched_setaffinity, so it is only available
+ *         on Linux. On other platforms use OMP_PROC_BIND and OMP_PLACES.
+ *
  *---------------------------------------------------------------------------------
  *  Copyright (C) 2009--2020 by the FASP team. All rights reserved.
  *  Released under the terms of the GNU Lesser General Public License 3.0 or later.
  *---------------------------------------------------------------------------------
  */
 
+#if defined(__linux__) && !defined(_GNU_SOURCE)
+#define _GNU_SOURCE // for sched_setaffinity and sched_getcpu
+#endif
+
 #include <stdio.h>
 #include <stdlib.h>
 
@@ -17,8 +24,18 @@
 #include <omp.h>
 #endif
 
+#ifdef __linux__
+#include <sched.h>
+#endif
+
 #include "fasp.h"
 
+/*---------------------------------*/
+/*--  Declare Private Functions  --*/
+/*---------------------------------*/
+
+static INT merge_path_row (const INT, const INT, const INT, const INT *);
+
 /*---------------------------------*/
 /*--      Public Functions       --*/
 /*---------------------------------*/
@@ -113,6 +130,124 @@ void fasp_get_start_end (const INT  procid,
     *end = end_loc;
 }
 
+/**
+ * \fn    void fasp_get_start_end_nnz (const INT procid, const INT nprocs, const INT n,
+ *                                     const INT *ia, INT *start, INT *end)
+ *
+ * \brief Assign rows of a CSR matrix to each thread with balanced number of nonzeros.
+ *
+ * \param procid Index of thread
+ * \param nprocs Number of threads
+ * \param n      Number of rows
+ * \param ia     Row pointers of the CSR matrix (size n+1)
+ * \param start  Pointer to the first row of the thread
+ * \param end    Pointer to the end (last row + 1) of the thread
+ *
+ * \author FASP team
+ * \date   10/16/2026
+ *
+ * \note  This is the merge-path partition on row granularity: the work of a row is
+ *        counted as its number of nonzeros plus one, and the combined work n+nnz is
+ *        split into nprocs equal parts. Each thread finds its rows by two binary
+ *        searches in ia, so no extra storage is needed. Use it for row-wise kernels
+ *        (SpMV etc.) instead of fasp_get_start_end when row lengths are skewed.
+ */
+void fasp_get_start_end_nnz (const INT  procid,
+                             const INT  nprocs,
+                             const INT  n,
+                             const INT *ia,
+                             INT       *start,
+                             INT       *end)
+{
+    *start = merge_path_row(procid,   nprocs, n, ia);
+    *end   = merge_path_row(procid+1, nprocs, n, ia);
+}
+
+/**
+ * \fn INT fasp_set_thread_affinity (const SHORT policy)
+ *
+ * \brief Pin OpenMP threads to cores
+ *
+ * \param policy  BIND_CLOSE, BIND_SPREAD, or BIND_NONE (undo pinning)
+ *
+ * \return        Number of threads whose affinity has been set
+ *
+ * \author FASP team
+ * \date   10/16/2026
+ *
+ * \note The cores are the ones the process was allowed to run on at the first call.
+ *       With BIND_SPREAD thread t gets core t*ncores/nthreads of them, so threads
+ *       are distributed over all sockets. Pin the threads before first touch
+ *       (fasp_mem_set_first_touch), otherwise they may move away from their data.
+ *       Returns 0 without OpenMP or on platforms other than Linux.
+ */
+INT fasp_set_thread_affinity (const SHORT policy)
+{
+    INT nbound = 0;
+
+#if defined(_OPENMP) && defined(__linux__)
+    static cpu_set_t allowed;
+    static INT       ncores = 0;
+    static INT       cores[CPU_SETSIZE];
+    INT              c;
+
+    if ( ncores == 0 ) { // cores of the process before any pinning
+        if ( sched_getaffinity(0, sizeof(cpu_set_t), &allowed) != 0 ) return 0;
+        for ( c = 0; c < CPU_SETSIZE; ++c ) {
+            if ( CPU_ISSET(c, &allowed) ) cores[ncores++] = c;
+        }
+        if ( ncores == 0 ) return 0;
+    }
+
+#pragma omp parallel reduction(+:nbound)
+    {
+        const INT myid     = omp_get_thread_num();
+        const INT nthreads = omp_get_num_threads();
+        cpu_set_t mask;
+
+        if ( policy == BIND_CLOSE || policy == BIND_SPREAD ) {
+            CPU_ZERO(&mask);
+            if ( policy == BIND_CLOSE ) CPU_SET(cores[myid % ncores], &mask);
+            else CPU_SET(cores[(LONGLONG)myid*ncores/nthreads], &mask);
+        }
+        else {
+            mask = allowed;
+        }
+
+        if ( sched_setaffinity(0, sizeof(cpu_set_t), &mask) == 0 ) nbound++;
+    }
+#endif
+
+    return nbound;
+}
+
+/**
+ * \fn void fasp_print_thread_affinity ( void )
+ *
+ * \brief Print the core each OpenMP thread is running on
+ *
+ * \author FASP team
+ * \date   10/16/2026
+ *
+ * \note Only available with OpenMP on Linux.
+ */
+void fasp_print_thread_affinity ( void )
+{
+#if defined(_OPENMP) && defined(__linux__)
+    const INT nthreads = fasp_get_num_threads();
+    INT       myid, core;
+
+#pragma omp parallel for ordered schedule(static,1) private(core)
+    for ( myid = 0; myid < nthreads; myid++ ) {
+        core = sched_getcpu();
+#pragma omp ordered
+        printf("Thread %3d is running on core %3d\n", myid, core);
+    }
+#else
+    printf("### WARNING: Thread affinity is not available! [%s]\n", __FUNCTION__);
+#endif
+}
+
 INT THDs_AMG_GS=0;  /**< AMG GS smoothing threads      */
 INT THDs_CPR_lGS=0; /**< reservoir GS smoothing threads     */
 INT THDs_CPR_gGS=0; /**< global matrix GS smoothing threads */
@@ -173,6 +308,45 @@ void fasp_set_gs_threads (const INT mythreads,
 #endif // _OPENMP
 }
 
+/*---------------------------------*/
+/*--      Private Functions      --*/
+/*---------------------------------*/
+
+/**
+ * \fn static INT merge_path_row (const INT k, const INT nprocs, const INT n,
+ *                                const INT *ia)
+ *
+ * \brief Find the first row of the k-th part in the merge-path partition
+ *
+ * \param k      Index of the part (0 <= k <= nprocs)
+ * \param nprocs Number of parts
+ * \param n      Number of rows
+ * \param ia     Row pointers of the CSR matrix (size n+1)
+ *
+ * \return       Smallest row index i such that i+nnz(0:i-1) >= k*(n+nnz)/nprocs
+ *
+ * \author FASP team
+ * \date   10/16/2026
+ */
+static INT merge_path_row (const INT  k,
+                           const INT  nprocs,
+                           const INT  n,
+                           const INT *ia)
+{
+    const LONGLONG total = (LONGLONG)n + (ia[n] - ia[0]);
+    const LONGLONG diag  = total * k / nprocs;
+
+    INT lo = 0, hi = n, mid;
+
+    while ( lo < hi ) {
+        mid = lo + (hi - lo) / 2;
+        if ( (LONGLONG)mid + (ia[mid] - ia[0]) < diag ) lo = mid + 1;
+        else hi = mid;
+    }
+
+    return lo;
+}
+
 /*---------------------------------*/
 /*--        End of File          --*/
 /*---------------------------------*/
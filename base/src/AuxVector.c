@@ -58,17 +58,44 @@ SHORT fasp_dvec_isnan (const dvector *u)
  *
  * \author Chensong Zhang 
  * \date   2010/04/06
+ *
+ * Modified by FASP team on 10/16/2026: first touch by all threads if it is on
  */
 dvector fasp_dvec_create (const INT m)
 {
     dvector u;
     
     u.row = m;
-    u.val = (REAL *)fasp_mem_calloc(m,sizeof(REAL));
+    u.val = (REAL *)fasp_mem_calloc_numa(m,sizeof(REAL));
     
     return u;
 }
 
+/**
+ * \fn dvector fasp_dvec_create_rows (const dCSRmat *A)
+ *
+ * \brief Create dvector data space of REAL type for the rows of a CSR matrix
+ *
+ * \param A    Pointer to the dCSRmat matrix
+ *
+ * \return u   The new dvector of size A->row
+ *
+ * \author FASP team
+ * \date   10/16/2026
+ *
+ * \note If first touch is on, each thread sets the rows it works on in SpMV with A
+ *       to zero (see fasp_mem_calloc_numa_rows).
+ */
+dvector fasp_dvec_create_rows (const dCSRmat *A)
+{
+    dvector u;
+
+    u.row = A->row;
+    u.val = (REAL *)fasp_mem_calloc_numa_rows(A->row, A->IA, sizeof(REAL));
+
+    return u;
+}
+
 /**
  * \fn ivector fasp_ivec_create (const INT m)
  *
@@ -101,12 +128,14 @@ ivector fasp_ivec_create (const INT m)
  *
  * \author Chensong Zhang 
  * \date   2010/04/06
+ *
+ * Modified by FASP team on 10/16/2026: first touch by all threads if it is on
  */
 void fasp_dvec_alloc (const INT  m,
                       dvector   *u)
 {    
     u->row = m;
-    u->val = (REAL*)fasp_mem_calloc(m,sizeof(REAL)); 
+    u->val = (REAL*)fasp_mem_calloc_numa(m,sizeof(REAL)); 
     
     return;
 }
@@ -419,7 +448,7 @@ void fasp_dvec_symdiagscale (dvector        *b,
     INT   i;
     
     if ( diag->row != n ) {
-        printf("### ERROR: Sizes of diag = %d != dvector = %d!", diag->row, n);
+        printf("### ERROR: Sizes of diag = " INTFMT " != dvector = " INTFMT "!", diag->row, n);
         fasp_chkerr(ERROR_MISC, __FUNCTION__);
     }
     
@@ -3,7 +3,7 @@
  *  \brief BLAS1 operations for arrays
  *
  *  \note  This file contains Level-1 (Bla) functions. It requires:
- *         AuxThreads.c
+ *         AuxMemory.c and AuxThreads.c
  *
  *---------------------------------------------------------------------------------
  *  Copyright (C) 2009--2020 by the FASP team. All rights reserved.
@@ -763,6 +763,476 @@ REAL fasp_blas_darray_dotprod (const INT    n,
     return value;
 }
 
+/**
+ * \fn void fasp_blas_darray_axpy2_norm2 (const INT n, const REAL a1,
+ *                                        const REAL *x1, REAL *y1, const REAL a2,
+ *                                        const REAL *x2, REAL *y2, REAL *norms)
+ *
+ * \brief y1 = a1*x1 + y1, y2 = a2*x2 + y2, and L2 norms of the new y1 and y2
+ *
+ * \param n      Number of variables
+ * \param a1     Factor a1
+ * \param x1     Pointer to x1
+ * \param y1     Pointer to y1, reused to store the resulting array
+ * \param a2     Factor a2
+ * \param x2     Pointer to x2
+ * \param y2     Pointer to y2, reused to store the resulting array
+ * \param norms  L2 norms of y1 and y2 (output)
+ *
+ * \author FASP team
+ * \date   10/16/2026
+ *
+ * \note Fused kernel for the solution and residual updates in Krylov methods:
+ *       one sweep over the arrays instead of two axpy and two norms.
+ */
+void fasp_blas_darray_axpy2_norm2 (const INT    n,
+                                   const REAL   a1,
+                                   const REAL  *x1,
+                                   REAL        *y1,
+                                   const REAL   a2,
+                                   const REAL  *x2,
+                                   REAL        *y2,
+                                   REAL        *norms)
+{
+    SHORT use_openmp = FALSE;
+    REAL  s1 = 0.0, s2 = 0.0;
+    INT   i;
+
+#ifdef _OPENMP
+    INT myid, mybegin, myend, nthreads;
+    if ( n > OPENMP_HOLDS ) {
+        use_openmp = TRUE;
+        nthreads = fasp_get_num_threads();
+    }
+#endif
+
+    if ( use_openmp ) {
+#ifdef _OPENMP
+#pragma omp parallel private(myid, mybegin, myend, i) num_threads(nthreads) \
+                     reduction(+:s1,s2)
+        {
+            myid = omp_get_thread_num();
+            fasp_get_start_end (myid, nthreads, n, &mybegin, &myend);
+            for ( i = mybegin; i < myend; ++i ) {
+                y1[i] += a1*x1[i]; s1 += y1[i]*y1[i];
+                y2[i] += a2*x2[i]; s2 += y2[i]*y2[i];
+            }
+        }
+#endif
+    }
+    else {
+        for ( i = 0; i < n; ++i ) {
+            y1[i] += a1*x1[i]; s1 += y1[i]*y1[i];
+            y2[i] += a2*x2[i]; s2 += y2[i]*y2[i];
+        }
+    }
+
+    norms[0] = sqrt(s1); norms[1] = sqrt(s2);
+}
+
+/**
+ * \fn void fasp_blas_darray_axpyz2_norm2 (const INT n, const REAL a1,
+ *                                         const REAL *x1, const REAL *y1, REAL *z1,
+ *                                         const REAL a2, const REAL *x2,
+ *                                         const REAL *y2, REAL *z2, REAL *norms)
+ *
+ * \brief z1 = a1*x1 + y1, z2 = a2*x2 + y2, and L2 norms of z1 and z2
+ *
+ * \param n      Number of variables
+ * \param a1     Factor a1
+ * \param x1     Pointer to x1
+ * \param y1     Pointer to y1
+ * \param z1     Pointer to z1
+ * \param a2     Factor a2
+ * \param x2     Pointer to x2
+ * \param y2     Pointer to y2
+ * \param z2     Pointer to z2
+ * \param norms  L2 norms of z1 and z2 (output)
+ *
+ * \author FASP team
+ * \date   10/16/2026
+ *
+ * \note Fused kernel for the half and full steps of BiCGstab: one sweep over the
+ *       arrays instead of two axpyz and two norms.
+ */
+void fasp_blas_darray_axpyz2_norm2 (const INT    n,
+                                    const REAL   a1,
+                                    const REAL  *x1,
+                                    const REAL  *y1,
+                                    REAL        *z1,
+                                    const REAL   a2,
+                                    const REAL  *x2,
+                                    const REAL  *y2,
+                                    REAL        *z2,
+                                    REAL        *norms)
+{
+    SHORT use_openmp = FALSE;
+    REAL  s1 = 0.0, s2 = 0.0;
+    INT   i;
+
+#ifdef _OPENMP
+    INT myid, mybegin, myend, nthreads;
+    if ( n > OPENMP_HOLDS ) {
+        use_openmp = TRUE;
+        nthreads = fasp_get_num_threads();
+    }
+#endif
+
+    if ( use_openmp ) {
+#ifdef _OPENMP
+#pragma omp parallel private(myid, mybegin, myend, i) num_threads(nthreads) \
+                     reduction(+:s1,s2)
+        {
+            myid = omp_get_thread_num();
+            fasp_get_start_end (myid, nthreads, n, &mybegin, &myend);
+            for ( i = mybegin; i < myend; ++i ) {
+                z1[i] = a1*x1[i] + y1[i]; s1 += z1[i]*z1[i];
+                z2[i] = a2*x2[i] + y2[i]; s2 += z2[i]*z2[i];
+            }
+        }
+#endif
+    }
+    else {
+        for ( i = 0; i < n; ++i ) {
+            z1[i] = a1*x1[i] + y1[i]; s1 += z1[i]*z1[i];
+            z2[i] = a2*x2[i] + y2[i]; s2 += z2[i]*z2[i];
+        }
+    }
+
+    norms[0] = sqrt(s1); norms[1] = sqrt(s2);
+}
+
+/**
+ * \fn void fasp_blas_darray_axpbypcz (const INT n, const REAL a, const REAL *x,
+ *                                     const REAL b, const REAL *y, const REAL c,
+ *                                     const REAL *z, REAL *w)
+ *
+ * \brief w = a*x + b*y + c*z
+ *
+ * \param n    Number of variables
+ * \param a    Factor a
+ * \param x    Pointer to x
+ * \param b    Factor b
+ * \param y    Pointer to y
+ * \param c    Factor c
+ * \param z    Pointer to z
+ * \param w    Pointer to w, may be the same as x, y, or z
+ *
+ * \author FASP team
+ * \date   10/16/2026
+ */
+void fasp_blas_darray_axpbypcz (const INT    n,
+                                const REAL   a,
+                                const REAL  *x,
+                                const REAL   b,
+                                const REAL  *y,
+                                const REAL   c,
+                                const REAL  *z,
+                                REAL        *w)
+{
+    SHORT use_openmp = FALSE;
+    INT   i;
+
+#ifdef _OPENMP
+    INT myid, mybegin, myend, nthreads;
+    if ( n > OPENMP_HOLDS ) {
+        use_openmp = TRUE;
+        nthreads = fasp_get_num_threads();
+    }
+#endif
+
+    if ( use_openmp ) {
+#ifdef _OPENMP
+#pragma omp parallel private(myid, mybegin, myend, i) num_threads(nthreads)
+        {
+            myid = omp_get_thread_num();
+            fasp_get_start_end (myid, nthreads, n, &mybegin, &myend);
+            for ( i = mybegin; i < myend; ++i ) w[i] = a*x[i] + b*y[i] + c*z[i];
+        }
+#endif
+    }
+    else {
+        for ( i = 0; i < n; ++i ) w[i] = a*x[i] + b*y[i] + c*z[i];
+    }
+}
+
+/**
+ * \fn void fasp_blas_darray_dotprod2 (const INT n, const REAL *x, const REAL *y,
+ *                                     const REAL *z, REAL *dots)
+ *
+ * \brief Inner products (x,y) and (x,z) in one sweep
+ *
+ * \param n     Number of variables
+ * \param x     Pointer to x
+ * \param y     Pointer to y
+ * \param z     Pointer to z
+ * \param dots  Inner products (x,y) and (x,z) (output)
+ *
+ * \author FASP team
+ * \date   10/16/2026
+ */
+void fasp_blas_darray_dotprod2 (const INT    n,
+                                const REAL  *x,
+                                const REAL  *y,
+                                const REAL  *z,
+                                REAL        *dots)
+{
+    REAL s1 = 0.0, s2 = 0.0;
+    INT  i;
+
+#ifdef _OPENMP
+#pragma omp parallel for reduction(+:s1,s2) private(i) if(n>OPENMP_HOLDS)
+#endif
+    for ( i = 0; i < n; ++i ) {
+        s1 += x[i]*y[i];
+        s2 += x[i]*z[i];
+    }
+
+    dots[0] = s1; dots[1] = s2;
+}
+
+/**
+ * \fn void fasp_blas_darray_mv_gram (const INT n, const INT k, const INT l,
+ *                                    const REAL *x, const REAL *y, REAL *G)
+ *
+ * \brief Inner products of two blocks of vectors G = X'*Y
+ *
+ * \param n    Number of variables
+ * \param k    Number of vectors in X
+ * \param l    Number of vectors in Y
+ * \param x    Pointer to X (n*k, interleaved)
+ * \param y    Pointer to Y (n*l, interleaved)
+ * \param G    Pointer to G (k*l, row-major)
+ *
+ * \author FASP team
+ * \date   10/16/2026
+ *
+ * \note Entry i of vector j of X is x[i*k+j]. All k*l inner products are computed
+ *       in one sweep, i.e., with one global reduction.
+ */
+void fasp_blas_darray_mv_gram (const INT    n,
+                               const INT    k,
+                               const INT    l,
+                               const REAL  *x,
+                               const REAL  *y,
+                               REAL        *G)
+{
+    const INT kl = k*l;
+    INT i, a, b, myid, mybegin, myend;
+
+    SHORT nthreads = 1;
+
+#ifdef _OPENMP
+    if ( n > OPENMP_HOLDS ) nthreads = fasp_get_num_threads();
+#endif
+
+    const size_t mark = fasp_arena_mark(NULL);
+    REAL *part = (REAL *)fasp_arena_calloc(NULL, nthreads*kl, sizeof(REAL));
+
+#ifdef _OPENMP
+#pragma omp parallel for private(myid, mybegin, myend, i, a, b) if(nthreads>1)
+#endif
+    for ( myid = 0; myid < nthreads; myid++ ) {
+        REAL *g = part + myid*kl;
+        fasp_get_start_end(myid, nthreads, n, &mybegin, &myend);
+        for ( i = mybegin; i < myend; ++i ) {
+            const REAL *xi = x + (size_t)i*k, *yi = y + (size_t)i*l;
+            for ( a = 0; a < k; ++a ) {
+                for ( b = 0; b < l; ++b ) g[a*l+b] += xi[a]*yi[b];
+            }
+        }
+    }
+
+    for ( a = 0; a < kl; ++a ) {
+        G[a] = part[a];
+        for ( myid = 1; myid < nthreads; ++myid ) G[a] += part[myid*kl+a];
+    }
+
+    fasp_arena_release(NULL, mark);
+}
+
+/**
+ * \fn void fasp_blas_darray_mv_axpy (const INT n, const INT k, const INT l,
+ *                                    const REAL a, const REAL *x, const REAL *C,
+ *                                    REAL *y)
+ *
+ * \brief Block update Y = a*X*C + Y
+ *
+ * \param n    Number of variables
+ * \param k    Number of vectors in X
+ * \param l    Number of vectors in Y
+ * \param a    Factor a
+ * \param x    Pointer to X (n*k, interleaved)
+ * \param C    Pointer to C (k*l, row-major)
+ * \param y    Pointer to Y (n*l, interleaved)
+ *
+ * \author FASP team
+ * \date   10/16/2026
+ */
+void fasp_blas_darray_mv_axpy (const INT    n,
+                               const INT    k,
+                               const INT    l,
+                               const REAL   a,
+                               const REAL  *x,
+                               const REAL  *C,
+                               REAL        *y)
+{
+    INT  i, p, q;
+    REAL t;
+
+#ifdef _OPENMP
+#pragma omp parallel for private(i, p, q, t) if(n>OPENMP_HOLDS)
+#endif
+    for ( i = 0; i < n; ++i ) {
+        const REAL *xi = x + (size_t)i*k;
+        REAL       *yi = y + (size_t)i*l;
+        for ( p = 0; p < k; ++p ) {
+            t = a*xi[p];
+            for ( q = 0; q < l; ++q ) yi[q] += t*C[p*l+q];
+        }
+    }
+}
+
+/**
+ * \fn void fasp_blas_darray_mv_norm2 (const INT n, const INT k, const REAL *x,
+ *                                     REAL *norms)
+ *
+ * \brief L2 norms of all vectors in a block X
+ *
+ * \param n      Number of variables
+ * \param k      Number of vectors in X
+ * \param x      Pointer to X (n*k, interleaved)
+ * \param norms  Pointer to the k norms
+ *
+ * \author FASP team
+ * \date   10/16/2026
+ */
+void fasp_blas_darray_mv_norm2 (const INT    n,
+                                const INT    k,
+                                const REAL  *x,
+                                REAL        *norms)
+{
+    INT i, j, myid, mybegin, myend;
+
+    SHORT nthreads = 1;
+
+#ifdef _OPENMP
+    if ( n > OPENMP_HOLDS ) nthreads = fasp_get_num_threads();
+#endif
+
+    const size_t mark = fasp_arena_mark(NULL);
+    REAL *part = (REAL *)fasp_arena_calloc(NULL, nthreads*k, sizeof(REAL));
+
+#ifdef _OPENMP
+#pragma omp parallel for private(myid, mybegin, myend, i, j) if(nthreads>1)
+#endif
+    for ( myid = 0; myid < nthreads; myid++ ) {
+        REAL *s = part + myid*k;
+        fasp_get_start_end(myid, nthreads, n, &mybegin, &myend);
+        for ( i = mybegin; i < myend; ++i ) {
+            const REAL *xi = x + (size_t)i*k;
+            for ( j = 0; j < k; ++j ) s[j] += xi[j]*xi[j];
+        }
+    }
+
+    for ( j = 0; j < k; ++j ) {
+        norms[j] = part[j];
+        for ( myid = 1; myid < nthreads; ++myid ) norms[j] += part[myid*k+j];
+        norms[j] = sqrt(norms[j]);
+    }
+
+    fasp_arena_release(NULL, mark);
+}
+
+/**
+ * \fn INT fasp_blas_darray_mv_cholqr (const INT n, const INT k, REAL *x, REAL *R)
+ *
+ * \brief Orthonormalize a block of vectors X = Q*R by Cholesky QR
+ *
+ * \param n    Number of variables
+ * \param k    Number of vectors in X
+ * \param x    Pointer to X (n*k, interleaved); overwritten by Q
+ * \param R    Pointer to the upper triangular factor R (k*k, row-major)
+ *
+ * \return     Numerical rank of X
+ *
+ * \author FASP team
+ * \date   10/16/2026
+ *
+ * \note Computes the Cholesky factor of X'*X and then Q = X*inv(R), so it needs two
+ *       sweeps over X and one global reduction. It is repeated once (CholQR2)
+ *       to recover orthogonality lost when X is ill-conditioned. Vectors that are
+ *       numerically dependent on the previous ones are set to zero and the
+ *       corresponding rows of R are zero.
+ */
+INT fasp_blas_darray_mv_cholqr (const INT    n,
+                                const INT    k,
+                                REAL        *x,
+                                REAL        *R)
+{
+    const REAL tol = 1e-24; // squared relative tolerance for dependence
+    const INT  kk = k*k;
+
+    INT  i, j, l, p, pass, rank = k;
+    REAL d, t;
+
+    const size_t mark = fasp_arena_mark(NULL);
+    REAL *G  = (REAL *)fasp_arena_alloc(NULL, 2*kk, sizeof(REAL));
+    REAL *R1 = G + kk;
+
+    for ( pass = 0; pass < 2; ++pass ) {
+
+        REAL *U = (pass == 0) ? R : R1;
+
+        fasp_blas_darray_mv_gram(n, k, k, x, x, G);
+
+        // Cholesky factorization G = U'*U with dependent columns dropped
+        for ( i = 0; i < kk; ++i ) U[i] = 0.0;
+        for ( j = 0; j < k; ++j ) {
+            d = G[j*k+j];
+            for ( l = 0; l < j; ++l ) d -= U[l*k+j]*U[l*k+j];
+            if ( d <= tol*G[j*k+j] || d <= SMALLREAL2 ) continue;
+            U[j*k+j] = d = sqrt(d);
+            for ( p = j+1; p < k; ++p ) {
+                t = G[j*k+p];
+                for ( l = 0; l < j; ++l ) t -= U[l*k+j]*U[l*k+p];
+                U[j*k+p] = t/d;
+            }
+        }
+
+        // X = X*inv(U), row by row
+#ifdef _OPENMP
+#pragma omp parallel for private(i, j, l, t) if(n>OPENMP_HOLDS)
+#endif
+        for ( i = 0; i < n; ++i ) {
+            REAL *xi = x + (size_t)i*k;
+            for ( j = 0; j < k; ++j ) {
+                if ( U[j*k+j] == 0.0 ) { xi[j] = 0.0; continue; }
+                t = xi[j];
+                for ( l = 0; l < j; ++l ) t -= xi[l]*U[l*k+j];
+                xi[j] = t/U[j*k+j];
+            }
+        }
+
+    }
+
+    // R = R1*R
+    for ( i = 0; i < kk; ++i ) G[i] = R[i];
+    for ( i = 0; i < k; ++i ) {
+        for ( j = 0; j < k; ++j ) {
+            t = 0.0;
+            for ( l = i; l <= j; ++l ) t += R1[i*k+l]*G[l*k+j];
+            R[i*k+j] = t;
+        }
+    }
+
+    for ( j = 0; j < k; ++j ) if ( R[j*k+j] == 0.0 ) rank--;
+
+    fasp_arena_release(NULL, mark);
+
+    return rank;
+}
+
 /*---------------------------------*/
 /*--        End of File          --*/
 /*---------------------------------*/
@@ -3,7 +3,7 @@
  *  \brief Computing the extreme eigenvalues
  *
  *  \note  This file contains Level-1 (Bla) functions. It requires:
- *         AuxVector.c, BlaArray.c, BlaSpmvCSR.c, and BlaVector.c
+ *         AuxArray.c, AuxMemory.c, AuxVector.c, BlaArray.c, and BlaSpmvCSR.c
  *
  *---------------------------------------------------------------------------------
  *  Copyright (C) 2009--2020 by the FASP team. All rights reserved.
@@ -16,6 +16,14 @@
 #include "fasp.h"
 #include "fasp_functs.h"
 
+/*---------------------------------*/
+/*--  Declare Private Functions  --*/
+/*---------------------------------*/
+
+static void lanczos_bounds (const dCSRmat *, precond *, const REAL, const INT,
+                            REAL *, REAL *);
+static REAL lanczos_ritz (const INT, const REAL *, const REAL *, const INT);
+
 /*---------------------------------*/
 /*--      Public Functions       --*/
 /*---------------------------------*/
@@ -23,54 +31,192 @@
 /**
  * \fn REAL fasp_dcsr_maxeig (const dCSRmat *A, const REAL tol, const INT maxit)
  *
- * \brief Approximate the largest eigenvalue of A by the power method
+ * \brief Approximate the largest eigenvalue of A by the Lanczos method
  *
  * \param A      Pointer to the dCSRmat matrix
- * \param tol    Tolerance for stopping the power method
+ * \param tol    Tolerance for stopping the Lanczos method
  * \param maxit  Max number of iterations
  *
  * \return       Largest eigenvalue
  *
  * \author Xiaozhe Hu
  * \date   01/25/2011
+ *
+ * Modified by FASP team on 10/16/2026: Lanczos instead of the power method
+ *
+ * \note A is assumed to be symmetric. The iteration stops once the largest Ritz
+ *       value changes by less than tol relatively.
  */
 REAL fasp_dcsr_maxeig (const dCSRmat  *A,
                        const REAL      tol,
                        const INT       maxit)
 {
-    REAL eigenvalue = 0.0, temp = 1.0, L2_norm_y;
-    dvector x, y;
-    int i;
-
-    fasp_dvec_alloc(A->row, &x);
-    fasp_dvec_rand(A->row,&x);
-    fasp_blas_darray_ax(A->row, 1.0/fasp_blas_dvec_norm2(&x), x.val);
-    
-    fasp_dvec_alloc(A->row, &y);
-    
-    for ( i = maxit; i--; ) {
-        // y = Ax;
-        fasp_blas_dcsr_mxv(A, x.val, y.val);
-        
-        // y/||y||
-        L2_norm_y = fasp_blas_dvec_norm2(&y);
-        fasp_blas_darray_ax(A->row, 1.0/L2_norm_y, y.val);
-        
-        // eigenvalue = y'Ay;
-        eigenvalue = fasp_blas_dcsr_vmv(A, y.val, y.val);
-        
-        // convergence test
-        if ( (ABS(eigenvalue - temp)/ABS(temp)) < tol ) break;
-        
-        fasp_dvec_cp(&y, &x);
-        temp = eigenvalue;
+    REAL emin, emax;
+
+    lanczos_bounds(A, NULL, tol, maxit, &emin, &emax);
+
+    return emax;
+}
+
+/**
+ * \fn void fasp_dcsr_eig_bounds (const dCSRmat *A, precond *pc, const INT maxit,
+ *                                REAL *emin, REAL *emax)
+ *
+ * \brief Approximate the extreme eigenvalues of M*A by the Lanczos method
+ *
+ * \param A      Pointer to the dCSRmat matrix
+ * \param pc     Pointer to the preconditioner M, NULL for M = I
+ * \param maxit  Number of Lanczos steps
+ * \param emin   Smallest Ritz value (output)
+ * \param emax   Largest Ritz value (output)
+ *
+ * \author FASP team
+ * \date   10/16/2026
+ *
+ * \note A and M are assumed to be SPD, so that M*A is self-adjoint in the inner
+ *       product given by inv(M). The Ritz values lie inside the spectrum: emax
+ *       is a lower bound of the largest eigenvalue and emin an upper bound of
+ *       the smallest one; the extreme ones converge first.
+ */
+void fasp_dcsr_eig_bounds (const dCSRmat  *A,
+                           precond        *pc,
+                           const INT       maxit,
+                           REAL           *emin,
+                           REAL           *emax)
+{
+    lanczos_bounds(A, pc, 0.0, maxit, emin, emax);
+}
+
+/*---------------------------------*/
+/*--      Private Functions      --*/
+/*---------------------------------*/
+
+/**
+ * \fn static void lanczos_bounds (const dCSRmat *A, precond *pc, const REAL tol,
+ *                                 const INT maxit, REAL *emin, REAL *emax)
+ *
+ * \brief Extreme Ritz values of M*A from preconditioned Lanczos
+ *
+ * \param A      Pointer to the dCSRmat matrix
+ * \param pc     Pointer to the preconditioner M, NULL for M = I
+ * \param tol    Stop once emax changes by less than tol relatively, 0 for never
+ * \param maxit  Max number of Lanczos steps
+ * \param emin   Smallest Ritz value (output)
+ * \param emax   Largest Ritz value (output)
+ *
+ * \author FASP team
+ * \date   10/16/2026
+ *
+ * \note The Lanczos vectors q_j are orthonormal in the inv(M) inner product and
+ *       p_j = inv(M)*q_j is kept, so each step needs one product with A, one
+ *       with M and two inner products. No reorthogonalization is done, which
+ *       only produces copies of converged Ritz values.
+ */
+static void lanczos_bounds (const dCSRmat  *A,
+                            precond        *pc,
+                            const REAL      tol,
+                            const INT       maxit,
+                            REAL           *emin,
+                            REAL           *emax)
+{
+    const INT    n = A->row;
+    const INT    m = MAX(maxit, 1);
+    const size_t mark = fasp_arena_mark(NULL);
+
+    REAL  *work  = (REAL *)fasp_arena_calloc(NULL, (size_t)5*n, sizeof(REAL));
+    REAL  *alpha = (REAL *)fasp_arena_calloc(NULL, 2*m+2, sizeof(REAL));
+    REAL  *beta  = alpha + m + 1; // beta[j] couples steps j-1 and j
+    REAL  *p0 = work, *p = p0 + n, *q = p + n, *u = q + n, *z = u + n;
+    REAL   b, eold = 0.0;
+    INT    j, k = 0;
+    dvector x;
+
+    // random start vector p, q = M*p, scaled to unit inv(M)-norm
+    x.row = n; x.val = p;
+    fasp_dvec_rand(n, &x);
+    if ( pc == NULL ) fasp_darray_cp(n, p, q); else pc->fct(p, q, pc->data);
+    b = sqrt(fasp_blas_darray_dotprod(n, p, q));
+    fasp_blas_darray_ax(n, 1.0/b, p);
+    fasp_blas_darray_ax(n, 1.0/b, q);
+
+    *emin = *emax = 0.0;
+
+    for ( j = 0; j < m; j++ ) {
+
+        // u = A*q_j - alpha_j*p_j - beta_j*p_{j-1}
+        fasp_blas_dcsr_mxv(A, q, u);
+        alpha[j] = fasp_blas_darray_dotprod(n, q, u);
+        fasp_blas_darray_axpbypcz(n, -alpha[j], p, -beta[j], p0, 1.0, u, u);
+        k = j + 1;
+
+        *emin = lanczos_ritz(k, alpha, beta, 0);
+        *emax = lanczos_ritz(k, alpha, beta, k-1);
+        if ( tol > 0.0 && j > 0 && ABS(*emax - eold) < tol*ABS(*emax) ) break;
+        eold = *emax;
+
+        // z = M*u, beta_{j+1} = ||u||_M
+        if ( pc == NULL ) fasp_darray_cp(n, u, z); else pc->fct(u, z, pc->data);
+        b = fasp_blas_darray_dotprod(n, u, z);
+        if ( b <= SMALLREAL2*ABS(alpha[j]) ) break; // invariant subspace found
+        b = sqrt(b);
+        beta[j+1] = b;
+
+        fasp_darray_cp(n, p, p0);
+        fasp_blas_darray_axpby(n, 1.0/b, u, 0.0, p);
+        fasp_blas_darray_axpby(n, 1.0/b, z, 0.0, q);
+    }
+
+    fasp_arena_release(NULL, mark);
+}
+
+/**
+ * \fn static REAL lanczos_ritz (const INT k, const REAL *alpha, const REAL *beta,
+ *                               const INT idx)
+ *
+ * \brief Eigenvalue number idx (ascending) of the Lanczos tridiagonal matrix
+ *
+ * \param k      Size of the tridiagonal matrix
+ * \param alpha  Pointer to the diagonal, alpha[0], ..., alpha[k-1]
+ * \param beta   Pointer to the off-diagonal, beta[1], ..., beta[k-1]
+ * \param idx    Index of the eigenvalue, 0 <= idx < k
+ *
+ * \return       The eigenvalue
+ *
+ * \author FASP team
+ * \date   10/16/2026
+ *
+ * \note Bisection on the Gershgorin interval with Sturm sequence counts.
+ */
+static REAL lanczos_ritz (const INT    k,
+                          const REAL  *alpha,
+                          const REAL  *beta,
+                          const INT    idx)
+{
+    INT   i, cnt, it;
+    REAL  lo = alpha[0], hi = alpha[0], r, mid, d;
+
+    // Gershgorin interval
+    for ( i = 0; i < k; i++ ) {
+        r = ( i > 0 ? ABS(beta[i]) : 0.0 ) + ( i < k-1 ? ABS(beta[i+1]) : 0.0 );
+        lo = MIN(lo, alpha[i] - r);
+        hi = MAX(hi, alpha[i] + r);
     }
-    
-    // clean up memory
-    fasp_dvec_free(&x);
-    fasp_dvec_free(&y);
-    
-    return eigenvalue;
+
+    for ( it = 0; it < 100 && hi - lo > 1e-14*MAX(ABS(lo), ABS(hi)); it++ ) {
+        mid = 0.5*(lo + hi);
+
+        // number of eigenvalues smaller than mid
+        cnt = 0; d = 1.0;
+        for ( i = 0; i < k; i++ ) {
+            d = alpha[i] - mid - ( i > 0 ? beta[i]*beta[i]/d : 0.0 );
+            if ( d == 0.0 ) d = -SMALLREAL2;
+            if ( d < 0.0 ) cnt++;
+        }
+
+        if ( cnt > idx ) hi = mid; else lo = mid;
+    }
+
+    return 0.5*(lo + hi);
 }
 
 /*---------------------------------*/
@@ -4,7 +4,7 @@
  *
  *  \note  This file contains Level-1 (Bla) functions. It requires:
  *         AuxArray.c, AuxMemory.c, AuxThreads.c, BlaSparseBSR.c, BlaSparseCSR.c,
- *         and BlaSparseCSRL.c
+ *         BlaSparseCSR16.c, BlaSparseCSRL.c, BlaSparseSELL.c, and BlaSparseSymCSR.c
  *
  *---------------------------------------------------------------------------------
  *  Copyright (C) 2009--2020 by the FASP team. All rights reserved.
@@ -478,6 +478,362 @@ dCSRLmat * fasp_format_dcsrl_dcsr (const dCSRmat *A)
     return B;
 }
 
+/**
+ * \fn dSELLmat * fasp_format_dcsr_dsell (const dCSRmat *A, const INT C,
+ *                                        const INT sigma)
+ *
+ * \brief Convert a dCSRmat into a dSELLmat (SELL-C-sigma format)
+ *
+ * \param A      Pointer to dCSRmat matrix
+ * \param C      Chunk height (SELL_CHUNK if C <= 0)
+ * \param sigma  Sorting window (SELL_SIGMA if sigma <= 0; rounded up to a multiple of C)
+ *
+ * \return       Pointer to dSELLmat matrix
+ *
+ * \author FASP team
+ * \date   10/16/2026
+ *
+ * \note Rows are sorted by decreasing length inside each window of sigma rows, which
+ *       reduces zero padding in the chunks while keeping the access to x local.
+ *       sigma = C means no sorting at all.
+ */
+dSELLmat * fasp_format_dcsr_dsell (const dCSRmat  *A,
+                                   const INT       C,
+                                   const INT       sigma)
+{
+    const INT   num_rows = A->row;
+    const INT  *IA = A->IA, *JA = A->JA;
+    const REAL *DATA = A->val;
+
+    INT chunk = ( C > 0 ) ? C : SELL_CHUNK;
+    INT window, nchunk, i, j, k, c, r, row, len, pos, end, maxlen = 0;
+
+    dSELLmat *B = NULL;
+    INT      *count = NULL, *work = NULL;
+
+    if ( chunk > SELL_MAX_CHUNK ) {
+        printf("### WARNING: Chunk height " INTFMT " is too big, reset to %d! [%s]\n",
+               chunk, SELL_MAX_CHUNK, __FUNCTION__);
+        chunk = SELL_MAX_CHUNK;
+    }
+
+    window = ( sigma > 0 ) ? sigma : SELL_SIGMA;
+    window = MAX(chunk, (window+chunk-1)/chunk*chunk);
+
+    B = fasp_dsell_create(num_rows, A->col, A->nnz, chunk, window);
+    nchunk = B->nchunk;
+
+    //--------------------------------------------
+    //  Sort rows by length within each window
+    //--------------------------------------------
+
+    for ( i = 0; i < num_rows; i++ ) {
+        B->perm[i] = i;
+        maxlen = MAX(maxlen, IA[i+1]-IA[i]);
+    }
+    for ( i = num_rows; i < nchunk*chunk; i++ ) B->perm[i] = -1;
+
+    // counting sort on the row lengths: stable and linear in the window size
+    // plus the longest row, also if many rows have the same length
+    if ( window > chunk ) {
+        count = (INT *)fasp_mem_calloc(maxlen+2, sizeof(INT));
+        work  = (INT *)fasp_mem_calloc(window, sizeof(INT));
+        for ( i = 0; i < num_rows; i += window ) {
+            end = MIN(i+window, num_rows);
+            k   = 0; // longest row in the window
+            for ( j = i; j < end; j++ ) k = MAX(k, IA[j+1]-IA[j]);
+            memset(count, 0, (k+2)*sizeof(INT));
+            for ( j = i; j < end; j++ ) count[k-(IA[j+1]-IA[j])+1]++;
+            for ( len = 0; len <= k; len++ ) count[len+1] += count[len];
+            for ( j = i; j < end; j++ ) work[count[k-(IA[j+1]-IA[j])]++] = j;
+            memcpy(&B->perm[i], work, (end-i)*sizeof(INT));
+        }
+        fasp_mem_free(work);  work  = NULL;
+        fasp_mem_free(count); count = NULL;
+    }
+
+    //--------------------------------------------
+    //  Chunk widths and starting positions
+    //--------------------------------------------
+
+    B->cs[0] = 0;
+    for ( c = 0; c < nchunk; c++ ) {
+        len = 0;
+        for ( r = 0; r < chunk; r++ ) {
+            row = B->perm[c*chunk+r];
+            if ( row >= 0 ) len = MAX(len, IA[row+1]-IA[row]);
+        }
+        B->cl[c]   = len;
+        B->cs[c+1] = B->cs[c] + len*chunk;
+    }
+
+    B->ja  = (INT *)fasp_mem_calloc(MAX(B->cs[nchunk],1), sizeof(INT));
+    B->val = (REAL *)fasp_mem_calloc(MAX(B->cs[nchunk],1), sizeof(REAL));
+
+    //--------------------------------------------
+    //  Fill entries column-major in each chunk
+    //--------------------------------------------
+
+    for ( c = 0; c < nchunk; c++ ) {
+        for ( r = 0; r < chunk; r++ ) {
+            row = B->perm[c*chunk+r];
+            len = 0; k = 0; // k is the padding column index
+            if ( row >= 0 ) {
+                len = IA[row+1] - IA[row];
+                for ( j = 0; j < len; j++ ) {
+                    pos = B->cs[c] + j*chunk + r;
+                    B->ja[pos]  = JA[IA[row]+j];
+                    B->val[pos] = DATA[IA[row]+j];
+                }
+                if ( len > 0 ) k = JA[IA[row+1]-1];
+            }
+            // pad with zeros which point to the last column touched by this row
+            for ( j = len; j < B->cl[c]; j++ ) {
+                pos = B->cs[c] + j*chunk + r;
+                B->ja[pos]  = k;
+                B->val[pos] = 0.0;
+            }
+        }
+    }
+
+    return B;
+}
+
+/**
+ * \fn dSymCSRmat * fasp_format_dcsr_dsymcsr (const dCSRmat *A)
+ *
+ * \brief Convert a symmetric dCSRmat into a dSymCSRmat (upper triangular part)
+ *
+ * \param A   Pointer to dCSRmat matrix (full or upper triangular storage)
+ *
+ * \return    Pointer to dSymCSRmat matrix
+ *
+ * \author FASP team
+ * \date   10/16/2026
+ *
+ * \note Entries below the diagonal are ignored, i.e., A is assumed to be
+ *       symmetric. Duplicated diagonal entries are summed up.
+ */
+dSymCSRmat * fasp_format_dcsr_dsymcsr (const dCSRmat *A)
+{
+    const INT   n = A->row;
+    const INT  *IA = A->IA, *JA = A->JA;
+    const REAL *DATA = A->val;
+
+    INT i, j, k, nnz = 0, pos = 0;
+
+    dSymCSRmat *B = NULL;
+    dCSRmat     U;
+
+    if ( A->row != A->col ) {
+        printf("### ERROR: A is not a square matrix (" INTFMT " x " INTFMT ")!\n", A->row, A->col);
+        fasp_chkerr(ERROR_MAT_SIZE, __FUNCTION__);
+    }
+
+    for ( i = 0; i < n; i++ ) {
+        for ( k = IA[i]; k < IA[i+1]; k++ ) {
+            if ( JA[k] > i ) nnz++;
+        }
+    }
+
+    B = fasp_dsymcsr_create(n, nnz);
+
+    for ( i = 0; i < n; i++ ) {
+        B->IA[i] = pos;
+        for ( k = IA[i]; k < IA[i+1]; k++ ) {
+            j = JA[k];
+            if ( j > i ) {
+                B->JA[pos]  = j;
+                B->val[pos] = DATA[k];
+                pos++;
+            }
+            else if ( j == i ) {
+                B->diag[i] += DATA[k];
+            }
+        }
+    }
+    B->IA[n] = pos;
+
+    // sort column indices in each row (the symmetric SpMV relies on it)
+    U.row = n; U.col = n; U.nnz = nnz;
+    U.IA  = B->IA; U.JA = B->JA; U.val = B->val;
+    fasp_dcsr_sort(&U);
+
+    return B;
+}
+
+/**
+ * \fn dCSRmat fasp_format_dsymcsr_dcsr (const dSymCSRmat *A)
+ *
+ * \brief Convert a dSymCSRmat into a dCSRmat with both triangular parts
+ *
+ * \param A   Pointer to dSymCSRmat matrix
+ *
+ * \return    dCSRmat matrix
+ *
+ * \author FASP team
+ * \date   10/16/2026
+ *
+ * \note The column indices in each row of the output are in increasing order.
+ */
+dCSRmat fasp_format_dsymcsr_dcsr (const dSymCSRmat *A)
+{
+    const INT   n = A->row;
+    const INT  *IA = A->IA, *JA = A->JA;
+    const REAL *DATA = A->val;
+
+    INT i, j, k, p;
+    INT *pos = NULL;
+
+    dCSRmat B = fasp_dcsr_create(n, n, n+2*A->nnz);
+
+    // row lengths: upper entries in column i + diagonal + upper part of row i
+    for ( i = 0; i < n; i++ ) {
+        B.IA[i+1] += 1 + IA[i+1] - IA[i];
+        for ( k = IA[i]; k < IA[i+1]; k++ ) B.IA[JA[k]+1]++;
+    }
+    for ( i = 0; i < n; i++ ) B.IA[i+1] += B.IA[i];
+
+    // diagonal and upper part at the end of each row
+    for ( i = 0; i < n; i++ ) {
+        p = B.IA[i+1] - (IA[i+1] - IA[i]) - 1;
+        B.JA[p] = i; B.val[p] = A->diag[i];
+        for ( k = IA[i]; k < IA[i+1]; k++ ) {
+            p++; B.JA[p] = JA[k]; B.val[p] = DATA[k];
+        }
+    }
+
+    // lower part at the beginning of each row, in increasing order of columns
+    pos = (INT *)fasp_mem_calloc(MAX(n,1), sizeof(INT));
+    for ( i = 0; i < n; i++ ) pos[i] = B.IA[i];
+    for ( i = 0; i < n; i++ ) {
+        for ( k = IA[i]; k < IA[i+1]; k++ ) {
+            j = JA[k];
+            B.JA[pos[j]]  = i;
+            B.val[pos[j]] = DATA[k];
+            pos[j]++;
+        }
+    }
+
+    fasp_mem_free(pos); pos = NULL;
+
+    return B;
+}
+
+/**
+ * \fn dCSR16mat * fasp_format_dcsr_dcsr16 (const dCSRmat *A)
+ *
+ * \brief Convert a dCSRmat into a dCSR16mat (16-bit column index deltas)
+ *
+ * \param A   Pointer to dCSRmat matrix
+ *
+ * \return    Pointer to dCSR16mat matrix
+ *
+ * \author FASP team
+ * \date   10/16/2026
+ *
+ * \note The order of the entries in each row is kept, so the columns do not need
+ *       to be sorted. For banded matrices all deltas fit in 16 bits as long as the
+ *       bandwidth is less than CSR16_MAXDELTA.
+ */
+dCSR16mat * fasp_format_dcsr_dcsr16 (const dCSRmat *A)
+{
+    const INT   n = A->row, nnz = A->nnz;
+    const INT  *IA = A->IA, *JA = A->JA;
+    const REAL *DATA = A->val;
+
+    INT i, k, d, nlong, nesc = 0, pos = 0;
+
+    dCSR16mat *B = NULL;
+
+    // count the long deltas: rows with long deltas store their columns in JE
+    for ( i = 0; i < n; i++ ) {
+        nlong = 0;
+        for ( k = IA[i]+1; k < IA[i+1]; k++ ) {
+            d = JA[k] - JA[IA[i]];
+            if ( d > CSR16_MAXDELTA || d < -CSR16_MAXDELTA ) nlong++;
+        }
+        if ( nlong > 0 ) nesc += nlong + 1;
+    }
+
+    B = fasp_dcsr16_create(n, A->col, nnz, nesc);
+
+    fasp_iarray_cp(n+1, IA, B->IA);
+    fasp_darray_cp(nnz, DATA, B->val);
+
+    for ( i = 0; i < n; i++ ) {
+
+        if ( IA[i+1] == IA[i] ) continue; // empty row: base[i] = 0
+
+        nlong = 0;
+        for ( k = IA[i]+1; k < IA[i+1]; k++ ) {
+            d = JA[k] - JA[IA[i]];
+            if ( d > CSR16_MAXDELTA || d < -CSR16_MAXDELTA ) nlong++;
+        }
+
+        if ( nlong == 0 ) {
+            B->base[i] = JA[IA[i]];
+        }
+        else {
+            B->base[i] = -(pos+1);
+            B->JE[pos++] = JA[IA[i]];
+        }
+
+        for ( k = IA[i]; k < IA[i+1]; k++ ) {
+            d = JA[k] - JA[IA[i]];
+            if ( d > CSR16_MAXDELTA || d < -CSR16_MAXDELTA ) {
+                B->JD[k] = CSR16_ESCAPE;
+                B->JE[pos++] = JA[k];
+            }
+            else {
+                B->JD[k] = (SHORT)d;
+            }
+        }
+    }
+
+    return B;
+}
+
+/**
+ * \fn dCSRmat fasp_format_dcsr16_dcsr (const dCSR16mat *A)
+ *
+ * \brief Convert a dCSR16mat into a dCSRmat
+ *
+ * \param A   Pointer to dCSR16mat matrix
+ *
+ * \return    dCSRmat matrix
+ *
+ * \author FASP team
+ * \date   10/16/2026
+ */
+dCSRmat fasp_format_dcsr16_dcsr (const dCSR16mat *A)
+{
+    const INT    n = A->row;
+    const INT   *IA = A->IA, *base = A->base, *JE = A->JE;
+    const SHORT *JD = A->JD;
+
+    INT i, j, k, e;
+
+    dCSRmat B = fasp_dcsr_create(n, A->col, A->nnz);
+
+    fasp_iarray_cp(n+1, IA, B.IA);
+    fasp_darray_cp(A->nnz, A->val, B.val);
+
+    for ( i = 0; i < n; i++ ) {
+        if ( base[i] >= 0 ) {
+            for ( k = IA[i]; k < IA[i+1]; k++ ) B.JA[k] = base[i] + JD[k];
+        }
+        else {
+            e = -base[i]-1; j = JE[e++];
+            for ( k = IA[i]; k < IA[i+1]; k++ ) {
+                B.JA[k] = ( JD[k] == CSR16_ESCAPE ) ? JE[e++] : j + JD[k];
+            }
+        }
+    }
+
+    return B;
+}
+
 /*!
  * \fn dCSRmat fasp_format_dbsr_dcsr (const dBSRmat *B)
  *
@@ -736,13 +1092,13 @@ dBSRmat fasp_format_dcsr_dbsr (const dCSRmat  *A,
 	REAL *bval;
 
     if ((A->row)%nb!=0) {
-        printf("### ERROR: A.row=%d is not a multiplication of nb=%d!\n",
+        printf("### ERROR: A.row=" INTFMT " is not a multiplication of nb=" INTFMT "!\n",
                A->row, nb);
         fasp_chkerr(ERROR_MAT_SIZE, __FUNCTION__);
     }
     
     if ((A->col)%nb!=0) {
-        printf("### ERROR: A.col=%d is not a multiplication of nb=%d!\n",
+        printf("### ERROR: A.col=" INTFMT " is not a multiplication of nb=" INTFMT "!\n",
                A->col, nb);
         fasp_chkerr(ERROR_MAT_SIZE, __FUNCTION__);
     }
@@ -2186,7 +2186,7 @@ static void fasp_check_col_index (INT row,
     for ( ii = 0; ii < num_1; ++ii ) {
         if ( q[ii] == q[ii+1] ) {
             printf("### ERROR: Multiple entries with same col indices!\n");
-            printf("### ERROR: row = %d, col = %d, %d!\n", row, q[ii], q[ii+1]);
+            printf("### ERROR: row = " INTFMT ", col = " INTFMT ", " INTFMT "!\n", row, q[ii], q[ii+1]);
             fasp_chkerr(ERROR_SOLVER_ILUSETUP, __FUNCTION__);
         }
     }
@@ -5,7 +5,7 @@
  *  \note  This file contains Level-1 (Bla) functions. It requires:
  *         AuxArray.c, AuxMemory.c, AuxTiming.c, BlaSmallMatInv.c, BlaILU.c,
  *         BlaSmallMat.c, BlaSmallMatInv.c, BlaSparseBSR.c, BlaSparseCSR.c,
- *         BlaSpmvCSR.c, and PreDataInit.c
+ *         BlaSpmvCSR.c, BlaStrengthCSR.c, and PreDataInit.c
  *
  *---------------------------------------------------------------------------------
  *  Copyright (C) 2010--2020 by the FASP team. All rights reserved.
@@ -26,7 +26,6 @@
 static INT numfactor (dBSRmat *, REAL *, INT *, INT *);
 static INT numfactor_mulcol (dBSRmat *, REAL *, INT *, INT *, INT, INT *, INT *);
 static INT numfactor_levsch (dBSRmat *, REAL *, INT *, INT *, INT, INT *, INT *);
-static void generate_S_theta(dCSRmat *, iCSRmat *, REAL);
 // static void topologic_sort_ILU (ILU_data *);
 // static void mulcol_independ_set (AMG_data *, INT);
 
@@ -51,11 +50,13 @@ static void generate_S_theta(dCSRmat *, iCSRmat *, REAL);
  * \note Works for general nb (Xiaozhe)
  * \note Change the size of work space by Zheng Li 04/26/2015.
  * \note Modified by Chunsheng Feng on 08/11/2017 for iludata->type not inited.
+ * Modified by FASP team on 10/16/2026: account memory to ILU factors.
  */
 SHORT fasp_ilu_dbsr_setup(dBSRmat *A,
                           ILU_data *iludata,
                           ILU_param *iluparam)
 {
+    const SHORT  memtag = fasp_mem_set_tag(MEM_TAG_ILU); // charge to ILU factors
     
     const SHORT  prtlvl = iluparam->print_level;
     const INT    n = A->COL, nnz = A->NNZ, nb = A->nb, nb2 = nb*nb;
@@ -104,7 +105,7 @@ SHORT fasp_ilu_dbsr_setup(dBSRmat *A,
     fasp_symbfactor(A->ROW,A->JA,A->IA,lfil,iwk,&nzlu,ijlu,uptr,&ierr);
     
     if ( ierr != 0 ) {
-        printf("### ERROR: ILU setup failed (ierr=%d)! [%s]\n", ierr, __FUNCTION__);
+        printf("### ERROR: ILU setup failed (ierr=" INTFMT ")! [%s]\n", ierr, __FUNCTION__);
         status = ERROR_SOLVER_ILUSETUP;
         goto FINISHED;
     }
@@ -140,7 +141,7 @@ SHORT fasp_ilu_dbsr_setup(dBSRmat *A,
 #endif
     
     if ( iwk < nzlu ) {
-        printf("### ERROR: ILU needs more RAM %d! [%s]\n", iwk-nzlu, __FUNCTION__);
+        printf("### ERROR: ILU needs more RAM " INTFMT "! [%s]\n", iwk-nzlu, __FUNCTION__);
         status = ERROR_SOLVER_ILUSETUP;
         goto FINISHED;
     }
@@ -148,7 +149,7 @@ SHORT fasp_ilu_dbsr_setup(dBSRmat *A,
     if ( prtlvl > PRINT_NONE ) {
         fasp_gettime(&setup_end);
         setup_duration = setup_end - setup_start;
-        printf("BSR ILU(%d) setup costs %f seconds.\n", lfil, setup_duration);
+        printf("BSR ILU(" INTFMT ") setup costs %f seconds.\n", lfil, setup_duration);
     }
     
 FINISHED:
@@ -159,6 +160,8 @@ FINISHED:
     printf("### DEBUG: [--End--] %s ...\n", __FUNCTION__);
 #endif
     
+    fasp_mem_set_tag(memtag);
+
     return status;
 }
 
@@ -183,12 +186,14 @@ FINISHED:
  * which are only determined by the last input parameter "step".
  * if step == 1: only symbolic factoration;
  * if step == 2: only numerical factoration. 
+ * Modified by FASP team on 10/16/2026: account memory to ILU factors.
  */
 SHORT fasp_ilu_dbsr_setup_step (dBSRmat    *A,
 								ILU_data   *iludata,
 								ILU_param  *iluparam,
 								INT step)
 {
+    const SHORT  memtag = fasp_mem_set_tag(MEM_TAG_ILU); // charge to ILU factors
     
     const SHORT  prtlvl = iluparam->print_level;
     const INT    n = A->COL, nnz = A->NNZ, nb = A->nb, nb2 = nb*nb;
@@ -265,13 +270,13 @@ SHORT fasp_ilu_dbsr_setup_step (dBSRmat    *A,
     #endif
         
         if ( ierr != 0 ) {
-            printf("### ERROR: ILU setup failed (ierr=%d)! [%s]\n", ierr, __FUNCTION__);
+            printf("### ERROR: ILU setup failed (ierr=" INTFMT ")! [%s]\n", ierr, __FUNCTION__);
             status = ERROR_SOLVER_ILUSETUP;
             goto FINISHED;
         }
         
         if ( iwk < nzlu ) {
-            printf("### ERROR: ILU needs more RAM %d! [%s]\n", iwk-nzlu, __FUNCTION__);
+            printf("### ERROR: ILU needs more RAM " INTFMT "! [%s]\n", iwk-nzlu, __FUNCTION__);
             status = ERROR_SOLVER_ILUSETUP;
             goto FINISHED;
         }
@@ -289,13 +294,15 @@ FINISHED:
     if ( prtlvl > PRINT_NONE ) {
         fasp_gettime(&setup_end);
         setup_duration = setup_end - setup_start;
-        printf("BSR ILU(%d) setup costs %f seconds.\n", lfil, setup_duration);
+        printf("BSR ILU(" INTFMT ") setup costs %f seconds.\n", lfil, setup_duration);
     }
 
 #if DEBUG_MODE > 0
     printf("### DEBUG: [--End--] %s ...\n", __FUNCTION__);
 #endif
     
+    fasp_mem_set_tag(memtag);
+
     return status;
 }
 
@@ -316,11 +323,13 @@ FINISHED:
  *
  * \note Only works for 1, 2, 3 nb (Zheng)
  * \note Modified by Chunsheng Feng on 09/06/2017 for iludata->type not inited.
+ * Modified by FASP team on 10/16/2026: account memory to ILU factors.
  */
 SHORT fasp_ilu_dbsr_setup_omp (dBSRmat    *A,
                                ILU_data   *iludata,
                                ILU_param  *iluparam)
 {
+    const SHORT  memtag = fasp_mem_set_tag(MEM_TAG_ILU); // charge to ILU factors
     
     const SHORT  prtlvl = iluparam->print_level;
     const INT    n = A->COL, nnz = A->NNZ, nb = A->nb, nb2 = nb*nb;
@@ -407,13 +416,13 @@ SHORT fasp_ilu_dbsr_setup_omp (dBSRmat    *A,
 #endif
     
     if ( ierr != 0 ) {
-        printf("### ERROR: ILU setup failed (ierr=%d)! [%s]\n", ierr, __FUNCTION__);
+        printf("### ERROR: ILU setup failed (ierr=" INTFMT ")! [%s]\n", ierr, __FUNCTION__);
         status = ERROR_SOLVER_ILUSETUP;
         goto FINISHED;
     }
     
     if ( iwk < nzlu ) {
-        printf("### ERROR: ILU needs more RAM %d! [%s]\n", iwk-nzlu, __FUNCTION__);
+        printf("### ERROR: ILU needs more RAM " INTFMT "! [%s]\n", iwk-nzlu, __FUNCTION__);
         status = ERROR_SOLVER_ILUSETUP;
         goto FINISHED;
     }
@@ -421,7 +430,7 @@ SHORT fasp_ilu_dbsr_setup_omp (dBSRmat    *A,
     if ( prtlvl > PRINT_NONE ) {
         fasp_gettime(&setup_end);
         setup_duration = setup_end - setup_start;
-        printf("BSR ILU(%d) setup costs %f seconds.\n", lfil, setup_duration);
+        printf("BSR ILU(" INTFMT ") setup costs %f seconds.\n", lfil, setup_duration);
     }
     
 FINISHED:
@@ -432,6 +441,8 @@ FINISHED:
     printf("### DEBUG: [--End--] %s ...\n", __FUNCTION__);
 #endif
     
+    fasp_mem_set_tag(memtag);
+
     return status;
 }
 
@@ -452,11 +463,13 @@ FINISHED:
  *
  * \note Only works for nb = 1, 2, 3 (Zheng)
  * \note Modified by Chunsheng Feng on 09/06/2017 for iludata->type not inited
+ * Modified by FASP team on 10/16/2026: account memory to ILU factors.
  */
 SHORT fasp_ilu_dbsr_setup_levsch_omp (dBSRmat    *A,
                                       ILU_data   *iludata,
                                       ILU_param  *iluparam)
 {
+    const SHORT  memtag = fasp_mem_set_tag(MEM_TAG_ILU); // charge to ILU factors
     const SHORT  prtlvl = iluparam->print_level;
     const INT    n = A->COL, nnz = A->NNZ, nb = A->nb, nb2 = nb*nb;
     
@@ -545,13 +558,13 @@ SHORT fasp_ilu_dbsr_setup_levsch_omp (dBSRmat    *A,
 #endif
     
     if ( ierr != 0 ) {
-        printf("### ERROR: ILU setup failed (ierr=%d)! [%s]\n", ierr, __FUNCTION__);
+        printf("### ERROR: ILU setup failed (ierr=" INTFMT ")! [%s]\n", ierr, __FUNCTION__);
         status = ERROR_SOLVER_ILUSETUP;
         goto FINISHED;
     }
     
     if ( iwk < nzlu ) {
-        printf("### ERROR: ILU needs more RAM %d! [%s]\n", iwk-nzlu, __FUNCTION__);
+        printf("### ERROR: ILU needs more RAM " INTFMT "! [%s]\n", iwk-nzlu, __FUNCTION__);
         status = ERROR_SOLVER_ILUSETUP;
         goto FINISHED;
     }
@@ -559,7 +572,7 @@ SHORT fasp_ilu_dbsr_setup_levsch_omp (dBSRmat    *A,
     if ( prtlvl > PRINT_NONE ) {
         fasp_gettime(&setup_end);
         setup_duration = setup_end - setup_start;
-        printf("BSR ILU(%d) setup costs %f seconds.\n", lfil, setup_duration);
+        printf("BSR ILU(" INTFMT ") setup costs %f seconds.\n", lfil, setup_duration);
     }
     
 FINISHED:
@@ -570,6 +583,8 @@ FINISHED:
     printf("### DEBUG: [--End--] %s ...\n", __FUNCTION__);
 #endif
     
+    fasp_mem_set_tag(memtag);
+
     return status;
 }
 
@@ -594,12 +609,14 @@ FINISHED:
  * which are only determined by the last input parameter "step".
  * if step == 1: only symbolic factoration;
  * if step == 2: only numerical factoration. 
+ * Modified by FASP team on 10/16/2026: account memory to ILU factors.
  */
 SHORT fasp_ilu_dbsr_setup_levsch_step (dBSRmat    *A,
                                        ILU_data   *iludata,
                                        ILU_param  *iluparam,
 									   INT step)
 {
+    const SHORT  memtag = fasp_mem_set_tag(MEM_TAG_ILU); // charge to ILU factors
     const SHORT  prtlvl = iluparam->print_level;
     const INT    n = A->COL, nnz = A->NNZ, nb = A->nb, nb2 = nb*nb;
     
@@ -677,13 +694,13 @@ SHORT fasp_ilu_dbsr_setup_levsch_step (dBSRmat    *A,
     #endif
         
         if ( ierr != 0 ) {
-            printf("### ERROR: ILU setup failed (ierr=%d)! [%s]\n", ierr, __FUNCTION__);
+            printf("### ERROR: ILU setup failed (ierr=" INTFMT ")! [%s]\n", ierr, __FUNCTION__);
             status = ERROR_SOLVER_ILUSETUP;
             goto FINISHED;
         }
         
         if ( iwk < nzlu ) {
-            printf("### ERROR: ILU needs more RAM %d! [%s]\n", iwk-nzlu, __FUNCTION__);
+            printf("### ERROR: ILU needs more RAM " INTFMT "! [%s]\n", iwk-nzlu, __FUNCTION__);
             status = ERROR_SOLVER_ILUSETUP;
             goto FINISHED;
         }
@@ -713,7 +730,7 @@ FINISHED:
     if ( prtlvl > PRINT_NONE ) {
         fasp_gettime(&setup_end);
         setup_duration = setup_end - setup_start;
-        printf("BSR ILU(%d) setup costs %f seconds.\n", lfil, setup_duration);
+        printf("BSR ILU(" INTFMT ") setup costs %f seconds.\n", lfil, setup_duration);
     }
     
 #if DEBUG_MODE > 0
@@ -721,6 +738,8 @@ FINISHED:
 #endif
 
     
+    fasp_mem_set_tag(memtag);
+
     return status;
 }
 
@@ -1589,92 +1608,6 @@ static INT numfactor_levsch (dBSRmat *A,
     return status;
 }
 
-/**
- * \fn static void generate_S_theta (dCSRmat *A, iCSRmat *S, REAL theta)
- *
- * \brief Generate strong sparsity pattern of A
- *
- * \param A      Pointer to input matrix
- * \param S      Pointer to strong sparsity pattern matrix
- * \param theta  Threshold
- *
- * \author Zheng Li, Chunsheng Feng
- * \date   12/04/2016
- */
-static void generate_S_theta (dCSRmat *A,
-                              iCSRmat *S,
-                              REAL     theta)
-{
-    const INT row=A->row, col=A->col;
-    const INT row_plus_one = row+1;
-    const INT nnz=A->IA[row]-A->IA[0];
-    
-    INT index, i, j, begin_row, end_row;
-    INT *ia=A->IA, *ja=A->JA;
-    REAL *aj=A->val;
-    
-    // get the diagnal entry of A
-    //dvector diag; fasp_dcsr_getdiag(0, A, &diag);
-    
-    /* generate S */
-    REAL row_abs_sum;
-    
-    // copy the structure of A to S
-    S->row=row; S->col=col; S->nnz=nnz; S->val=NULL;
-    
-    S->IA=(INT*)fasp_mem_calloc(row_plus_one, sizeof(INT));
-    
-    S->JA=(INT*)fasp_mem_calloc(nnz, sizeof(INT));
-    
-    fasp_iarray_cp(row_plus_one, ia, S->IA);
-    fasp_iarray_cp(nnz, ja, S->JA);
-    
-    for (i=0;i<row;++i) {
-        /* compute scaling factor and row sum */
-        row_abs_sum=0;
-        
-        begin_row=ia[i]; end_row=ia[i+1];
-        
-        for (j=begin_row;j<end_row;j++) row_abs_sum+=ABS(aj[j]);
-        
-        row_abs_sum = row_abs_sum*theta;
-        
-        /* deal with the diagonal element of S */
-        //  for (j=begin_row;j<end_row;j++) {
-        //     if (ja[j]==i) {S->JA[j]=-1; break;}
-        //  }
-        
-        /* deal with  the element of S */
-        for (j=begin_row;j<end_row;j++){
-            /* if $\sum_{j=1}^n |a_{ij}|*theta>= |a_{ij}|$ */
-            if ( (row_abs_sum >= ABS(aj[j])) && (ja[j] !=i) ) S->JA[j]=-1;
-        }
-    } // end for i
-    
-    /* Compress the strength matrix */
-    index=0;
-    for (i=0;i<row;++i) {
-        S->IA[i]=index;
-        begin_row=ia[i]; end_row=ia[i+1]-1;
-        for (j=begin_row;j<=end_row;j++) {
-            if (S->JA[j]>-1) {
-                S->JA[index]=S->JA[j];
-                index++;
-            }
-        }
-    }
-    
-    if (index > 0) {
-        S->IA[row]=index;
-        S->nnz=index;
-        S->JA=(INT*)fasp_mem_realloc(S->JA,index*sizeof(INT));
-    }
-    else {
-        S->nnz = 0;
-        S->JA = NULL;
-    }
-}
-
 /**
  * \fn static void multicoloring (AMG_data *mgl, REAL theta, INT *rowmax,
  *                                INT *groups)
@@ -1688,6 +1621,8 @@ static void generate_S_theta (dCSRmat *A,
  *
  * \author Zheng Li, Chunsheng Feng
  * \date   12/04/2016
+ *
+ * Modified by FASP team on 10/16/2026: use the shared strength graph
  */
 static void multicoloring (AMG_data *mgl,
                            REAL      theta,
@@ -1709,7 +1644,7 @@ static void multicoloring (AMG_data *mgl,
     theta = MAX(0.0, MIN(1.0, theta));
 
     if (theta > 0.0 && theta < 1.0) {
-        generate_S_theta(&A, &S, theta);
+        fasp_dcsr_strength(&A, STRENGTH_SUM, theta, 0.0, &S, NULL);
         IA = S.IA;
         JA = S.JA;
     }
@@ -1926,7 +1861,7 @@ void mulcol_independ_set (AMG_data *mgl,
         
         // print
         if ( prtlvl > PRINT_MIN )
-            printf("mgl[%3d].A.row = %12d rowmax = %5d rowavg = %7.2lf colors = %5d theta = %le\n",
+            printf("mgl[%3" INTMOD "d].A.row = %12" INTMOD "d rowmax = %5" INTMOD "d rowavg = %7.2lf colors = %5" INTMOD "d theta = %le\n",
                    level, mgl[level].A.row, rowmax, (double)mgl[level].A.nnz/mgl[level].A.row,
                    mgl[level].colors, theta);
     }
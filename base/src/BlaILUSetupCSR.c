@@ -3,7 +3,7 @@
  *  \brief Setup incomplete LU decomposition for dCSRmat matrices
  *
  *  \note  This file contains Level-1 (Bla) functions. It requires:
- *         AuxTiming.c, BlaILU.c, BlaSparseCSR.c, and PreDataInit.c
+ *         AuxTiming.c, BlaFormat.c, BlaILU.c, BlaSparseCSR.c, and PreDataInit.c
  *
  *---------------------------------------------------------------------------------
  *  Copyright (C) 2009--2020 by the FASP team. All rights reserved.
@@ -136,13 +136,13 @@ SHORT fasp_ilu_dcsr_setup (dCSRmat    *A,
 #endif    
     
     if (ierr!=0) {
-        printf("### ERROR: ILU setup failed (ierr=%d)! [%s]\n", ierr, __FUNCTION__);
+        printf("### ERROR: ILU setup failed (ierr=" INTFMT ")! [%s]\n", ierr, __FUNCTION__);
         status = ERROR_SOLVER_ILUSETUP;
         goto FINISHED;
     }
     
     if (iwk<nzlu) {
-        printf("### ERROR: ILU needs more RAM %d! [%s]\n", iwk-nzlu, __FUNCTION__);
+        printf("### ERROR: ILU needs more RAM " INTFMT "! [%s]\n", iwk-nzlu, __FUNCTION__);
         status = ERROR_SOLVER_ILUSETUP;
         goto FINISHED;
     }
@@ -173,6 +173,49 @@ FINISHED:
     return status;
 }
 
+/**
+ * \fn SHORT fasp_ilu_dsymcsr_setup (const dSymCSRmat *A, ILU_data *iludata,
+ *                                   ILU_param *iluparam)
+ *
+ * \brief Get ILU decomposition of a symmetric matrix A in SymCSR format
+ *
+ * \param A         Pointer to dSymCSRmat matrix
+ * \param iludata   Pointer to ILU_data
+ * \param iluparam  Pointer to ILU_param
+ *
+ * \return          FASP_SUCCESS if successed; otherwise, error information.
+ *
+ * \author FASP team
+ * \date   10/16/2026
+ *
+ * \note The full matrix is only formed during the setup. ILUtp is replaced by
+ *       ILUk since column pivoting would destroy the symmetry of A.
+ */
+SHORT fasp_ilu_dsymcsr_setup (const dSymCSRmat  *A,
+                              ILU_data          *iludata,
+                              ILU_param         *iluparam)
+{
+    ILU_param  param = *iluparam;
+    dCSRmat    Afull;
+    SHORT      status;
+
+    if ( param.ILU_type == ILUtp ) {
+        if ( param.print_level > PRINT_NONE ) {
+            printf("### WARNING: ILUtp is not supported for SymCSR, use ILUk! [%s]\n",
+                   __FUNCTION__);
+        }
+        param.ILU_type = ILUk;
+    }
+
+    Afull  = fasp_format_dsymcsr_dcsr(A);
+    status = fasp_ilu_dcsr_setup(&Afull, iludata, &param);
+
+    iludata->A = NULL; // the full matrix is not kept
+    fasp_dcsr_free(&Afull);
+
+    return status;
+}
+
 /*---------------------------------*/
 /*--        End of File          --*/
 /*---------------------------------*/
@@ -64,7 +64,7 @@ void fasp_dcsrvec_read1 (const char  *filename,
                          dCSRmat     *A,
                          dvector     *b)
 {
-    int  i, m, n, idata;
+    INT  i, m, n, idata;
     REAL ddata;
     
     // Open input disk file
@@ -77,7 +77,7 @@ void fasp_dcsrvec_read1 (const char  *filename,
     skip_comments(fp); // skip the comments in the beginning --zcs 06/30/2020
 
     // Read CSR matrix
-    if ( fscanf(fp, "%d %d", &m, &n) > 0 ) {
+    if ( fscanf(fp, INTFMT " " INTFMT, &m, &n) > 0 ) {
         A->row = m; A->col = n;
     }
     else {
@@ -86,7 +86,7 @@ void fasp_dcsrvec_read1 (const char  *filename,
     
     A->IA = (INT *)fasp_mem_calloc(m+1, sizeof(INT));
     for ( i = 0; i <= m; ++i ) {
-        if ( fscanf(fp, "%d", &idata) > 0 ) A->IA[i] = idata;
+        if ( fscanf(fp, INTFMT, &idata) > 0 ) A->IA[i] = idata;
         else {
             fasp_chkerr(ERROR_WRONG_FILE, filename);
         }
@@ -99,7 +99,7 @@ void fasp_dcsrvec_read1 (const char  *filename,
     A->val = (REAL*)fasp_mem_calloc(nnz, sizeof(REAL));
     
     for ( i = 0; i < nnz; ++i ) {
-        if ( fscanf(fp, "%d", &idata) > 0 ) A->JA[i] = idata;
+        if ( fscanf(fp, INTFMT, &idata) > 0 ) A->JA[i] = idata;
         else {
             fasp_chkerr(ERROR_WRONG_FILE, filename);
         }
@@ -113,7 +113,7 @@ void fasp_dcsrvec_read1 (const char  *filename,
     }
     
     // Read RHS vector
-    if ( fscanf(fp, "%d", &m) > 0 ) b->row = m;
+    if ( fscanf(fp, INTFMT, &m) > 0 ) b->row = m;
     
     b->val = (REAL*)fasp_mem_calloc(m, sizeof(REAL));
     
@@ -164,7 +164,7 @@ void fasp_dcsrvec_read2 (const char  *filemat,
                          dCSRmat     *A,
                          dvector     *b)
 {
-    int i, n, tempi;
+    INT i, n, tempi;
     
     /* read the matrix from file */
     FILE *fp = fopen(filemat,"r");
@@ -175,7 +175,7 @@ void fasp_dcsrvec_read2 (const char  *filemat,
     
     skip_comments(fp); // skip the comments in the beginning --zcs 06/30/2020
 
-    if ( fscanf(fp,"%d\n",&n) > 0 ) {
+    if ( fscanf(fp,INTFMT "\n",&n) > 0 ) {
         A->row = n;
         A->col = n;
         A->IA  = (INT *)fasp_mem_calloc(n+1, sizeof(INT));
@@ -185,7 +185,7 @@ void fasp_dcsrvec_read2 (const char  *filemat,
     }
 
     for ( i = 0; i <= n; ++i ) {
-        if ( fscanf(fp,"%d\n",&tempi) > 0 ) A->IA[i] = tempi-1;
+        if ( fscanf(fp,INTFMT "\n",&tempi) > 0 ) A->IA[i] = tempi-1;
         else {
             fasp_chkerr(ERROR_WRONG_FILE, filemat);
         }
@@ -197,7 +197,7 @@ void fasp_dcsrvec_read2 (const char  *filemat,
     A->val = (REAL *)fasp_mem_calloc(nz, sizeof(REAL));
     
     for ( i = 0; i < nz; ++i ) {
-        if ( fscanf(fp,"%d\n",&tempi) > 0 ) A->JA[i] = tempi-1;
+        if ( fscanf(fp,INTFMT "\n",&tempi) > 0 ) A->JA[i] = tempi-1;
         else {
             fasp_chkerr(ERROR_WRONG_FILE, filemat);
         }
@@ -221,10 +221,10 @@ void fasp_dcsrvec_read2 (const char  *filemat,
 
     printf("%s: reading file %s...\n", __FUNCTION__, filerhs);
     
-    if ( fscanf(fp,"%d\n",&n) < 0 ) fasp_chkerr(ERROR_WRONG_FILE, filerhs);
+    if ( fscanf(fp,INTFMT "\n",&n) < 0 ) fasp_chkerr(ERROR_WRONG_FILE, filerhs);
 
     if ( n != b->row ) {
-        printf("### WARNING: rhs size = %d, matrix size = %d!\n", n, b->row);
+        printf("### WARNING: rhs size = " INTFMT ", matrix size = " INTFMT "!\n", n, b->row);
         fasp_chkerr(ERROR_MAT_SIZE, filemat);
     }
     
@@ -251,7 +251,7 @@ void fasp_dcsrvec_read2 (const char  *filemat,
 void fasp_dcsr_read (const char  *filename,
                      dCSRmat     *A)
 {
-    int  i,m,idata;
+    INT  i,m,idata;
     REAL ddata;
     
     // Open input disk file
@@ -264,14 +264,14 @@ void fasp_dcsr_read (const char  *filename,
     skip_comments(fp); // skip the comments in the beginning --zcs 06/30/2020
 
     // Read CSR matrix
-    if ( fscanf(fp, "%d", &m) > 0 ) A->row = A->col = m;
+    if ( fscanf(fp, INTFMT, &m) > 0 ) A->row = A->col = m;
     else {
         fasp_chkerr(ERROR_WRONG_FILE, filename);
     }
 
     A->IA = (INT *)fasp_mem_calloc(m+1, sizeof(INT));
     for ( i = 0; i <= m; ++i ) {
-        if ( fscanf(fp, "%d", &idata) > 0 ) A->IA[i] = idata;
+        if ( fscanf(fp, INTFMT, &idata) > 0 ) A->IA[i] = idata;
         else {
             fasp_chkerr(ERROR_WRONG_FILE, filename);
         }
@@ -287,7 +287,7 @@ void fasp_dcsr_read (const char  *filename,
     A->val = (REAL*)fasp_mem_calloc(nnz, sizeof(REAL));
     
     for ( i = 0; i < nnz; ++i ) {
-        if ( fscanf(fp, "%d", &idata) > 0 ) A->JA[i] = idata;
+        if ( fscanf(fp, INTFMT, &idata) > 0 ) A->JA[i] = idata;
         else {
             fasp_chkerr(ERROR_WRONG_FILE, filename);
         }
@@ -326,7 +326,7 @@ void fasp_dcsr_read (const char  *filename,
 void fasp_dcoo_read (const char  *filename,
                      dCSRmat     *A)
 {
-    int  i,j,k,m,n,nnz;
+    INT  i,j,k,m,n,nnz;
     REAL value;
     
     FILE *fp = fopen(filename,"r");
@@ -337,14 +337,14 @@ void fasp_dcoo_read (const char  *filename,
 
     skip_comments(fp); // skip the comments in the beginning --zcs 06/30/2020
 
-    if ( fscanf(fp,"%d %d %d",&m,&n,&nnz) <= 0 ) {
+    if ( fscanf(fp,INTFMT " " INTFMT " " INTFMT,&m,&n,&nnz) <= 0 ) {
         fasp_chkerr(ERROR_WRONG_FILE, filename);
     }
 
     dCOOmat Atmp = fasp_dcoo_create(m,n,nnz);
 
     for ( k = 0; k < nnz; k++ ) {
-        if ( fscanf(fp, "%d %d %le", &i, &j, &value) != EOF ) {
+        if ( fscanf(fp, INTFMT " " INTFMT " %le", &i, &j, &value) != EOF ) {
             Atmp.rowind[k]=i; Atmp.colind[k]=j; Atmp.val[k] = value;
         }
         else {
@@ -378,7 +378,7 @@ void fasp_dcoo_read (const char  *filename,
 void fasp_dcoo_read1 (const char  *filename,
                       dCSRmat     *A)
 {
-    int  i,j,k,m,n,nnz;
+    INT  i,j,k,m,n,nnz;
     REAL value;
 
     FILE *fp = fopen(filename,"r");
@@ -389,14 +389,14 @@ void fasp_dcoo_read1 (const char  *filename,
 
     skip_comments(fp); // skip the comments in the beginning --zcs 06/30/2020
 
-    if ( fscanf(fp,"%d %d %d",&m,&n,&nnz) <= 0 ) {
+    if ( fscanf(fp,INTFMT " " INTFMT " " INTFMT,&m,&n,&nnz) <= 0 ) {
         fasp_chkerr(ERROR_WRONG_FILE, filename);
     }
 
     dCOOmat Atmp = fasp_dcoo_create(m,n,nnz);
 
     for ( k = 0; k < nnz; k++ ) {
-        if ( fscanf(fp, "%d %d %le", &i, &j, &value) != EOF ) {
+        if ( fscanf(fp, INTFMT " " INTFMT " %le", &i, &j, &value) != EOF ) {
             Atmp.rowind[k]=i-1; Atmp.colind[k]=j-1; Atmp.val[k] = value;
         }
         else {
@@ -433,7 +433,7 @@ void fasp_dcoo_read1 (const char  *filename,
 void fasp_dcoo_shift_read (const char  *filename,
                            dCSRmat     *A)
 {
-    int  i,j,k,m,n,nnz;
+    INT  i,j,k,m,n,nnz;
     REAL value;
     
     FILE *fp = fopen(filename,"r");
@@ -444,14 +444,14 @@ void fasp_dcoo_shift_read (const char  *filename,
     
     skip_comments(fp); // skip the comments in the beginning --zcs 06/30/2020
 
-    if ( fscanf(fp,"%d %d %d",&m,&n,&nnz) <= 0 ) {
+    if ( fscanf(fp,INTFMT " " INTFMT " " INTFMT,&m,&n,&nnz) <= 0 ) {
         fasp_chkerr(ERROR_WRONG_FILE, filename);
     }
     
     dCOOmat Atmp = fasp_dcoo_create(m,n,nnz);
     
     for ( k = 0; k < nnz; k++ ) {
-        if ( fscanf(fp, "%d %d %le", &i, &j, &value) != EOF ) {
+        if ( fscanf(fp, INTFMT " " INTFMT " %le", &i, &j, &value) != EOF ) {
             Atmp.rowind[k]=i-1; Atmp.colind[k]=j-1; Atmp.val[k] = value;
         }
         else {
@@ -486,7 +486,7 @@ void fasp_dcoo_shift_read (const char  *filename,
 void fasp_dmtx_read (const char  *filename,
                      dCSRmat     *A)
 {
-    int  i,j,m,n,nnz;
+    INT  i,j,m,n,nnz;
     INT  innz; // index of nonzeros
     REAL value;
     
@@ -498,7 +498,7 @@ void fasp_dmtx_read (const char  *filename,
 
     skip_comments(fp); // skip the comments in the beginning --zcs 06/30/2020
 
-    if ( fscanf(fp,"%d %d %d",&m,&n,&nnz) <= 0 ) {
+    if ( fscanf(fp,INTFMT " " INTFMT " " INTFMT,&m,&n,&nnz) <= 0 ) {
         fasp_chkerr(ERROR_WRONG_FILE, filename);
     }
     
@@ -507,7 +507,7 @@ void fasp_dmtx_read (const char  *filename,
     innz = 0;
     
     while (innz < nnz) {
-        if ( fscanf(fp, "%d %d %le", &i, &j, &value) != EOF ) {
+        if ( fscanf(fp, INTFMT " " INTFMT " %le", &i, &j, &value) != EOF ) {
             Atmp.rowind[innz]=i-1;
             Atmp.colind[innz]=j-1;
             Atmp.val[innz] = value;
@@ -545,8 +545,8 @@ void fasp_dmtx_read (const char  *filename,
 void fasp_dmtxsym_read (const char  *filename,
                         dCSRmat     *A)
 {
-    int  i,j,m,n,nnz;
-    int  innz; // index of nonzeros
+    INT  i,j,m,n,nnz;
+    INT  innz; // index of nonzeros
     REAL value;
     
     FILE *fp = fopen(filename,"r");
@@ -557,7 +557,7 @@ void fasp_dmtxsym_read (const char  *filename,
     
     skip_comments(fp); // skip the comments in the beginning --zcs 06/30/2020
 
-    if ( fscanf(fp,"%d %d %d",&m,&n,&nnz) <= 0 ) {
+    if ( fscanf(fp,INTFMT " " INTFMT " " INTFMT,&m,&n,&nnz) <= 0 ) {
         fasp_chkerr(ERROR_WRONG_FILE, filename);
     }
     
@@ -567,7 +567,7 @@ void fasp_dmtxsym_read (const char  *filename,
     innz = 0;
     
     while (innz < nnz) {
-        if ( fscanf(fp, "%d %d %le", &i, &j, &value) != EOF ) {
+        if ( fscanf(fp, INTFMT " " INTFMT " %le", &i, &j, &value) != EOF ) {
             
             if ( i == j ) {
                 Atmp.rowind[innz] = i-1;
@@ -622,8 +622,8 @@ void fasp_dmtxsym_read (const char  *filename,
 void fasp_dstr_read (const char  *filename,
                      dSTRmat     *A)
 {
-    int  nx, ny, nz, nxy, ngrid, nband, nc, offset;
-    int  i, k, n;
+    INT  nx, ny, nz, nxy, ngrid, nband, nc, offset;
+    INT  i, k, n;
     REAL value;
     
     FILE *fp = fopen(filename,"r");
@@ -635,7 +635,7 @@ void fasp_dstr_read (const char  *filename,
     skip_comments(fp); // skip the comments in the beginning --zcs 06/30/2020
 
     // read dimension of the problem
-    if ( fscanf(fp,"%d %d %d",&nx,&ny,&nz) > 0 ) {
+    if ( fscanf(fp,INTFMT " " INTFMT " " INTFMT,&nx,&ny,&nz) > 0 ) {
         A->nx = nx; A->ny = ny; A->nz = nz;
     }
     else {
@@ -646,13 +646,13 @@ void fasp_dstr_read (const char  *filename,
     A->nxy = nxy; A->ngrid = ngrid;
     
     // read number of components
-    if ( fscanf(fp,"%d",&nc) > 0 ) A->nc = nc;
+    if ( fscanf(fp,INTFMT,&nc) > 0 ) A->nc = nc;
     else {
         fasp_chkerr(ERROR_WRONG_FILE, filename);
     }
     
     // read number of bands
-    if ( fscanf(fp,"%d",&nband) > 0 ) A->nband = nband;
+    if ( fscanf(fp,INTFMT,&nband) > 0 ) A->nband = nband;
     else {
         fasp_chkerr(ERROR_WRONG_FILE, filename);
     }
@@ -660,7 +660,7 @@ void fasp_dstr_read (const char  *filename,
     A->offsets = (INT *)fasp_mem_calloc(nband, sizeof(INT));
     
     // read diagonal
-    if ( fscanf(fp, "%d", &n) > 0 ) {
+    if ( fscanf(fp, INTFMT, &n) > 0 ) {
         A->diag = (REAL *)fasp_mem_calloc(n, sizeof(REAL));
     }
     else {
@@ -679,7 +679,7 @@ void fasp_dstr_read (const char  *filename,
     A->offdiag = (REAL **)fasp_mem_calloc(nband, sizeof(REAL *));
     while ( k-- ) {
         // read number band k
-        if ( fscanf(fp,"%d %d",&offset,&n) > 0 ) {
+        if ( fscanf(fp,INTFMT " " INTFMT,&offset,&n) > 0 ) {
             A->offsets[nband-k-1] = offset;
         }
         else {
@@ -728,9 +728,9 @@ void fasp_dstr_read (const char  *filename,
 void fasp_dbsr_read (const char  *filename,
                      dBSRmat     *A)
 {
-    int     ROW, COL, NNZ, nb, storage_manner;
-    int     i, n;
-    int     index;
+    INT     ROW, COL, NNZ, nb, storage_manner;
+    INT     i, n;
+    INT     index;
     REAL    value;
     size_t  status;
 
@@ -742,15 +742,15 @@ void fasp_dbsr_read (const char  *filename,
 
     skip_comments(fp); // skip the comments in the beginning --zcs 06/30/2020
 
-    status = fscanf(fp, "%d %d %d", &ROW, &COL, &NNZ); // dimensions of the problem
+    status = fscanf(fp, INTFMT " " INTFMT " " INTFMT, &ROW, &COL, &NNZ); // dimensions of the problem
     fasp_chkerr(status, filename);
     A->ROW = ROW; A->COL = COL; A->NNZ = NNZ;
 
-    status = fscanf(fp, "%d", &nb); // read the size of each block
+    status = fscanf(fp, INTFMT, &nb); // read the size of each block
     fasp_chkerr(status, filename);
     A->nb = nb;
     
-    status = fscanf(fp, "%d", &storage_manner); // read the storage_manner
+    status = fscanf(fp, INTFMT, &storage_manner); // read the storage_manner
     fasp_chkerr(status, filename);
     A->storage_manner = storage_manner;
 
@@ -758,25 +758,25 @@ void fasp_dbsr_read (const char  *filename,
     fasp_dbsr_alloc(ROW, COL, NNZ, nb, storage_manner, A);
 
     // read IA
-    status = fscanf(fp, "%d", &n);
+    status = fscanf(fp, INTFMT, &n);
     fasp_chkerr(status, filename);
     for ( i = 0; i < n; ++i ) {
-        status = fscanf(fp, "%d", &index);
+        status = fscanf(fp, INTFMT, &index);
         fasp_chkerr(status, filename);
         A->IA[i] = index;
     }
     
     // read JA
-    status = fscanf(fp, "%d", &n);
+    status = fscanf(fp, INTFMT, &n);
     fasp_chkerr(status, filename);
     for ( i = 0; i < n; ++i ) {
-        status = fscanf(fp, "%d", &index);
+        status = fscanf(fp, INTFMT, &index);
         fasp_chkerr(status, filename);
         A->JA[i] = index;
     }
     
     // read val
-    status = fscanf(fp, "%d", &n);
+    status = fscanf(fp, INTFMT, &n);
     fasp_chkerr(status, filename);
     for ( i = 0; i < n; ++i ) {
         status = fscanf(fp, "%le", &value);
@@ -807,7 +807,7 @@ void fasp_dbsr_read (const char  *filename,
 void fasp_dvecind_read (const char  *filename,
                         dvector     *b)
 {
-    int     i, n, index;
+    INT     i, n, index;
     REAL    value;
     size_t  status;
 
@@ -819,17 +819,17 @@ void fasp_dvecind_read (const char  *filename,
 
     skip_comments(fp); // skip the comments in the beginning --zcs 06/30/2020
 
-    status = fscanf(fp, "%d", &n);
+    status = fscanf(fp, INTFMT, &n);
     fasp_dvec_alloc(n,b);
     
     for ( i = 0; i < n; ++i ) {
         
-        status = fscanf(fp, "%d %le", &index, &value);
+        status = fscanf(fp, INTFMT " %le", &index, &value);
         
         if ( value > BIGREAL || index >= n ) {
             fasp_dvec_free(b); fclose(fp);
 
-            printf("### ERROR: Wrong index = %d or value = %lf\n", index, value);
+            printf("### ERROR: Wrong index = " INTFMT " or value = %lf\n", index, value);
             fasp_chkerr(ERROR_INPUT_PAR, __FUNCTION__);
         }
         
@@ -858,7 +858,7 @@ void fasp_dvecind_read (const char  *filename,
 void fasp_dvec_read (const char  *filename,
                      dvector     *b)
 {
-    int     i, n;
+    INT     i, n;
     REAL    value;
     size_t  status;
     
@@ -870,7 +870,7 @@ void fasp_dvec_read (const char  *filename,
 
     skip_comments(fp); // skip the comments in the beginning --zcs 06/30/2020
 
-    status = fscanf(fp,"%d",&n);
+    status = fscanf(fp,INTFMT,&n);
     
     fasp_dvec_alloc(n,b);
     
@@ -910,7 +910,7 @@ void fasp_dvec_read (const char  *filename,
 void fasp_ivecind_read (const char  *filename,
                         ivector     *b)
 {
-    int     i, n, index, value;
+    INT     i, n, index, value;
     size_t  status;
 
     FILE *fp = fopen(filename,"r");
@@ -921,11 +921,11 @@ void fasp_ivecind_read (const char  *filename,
 
     skip_comments(fp); // skip the comments in the beginning --zcs 06/30/2020
 
-    status = fscanf(fp,"%d",&n);
+    status = fscanf(fp,INTFMT,&n);
     fasp_ivec_alloc(n,b);
 
     for ( i = 0; i < n; ++i ) {
-        status = fscanf(fp, "%d %d", &index, &value);
+        status = fscanf(fp, INTFMT " " INTFMT, &index, &value);
         b->val[index] = value;
     }
     
@@ -951,7 +951,7 @@ void fasp_ivecind_read (const char  *filename,
 void fasp_ivec_read (const char  *filename,
                      ivector     *b)
 {
-    int     i, n, value;
+    INT     i, n, value;
     size_t  status;
 
     FILE *fp = fopen(filename,"r");
@@ -962,11 +962,11 @@ void fasp_ivec_read (const char  *filename,
 
     skip_comments(fp); // skip the comments in the beginning --zcs 06/30/2020
 
-    status = fscanf(fp,"%d",&n);
+    status = fscanf(fp,INTFMT,&n);
     fasp_ivec_alloc(n,b);
     
     for ( i = 0; i < n; ++i ) {
-        status = fscanf(fp, "%d", &value);
+        status = fscanf(fp, INTFMT, &value);
         b->val[i] = value;
     }
     
@@ -1013,12 +1013,12 @@ void fasp_dcsrvec_write1 (const char  *filename,
     /* write the matrix to file */
     printf("%s: reading file %s...\n", __FUNCTION__, filename);
     
-    fprintf(fp,"%d %d\n",m,n);
+    fprintf(fp,INTFMT " " INTFMT "\n",m,n);
     for ( i = 0; i < m+1; ++i ) {
-        fprintf(fp, "%d\n", A->IA[i]);
+        fprintf(fp, INTFMT "\n", A->IA[i]);
     }
     for (i = 0; i < nnz; ++i) {
-        fprintf(fp, "%d\n", A->JA[i]);
+        fprintf(fp, INTFMT "\n", A->JA[i]);
     }
     for (i = 0; i < nnz; ++i) {
         fprintf(fp, "%le\n", A->val[i]);
@@ -1029,7 +1029,7 @@ void fasp_dcsrvec_write1 (const char  *filename,
     /* write the rhs to file */
     printf("%s: writing to file %s...\n", __FUNCTION__, filename);
     
-    fprintf(fp,"%d\n",m);
+    fprintf(fp,INTFMT "\n",m);
     
     for ( i = 0; i < m; ++i ) fprintf(fp,"%le\n",b->val[i]);
     
@@ -1082,12 +1082,12 @@ void fasp_dcsrvec_write2 (const char  *filemat,
 
     printf("%s: writing to file %s...\n", __FUNCTION__, filemat);
     
-    fprintf(fp,"%d\n",m);
+    fprintf(fp,INTFMT "\n",m);
     for ( i = 0; i < m+1; ++i ) {
-        fprintf(fp, "%d\n", A->IA[i]+1);
+        fprintf(fp, INTFMT "\n", A->IA[i]+1);
     }
     for (i = 0; i < nnz; ++i) {
-        fprintf(fp, "%d\n", A->JA[i]+1);
+        fprintf(fp, INTFMT "\n", A->JA[i]+1);
     }
     for (i = 0; i < nnz; ++i) {
         fprintf(fp, "%le\n", A->val[i]);
@@ -1104,7 +1104,7 @@ void fasp_dcsrvec_write2 (const char  *filemat,
     
     printf("%s: writing to file %s...\n", __FUNCTION__, filerhs);
     
-    fprintf(fp,"%d\n",m);
+    fprintf(fp,INTFMT "\n",m);
     
     for ( i = 0; i < m; ++i ) fprintf(fp,"%le\n",b->val[i]);
     
@@ -1143,10 +1143,10 @@ void fasp_dcoo_write (const char  *filename,
 
     printf("%s: writing to file %s...\n", __FUNCTION__, filename);
     
-    fprintf(fp,"%d  %d  %d\n",m,n,A->nnz);
+    fprintf(fp,INTFMT "  " INTFMT "  " INTFMT "\n",m,n,A->nnz);
     for ( i = 0; i < m; ++i ) {
         for ( j = A->IA[i]; j < A->IA[i+1]; j++ )
-            fprintf(fp,"%d  %d  %0.15e\n",i,A->JA[j],A->val[j]);
+            fprintf(fp,INTFMT "  " INTFMT "  %0.15e\n",i,A->JA[j],A->val[j]);
     }
     
     fclose(fp);
@@ -1182,15 +1182,15 @@ void fasp_dstr_write (const char  *filename,
 
     printf("%s: writing to file %s...\n", __FUNCTION__, filename);
     
-    fprintf(fp,"%d  %d  %d\n",nx,ny,nz); // write dimension of the problem
+    fprintf(fp,INTFMT "  " INTFMT "  " INTFMT "\n",nx,ny,nz); // write dimension of the problem
     
-    fprintf(fp,"%d\n",nc); // read number of components
+    fprintf(fp,INTFMT "\n",nc); // read number of components
     
-    fprintf(fp,"%d\n",nband); // write number of bands
+    fprintf(fp,INTFMT "\n",nband); // write number of bands
     
     // write diagonal
     n=ngrid*nc*nc; // number of nonzeros in each band
-    fprintf(fp,"%d\n",n); // number of diagonal entries
+    fprintf(fp,INTFMT "\n",n); // number of diagonal entries
     for ( i = 0; i < n; ++i ) fprintf(fp, "%le\n", A->diag[i]);
     
     // write offdiags
@@ -1198,7 +1198,7 @@ void fasp_dstr_write (const char  *filename,
     while ( k-- ) {
         INT offset=offsets[nband-k-1];
         n=(ngrid-ABS(offset))*nc*nc; // number of nonzeros in each band
-        fprintf(fp,"%d  %d\n",offset,n); // read number band k
+        fprintf(fp,INTFMT "  " INTFMT "\n",offset,n); // read number band k
         for ( i = 0; i < n; ++i ) {
             fprintf(fp, "%le\n", A->offdiag[nband-k-1][i]);
         }
@@ -1240,7 +1240,7 @@ void fasp_dbsr_print (const char *filename,
     for ( i = 0; i < ROW; i++ ) {
         for ( k = ia[i]; k < ia[i+1]; k++ ) {
             j = ja[k];
-            fprintf(fp, "A[%d,%d]=\n", i, j);
+            fprintf(fp, "A[" INTFMT "," INTFMT "]=\n", i, j);
             for ( ind = 0; ind < nb2; ind++ ) {
                 fprintf(fp, "%+.10E  ", val[k*nb2+ind]);
             }
@@ -1281,25 +1281,25 @@ void fasp_dbsr_write (const char *filename,
 
     printf("%s: writing to file %s...\n", __FUNCTION__, filename);
     
-    fprintf(fp,"%d  %d  %d\n",ROW,COL,NNZ); // write dimension of the block matrix
+    fprintf(fp,INTFMT "  " INTFMT "  " INTFMT "\n",ROW,COL,NNZ); // write dimension of the block matrix
     
-    fprintf(fp,"%d\n",nb); // write the size of each block
+    fprintf(fp,INTFMT "\n",nb); // write the size of each block
     
-    fprintf(fp,"%d\n",storage_manner); // write storage manner of each block
+    fprintf(fp,INTFMT "\n",storage_manner); // write storage manner of each block
     
     // write A->IA
     n = ROW + 1; // length of A->IA
-    fprintf(fp,"%d\n",n); // length of A->IA
-    for ( i = 0; i < n; ++i ) fprintf(fp, "%d\n", ia[i]);
+    fprintf(fp,INTFMT "\n",n); // length of A->IA
+    for ( i = 0; i < n; ++i ) fprintf(fp, INTFMT "\n", ia[i]);
     
     // write A->JA
     n = NNZ; // length of A->JA
-    fprintf(fp, "%d\n", n); // length of A->JA
-    for ( i = 0; i < n; ++i ) fprintf(fp, "%d\n", ja[i]);
+    fprintf(fp, INTFMT "\n", n); // length of A->JA
+    for ( i = 0; i < n; ++i ) fprintf(fp, INTFMT "\n", ja[i]);
     
     // write A->val
     n = NNZ*nb*nb; // length of A->val
-    fprintf(fp, "%d\n", n); // length of A->val
+    fprintf(fp, INTFMT "\n", n); // length of A->val
     for ( i = 0; i < n; ++i ) fprintf(fp, "%le\n", val[i]);
     
     fclose(fp);
@@ -1327,7 +1327,7 @@ void fasp_dvec_write (const char  *filename,
 
     printf("%s: writing to file %s...\n", __FUNCTION__, filename);
     
-    fprintf(fp,"%d\n",m);
+    fprintf(fp,INTFMT "\n",m);
     
     for ( i = 0; i < m; ++i ) fprintf(fp,"%0.15e\n",vec->val[i]);
     
@@ -1360,9 +1360,9 @@ void fasp_dvecind_write (const char  *filename,
 
     printf("%s: writing to file %s...\n", __FUNCTION__, filename);
     
-    fprintf(fp,"%d\n",m);
+    fprintf(fp,INTFMT "\n",m);
     
-    for ( i = 0; i < m; ++i ) fprintf(fp,"%d %le\n",i,vec->val[i]);
+    for ( i = 0; i < m; ++i ) fprintf(fp,INTFMT " %le\n",i,vec->val[i]);
     
     fclose(fp);
 }
@@ -1394,10 +1394,10 @@ void fasp_ivec_write (const char  *filename,
     printf("%s: writing to file %s...\n", __FUNCTION__, filename);
     
     // write number of nonzeros
-    fprintf(fp,"%d\n",m);
+    fprintf(fp,INTFMT "\n",m);
     
     // write index and value each line
-    for ( i = 0; i < m; ++i ) fprintf(fp,"%d %d\n",i,vec->val[i]+1);
+    for ( i = 0; i < m; ++i ) fprintf(fp,INTFMT " " INTFMT "\n",i,vec->val[i]+1);
     
     fclose(fp);
 }
@@ -1421,7 +1421,7 @@ void fasp_dvec_print (const INT  n,
     
     if ( n <= 0 ) NumPrint = u->row; // print all
     
-    for ( i = 0; i < NumPrint; ++i ) printf("vec_%d = %15.10E\n",i,u->val[i]);
+    for ( i = 0; i < NumPrint; ++i ) printf("vec_" INTFMT " = %15.10E\n",i,u->val[i]);
 }
 
 /**
@@ -1443,7 +1443,7 @@ void fasp_ivec_print (const INT  n,
     
     if ( n <= 0 ) NumPrint = u->row; // print all
     
-    for ( i = 0; i < NumPrint; ++i ) printf("vec_%d = %d\n",i,u->val[i]);
+    for ( i = 0; i < NumPrint; ++i ) printf("vec_" INTFMT " = " INTFMT "\n",i,u->val[i]);
 }
 
 /**
@@ -1461,10 +1461,10 @@ void fasp_dcsr_print (const dCSRmat *A)
     const INT m=A->row, n=A->col;
     INT i, j;
     
-    printf("nrow = %d, ncol = %d, nnz = %d\n",m,n,A->nnz);
+    printf("nrow = " INTFMT ", ncol = " INTFMT ", nnz = " INTFMT "\n",m,n,A->nnz);
     for ( i = 0; i < m; ++i ) {
         for (j=A->IA[i]; j<A->IA[i+1]; j++)
-            printf("A_(%d,%d) = %+.10E\n",i,A->JA[j],A->val[j]);
+            printf("A_(" INTFMT "," INTFMT ") = %+.10E\n",i,A->JA[j],A->val[j]);
     }
 }
 
@@ -1482,9 +1482,9 @@ void fasp_dcoo_print (const dCOOmat *A)
 {
     INT k;
     
-    printf("nrow = %d, ncol = %d, nnz = %d\n",A->row,A->col,A->nnz);
+    printf("nrow = " INTFMT ", ncol = " INTFMT ", nnz = " INTFMT "\n",A->row,A->col,A->nnz);
     for ( k = 0; k < A->nnz; k++ ) {
-        printf("A_(%d,%d) = %+.10E\n",A->rowind[k],A->colind[k],A->val[k]);
+        printf("A_(" INTFMT "," INTFMT ") = %+.10E\n",A->rowind[k],A->colind[k],A->val[k]);
     }
 }
 
@@ -1515,26 +1515,26 @@ void fasp_dbsr_write_coo (const char    *filename,
     if ( fp == NULL ) fasp_chkerr(ERROR_OPEN_FILE, filename);
 
 #if DEBUG_MODE > PRINT_MIN
-    printf("### DEBUG: nrow = %d, ncol = %d, nnz = %d, nb = %d\n",
+    printf("### DEBUG: nrow = " INTFMT ", ncol = " INTFMT ", nnz = " INTFMT ", nb = " INTFMT "\n",
            A->ROW, A->COL, A->NNZ, A->nb);
-    printf("### DEBUG: storage_manner = %d\n", A->storage_manner);
+    printf("### DEBUG: storage_manner = " INTFMT "\n", A->storage_manner);
 #endif
     
     printf("%s: writing to file %s...\n", __FUNCTION__, filename);
     
     // write dimension of the block matrix
-    fprintf(fp,"%% dimension of the block matrix and nonzeros %d  %d  %d\n",
+    fprintf(fp,"%% dimension of the block matrix and nonzeros " INTFMT "  " INTFMT "  " INTFMT "\n",
             A->ROW,A->COL,A->NNZ);
     // write the size of each block
-    fprintf(fp,"%% the size of each block %d\n",A->nb);
+    fprintf(fp,"%% the size of each block " INTFMT "\n",A->nb);
     // write storage manner of each block
-    fprintf(fp,"%% storage manner of each block %d\n",A->storage_manner);
+    fprintf(fp,"%% storage manner of each block " INTFMT "\n",A->storage_manner);
     
     for ( i = 0; i < A->ROW; i++ ) {
         for ( j = A->IA[i]; j < A->IA[i+1]; j++ ) {
             for ( k = 0; k < A->nb; k++ ) {
                 for ( l = 0; l < A->nb; l++ ) {
-                    fprintf(fp, "%d %d %+.10E\n",
+                    fprintf(fp, INTFMT " " INTFMT " %+.10E\n",
                             i*nb+k+1, A->JA[j]*nb+l+1, A->val[ j*nb2+k*nb+l]);
                 }
             }
@@ -1562,7 +1562,7 @@ void fasp_dcsr_write_coo (const char    *filename,
     INT i, j;
 
 #if DEBUG_MODE > PRINT_MIN
-    printf("nrow = %d, ncol = %d, nnz = %d\n", A->row, A->col, A->nnz);
+    printf("nrow = " INTFMT ", ncol = " INTFMT ", nnz = " INTFMT "\n", A->row, A->col, A->nnz);
 #endif
 
     FILE *fp = fopen(filename,"w");
@@ -1572,12 +1572,12 @@ void fasp_dcsr_write_coo (const char    *filename,
     printf("%s: writing to file %s...\n", __FUNCTION__, filename);
     
     // write dimension of the block matrix
-    fprintf(fp,"%% dimension of the block matrix and nonzeros %d  %d  %d\n",
+    fprintf(fp,"%% dimension of the block matrix and nonzeros " INTFMT "  " INTFMT "  " INTFMT "\n",
             A->row,A->col,A->nnz);
     
     for ( i = 0; i < A->row; i++ ) {
         for ( j = A->IA[i]; j < A->IA[i+1]; j++ ) {
-            fprintf(fp, "%d %d %+.10E\n", i+1, A->JA[j]+1, A->val[j]);
+            fprintf(fp, INTFMT " " INTFMT " %+.10E\n", i+1, A->JA[j]+1, A->val[j]);
         }
     }
     
@@ -1627,6 +1627,7 @@ void fasp_dstr_print (const dSTRmat *A)
  * \date   12/24/2012
  *
  * Modified by Chensong Zhang on 05/01/2013
+ * Modified by FASP team on 10/16/2026: read the header as int and check the INT length
  */
 void fasp_matrix_read (const char  *filename,
                        void        *A)
@@ -1642,7 +1643,7 @@ void fasp_matrix_read (const char  *filename,
     
     printf("%s: reading file %s...\n", __FUNCTION__, filename);
     
-    status = fread(&index, sizeof(INT), 1, fp);
+    status = fread(&index, sizeof(int), 1, fp);
     fasp_chkerr(status, filename);
 
     // matrix stored in ASCII format
@@ -1689,13 +1690,18 @@ void fasp_matrix_read (const char  *filename,
     // test Endian consistence of machine and file
     EndianFlag = index;
     
-    status = fread(&index, sizeof(INT), 1, fp);
+    status = fread(&index, sizeof(int), 1, fp);
     fasp_chkerr(status, filename);
 
-    index = endian_convert_int(index, sizeof(INT), EndianFlag);
+    index = endian_convert_int(index, sizeof(int), EndianFlag);
     flag = (INT) index/100;
     ilength = (INT) (index - flag*100)/10;
     dlength = index%10;
+
+    if ( ilength > (int)sizeof(INT) ) { // fread would overflow INT variables
+        printf("### ERROR: %s has %d-byte INT, build with USE_INT64!\n", filename, ilength);
+        fasp_chkerr(ERROR_WRONG_FILE, __FUNCTION__);
+    }
     
     switch (flag) {
         case 1:
@@ -1736,6 +1742,7 @@ void fasp_matrix_read (const char  *filename,
  * \date   04/14/2013
  *
  * Modified by Chensong Zhang on 05/01/2013: Use it to read binary files!!!
+ * Modified by FASP team on 10/16/2026: read the header as int and check the INT length
  */
 void fasp_matrix_read_bin (const char *filename,
                            void       *A)
@@ -1750,14 +1757,19 @@ void fasp_matrix_read_bin (const char *filename,
 
     printf("%s: reading file %s...\n", __FUNCTION__, filename);
     
-    status = fread(&index, sizeof(INT), 1, fp);
+    status = fread(&index, sizeof(int), 1, fp);
     fasp_chkerr(status, filename);
 
-    index = endian_convert_int(index, sizeof(INT), EndianFlag);
+    index = endian_convert_int(index, sizeof(int), EndianFlag);
     
     flag = (INT) index/100;
     ilength = (int) (index - flag*100)/10;
     dlength = index%10;
+
+    if ( ilength > (int)sizeof(INT) ) { // fread would overflow INT variables
+        printf("### ERROR: %s has %d-byte INT, build with USE_INT64!\n", filename, ilength);
+        fasp_chkerr(ERROR_WRONG_FILE, __FUNCTION__);
+    }
     
     switch (flag) {
         case 1:
@@ -1809,6 +1821,8 @@ void fasp_matrix_read_bin (const char *filename,
  *
  * \author Ziteng Wang
  * \date   12/24/2012
+ *
+ * Modified by FASP team on 10/16/2026: write the header as int
  */
 void fasp_matrix_write (const char *filename,
                         void       *A,
@@ -1829,9 +1843,9 @@ void fasp_matrix_write (const char *filename,
 
         printf("%s: writing to file %s...\n", __FUNCTION__, filename);
         
-        fprintf(fp,"%d%d%d%d\n",fileflag,fileflag,fileflag,fileflag);
+        fprintf(fp,INTFMT INTFMT INTFMT INTFMT "\n",fileflag,fileflag,fileflag,fileflag);
         
-        fprintf(fp,"%d%d%d\n",matrixflag,(int)sizeof(INT),(int)sizeof(REAL));
+        fprintf(fp,INTFMT "%d%d\n",matrixflag,(int)sizeof(INT),(int)sizeof(REAL));
         
         switch (matrixflag) {
             case 1:
@@ -1844,7 +1858,7 @@ void fasp_matrix_write (const char *filename,
                 fasp_dstr_write_s(fp, (dSTRmat *)A);
                 break;
             default:
-                printf("### WARNING: Unknown matrix flag %d\n", matrixflag);
+                printf("### WARNING: Unknown matrix flag " INTFMT "\n", matrixflag);
        }
         fclose(fp);
         return;
@@ -1857,8 +1871,8 @@ void fasp_matrix_write (const char *filename,
 
     printf("%s: writing to file %s...\n", __FUNCTION__, filename);
     
-    INT putflag = fileflag*100 + sizeof(INT)*10 + sizeof(REAL);
-    fwrite(&putflag,sizeof(INT),1,fp);
+    int putflag = fileflag*100 + sizeof(INT)*10 + sizeof(REAL);
+    fwrite(&putflag,sizeof(int),1,fp);
     
     switch (matrixflag) {
         case 1:
@@ -1871,7 +1885,7 @@ void fasp_matrix_write (const char *filename,
             fasp_dstr_write_b(fp, (dSTRmat *)A);
             break;
         default:
-            printf("### WARNING: Unknown matrix flag %d\n", matrixflag);
+            printf("### WARNING: Unknown matrix flag " INTFMT "\n", matrixflag);
     }
     
     fclose(fp);
@@ -1901,6 +1915,8 @@ void fasp_matrix_write (const char *filename,
  *
  * \author Ziteng Wang
  * \date   12/24/2012
+ *
+ * Modified by FASP team on 10/16/2026: read the header as int and check the INT length
  */
 void fasp_vector_read (const char *filerhs,
                        void       *b)
@@ -1915,7 +1931,7 @@ void fasp_vector_read (const char *filerhs,
 
     printf("%s: reading file %s...\n", __FUNCTION__, filerhs);
     
-    status = fread(&index, sizeof(INT), 1, fp);
+    status = fread(&index, sizeof(int), 1, fp);
     fasp_chkerr(status, filerhs);
 
     // vector stored in ASCII
@@ -1952,13 +1968,18 @@ void fasp_vector_read (const char *filerhs,
     
     // vector stored in binary
     EndianFlag = index;
-    status = fread(&index, sizeof(INT), 1, fp);
+    status = fread(&index, sizeof(int), 1, fp);
     fasp_chkerr(status, filerhs);
 
-    index = endian_convert_int(index, sizeof(INT), EndianFlag);
+    index = endian_convert_int(index, sizeof(int), EndianFlag);
     flag = (int) index/100;
     ilength = (int) (index-100*flag)/10;
     dlength = index%10;
+
+    if ( ilength > (int)sizeof(INT) ) { // fread would overflow INT variables
+        printf("### ERROR: %s has %d-byte INT, build with USE_INT64!\n", filerhs, ilength);
+        fasp_chkerr(ERROR_WRONG_FILE, __FUNCTION__);
+    }
     
     switch (flag) {
         case 1:
@@ -2009,6 +2030,7 @@ void fasp_vector_read (const char *filerhs,
  * \date   12/24/2012
  *
  * Modified by Chensong Zhang on 05/02/2013: fix a bug when writing in binary format
+ * Modified by FASP team on 10/16/2026: write the header as int
  */
 void fasp_vector_write (const char *filerhs,
                         void       *b,
@@ -2029,9 +2051,9 @@ void fasp_vector_write (const char *filerhs,
 
         printf("%s: writing to file %s...\n", __FUNCTION__, filerhs);
         
-        fprintf(fp,"%d%d%d%d\n",fileflag,fileflag,fileflag,fileflag);
+        fprintf(fp,INTFMT INTFMT INTFMT INTFMT "\n",fileflag,fileflag,fileflag,fileflag);
         
-        fprintf(fp,"%d%d%d\n",vectorflag,(int)sizeof(INT),(int)sizeof(REAL));
+        fprintf(fp,INTFMT "%d%d\n",vectorflag,(int)sizeof(INT),(int)sizeof(REAL));
         
         switch (vectorflag) {
             case 1:
@@ -2047,7 +2069,7 @@ void fasp_vector_write (const char *filerhs,
                 fasp_ivecind_write_s(fp, (ivector *)b);
                 break;
             default:
-                printf("### WARNING: Unknown vector flag %d\n", vectorflag);
+                printf("### WARNING: Unknown vector flag " INTFMT "\n", vectorflag);
         }
 
         fclose(fp);
@@ -2061,8 +2083,8 @@ void fasp_vector_write (const char *filerhs,
 
     printf("%s: writing to file %s...\n", __FUNCTION__, filerhs);
     
-    INT putflag = vectorflag*100 + sizeof(INT)*10 + sizeof(REAL);
-    fwrite(&putflag,sizeof(INT),1,fp);
+    int putflag = vectorflag*100 + sizeof(INT)*10 + sizeof(REAL);
+    fwrite(&putflag,sizeof(int),1,fp);
     
     switch (vectorflag) {
         case 1:
@@ -2078,7 +2100,7 @@ void fasp_vector_write (const char *filerhs,
             fasp_ivecind_write_b(fp, (ivector *)b);
             break;
         default:
-            printf("### WARNING: Unknown vector flag %d\n", vectorflag);
+            printf("### WARNING: Unknown vector flag " INTFMT "\n", vectorflag);
     }
     
     fclose(fp);
@@ -28,7 +28,7 @@ static inline void skip_comments (FILE * fp)
 {
     while ( 1 ) {
         char  buffer[500];
-        int   loc = ftell(fp); // record the current position
+        long  loc = ftell(fp); // record the current position
         int   val = fscanf(fp,"%s",buffer); // read in a string
         if ( val!=1 || val==EOF ) {
             printf("### ERROR: Could not get any data!\n");
@@ -60,21 +60,29 @@ static inline void skip_comments (FILE * fp)
  *
  * \author Ziteng Wang
  * \date   2012-12-24
+ *
+ * Modified by FASP team on 10/16/2026: only use the first ilength bytes of inum,
+ * which are filled by fread, so that ilength can be less than sizeof(INT)
  */
 static inline INT endian_convert_int (const INT  inum,
                                       const INT  ilength,
                                       const INT  EndianFlag)
 {
-    INT iretVal = 0, i;
-    char *intToConvert = ( char * ) & inum;
-    char *returnInt = ( char * ) & iretVal;
-    
-    if ( EndianFlag == 1 ) return inum;
-    else {
-        for (i = 0; i < ilength; i++) {
-            returnInt[i] = intToConvert[ilength-i-1];
-        }
-        return iretVal;
+    const char *intToConvert = ( const char * ) & inum;
+    char        buffer[sizeof(LONGLONG)];
+    short       i2;
+    int         i4;
+    LONGLONG    i8;
+    INT         i;
+    
+    for (i = 0; i < ilength; i++) {
+        buffer[i] = ( EndianFlag == 1 ) ? intToConvert[i] : intToConvert[ilength-i-1];
+    }
+
+    switch ( ilength ) {
+        case 2:  memcpy(&i2, buffer, 2); return (INT)i2;
+        case 4:  memcpy(&i4, buffer, 4); return (INT)i4;
+        default: memcpy(&i8, buffer, 8); return (INT)i8;
     }
 }
 
@@ -120,12 +128,12 @@ static inline void fasp_dcsr_read_s (FILE        *fp,
     REAL  ddata;
     
     // Read CSR matrix
-    status = fscanf(fp, "%d", &m);
+    status = fscanf(fp, INTFMT, &m);
     A->row=m;
     
     A->IA = (INT *)fasp_mem_calloc(m+1, sizeof(INT));
     for ( i = 0; i <= m; ++i ) {
-        status = fscanf(fp, "%d", &idata);
+        status = fscanf(fp, INTFMT, &idata);
         A->IA[i] = idata;
     }
     
@@ -135,7 +143,7 @@ static inline void fasp_dcsr_read_s (FILE        *fp,
     A->val = (REAL*)fasp_mem_calloc(nnz, sizeof(REAL));
     
     for ( i = 0; i < nnz; ++i ) {
-        status = fscanf(fp, "%d", &idata);
+        status = fscanf(fp, INTFMT, &idata);
         A->JA[i] = idata;
     }
     
@@ -191,12 +199,12 @@ static inline void fasp_dcoo_read_s (FILE        *fp,
     REAL  value;
     int   status;
     
-    status = fscanf(fp,"%d %d %d",&m,&n,&nnz);
+    status = fscanf(fp,INTFMT " " INTFMT " " INTFMT,&m,&n,&nnz);
     
     dCOOmat Atmp = fasp_dcoo_create(m,n,nnz);
     
     for ( k = 0; k < nnz; k++ ) {
-        status = fscanf(fp, "%d %d %le", &i, &j, &value);
+        status = fscanf(fp, INTFMT " " INTFMT " %le", &i, &j, &value);
         if ( status != EOF ) {
             Atmp.rowind[k] = i;
             Atmp.colind[k] = j;
@@ -264,15 +272,15 @@ static inline void fasp_dbsr_read_s (FILE        *fp,
     REAL  value;
     int   status;
     
-    status = fscanf(fp, "%d %d %d", &ROW,&COL,&NNZ); // read dimension of the problem
+    status = fscanf(fp, INTFMT " " INTFMT " " INTFMT, &ROW,&COL,&NNZ); // read dimension of the problem
     fasp_chkerr(status, __FUNCTION__);
     A->ROW = ROW; A->COL = COL; A->NNZ = NNZ;
     
-    status = fscanf(fp, "%d", &nb); // read the size
+    status = fscanf(fp, INTFMT, &nb); // read the size
     fasp_chkerr(status, __FUNCTION__);
     A->nb = nb;
     
-    status = fscanf(fp, "%d", &storage_manner); // read the storage_manner
+    status = fscanf(fp, INTFMT, &storage_manner); // read the storage_manner
     fasp_chkerr(status, __FUNCTION__);
     A->storage_manner = storage_manner;
     
@@ -280,27 +288,27 @@ static inline void fasp_dbsr_read_s (FILE        *fp,
     fasp_dbsr_alloc(ROW, COL, NNZ, nb, storage_manner, A);
     
     // read IA
-    status = fscanf(fp, "%d", &n);
+    status = fscanf(fp, INTFMT, &n);
     fasp_chkerr(status, __FUNCTION__);
 
     for ( i = 0; i < n; ++i ) {
-        status = fscanf(fp, "%d", &index);
+        status = fscanf(fp, INTFMT, &index);
         fasp_chkerr(status, __FUNCTION__);
         A->IA[i] = index;
     }
     
     // read JA
-    status = fscanf(fp, "%d", &n);
+    status = fscanf(fp, INTFMT, &n);
     fasp_chkerr(status, __FUNCTION__);
 
     for ( i = 0; i < n; ++i ){
-        status = fscanf(fp, "%d", &index);
+        status = fscanf(fp, INTFMT, &index);
         fasp_chkerr(status, __FUNCTION__);
         A->JA[i] = index;
     }
     
     // read val
-    status = fscanf(fp, "%d", &n);
+    status = fscanf(fp, INTFMT, &n);
     fasp_chkerr(status, __FUNCTION__);
 
     for ( i = 0; i < n; ++i ) {
@@ -381,25 +389,25 @@ static inline void fasp_dstr_read_s (FILE        *fp,
     REAL  value;
     int   status;
     
-    status = fscanf(fp,"%d %d %d",&nx,&ny,&nz); // read dimension of the problem
+    status = fscanf(fp,INTFMT " " INTFMT " " INTFMT,&nx,&ny,&nz); // read dimension of the problem
     fasp_chkerr(status, __FUNCTION__);
     A->nx = nx; A->ny = ny; A->nz = nz;
     
     nxy = nx*ny; ngrid = nxy*nz;
     A->nxy = nxy; A->ngrid = ngrid;
     
-    status = fscanf(fp,"%d",&nc); // read number of components
+    status = fscanf(fp,INTFMT,&nc); // read number of components
     fasp_chkerr(status, __FUNCTION__);
     A->nc = nc;
     
-    status = fscanf(fp,"%d",&nband); // read number of bands
+    status = fscanf(fp,INTFMT,&nband); // read number of bands
     fasp_chkerr(status, __FUNCTION__);
     A->nband = nband;
     
     A->offsets=(INT*)fasp_mem_calloc(nband, ilength);
     
     // read diagonal
-    status = fscanf(fp, "%d", &n);
+    status = fscanf(fp, INTFMT, &n);
     fasp_chkerr(status, __FUNCTION__);
     A->diag=(REAL *)fasp_mem_calloc(n, sizeof(REAL));
     for ( i = 0; i < n; ++i ) {
@@ -412,7 +420,7 @@ static inline void fasp_dstr_read_s (FILE        *fp,
     k = nband;
     A->offdiag=(REAL **)fasp_mem_calloc(nband, sizeof(REAL *));
     while ( k-- ) {
-        status = fscanf(fp,"%d %d",&offset,&n); // read number band k
+        status = fscanf(fp,INTFMT " " INTFMT,&offset,&n); // read number band k
         fasp_chkerr(status, __FUNCTION__);
         A->offsets[nband-k-1]=offset;
         
@@ -505,14 +513,14 @@ static inline void fasp_dmtx_read_s (FILE        *fp,
     REAL  value;
     int   status;
     
-    status = fscanf(fp,"%d %d %d",&m,&n,&nnz);
+    status = fscanf(fp,INTFMT " " INTFMT " " INTFMT,&m,&n,&nnz);
     
     dCOOmat Atmp=fasp_dcoo_create(m,n,nnz);
     
     innz = 0;
     
     while (innz < nnz) {
-        status = fscanf(fp, "%d %d %le", &i, &j, &value);
+        status = fscanf(fp, INTFMT " " INTFMT " %le", &i, &j, &value);
         if ( status != EOF ) {
             Atmp.rowind[innz]=i-1;
             Atmp.colind[innz]=j-1;
@@ -583,7 +591,7 @@ static inline void fasp_dmtxsym_read_s (FILE        *fp,
     REAL  value;
     int   status;
     
-    status = fscanf(fp,"%d %d %d",&m,&n,&nnz);
+    status = fscanf(fp,INTFMT " " INTFMT " " INTFMT,&m,&n,&nnz);
     
     nnz = 2*(nnz-m) + m; // adjust for sym problem
     
@@ -592,7 +600,7 @@ static inline void fasp_dmtxsym_read_s (FILE        *fp,
     innz = 0;
     
     while (innz < nnz) {
-        status = fscanf(fp, "%d %d %le", &i, &j, &value);
+        status = fscanf(fp, INTFMT " " INTFMT " %le", &i, &j, &value);
         if ( status != EOF ) {
             if (i==j) {
                 Atmp.rowind[innz]=i-1;
@@ -624,7 +632,7 @@ static inline void fasp_dmtxsym_read_b (FILE        *fp,
 {
     INT     m,n,nnz;
     INT     innz;
-    INT     index[2];
+    INT     index[2] = {0, 0};
     REAL    value;
     size_t  status;
     
@@ -646,7 +654,8 @@ static inline void fasp_dmtxsym_read_b (FILE        *fp,
     innz = 0;
     
     while (innz < nnz) {
-        if ( fread(index, ilength, 2, fp) !=EOF ) {
+        if ( fread(&index[0], ilength, 1, fp) !=EOF &&
+             fread(&index[1], ilength, 1, fp) !=EOF ) {
             
             if (index[0]==index[1]) {
                 INT indextemp = index[0];
@@ -690,11 +699,11 @@ static inline void fasp_dcsr_write_s (FILE        *fp,
     const INT m=A->row, n=A->col;
     INT i;
     
-    fprintf(fp,"%d  %d  %d\n",m,n,A->nnz);
+    fprintf(fp,INTFMT "  " INTFMT "  " INTFMT "\n",m,n,A->nnz);
     
-    for ( i = 0; i < m+1; ++i ) fprintf(fp,"%d\n", A->IA[i]);
+    for ( i = 0; i < m+1; ++i ) fprintf(fp,INTFMT "\n", A->IA[i]);
     
-    for ( i = 0; i < A->nnz; ++i ) fprintf(fp,"%d\n", A->JA[i]);
+    for ( i = 0; i < A->nnz; ++i ) fprintf(fp,INTFMT "\n", A->JA[i]);
     
     for ( i = 0; i < A->nnz; ++i ) fprintf(fp,"%le\n", A->val[i]);
 }
@@ -735,25 +744,25 @@ static inline void fasp_dbsr_write_s (FILE        *fp,
     
     INT i, n;
     
-    fprintf(fp,"%d  %d  %d\n",ROW,COL,NNZ); // write dimension of the block matrix
+    fprintf(fp,INTFMT "  " INTFMT "  " INTFMT "\n",ROW,COL,NNZ); // write dimension of the block matrix
     
-    fprintf(fp,"%d\n",nb); // write the size
+    fprintf(fp,INTFMT "\n",nb); // write the size
     
-    fprintf(fp,"%d\n",storage_manner); // write storage manner
+    fprintf(fp,INTFMT "\n",storage_manner); // write storage manner
     
     // write A->IA
     n = ROW+1; // length of A->IA
-    fprintf(fp,"%d\n",n); // length of A->IA
-    for ( i = 0; i < n; ++i ) fprintf(fp, "%d\n", ia[i]);
+    fprintf(fp,INTFMT "\n",n); // length of A->IA
+    for ( i = 0; i < n; ++i ) fprintf(fp, INTFMT "\n", ia[i]);
     
     // write A->JA
     n = NNZ; // length of A->JA
-    fprintf(fp, "%d\n", n); // length of A->JA
-    for ( i = 0; i < n; ++i ) fprintf(fp, "%d\n", ja[i]);
+    fprintf(fp, INTFMT "\n", n); // length of A->JA
+    for ( i = 0; i < n; ++i ) fprintf(fp, INTFMT "\n", ja[i]);
     
     // write A->val
     n = NNZ*nb*nb; // length of A->val
-    fprintf(fp, "%d\n", n); // length of A->val
+    fprintf(fp, INTFMT "\n", n); // length of A->val
     for ( i = 0; i < n; ++i ) fprintf(fp, "%le\n", val[i]);
 }
 
@@ -814,15 +823,15 @@ static inline void fasp_dstr_write_s (FILE        *fp,
     
     INT i, k, n;
     
-    fprintf(fp,"%d  %d  %d\n",nx,ny,nz); // write dimension of the problem
+    fprintf(fp,INTFMT "  " INTFMT "  " INTFMT "\n",nx,ny,nz); // write dimension of the problem
     
-    fprintf(fp,"%d\n",nc); // read number of components
+    fprintf(fp,INTFMT "\n",nc); // read number of components
     
-    fprintf(fp,"%d\n",nband); // write number of bands
+    fprintf(fp,INTFMT "\n",nband); // write number of bands
     
     // write diagonal
     n=ngrid*nc*nc; // number of nonzeros in each band
-    fprintf(fp,"%d\n",n); // number of diagonal entries
+    fprintf(fp,INTFMT "\n",n); // number of diagonal entries
     for ( i = 0; i < n; ++i ) fprintf(fp, "%le\n", A->diag[i]);
     
     // write offdiags
@@ -830,7 +839,7 @@ static inline void fasp_dstr_write_s (FILE        *fp,
     while ( k-- ) {
         INT offset=offsets[nband-k-1];
         n=(ngrid-ABS(offset))*nc*nc; // number of nonzeros in each band
-        fprintf(fp,"%d  %d\n",offset,n); // read number band k
+        fprintf(fp,INTFMT "  " INTFMT "\n",offset,n); // read number band k
         for ( i = 0; i < n; ++i ) {
             fprintf(fp, "%le\n", A->offdiag[nband-k-1][i]);
         }
@@ -889,7 +898,7 @@ static inline void fasp_dvec_read_s (FILE        *fp,
     REAL  value;
     INT   status;
     
-    status = fscanf(fp,"%d",&n);
+    status = fscanf(fp,INTFMT,&n);
     fasp_dvec_alloc(n,b);
     
     for ( i = 0; i < n; ++i ) {
@@ -926,11 +935,11 @@ static inline void fasp_ivec_read_s (FILE        *fp,
     INT   i, n, value;
     INT   status;
     
-    status = fscanf(fp,"%d",&n);
+    status = fscanf(fp,INTFMT,&n);
     fasp_ivec_alloc(n,b);
     
     for ( i = 0; i < n; ++i ) {
-        status = fscanf(fp, "%d", &value);
+        status = fscanf(fp, INTFMT, &value);
         b->val[i] = value;
     }
 
@@ -964,11 +973,11 @@ static inline void fasp_dvecind_read_s (FILE        *fp,
     REAL  value;
     INT   status;
     
-    status = fscanf(fp,"%d",&n);
+    status = fscanf(fp,INTFMT,&n);
     fasp_dvec_alloc(n,b);
     
     for ( i = 0; i < n; ++i ) {
-        status = fscanf(fp, "%d %le", &index, &value);
+        status = fscanf(fp, INTFMT " %le", &index, &value);
         b->val[index] = value;
     }
 
@@ -1008,13 +1017,13 @@ static inline void fasp_ivecind_read_s (FILE        *fp,
     INT   i, n, index, value;
     int   status;
     
-    status = fscanf(fp,"%d",&n);
+    status = fscanf(fp,INTFMT,&n);
     fasp_chkerr(status, __FUNCTION__);
 
     fasp_ivec_alloc(n,b);
     
     for ( i = 0; i < n; ++i ) {
-        status = fscanf(fp, "%d %d", &index, &value);
+        status = fscanf(fp, INTFMT " " INTFMT, &index, &value);
         fasp_chkerr(status, __FUNCTION__);
         b->val[index] = value;
     }
@@ -1050,7 +1059,7 @@ static inline void fasp_dvec_write_s (FILE        *fp,
 {
     INT m = vec->row, i;
     
-    fprintf(fp,"%d\n",m);
+    fprintf(fp,INTFMT "\n",m);
     
     for ( i = 0; i < m; ++i ) fprintf(fp,"%le\n",vec->val[i]);
 }
@@ -1074,9 +1083,9 @@ static inline void fasp_ivec_write_s (FILE        *fp,
 {
     INT m = vec->row, i;
     
-    fprintf(fp,"%d\n",m);
+    fprintf(fp,INTFMT "\n",m);
     
-    for ( i = 0; i < m; ++i ) fprintf(fp,"%d %d\n",i,vec->val[i]);
+    for ( i = 0; i < m; ++i ) fprintf(fp,INTFMT " " INTFMT "\n",i,vec->val[i]);
 }
 
 static inline void fasp_ivec_write_b (FILE        *fp,
@@ -1098,9 +1107,9 @@ static inline void fasp_dvecind_write_s (FILE        *fp,
 {
     INT m = vec->row, i;
     
-    fprintf(fp,"%d\n",m);
+    fprintf(fp,INTFMT "\n",m);
     
-    for ( i = 0; i < m; ++i ) fprintf(fp,"%d %le\n",i,vec->val[i]);
+    for ( i = 0; i < m; ++i ) fprintf(fp,INTFMT " %le\n",i,vec->val[i]);
 }
 
 static inline void fasp_dvecind_write_b (FILE        *fp,
@@ -1138,9 +1147,9 @@ static inline void fasp_ivecind_write_s (FILE        *fp,
 {
     INT m = vec->row, i;
     
-    fprintf(fp,"%d\n",m);
+    fprintf(fp,INTFMT "\n",m);
     
-    for ( i = 0; i < m; ++i ) fprintf(fp, "%d %d\n", i, vec->val[i]);
+    for ( i = 0; i < m; ++i ) fprintf(fp, INTFMT " " INTFMT "\n", i, vec->val[i]);
 }
 
 /*---------------------------------*/
@@ -451,7 +451,7 @@ void fasp_smat_inv_nc (REAL      *a,
         
         if (ABS(a[l]) < SMALLREAL) {
             printf("### ERROR: Diagonal entry is close to zero! ");
-            printf("diag_%d = %.2e! [%s]\n", k, a[l], __FUNCTION__);
+            printf("diag_" INTFMT " = %.2e! [%s]\n", k, a[l], __FUNCTION__);
             exit(ERROR_SOLVER_EXIT);
         }
         alinv = 1.0/a[l];
@@ -41,6 +41,8 @@
  *
  * \author Xiaozhe Hu
  * \date   10/26/2010
+ *
+ * Modified by FASP team on 10/16/2026: first touch by all threads if it is on
  */
 dBSRmat fasp_dbsr_create (const INT  ROW,
                           const INT  COL,
@@ -51,21 +53,21 @@ dBSRmat fasp_dbsr_create (const INT  ROW,
     dBSRmat A;
     
     if ( ROW > 0 ) {
-        A.IA = (INT*)fasp_mem_calloc(ROW+1, sizeof(INT));
+        A.IA = (INT*)fasp_mem_calloc_numa(ROW+1, sizeof(INT));
     }
     else {
         A.IA = NULL;
     }
     
     if ( NNZ > 0 ) {
-        A.JA = (INT*)fasp_mem_calloc(NNZ ,sizeof(INT));
+        A.JA = (INT*)fasp_mem_calloc_numa(NNZ ,sizeof(INT));
     }
     else {
         A.JA = NULL;
     }
     
     if ( nb > 0 && NNZ > 0) {
-        A.val = (REAL*)fasp_mem_calloc(NNZ*nb*nb, sizeof(REAL));
+        A.val = (REAL*)fasp_mem_calloc_numa(NNZ*nb*nb, sizeof(REAL));
     }
     else {
         A.val = NULL;
@@ -95,6 +97,8 @@ dBSRmat fasp_dbsr_create (const INT  ROW,
  *
  * \author Xiaozhe Hu
  * \date   10/26/2010
+ *
+ * Modified by FASP team on 10/16/2026: first touch by all threads if it is on
  */
 void fasp_dbsr_alloc (const INT  ROW,
                       const INT  COL,
@@ -104,21 +108,21 @@ void fasp_dbsr_alloc (const INT  ROW,
                       dBSRmat   *A)
 {
     if ( ROW > 0 ) {
-        A->IA = (INT*)fasp_mem_calloc(ROW+1, sizeof(INT));
+        A->IA = (INT*)fasp_mem_calloc_numa(ROW+1, sizeof(INT));
     }
     else {
         A->IA = NULL;
     }
 
     if ( NNZ > 0 ) {
-        A->JA = (INT*)fasp_mem_calloc(NNZ, sizeof(INT));
+        A->JA = (INT*)fasp_mem_calloc_numa(NNZ, sizeof(INT));
     }
     else {
         A->JA = NULL;
     }
 
     if ( nb > 0 ) {
-        A->val = (REAL*)fasp_mem_calloc(NNZ*nb*nb, sizeof(REAL));
+        A->val = (REAL*)fasp_mem_calloc_numa(NNZ*nb*nb, sizeof(REAL));
     }
     else {
         A->val = NULL;
@@ -2190,7 +2194,7 @@ INT fasp_dbsr_merge_col (dBSRmat *A)
                             // add jj col to j
                             for ( ii=0; ii <nb2; ii++ )
                                 A_data[j*nb2 +ii] += A_data[ jj*nb2+ii];
-                            printf("### WARNING: Same col indices at %d, col %d (%d %d)!\n",
+                            printf("### WARNING: Same col indices at " INTFMT ", col " INTFMT " (" INTFMT " " INTFMT ")!\n",
                                    i, A_j[j], j, jj );
                             A_j[jj] = -1;
                             count ++;
@@ -2221,7 +2225,7 @@ INT fasp_dbsr_merge_col (dBSRmat *A)
         A-> NNZ = jj;
         fasp_mem_free(tempA_i); tempA_i = NULL;
         
-        printf("### WARNING: %d col indices have been merged!\n", count);
+        printf("### WARNING: " INTFMT " col indices have been merged!\n", count);
     }
     
     return count;
@@ -4,7 +4,7 @@
  *
  *  \note  This file contains Level-1 (Bla) functions. It requires:
  *         AuxArray.c, AuxMemory.c, AuxMessage.c, AuxSort.c, AuxThreads.c,
- *         AuxVector.c, and BlaSpmvCSR.c
+ *         AuxVector.c, BlaSpmvCSR.c, and BlaStrengthCSR.c
  *
  *---------------------------------------------------------------------------------
  *  Copyright (C) 2009--2020 by the FASP team. All rights reserved.
@@ -22,10 +22,6 @@
 #include "fasp.h"
 #include "fasp_functs.h"
 
-#if MULTI_COLOR_ORDER
-static void generate_S_theta(dCSRmat *, iCSRmat *, REAL);
-#endif 
-
 /*---------------------------------*/
 /*--      Public Functions       --*/
 /*---------------------------------*/
@@ -43,6 +39,8 @@ static void generate_S_theta(dCSRmat *, iCSRmat *, REAL);
  *
  * \author Chensong Zhang
  * \date   2010/04/06
+ *
+ * Modified by FASP team on 10/16/2026: first touch by all threads if it is on
  */
 dCSRmat fasp_dcsr_create(const INT m,
                          const INT n,
@@ -51,21 +49,21 @@ dCSRmat fasp_dcsr_create(const INT m,
     dCSRmat A;
     
     if ( m > 0 ) {
-        A.IA = (INT *)fasp_mem_calloc(m+1, sizeof(INT));
+        A.IA = (INT *)fasp_mem_calloc_numa(m+1, sizeof(INT));
     }
     else {
         A.IA = NULL;
     }
     
     if ( n > 0 ) {
-        A.JA = (INT *)fasp_mem_calloc(nnz, sizeof(INT));
+        A.JA = (INT *)fasp_mem_calloc_numa(nnz, sizeof(INT));
     }
     else {
         A.JA = NULL;
     }
     
     if ( nnz > 0 ) {
-        A.val = (REAL *)fasp_mem_calloc(nnz, sizeof(REAL));
+        A.val = (REAL *)fasp_mem_calloc_numa(nnz, sizeof(REAL));
     }
     else {
         A.val = NULL;
@@ -140,6 +138,8 @@ iCSRmat fasp_icsr_create (const INT  m,
  *
  * \author Chensong Zhang
  * \date   2010/04/06
+ *
+ * Modified by FASP team on 10/16/2026: first touch by all threads if it is on
  */
 void fasp_dcsr_alloc (const INT  m,
                       const INT  n,
@@ -147,21 +147,21 @@ void fasp_dcsr_alloc (const INT  m,
                       dCSRmat   *A)
 {
     if ( m <= 0 || n <= 0 ) {
-        printf("### ERROR: Matrix dim %d, %d must be positive! [%s]\n",
+        printf("### ERROR: Matrix dim " INTFMT ", " INTFMT " must be positive! [%s]\n",
                m, n, __FUNCTION__);
         return;
     }
 
     if ( m > 0 ) {
-        A->IA = (INT*)fasp_mem_calloc(m+1,sizeof(INT));
+        A->IA = (INT*)fasp_mem_calloc_numa(m+1,sizeof(INT));
     }
     else {
         A->IA = NULL;
     }
 
     if ( nnz > 0 ) {
-        A->JA  = (INT*)fasp_mem_calloc(nnz,sizeof(INT));
-        A->val = (REAL*)fasp_mem_calloc(nnz,sizeof(REAL));
+        A->JA  = (INT*)fasp_mem_calloc_numa(nnz,sizeof(INT));
+        A->val = (REAL*)fasp_mem_calloc_numa(nnz,sizeof(REAL));
     }
     else {
         A->JA  = NULL;
@@ -209,6 +209,58 @@ void fasp_dcsr_free (dCSRmat *A)
     A = NULL;	
 }
 
+/**
+ * \fn void fasp_dcsr_first_touch (dCSRmat *A)
+ *
+ * \brief Move the storage of a CSR matrix to the NUMA nodes of the threads which
+ *        work on its rows in SpMV
+ *
+ * \param A   Pointer to the dCSRmat matrix
+ *
+ * \author FASP team
+ * \date   10/16/2026
+ *
+ * \note New arrays are allocated without touching them and each thread copies the
+ *       rows it owns in fasp_blas_dcsr_mxv (fasp_get_start_end_nnz). Call it after
+ *       the matrix has been filled, e.g. after reading it on the master thread.
+ *       Nothing is done without OpenMP or with one thread.
+ */
+void fasp_dcsr_first_touch (dCSRmat *A)
+{
+#ifdef _OPENMP
+    const INT m = A->row, nnz = A->nnz;
+    INT      *IA, *JA, nthreads, myid, mybegin, myend, kbegin, kend;
+    REAL     *val = NULL;
+
+    if ( m <= OPENMP_HOLDS || nnz <= 0 || A->IA == NULL || A->JA == NULL ) return;
+
+    nthreads = fasp_get_num_threads();
+    if ( nthreads < 2 ) return;
+
+    IA = (INT *)fasp_mem_malloc(m+1, sizeof(INT));
+    JA = (INT *)fasp_mem_malloc(nnz, sizeof(INT));
+    if ( A->val != NULL ) val = (REAL *)fasp_mem_malloc(nnz, sizeof(REAL));
+
+#pragma omp parallel for private(myid, mybegin, myend, kbegin, kend)
+    for ( myid = 0; myid < nthreads; myid++ ) {
+        fasp_get_start_end_nnz(myid, nthreads, m, A->IA, &mybegin, &myend);
+        // the first and the last thread also take entries outside of IA[0]:IA[m]
+        kbegin = ( myid == 0 ) ? 0 : A->IA[mybegin];
+        kend   = ( myid == nthreads-1 ) ? nnz : A->IA[myend];
+        if ( myid == nthreads-1 ) myend++; // IA[m]
+        memcpy(IA+mybegin, A->IA+mybegin, (size_t)(myend-mybegin)*sizeof(INT));
+        memcpy(JA+kbegin, A->JA+kbegin, (size_t)(kend-kbegin)*sizeof(INT));
+        if ( val != NULL ) {
+            memcpy(val+kbegin, A->val+kbegin, (size_t)(kend-kbegin)*sizeof(REAL));
+        }
+    }
+
+    fasp_mem_free(A->IA);  A->IA  = IA;
+    fasp_mem_free(A->JA);  A->JA  = JA;
+    fasp_mem_free(A->val); A->val = val;
+#endif
+}
+
 /**
  * \fn void fasp_icsr_free (iCSRmat *A)
  *
@@ -611,7 +663,7 @@ void fasp_dcsr_getcol (const INT      n,
     
     // check the column index n
     if ( n < 0 || n >= ncol ) {
-        printf("### ERROR: Illegal column index %d! [%s]\n", n, __FUNCTION__);
+        printf("### ERROR: Illegal column index " INTFMT "! [%s]\n", n, __FUNCTION__);
         status = ERROR_DUMMY_VAR;
         goto FINISHED;
     }
@@ -748,7 +800,7 @@ void fasp_dcsr_diagpref (dCSRmat *A)
                     }
                 }
                 if (j == row_size) {
-                    printf("### ERROR: Diagonal entry %d is zero!\n", i);
+                    printf("### ERROR: Diagonal entry " INTFMT " is zero!\n", i);
                     fasp_chkerr(ERROR_MISC, __FUNCTION__);
                 }
             }
@@ -1290,7 +1342,7 @@ void fasp_dcsr_symdiagscale (dCSRmat       *A,
 #endif
     
     if (diag->row != n) {
-        printf("### ERROR: Size of diag = %d != size of matrix = %d!", diag->row, n);
+        printf("### ERROR: Size of diag = " INTFMT " != size of matrix = " INTFMT "!", diag->row, n);
         fasp_chkerr(ERROR_MISC, __FUNCTION__);
     }
     
@@ -1769,80 +1821,97 @@ void dCSRmat_Multicoloring(dCSRmat *A,
 #endif
 }
 
-#if MULTI_COLOR_ORDER
-static void generate_S_theta(dCSRmat *A,
-                            iCSRmat *S,
-                            REAL theta)
+/**
+ * \fn dCSRplan * fasp_dcsr_plan_create (const dCSRmat *A)
+ *
+ * \brief Build a SpMV plan for a CSR matrix
+ *
+ * \param A   Pointer to the dCSRmat matrix
+ *
+ * \return    Pointer to the plan
+ *
+ * \author FASP team
+ * \date   10/16/2026
+ *
+ * \note The plan records whether the threaded kernel is used, the nnz-balanced
+ *       row partition and the row-length histogram of A, so that the SpMV with
+ *       the plan does not repeat these decisions at every call. It should be
+ *       rebuilt if the sparsity pattern of A changes.
+ */
+dCSRplan * fasp_dcsr_plan_create (const dCSRmat *A)
 {
-    const INT row=A->row, col=A->col;
-    const INT row_plus_one = row+1;
-    const INT nnz=A->IA[row]-A->IA[0];
-    
-    INT index, i, j, begin_row, end_row;
-    INT *ia=A->IA, *ja=A->JA;
-    REAL *aj=A->val;
+    const INT  m  = A->row;
+    const INT *ia = A->IA;
 
-    // get the diagnal entry of A
-    //dvector diag; fasp_dcsr_getdiag(0, A, &diag);
-    
-    /* generate S */
-    REAL row_abs_sum;     
+    dCSRplan *plan = (dCSRplan *)fasp_mem_calloc(1, sizeof(dCSRplan));
+
+    INT i, k, maxnzr = 0;
+
+    plan->row        = m;
+    plan->nnz        = A->nnz;
+    plan->use_openmp = FALSE;
+    plan->nthreads   = 1;
 
-    // copy the structure of A to S
-    S->row=row; S->col=col; S->nnz=nnz; S->val=NULL;
-    
-    S->IA=(INT*)fasp_mem_calloc(row_plus_one, sizeof(INT));
-    
-    S->JA=(INT*)fasp_mem_calloc(nnz, sizeof(INT));
-    
-    fasp_iarray_cp(row_plus_one, ia, S->IA);
-    fasp_iarray_cp(nnz, ja, S->JA);
-    
 #ifdef _OPENMP
-#pragma omp parallel for private(i,j,begin_row,end_row,row_abs_sum)
-#endif
-    for (i=0;i<row;++i) {
-        /* compute scaling factor and row sum */
-        row_abs_sum=0;
-        begin_row=ia[i]; end_row=ia[i+1];
-        for (j=begin_row;j<end_row;j++) {
-            row_abs_sum+=ABS(aj[j]);
-        }
-	    row_abs_sum = row_abs_sum*theta;
-            
-        /* deal with  the element of S */
-        for (j=begin_row;j<end_row;j++){
-            if ( (row_abs_sum >= ABS(aj[j])) && (ja[j] !=i) )  {		    
-                S->JA[j]=-1;
-	    } 
-        }
-    } // end for i
-    
-    /* Compress the strength matrix */
-    index=0;
-    for (i=0;i<row;++i) {
-        S->IA[i]=index;
-        begin_row=ia[i]; end_row=ia[i+1]-1;
-        for (j=begin_row;j<=end_row;j++) {
-            if (S->JA[j]>-1) {
-                S->JA[index]=S->JA[j];
-                index++;
-            }
-        }
+    if ( m > OPENMP_HOLDS ) {
+        plan->use_openmp = TRUE;
+        plan->nthreads   = fasp_get_num_threads();
     }
-    
-    if (index > 0) {
-        S->IA[row]=index;
-        S->nnz=index;
-        S->JA=(INT*)fasp_mem_realloc(S->JA,index*sizeof(INT));
-    }
-    else {
-        S->nnz = 0;
-        S->JA = NULL;
+#endif
+
+    plan->part = (INT *)fasp_mem_calloc(plan->nthreads+1, sizeof(INT));
+    for ( k = 0; k < plan->nthreads; ++k ) {
+        fasp_get_start_end_nnz(k, plan->nthreads, m, ia,
+                               &plan->part[k], &plan->part[k+1]);
     }
-    
+
+    for ( i = 0; i < m; ++i ) maxnzr = MAX(maxnzr, ia[i+1]-ia[i]);
+    plan->maxnzr = maxnzr;
+    plan->hist   = (INT *)fasp_mem_calloc(maxnzr+1, sizeof(INT));
+    for ( i = 0; i < m; ++i ) plan->hist[ia[i+1]-ia[i]]++;
+
+    // all rows have the same length: row pointers are not needed in SpMV
+    plan->fixlen = ( m > 0 && plan->hist[maxnzr] == m ) ? maxnzr : 0;
+
+    return plan;
+}
+
+/**
+ * \fn void fasp_dcsr_plan_free (dCSRplan *plan)
+ *
+ * \brief Free a SpMV plan
+ *
+ * \param plan   Pointer to the plan
+ *
+ * \author FASP team
+ * \date   10/16/2026
+ */
+void fasp_dcsr_plan_free (dCSRplan *plan)
+{
+    if ( plan == NULL ) return;
+
+    fasp_mem_free(plan->part); plan->part = NULL;
+    fasp_mem_free(plan->hist); plan->hist = NULL;
+    fasp_mem_free(plan);
+}
+
+/**
+ * \fn void fasp_dcsr_rap_free (dCSRrap *plan)
+ *
+ * \brief Free a plan of the Galerkin product R*A*P
+ *
+ * \param plan   Pointer to the plan
+ *
+ * \author FASP team
+ * \date   10/16/2026
+ */
+void fasp_dcsr_rap_free (dCSRrap *plan)
+{
+    if ( plan == NULL ) return;
+
+    fasp_mem_free(plan->part); plan->part = NULL;
+    fasp_mem_free(plan);
 }
-#endif
 
 /**
  * \fn void dCSRmat_Multicoloring(dCSRmat *A, iCSRmat *S, INT *flags, INT *groups)
@@ -1978,7 +2047,7 @@ void dCSRmat_Multicoloring_Theta(dCSRmat *A,
      iCSRmat S;
      INT *IA,*JA;
      if (theta > 0 && theta < 1.0){
-     generate_S_theta(A, &S, theta);
+     fasp_dcsr_strength(A, STRENGTH_SUM, theta, 0.0, &S, NULL);
      IA = S.IA;
      JA = S.JA;
      } else if (theta == 1.0 ){
@@ -0,0 +1,81 @@
+/*! \file  BlaSparseCSR16.c
+ *
+ *  \brief Sparse matrix operations for dCSR16mat matrices
+ *
+ *  \note  This file contains Level-1 (Bla) functions. It requires:
+ *         AuxMemory.c
+ *
+ *---------------------------------------------------------------------------------
+ *  Copyright (C) 2026--Present by the FASP team. All rights reserved.
+ *  Released under the terms of the GNU Lesser General Public License 3.0 or later.
+ *---------------------------------------------------------------------------------
+ */
+
+#include "fasp.h"
+#include "fasp_functs.h"
+
+/*---------------------------------*/
+/*--      Public Functions       --*/
+/*---------------------------------*/
+
+/**
+ * \fn dCSR16mat * fasp_dcsr16_create (const INT num_rows, const INT num_cols,
+ *                                     const INT num_nonzeros, const INT num_escapes)
+ *
+ * \brief Create a dCSR16mat object
+ *
+ * \param num_rows      Number of rows
+ * \param num_cols      Number of cols
+ * \param num_nonzeros  Number of nonzero entries
+ * \param num_escapes   Number of entries in JE
+ *
+ * \return              Pointer to the dCSR16mat matrix
+ *
+ * \author FASP team
+ * \date   10/16/2026
+ */
+dCSR16mat * fasp_dcsr16_create (const INT num_rows,
+                                const INT num_cols,
+                                const INT num_nonzeros,
+                                const INT num_escapes)
+{
+    dCSR16mat *A = (dCSR16mat *)fasp_mem_calloc(1, sizeof(dCSR16mat));
+
+    A -> row  = num_rows;
+    A -> col  = num_cols;
+    A -> nnz  = num_nonzeros;
+    A -> nesc = num_escapes;
+    A -> IA   = (INT *)fasp_mem_calloc(num_rows+1, sizeof(INT));
+    A -> base = (INT *)fasp_mem_calloc(MAX(num_rows,1), sizeof(INT));
+    A -> JD   = (SHORT *)fasp_mem_calloc(MAX(num_nonzeros,1), sizeof(SHORT));
+    A -> JE   = (INT *)fasp_mem_calloc(MAX(num_escapes,1), sizeof(INT));
+    A -> val  = (REAL *)fasp_mem_calloc(MAX(num_nonzeros,1), sizeof(REAL));
+
+    return A;
+}
+
+/**
+ * \fn void fasp_dcsr16_free (dCSR16mat *A)
+ *
+ * \brief Destroy a dCSR16mat object
+ *
+ * \param A   Pointer to the dCSR16mat type matrix
+ *
+ * \author FASP team
+ * \date   10/16/2026
+ */
+void fasp_dcsr16_free (dCSR16mat *A)
+{
+    if (A) {
+        fasp_mem_free(A -> IA);
+        fasp_mem_free(A -> base);
+        fasp_mem_free(A -> JD);
+        fasp_mem_free(A -> JE);
+        fasp_mem_free(A -> val);
+        fasp_mem_free(A);
+    }
+}
+
+/*---------------------------------*/
+/*--        End of File          --*/
+/*---------------------------------*/
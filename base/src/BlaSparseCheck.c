@@ -50,7 +50,7 @@ INT fasp_check_diagpos (const dCSRmat *A)
         if (diag.val[i]<0) num_neg++;        
     }
     
-    printf("Number of negative diagonal entries = %d\n", num_neg);
+    printf("Number of negative diagonal entries = " INTFMT "\n", num_neg);
     
     fasp_dvec_free(&diag);
     
@@ -84,7 +84,7 @@ SHORT fasp_check_diagzero (const dCSRmat *A)
             j = ja[k];
             if ( i == j ) {
                 if ( ABS(aj[k]) < SMALLREAL ) {
-                    printf("### ERROR: diag[%d] = %e, close to zero!\n", i, aj[k]);
+                    printf("### ERROR: diag[" INTFMT "] = %e, close to zero!\n", i, aj[k]);
                     status = ERROR_DATA_ZERODIAG;
                     goto FINISHED;
                 }
@@ -172,7 +172,7 @@ INT fasp_check_symm (const dCSRmat *A)
     const INT nnz = A->IA[nn]-A->IA[0];
     
     if (nnz!=A->nnz) {
-        printf("### ERROR: nnz=%d, ia[n]-ia[0]=%d, mismatch!\n",A->nnz,nnz);
+        printf("### ERROR: nnz=" INTFMT ", ia[n]-ia[0]=" INTFMT ", mismatch!\n",A->nnz,nnz);
         fasp_chkerr(ERROR_DATA_STRUCTURE, __FUNCTION__);
     }
     
@@ -243,11 +243,11 @@ INT fasp_check_symm (const dCSRmat *A)
         printf("Matrix is symmetric with max relative difference is %1.3le\n",maxdif);
         break;
     case -1:
-        printf("Matrix has nonsymmetric pattern, check the %d-th, %d-th and %d-th rows and cols\n",
+        printf("Matrix has nonsymmetric pattern, check the " INTFMT "-th, " INTFMT "-th and " INTFMT "-th rows and cols\n",
                mdi-1,mdi,mdi+1);
         break;
     case -2:
-        printf("Matrix has nonsymmetric pattern, check the %d-th, %d-th and %d-th cols and rows\n",
+        printf("Matrix has nonsymmetric pattern, check the " INTFMT "-th, " INTFMT "-th and " INTFMT "-th cols and rows\n",
                mdj-1,mdj,mdj+1);
         break;
     case -3:
@@ -367,7 +367,8 @@ void fasp_check_ordering (dCSRmat *A)
 		for ( j=start; j<end-1; ++j ) {
 			j1 = A->JA[j]; j2 = A->JA[j + 1];
 			if ( j1 >= j2 ) {
-				printf("### ERROR: Order in row %10d is wrong! %10d, %10d\n", i, j1, j2);
+				printf("### ERROR: Order in row %10" INTMOD "d is wrong! %10" INTMOD "d, %10" INTMOD "d\n",
+				       i, j1, j2);
 				fasp_chkerr(ERROR_DATA_STRUCTURE, __FUNCTION__);
 			}
 		}
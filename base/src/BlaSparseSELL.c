@@ -0,0 +1,95 @@
+/*! \file  BlaSparseSELL.c
+ *
+ *  \brief Sparse matrix operations for dSELLmat matrices
+ *
+ *  \note  This file contains Level-1 (Bla) functions. It requires:
+ *         AuxMemory.c
+ *
+ *  Reference:
+ *         M. Kreutzer, G. Hager, G. Wellein, H. Fehske, and A.R. Bishop
+ *         A unified sparse matrix data format for efficient general sparse
+ *         matrix-vector multiplication on modern processors with wide SIMD units,
+ *         SIAM J. Sci. Comput. 36(5), 2014.
+ *
+ *---------------------------------------------------------------------------------
+ *  Copyright (C) 2026--Present by the FASP team. All rights reserved.
+ *  Released under the terms of the GNU Lesser General Public License 3.0 or later.
+ *---------------------------------------------------------------------------------
+ */
+
+#include "fasp.h"
+#include "fasp_functs.h"
+
+/*---------------------------------*/
+/*--      Public Functions       --*/
+/*---------------------------------*/
+
+/**
+ * \fn dSELLmat * fasp_dsell_create (const INT num_rows, const INT num_cols,
+ *                                   const INT num_nonzeros, const INT C,
+ *                                   const INT sigma)
+ *
+ * \brief Create a dSELLmat object
+ *
+ * \param num_rows      Number of rows
+ * \param num_cols      Number of cols
+ * \param num_nonzeros  Number of nonzero entries
+ * \param C             Chunk height
+ * \param sigma         Sorting window
+ *
+ * \return              Pointer to the dSELLmat matrix
+ *
+ * \author FASP team
+ * \date   10/16/2026
+ *
+ * \note Only the chunk information is allocated here; ja and val are allocated
+ *       after the chunk widths are known.
+ */
+dSELLmat * fasp_dsell_create (const INT num_rows,
+                              const INT num_cols,
+                              const INT num_nonzeros,
+                              const INT C,
+                              const INT sigma)
+{
+    dSELLmat *A = (dSELLmat *)fasp_mem_calloc(1, sizeof(dSELLmat));
+
+    A -> row    = num_rows;
+    A -> col    = num_cols;
+    A -> nnz    = num_nonzeros;
+    A -> C      = C;
+    A -> sigma  = sigma;
+    A -> nchunk = (num_rows + C - 1) / C;
+    A -> cs     = (INT *)fasp_mem_calloc(A->nchunk+1, sizeof(INT));
+    A -> cl     = (INT *)fasp_mem_calloc(A->nchunk, sizeof(INT));
+    A -> perm   = (INT *)fasp_mem_calloc(A->nchunk*C, sizeof(INT));
+    A -> ja     = NULL;
+    A -> val    = NULL;
+
+    return A;
+}
+
+/**
+ * \fn void fasp_dsell_free (dSELLmat *A)
+ *
+ * \brief Destroy a dSELLmat object
+ *
+ * \param A   Pointer to the dSELLmat type matrix
+ *
+ * \author FASP team
+ * \date   10/16/2026
+ */
+void fasp_dsell_free (dSELLmat *A)
+{
+    if (A) {
+        fasp_mem_free(A -> cs);
+        fasp_mem_free(A -> cl);
+        fasp_mem_free(A -> perm);
+        fasp_mem_free(A -> ja);
+        fasp_mem_free(A -> val);
+        fasp_mem_free(A);
+    }
+}
+
+/*---------------------------------*/
+/*--        End of File          --*/
+/*---------------------------------*/
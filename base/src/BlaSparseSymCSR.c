@@ -0,0 +1,77 @@
+/*! \file  BlaSparseSymCSR.c
+ *
+ *  \brief Sparse matrix operations for dSymCSRmat matrices
+ *
+ *  \note  This file contains Level-1 (Bla) functions. It requires:
+ *         AuxMemory.c
+ *
+ *---------------------------------------------------------------------------------
+ *  Copyright (C) 2026--Present by the FASP team. All rights reserved.
+ *  Released under the terms of the GNU Lesser General Public License 3.0 or later.
+ *---------------------------------------------------------------------------------
+ */
+
+#include "fasp.h"
+#include "fasp_functs.h"
+
+/*---------------------------------*/
+/*--      Public Functions       --*/
+/*---------------------------------*/
+
+/**
+ * \fn dSymCSRmat * fasp_dsymcsr_create (const INT num_rows, const INT num_nonzeros)
+ *
+ * \brief Create a dSymCSRmat object
+ *
+ * \param num_rows      Number of rows
+ * \param num_nonzeros  Number of nonzero entries in the strictly upper part
+ *
+ * \return              Pointer to the dSymCSRmat matrix
+ *
+ * \author FASP team
+ * \date   10/16/2026
+ */
+dSymCSRmat * fasp_dsymcsr_create (const INT num_rows,
+                                  const INT num_nonzeros)
+{
+    dSymCSRmat *A = (dSymCSRmat *)fasp_mem_calloc(1, sizeof(dSymCSRmat));
+
+    A -> row  = num_rows;
+    A -> col  = num_rows;
+    A -> nnz  = num_nonzeros;
+    A -> diag = (REAL *)fasp_mem_calloc(MAX(num_rows,1), sizeof(REAL));
+    A -> IA   = (INT *)fasp_mem_calloc(num_rows+1, sizeof(INT));
+    A -> JA   = (INT *)fasp_mem_calloc(MAX(num_nonzeros,1), sizeof(INT));
+    A -> val  = (REAL *)fasp_mem_calloc(MAX(num_nonzeros,1), sizeof(REAL));
+
+    return A;
+}
+
+/**
+ * \fn void fasp_dsymcsr_free (dSymCSRmat *A)
+ *
+ * \brief Destroy a dSymCSRmat object
+ *
+ * \param A   Pointer to the dSymCSRmat type matrix
+ *
+ * \author FASP team
+ * \date   10/16/2026
+ *
+ * Modified by FASP team on 10/16/2026: free the threaded SpMV buffers
+ */
+void fasp_dsymcsr_free (dSymCSRmat *A)
+{
+    if (A) {
+        fasp_mem_free(A -> diag);
+        fasp_mem_free(A -> IA);
+        fasp_mem_free(A -> JA);
+        fasp_mem_free(A -> val);
+        fasp_mem_free(A -> part);
+        fasp_mem_free(A -> work);
+        fasp_mem_free(A);
+    }
+}
+
+/*---------------------------------*/
+/*--        End of File          --*/
+/*---------------------------------*/
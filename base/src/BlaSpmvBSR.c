@@ -20,6 +20,18 @@
 #include "fasp.h"
 #include "fasp_functs.h"
 
+/*---------------------------------*/
+/*--  Declare Private Functions  --*/
+/*---------------------------------*/
+
+static inline void dbsr_spmv_rows_sp(const dBSRmat *, const SREAL *, const INT,
+                                     const INT, const REAL, const SHORT, const REAL *,
+                                     REAL *);
+static void dbsr_spmm(const dBSRmat *, const REAL, const SHORT, const INT,
+                      const REAL *, REAL *);
+static inline void dbsr_spmm_rows(const dBSRmat *, const INT, const INT, const REAL,
+                                  const SHORT, const INT, const REAL *, REAL *);
+
 /*---------------------------------*/
 /*--      Public Functions       --*/
 /*---------------------------------*/
@@ -4629,6 +4641,153 @@ void fasp_blas_dbsr_mxv_agg (const dBSRmat  *A,
     }
 }
 
+/**
+ * \fn void fasp_blas_dbsr_mxv_sp (const dBSRmat *A, const SREAL *val,
+ *                                 const REAL *x, REAL *y)
+ *
+ * \brief Compute y := A*x with single precision values
+ *
+ * \param A      Pointer to the dBSRmat matrix (only the pattern IA, JA is used)
+ * \param val    Single precision values of A
+ * \param x      Pointer to the array x
+ * \param y      Pointer to the array y
+ *
+ * \author FASP team
+ * \date   10/16/2026
+ *
+ * \note Works for general nb. The values are promoted to REAL and accumulated in
+ *       double precision.
+ */
+void fasp_blas_dbsr_mxv_sp (const dBSRmat  *A,
+                            const SREAL    *val,
+                            const REAL     *x,
+                            REAL           *y)
+{
+    const INT ROW = A->ROW;
+
+    SHORT nthreads = 1, use_openmp = FALSE;
+
+#ifdef _OPENMP
+    if ( ROW > OPENMP_HOLDS ) {
+        use_openmp = TRUE;
+        nthreads = fasp_get_num_threads();
+    }
+#endif
+
+    if (use_openmp) {
+        INT myid, mybegin, myend;
+#ifdef _OPENMP
+#pragma omp parallel for private(myid, mybegin, myend)
+#endif
+        for (myid = 0; myid < nthreads; myid++ ) {
+            fasp_get_start_end(myid, nthreads, ROW, &mybegin, &myend);
+            dbsr_spmv_rows_sp(A, val, mybegin, myend, 1.0, FALSE, x, y);
+        }
+    }
+    else {
+        dbsr_spmv_rows_sp(A, val, 0, ROW, 1.0, FALSE, x, y);
+    }
+}
+
+/**
+ * \fn void fasp_blas_dbsr_aAxpy_sp (const REAL alpha, const dBSRmat *A,
+ *                                   const SREAL *val, const REAL *x, REAL *y)
+ *
+ * \brief Compute y := alpha*A*x + y with single precision values
+ *
+ * \param alpha  REAL factor alpha
+ * \param A      Pointer to the dBSRmat matrix (only the pattern IA, JA is used)
+ * \param val    Single precision values of A
+ * \param x      Pointer to the array x
+ * \param y      Pointer to the array y
+ *
+ * \author FASP team
+ * \date   10/16/2026
+ *
+ * \note Works for general nb. The values are promoted to REAL and accumulated in
+ *       double precision.
+ */
+void fasp_blas_dbsr_aAxpy_sp (const REAL      alpha,
+                              const dBSRmat  *A,
+                              const SREAL    *val,
+                              const REAL     *x,
+                              REAL           *y)
+{
+    const INT ROW = A->ROW;
+
+    SHORT nthreads = 1, use_openmp = FALSE;
+
+#ifdef _OPENMP
+    if ( ROW > OPENMP_HOLDS ) {
+        use_openmp = TRUE;
+        nthreads = fasp_get_num_threads();
+    }
+#endif
+
+    if (use_openmp) {
+        INT myid, mybegin, myend;
+#ifdef _OPENMP
+#pragma omp parallel for private(myid, mybegin, myend)
+#endif
+        for (myid = 0; myid < nthreads; myid++ ) {
+            fasp_get_start_end(myid, nthreads, ROW, &mybegin, &myend);
+            dbsr_spmv_rows_sp(A, val, mybegin, myend, alpha, TRUE, x, y);
+        }
+    }
+    else {
+        dbsr_spmv_rows_sp(A, val, 0, ROW, alpha, TRUE, x, y);
+    }
+}
+
+/**
+ * \fn void fasp_blas_dbsr_mxm_dense (const dBSRmat *A, const INT nrhs,
+ *                                    const REAL *x, REAL *y)
+ *
+ * \brief Multiply A with a block of vectors Y = A*X
+ *
+ * \param A      Pointer to the dBSRmat matrix
+ * \param nrhs   Number of vectors in X and Y
+ * \param x      Pointer to the array X (A->COL*nb*nrhs, interleaved)
+ * \param y      Pointer to the array Y (A->ROW*nb*nrhs, interleaved)
+ *
+ * \author FASP team
+ * \date   10/16/2026
+ *
+ * \note Entry i of vector j is x[i*nrhs+j], where i is the point (not block)
+ *       index. A is read once for all nrhs vectors. Works for general nb.
+ */
+void fasp_blas_dbsr_mxm_dense (const dBSRmat  *A,
+                               const INT       nrhs,
+                               const REAL     *x,
+                               REAL           *y)
+{
+    dbsr_spmm(A, 1.0, FALSE, nrhs, x, y);
+}
+
+/**
+ * \fn void fasp_blas_dbsr_aAxpy_dense (const REAL alpha, const dBSRmat *A,
+ *                                      const INT nrhs, const REAL *x, REAL *y)
+ *
+ * \brief Multiply A with a block of vectors Y = alpha*A*X + Y
+ *
+ * \param alpha  REAL factor alpha
+ * \param A      Pointer to the dBSRmat matrix
+ * \param nrhs   Number of vectors in X and Y
+ * \param x      Pointer to the array X (A->COL*nb*nrhs, interleaved)
+ * \param y      Pointer to the array Y (A->ROW*nb*nrhs, interleaved)
+ *
+ * \author FASP team
+ * \date   10/16/2026
+ */
+void fasp_blas_dbsr_aAxpy_dense (const REAL      alpha,
+                                 const dBSRmat  *A,
+                                 const INT       nrhs,
+                                 const REAL     *x,
+                                 REAL           *y)
+{
+    dbsr_spmm(A, alpha, TRUE, nrhs, x, y);
+}
+
 /**
  * \fn void fasp_blas_dbsr_mxm (const dBSRmat *A, const dBSRmat *B, dBSRmat *C)
  *
@@ -5467,6 +5626,172 @@ counter, i, jj_row_begining, jj1, i1, jj2, i2, jj3, i3)
     fasp_mem_free(Ps_marker); Ps_marker = NULL;
 }
 
+/*---------------------------------*/
+/*--      Private Functions      --*/
+/*---------------------------------*/
+
+/**
+ * \fn static inline void dbsr_spmv_rows_sp (const dBSRmat *A, const SREAL *val,
+ *                                           const INT begin, const INT end,
+ *                                           const REAL alpha, const SHORT add,
+ *                                           const REAL *x, REAL *y)
+ *
+ * \brief Compute y = alpha*A*x (+ y if add) for block rows begin, ..., end-1 of A
+ *        with single precision values
+ *
+ * \param A       Pointer to the dBSRmat matrix (only the pattern IA, JA is used)
+ * \param val     Single precision values of A (blocks in row-major order)
+ * \param begin   First block row
+ * \param end     Last block row + 1
+ * \param alpha   REAL factor alpha
+ * \param add     Add to y (TRUE) or overwrite y (FALSE)
+ * \param x       Pointer to the array x
+ * \param y       Pointer to the array y
+ *
+ * \author FASP team
+ * \date   10/16/2026
+ */
+static inline void dbsr_spmv_rows_sp (const dBSRmat  *A,
+                                      const SREAL    *val,
+                                      const INT       begin,
+                                      const INT       end,
+                                      const REAL      alpha,
+                                      const SHORT     add,
+                                      const REAL     *x,
+                                      REAL           *y)
+{
+    const INT  nb = A->nb, jump = nb*nb;
+    const INT *IA = A->IA, *JA = A->JA;
+
+    const SREAL *pA;
+    const REAL  *px;
+    REAL        *py, temp;
+    INT          i, k, r, c;
+
+    for (i = begin; i < end; ++i) {
+        py = y + i*nb;
+        if ( !add ) for (r = 0; r < nb; ++r) py[r] = 0.0;
+        for (k = IA[i]; k < IA[i+1]; ++k) {
+            pA = val + k*jump;
+            px = x + JA[k]*nb;
+            for (r = 0; r < nb; ++r) {
+                temp = 0.0;
+                for (c = 0; c < nb; ++c) temp += (REAL)pA[r*nb+c]*px[c];
+                py[r] += alpha*temp;
+            }
+        }
+    }
+}
+
+/**
+ * \fn static void dbsr_spmm (const dBSRmat *A, const REAL alpha, const SHORT add,
+ *                            const INT nrhs, const REAL *x, REAL *y)
+ *
+ * \brief Compute Y = alpha*A*X (+ Y if add) for a block of nrhs vectors
+ *
+ * \param A       Pointer to the dBSRmat matrix
+ * \param alpha   REAL factor alpha
+ * \param add     Add to Y (TRUE) or overwrite Y (FALSE)
+ * \param nrhs    Number of vectors in X and Y
+ * \param x       Pointer to the array X (interleaved)
+ * \param y       Pointer to the array Y (interleaved)
+ *
+ * \author FASP team
+ * \date   10/16/2026
+ */
+static void dbsr_spmm (const dBSRmat  *A,
+                       const REAL      alpha,
+                       const SHORT     add,
+                       const INT       nrhs,
+                       const REAL     *x,
+                       REAL           *y)
+{
+    const INT ROW = A->ROW;
+
+    SHORT nthreads = 1, use_openmp = FALSE;
+
+#ifdef _OPENMP
+    if ( ROW > OPENMP_HOLDS ) {
+        use_openmp = TRUE;
+        nthreads = fasp_get_num_threads();
+    }
+#endif
+
+    if (use_openmp) {
+        INT myid, mybegin, myend;
+#ifdef _OPENMP
+#pragma omp parallel for private(myid, mybegin, myend)
+#endif
+        for (myid = 0; myid < nthreads; myid++ ) {
+            fasp_get_start_end(myid, nthreads, ROW, &mybegin, &myend);
+            dbsr_spmm_rows(A, mybegin, myend, alpha, add, nrhs, x, y);
+        }
+    }
+    else {
+        dbsr_spmm_rows(A, 0, ROW, alpha, add, nrhs, x, y);
+    }
+}
+
+/**
+ * \fn static inline void dbsr_spmm_rows (const dBSRmat *A, const INT begin,
+ *                                        const INT end, const REAL alpha,
+ *                                        const SHORT add, const INT nrhs,
+ *                                        const REAL *x, REAL *y)
+ *
+ * \brief Compute Y = alpha*A*X (+ Y if add) for block rows begin, ..., end-1 of A
+ *
+ * \param A       Pointer to the dBSRmat matrix (blocks in row-major order)
+ * \param begin   First block row
+ * \param end     Last block row + 1
+ * \param alpha   REAL factor alpha
+ * \param add     Add to Y (TRUE) or overwrite Y (FALSE)
+ * \param nrhs    Number of vectors in X and Y
+ * \param x       Pointer to the array X (interleaved)
+ * \param y       Pointer to the array Y (interleaved)
+ *
+ * \author FASP team
+ * \date   10/16/2026
+ *
+ * \note Each block entry updates a contiguous row of Y, the loop over the
+ *       vectors is vectorized.
+ */
+static inline void dbsr_spmm_rows (const dBSRmat  *A,
+                                   const INT       begin,
+                                   const INT       end,
+                                   const REAL      alpha,
+                                   const SHORT     add,
+                                   const INT       nrhs,
+                                   const REAL     *x,
+                                   REAL           *y)
+{
+    const INT  nb = A->nb, jump = nb*nb, ldx = nb*nrhs;
+    const INT *IA = A->IA, *JA = A->JA;
+
+    const REAL *pA, *px, *pxc;
+    REAL       *py, *pyr, a;
+    INT         i, j, k, r, c;
+
+    for (i = begin; i < end; ++i) {
+        py = y + (size_t)i*ldx;
+        if ( !add ) for (j = 0; j < ldx; ++j) py[j] = 0.0;
+        for (k = IA[i]; k < IA[i+1]; ++k) {
+            pA = A->val + (size_t)k*jump;
+            px = x + (size_t)JA[k]*ldx;
+            for (r = 0; r < nb; ++r) {
+                pyr = py + r*nrhs;
+                for (c = 0; c < nb; ++c) {
+                    a   = alpha*pA[r*nb+c];
+                    pxc = px + c*nrhs;
+#ifdef _OPENMP
+#pragma omp simd
+#endif
+                    for (j = 0; j < nrhs; ++j) pyr[j] += a*pxc[j];
+                }
+            }
+        }
+    }
+}
+
 /*---------------------------------*/
 /*--        End of File          --*/
 /*---------------------------------*/
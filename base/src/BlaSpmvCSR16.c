@@ -0,0 +1,182 @@
+/*! \file  BlaSpmvCSR16.c
+ *
+ *  \brief Linear algebraic operations for dCSR16mat matrices
+ *
+ *  \note  This file contains Level-1 (Bla) functions. It requires:
+ *         AuxThreads.c and BlaSparseCSR16.c
+ *
+ *  \note  The column indices are decoded on the fly from the 16-bit deltas, so the
+ *         index stream read by SpMV is half of that of dCSRmat. Rows without escapes
+ *         take a loop without any branch.
+ *
+ *---------------------------------------------------------------------------------
+ *  Copyright (C) 2026--Present by the FASP team. All rights reserved.
+ *  Released under the terms of the GNU Lesser General Public License 3.0 or later.
+ *---------------------------------------------------------------------------------
+ */
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+#include "fasp.h"
+#include "fasp_functs.h"
+
+/*---------------------------------*/
+/*--  Declare Private Functions  --*/
+/*---------------------------------*/
+
+static inline void dcsr16_spmv_rows(const dCSR16mat *, const INT, const INT,
+                                    const REAL, const SHORT, const REAL *, REAL *);
+
+/*---------------------------------*/
+/*--      Public Functions       --*/
+/*---------------------------------*/
+
+/**
+ * \fn void fasp_blas_dcsr16_mxv (const dCSR16mat *A, const REAL *x, REAL *y)
+ *
+ * \brief Matrix-vector multiplication y = A*x for a sparse matrix in CSR16 format
+ *
+ * \param A   Pointer to dCSR16mat matrix A
+ * \param x   Pointer to array x
+ * \param y   Pointer to array y
+ *
+ * \author FASP team
+ * \date   10/16/2026
+ */
+void fasp_blas_dcsr16_mxv (const dCSR16mat  *A,
+                           const REAL       *x,
+                           REAL             *y)
+{
+    const INT m = A->row;
+
+    SHORT nthreads = 1, use_openmp = FALSE;
+
+#ifdef _OPENMP
+    if ( m > OPENMP_HOLDS ) {
+        use_openmp = TRUE;
+        nthreads = fasp_get_num_threads();
+    }
+#endif
+
+    if (use_openmp) {
+        INT myid, mybegin, myend;
+#ifdef _OPENMP
+#pragma omp parallel for private(myid, mybegin, myend)
+#endif
+        for (myid = 0; myid < nthreads; myid++ ) {
+            fasp_get_start_end_nnz(myid, nthreads, m, A->IA, &mybegin, &myend);
+            dcsr16_spmv_rows(A, mybegin, myend, 1.0, FALSE, x, y);
+        }
+    }
+    else {
+        dcsr16_spmv_rows(A, 0, m, 1.0, FALSE, x, y);
+    }
+}
+
+/**
+ * \fn void fasp_blas_dcsr16_aAxpy (const REAL alpha, const dCSR16mat *A,
+ *                                  const REAL *x, REAL *y)
+ *
+ * \brief Matrix-vector multiplication y = alpha*A*x + y for a sparse matrix in
+ *        CSR16 format
+ *
+ * \param alpha  REAL factor alpha
+ * \param A      Pointer to dCSR16mat matrix A
+ * \param x      Pointer to array x
+ * \param y      Pointer to array y
+ *
+ * \author FASP team
+ * \date   10/16/2026
+ */
+void fasp_blas_dcsr16_aAxpy (const REAL        alpha,
+                             const dCSR16mat  *A,
+                             const REAL       *x,
+                             REAL             *y)
+{
+    const INT m = A->row;
+
+    SHORT nthreads = 1, use_openmp = FALSE;
+
+#ifdef _OPENMP
+    if ( m > OPENMP_HOLDS ) {
+        use_openmp = TRUE;
+        nthreads = fasp_get_num_threads();
+    }
+#endif
+
+    if (use_openmp) {
+        INT myid, mybegin, myend;
+#ifdef _OPENMP
+#pragma omp parallel for private(myid, mybegin, myend)
+#endif
+        for (myid = 0; myid < nthreads; myid++ ) {
+            fasp_get_start_end_nnz(myid, nthreads, m, A->IA, &mybegin, &myend);
+            dcsr16_spmv_rows(A, mybegin, myend, alpha, TRUE, x, y);
+        }
+    }
+    else {
+        dcsr16_spmv_rows(A, 0, m, alpha, TRUE, x, y);
+    }
+}
+
+/*---------------------------------*/
+/*--      Private Functions      --*/
+/*---------------------------------*/
+
+/**
+ * \fn static inline void dcsr16_spmv_rows (const dCSR16mat *A, const INT begin,
+ *                                          const INT end, const REAL alpha,
+ *                                          const SHORT add, const REAL *x, REAL *y)
+ *
+ * \brief Compute y = alpha*A*x (+ y if add) for rows begin, ..., end-1 of A
+ *
+ * \param A       Pointer to dCSR16mat matrix A
+ * \param begin   First row
+ * \param end     Last row + 1
+ * \param alpha   REAL factor alpha
+ * \param add     Add to y (TRUE) or overwrite y (FALSE)
+ * \param x       Pointer to array x
+ * \param y       Pointer to array y
+ *
+ * \author FASP team
+ * \date   10/16/2026
+ */
+static inline void dcsr16_spmv_rows (const dCSR16mat  *A,
+                                     const INT         begin,
+                                     const INT         end,
+                                     const REAL        alpha,
+                                     const SHORT       add,
+                                     const REAL       *x,
+                                     REAL             *y)
+{
+    const INT   *ia = A->IA, *base = A->base, *je = A->JE;
+    const SHORT *jd = A->JD;
+    const REAL  *aj = A->val;
+
+    INT  i, j, k, e;
+    REAL temp;
+    const REAL *xb;
+
+    for (i = begin; i < end; ++i) {
+        temp = 0.0;
+        if ( base[i] >= 0 ) {
+            xb = x + base[i];
+            for (k = ia[i]; k < ia[i+1]; ++k) temp += aj[k]*xb[jd[k]];
+        }
+        else { // row with escapes
+            e = -base[i]-1; j = je[e++];
+            for (k = ia[i]; k < ia[i+1]; ++k) {
+                if ( jd[k] == CSR16_ESCAPE ) temp += aj[k]*x[je[e++]];
+                else                         temp += aj[k]*x[j+jd[k]];
+            }
+        }
+        if ( add ) y[i] += alpha*temp;
+        else       y[i]  = alpha*temp;
+    }
+}
+
+/*---------------------------------*/
+/*--        End of File          --*/
+/*---------------------------------*/
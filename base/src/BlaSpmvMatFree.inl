@@ -110,6 +110,63 @@ static inline void fasp_blas_mxv_csrl (const void *A,
     fasp_blas_dcsrl_mxv((const dCSRLmat *)A, x, y);
 }
 
+/**
+ * \fn static inline void fasp_blas_mxv_sell (const void *A, const REAL *x, REAL *y)
+ *
+ * \brief Matrix-vector multiplication y = A*x
+ *
+ * \param A               Pointer to SELL matrix A
+ * \param x               Pointer to array x
+ * \param y               Pointer to array y
+ *
+ * \author FASP team
+ * \date   10/16/2026
+ */
+static inline void fasp_blas_mxv_sell (const void *A,
+                                       const REAL *x,
+                                       REAL       *y)
+{
+    fasp_blas_dsell_mxv((const dSELLmat *)A, x, y);
+}
+
+/**
+ * \fn static inline void fasp_blas_mxv_symcsr (const void *A, const REAL *x, REAL *y)
+ *
+ * \brief Matrix-vector multiplication y = A*x
+ *
+ * \param A               Pointer to SymCSR matrix A
+ * \param x               Pointer to array x
+ * \param y               Pointer to array y
+ *
+ * \author FASP team
+ * \date   10/16/2026
+ */
+static inline void fasp_blas_mxv_symcsr (const void *A,
+                                         const REAL *x,
+                                         REAL       *y)
+{
+    fasp_blas_dsymcsr_mxv((const dSymCSRmat *)A, x, y);
+}
+
+/**
+ * \fn static inline void fasp_blas_mxv_csr16 (const void *A, const REAL *x, REAL *y)
+ *
+ * \brief Matrix-vector multiplication y = A*x
+ *
+ * \param A               Pointer to CSR16 matrix A
+ * \param x               Pointer to array x
+ * \param y               Pointer to array y
+ *
+ * \author FASP team
+ * \date   10/16/2026
+ */
+static inline void fasp_blas_mxv_csr16 (const void *A,
+                                        const REAL *x,
+                                        REAL       *y)
+{
+    fasp_blas_dcsr16_mxv((const dCSR16mat *)A, x, y);
+}
+
 /*---------------------------------*/
 /*--        End of File          --*/
 /*---------------------------------*/
@@ -39,6 +39,10 @@ static inline void str_spaAxpy_3D_blk(const REAL, const dSTRmat *, const REAL *,
 static inline void str_spaAxpy(const REAL, const dSTRmat *, const REAL *, REAL *);
 static inline void blkcontr_str(const INT, const INT, const INT, const INT,
                                 const REAL *, const REAL *, REAL *);
+static void str_spmm(const dSTRmat *, const REAL, const SHORT, const INT,
+                     const REAL *, REAL *);
+static inline void str_spmm_rows(const dSTRmat *, const INT, const INT, const REAL,
+                                 const SHORT, const INT, const REAL *, REAL *);
 
 /*---------------------------------*/
 /*--      Public Functions       --*/
@@ -127,18 +131,68 @@ void fasp_blas_dstr_aAxpy (const REAL      alpha,
  *
  * \author Chensong Zhang
  * \date   04/27/2013
+ *
+ * Modified by FASP team on 10/16/2026: length of y is ngrid*nc
  */
 void fasp_blas_dstr_mxv (const dSTRmat  *A,
                          const REAL     *x,
                          REAL           *y)
 {
-    int n = (A->ngrid)*(A->nc)*(A->nc);
+    const INT n = (A->ngrid)*(A->nc); // length of y
     
     memset(y, 0, n*sizeof(REAL));
     
     fasp_blas_dstr_aAxpy(1.0, A, x, y);
 }
 
+/**
+ * \fn void fasp_blas_dstr_mxm_dense (const dSTRmat *A, const INT nrhs,
+ *                                    const REAL *x, REAL *y)
+ *
+ * \brief Multi-vector product Y = A*X for nrhs vectors
+ *
+ * \param A       Pointer to dSTRmat matrix
+ * \param nrhs    Number of vectors in X and Y
+ * \param x       Pointer to the array X (ngrid*nc*nrhs, interleaved)
+ * \param y       Pointer to the array Y (ngrid*nc*nrhs, interleaved)
+ *
+ * \author FASP team
+ * \date   10/16/2026
+ *
+ * \note Entry i of vector j is stored in x[i*nrhs+j].
+ */
+void fasp_blas_dstr_mxm_dense (const dSTRmat  *A,
+                               const INT       nrhs,
+                               const REAL     *x,
+                               REAL           *y)
+{
+    str_spmm(A, 1.0, FALSE, nrhs, x, y);
+}
+
+/**
+ * \fn void fasp_blas_dstr_aAxpy_dense (const REAL alpha, const dSTRmat *A,
+ *                                      const INT nrhs, const REAL *x, REAL *y)
+ *
+ * \brief Multi-vector product Y = alpha*A*X + Y for nrhs vectors
+ *
+ * \param alpha   REAL factor alpha
+ * \param A       Pointer to dSTRmat matrix
+ * \param nrhs    Number of vectors in X and Y
+ * \param x       Pointer to the array X (ngrid*nc*nrhs, interleaved)
+ * \param y       Pointer to the array Y (ngrid*nc*nrhs, interleaved)
+ *
+ * \author FASP team
+ * \date   10/16/2026
+ */
+void fasp_blas_dstr_aAxpy_dense (const REAL      alpha,
+                                 const dSTRmat  *A,
+                                 const INT       nrhs,
+                                 const REAL     *x,
+                                 REAL           *y)
+{
+    str_spmm(A, alpha, TRUE, nrhs, x, y);
+}
+
 /*!
  * \fn INT fasp_blas_dstr_diagscale (const dSTRmat *A, dSTRmat *B)
  *
@@ -1854,6 +1908,129 @@ static inline void str_spaAxpy (const REAL      alpha,
     }
 }
 
+/**
+ * \fn static void str_spmm (const dSTRmat *A, const REAL alpha, const SHORT add,
+ *                           const INT nrhs, const REAL *x, REAL *y)
+ *
+ * \brief Compute Y = alpha*A*X (+ Y if add) for a block of nrhs vectors
+ *
+ * \param A       Pointer to dSTRmat matrix
+ * \param alpha   REAL factor alpha
+ * \param add     Add to Y (TRUE) or overwrite Y (FALSE)
+ * \param nrhs    Number of vectors in X and Y
+ * \param x       Pointer to the array X (interleaved)
+ * \param y       Pointer to the array Y (interleaved)
+ *
+ * \author FASP team
+ * \date   10/16/2026
+ *
+ * \note Unlike str_spaAxpy, the bands are applied row by row (gather), so
+ *       grid points can be split among threads without write conflicts.
+ */
+static void str_spmm (const dSTRmat  *A,
+                      const REAL      alpha,
+                      const SHORT     add,
+                      const INT       nrhs,
+                      const REAL     *x,
+                      REAL           *y)
+{
+    const INT ngrid = A->ngrid;
+
+    SHORT nthreads = 1, use_openmp = FALSE;
+
+#ifdef _OPENMP
+    if ( ngrid > OPENMP_HOLDS ) {
+        use_openmp = TRUE;
+        nthreads = fasp_get_num_threads();
+    }
+#endif
+
+    if (use_openmp) {
+        INT myid, mybegin, myend;
+#ifdef _OPENMP
+#pragma omp parallel for private(myid, mybegin, myend)
+#endif
+        for (myid = 0; myid < nthreads; myid++ ) {
+            fasp_get_start_end(myid, nthreads, ngrid, &mybegin, &myend);
+            str_spmm_rows(A, mybegin, myend, alpha, add, nrhs, x, y);
+        }
+    }
+    else {
+        str_spmm_rows(A, 0, ngrid, alpha, add, nrhs, x, y);
+    }
+}
+
+/**
+ * \fn static inline void str_spmm_rows (const dSTRmat *A, const INT begin,
+ *                                       const INT end, const REAL alpha,
+ *                                       const SHORT add, const INT nrhs,
+ *                                       const REAL *x, REAL *y)
+ *
+ * \brief Compute Y = alpha*A*X (+ Y if add) for grid points begin, ..., end-1
+ *
+ * \param A       Pointer to dSTRmat matrix
+ * \param begin   First grid point
+ * \param end     Last grid point + 1
+ * \param alpha   REAL factor alpha
+ * \param add     Add to Y (TRUE) or overwrite Y (FALSE)
+ * \param nrhs    Number of vectors in X and Y
+ * \param x       Pointer to the array X (interleaved)
+ * \param y       Pointer to the array Y (interleaved)
+ *
+ * \author FASP team
+ * \date   10/16/2026
+ *
+ * \note For a band with offset w, grid point i couples to grid point i+w and the
+ *       block is stored at position i (w > 0) or i+w (w < 0) of the band.
+ */
+static inline void str_spmm_rows (const dSTRmat  *A,
+                                  const INT       begin,
+                                  const INT       end,
+                                  const REAL      alpha,
+                                  const SHORT     add,
+                                  const INT       nrhs,
+                                  const REAL     *x,
+                                  REAL           *y)
+{
+    const INT  ngrid = A->ngrid, nc = A->nc, nband = A->nband;
+    const INT  nc2 = nc*nc, ldx = nc*nrhs;
+    const INT *offsets = A->offsets;
+
+    const REAL *pA, *px, *pxc;
+    REAL       *py, *pyr, a;
+    INT         i, j, r, c, band, width, col;
+
+    for (i = begin; i < end; ++i) {
+        py = y + (size_t)i*ldx;
+        if ( !add ) for (j = 0; j < ldx; ++j) py[j] = 0.0;
+
+        for (band = -1; band < nband; ++band) {
+            if ( band < 0 ) { // diagonal band
+                col = i;
+                pA  = A->diag + (size_t)i*nc2;
+            }
+            else {
+                width = offsets[band];
+                col   = i + width;
+                if ( col < 0 || col >= ngrid ) continue;
+                pA = A->offdiag[band] + (size_t)(width < 0 ? col : i)*nc2;
+            }
+            px = x + (size_t)col*ldx;
+            for (r = 0; r < nc; ++r) {
+                pyr = py + r*nrhs;
+                for (c = 0; c < nc; ++c) {
+                    a   = alpha*pA[r*nc+c];
+                    pxc = px + c*nrhs;
+#ifdef _OPENMP
+#pragma omp simd
+#endif
+                    for (j = 0; j < nrhs; ++j) pyr[j] += a*pxc[j];
+                }
+            }
+        }
+    }
+}
+
 /*---------------------------------*/
 /*--        End of File          --*/
 /*---------------------------------*/
@@ -0,0 +1,226 @@
+/*! \file  BlaSpmvSymCSR.c
+ *
+ *  \brief Linear algebraic operations for dSymCSRmat matrices
+ *
+ *  \note  This file contains Level-1 (Bla) functions. It requires:
+ *         AuxArray.c, AuxMemory.c, and AuxThreads.c
+ *
+ *  \note  Each stored entry a_ij (j > i) is used twice: gathered into y_i and
+ *         scattered into y_j. With OpenMP, the scatter to rows owned by other
+ *         threads goes into per-thread buffers which only cover the rows between
+ *         the end of the thread's block and the largest column index it touches;
+ *         the buffers are added to y afterwards. The partition and the buffers
+ *         are kept in the matrix and reused by later SpMVs.
+ *
+ *---------------------------------------------------------------------------------
+ *  Copyright (C) 2026--Present by the FASP team. All rights reserved.
+ *  Released under the terms of the GNU Lesser General Public License 3.0 or later.
+ *---------------------------------------------------------------------------------
+ */
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+#include "fasp.h"
+#include "fasp_functs.h"
+
+/*---------------------------------*/
+/*--  Declare Private Functions  --*/
+/*---------------------------------*/
+
+#ifdef _OPENMP
+static void dsymcsr_aAxpy_omp(const REAL, const dSymCSRmat *, const REAL *, REAL *,
+                              const INT);
+#endif
+
+/*---------------------------------*/
+/*--      Public Functions       --*/
+/*---------------------------------*/
+
+/**
+ * \fn void fasp_blas_dsymcsr_mxv (const dSymCSRmat *A, const REAL *x, REAL *y)
+ *
+ * \brief Matrix-vector multiplication y = A*x for a symmetric matrix in SymCSR
+ *        format
+ *
+ * \param A   Pointer to dSymCSRmat matrix A
+ * \param x   Pointer to array x
+ * \param y   Pointer to array y
+ *
+ * \author FASP team
+ * \date   10/16/2026
+ */
+void fasp_blas_dsymcsr_mxv (const dSymCSRmat  *A,
+                            const REAL        *x,
+                            REAL              *y)
+{
+    fasp_darray_set(A->row, y, 0.0);
+    fasp_blas_dsymcsr_aAxpy(1.0, A, x, y);
+}
+
+/**
+ * \fn void fasp_blas_dsymcsr_aAxpy (const REAL alpha, const dSymCSRmat *A,
+ *                                   const REAL *x, REAL *y)
+ *
+ * \brief Matrix-vector multiplication y = alpha*A*x + y for a symmetric matrix in
+ *        SymCSR format
+ *
+ * \param alpha  REAL factor alpha
+ * \param A      Pointer to dSymCSRmat matrix A
+ * \param x      Pointer to array x
+ * \param y      Pointer to array y
+ *
+ * \author FASP team
+ * \date   10/16/2026
+ */
+void fasp_blas_dsymcsr_aAxpy (const REAL         alpha,
+                              const dSymCSRmat  *A,
+                              const REAL        *x,
+                              REAL              *y)
+{
+    const INT   n = A->row;
+    const INT  *ia = A->IA, *ja = A->JA;
+    const REAL *aj = A->val, *diag = A->diag;
+
+    INT  i, j, k;
+    REAL temp, axi;
+
+#ifdef _OPENMP
+    if ( n > OPENMP_HOLDS ) {
+        const INT nthreads = fasp_get_num_threads();
+        if ( nthreads > 1 ) {
+            dsymcsr_aAxpy_omp(alpha, A, x, y, nthreads);
+            return;
+        }
+    }
+#endif
+
+    for ( i = 0; i < n; ++i ) {
+        temp = diag[i]*x[i];
+        axi  = alpha*x[i];
+        for ( k = ia[i]; k < ia[i+1]; ++k ) {
+            j = ja[k];
+            temp += aj[k]*x[j];
+            y[j] += aj[k]*axi;
+        }
+        y[i] += alpha*temp;
+    }
+}
+
+/*---------------------------------*/
+/*--      Private Functions      --*/
+/*---------------------------------*/
+
+#ifdef _OPENMP
+
+/**
+ * \fn static void dsymcsr_aAxpy_omp (const REAL alpha, const dSymCSRmat *A,
+ *                                    const REAL *x, REAL *y, const INT nthreads)
+ *
+ * \brief Threaded y = alpha*A*x + y for a symmetric matrix in SymCSR format
+ *
+ * \param alpha     REAL factor alpha
+ * \param A         Pointer to dSymCSRmat matrix A
+ * \param x         Pointer to array x
+ * \param y         Pointer to array y
+ * \param nthreads  Number of threads
+ *
+ * \author FASP team
+ * \date   10/16/2026
+ *
+ * \note Thread t owns rows [start_t, end_t) and only writes y in its own block;
+ *       contributions to rows in [end_t, hi_t] go to its buffer. For matrices with
+ *       a small bandwidth the buffers are short, so the extra memory traffic is
+ *       negligible compared with the matrix.
+ *
+ * \note The partition and the buffers only depend on the sparsity of A and the
+ *       number of threads. They are built at the first call and kept in A, so
+ *       concurrent SpMVs with the same matrix are not allowed.
+ *
+ * Modified by FASP team on 10/16/2026: keep the partition and buffers in A
+ */
+static void dsymcsr_aAxpy_omp (const REAL         alpha,
+                               const dSymCSRmat  *A,
+                               const REAL        *x,
+                               REAL              *y,
+                               const INT          nthreads)
+{
+    const INT   n = A->row;
+    const INT  *ia = A->IA, *ja = A->JA;
+    const REAL *aj = A->val, *diag = A->diag;
+
+    dSymCSRmat *Ac = (dSymCSRmat *)A; // only the cached partition is changed
+
+    INT  *part, *hi, *off;
+    REAL *buf;
+
+    INT myid, mybegin, myend, i, j, k, s, lo, up;
+    REAL temp, axi, *mybuf;
+
+    // row blocks balanced by nonzeros and the last row each block scatters to
+    if ( Ac->part == NULL || Ac->nthreads != nthreads ) {
+
+        fasp_mem_free(Ac->part); Ac->part = NULL;
+        fasp_mem_free(Ac->work); Ac->work = NULL;
+
+        part = (INT *)fasp_mem_calloc(3*(nthreads+1), sizeof(INT));
+        hi   = part + (nthreads+1);
+        off  = hi + (nthreads+1);
+
+#pragma omp parallel for private(myid, mybegin, myend, i)
+        for ( myid = 0; myid < nthreads; myid++ ) {
+            fasp_get_start_end_nnz(myid, nthreads, n, ia, &mybegin, &myend);
+            part[myid+1] = myend; // part[0] = 0
+            hi[myid] = myend - 1;
+            for ( i = mybegin; i < myend; ++i ) {
+                if ( ia[i+1] > ia[i] ) hi[myid] = MAX(hi[myid], ja[ia[i+1]-1]);
+            }
+        }
+
+        for ( myid = 0; myid < nthreads; myid++ ) {
+            off[myid+1] = off[myid] + hi[myid] - part[myid+1] + 1;
+        }
+
+        Ac->part     = part;
+        Ac->work     = (REAL *)fasp_mem_calloc(MAX(off[nthreads],1), sizeof(REAL));
+        Ac->nthreads = nthreads;
+    }
+
+    part = Ac->part; hi = part + (nthreads+1); off = hi + (nthreads+1);
+    buf  = Ac->work;
+
+#pragma omp parallel for private(myid, mybegin, myend, mybuf, i, j, k, temp, axi)
+    for ( myid = 0; myid < nthreads; myid++ ) {
+        mybegin = part[myid]; myend = part[myid+1];
+        mybuf   = buf + off[myid]; // mybuf[j-myend] for j >= myend
+        for ( i = 0; i < off[myid+1]-off[myid]; ++i ) mybuf[i] = 0.0;
+        for ( i = mybegin; i < myend; ++i ) {
+            temp = diag[i]*x[i];
+            axi  = alpha*x[i];
+            for ( k = ia[i]; k < ia[i+1]; ++k ) {
+                j = ja[k];
+                temp += aj[k]*x[j];
+                if ( j < myend ) y[j] += aj[k]*axi;
+                else mybuf[j-myend] += aj[k]*axi;
+            }
+            y[i] += alpha*temp;
+        }
+    }
+
+    // add the buffers of the preceding blocks
+#pragma omp parallel for private(myid, s, lo, up, i)
+    for ( myid = 1; myid < nthreads; myid++ ) {
+        for ( s = 0; s < myid; s++ ) {
+            lo = MAX(part[myid], part[s+1]);
+            up = MIN(part[myid+1]-1, hi[s]);
+            for ( i = lo; i <= up; ++i ) y[i] += buf[off[s]+i-part[s+1]];
+        }
+    }
+}
+
+#endif
+
+/*---------------------------------*/
+/*--        End of File          --*/
+/*---------------------------------*/
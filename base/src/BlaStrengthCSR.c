@@ -0,0 +1,240 @@
+/*! \file  BlaStrengthCSR.c
+ *
+ *  \brief Strength-of-connection graphs of dCSRmat matrices
+ *
+ *  \note  This file contains Level-1 (Bla) functions. It requires:
+ *         AuxMemory.c, AuxMessage.c, and AuxSort.c
+ *
+ *---------------------------------------------------------------------------------
+ *  Copyright (C) 2009--Present by the FASP team. All rights reserved.
+ *  Released under the terms of the GNU Lesser General Public License 3.0 or later.
+ *---------------------------------------------------------------------------------
+ *
+ *  \note  The strength graph is shared by the classical (RS), the aggregation
+ *         (SA and UA) AMG methods, and the multicoloring of the ILU smoothers.
+ *         The rows of the graph are independent of each other, so they are
+ *         decided and filled with OpenMP; the transpose graph, which most of
+ *         the C/F splittings need, is formed in the same two passes.
+ */
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+#include "fasp.h"
+#include "fasp_functs.h"
+
+/*---------------------------------*/
+/*--      Public Functions       --*/
+/*---------------------------------*/
+
+/**
+ * \fn SHORT fasp_dcsr_strength (const dCSRmat *A, const SHORT type,
+ *                               const REAL theta, const REAL max_row_sum,
+ *                               iCSRmat *S, iCSRmat *ST)
+ *
+ * \brief Form the strength-of-connection graph of A and its transpose
+ *
+ * \param A            Pointer to dCSRmat matrix
+ * \param type         Type of strength: STRENGTH_CLS, STRENGTH_ABS, STRENGTH_SYM,
+ *                     or STRENGTH_SUM
+ * \param theta        Strength threshold
+ * \param max_row_sum  Maximal row sum parameter (STRENGTH_CLS and STRENGTH_ABS)
+ * \param S            Pointer to the strength graph (output)
+ * \param ST           Pointer to the transpose of S (output; skipped if NULL)
+ *
+ * \return             FASP_SUCCESS if successed; otherwise, error information.
+ *
+ * \author FASP team
+ * \date   10/16/2026
+ *
+ * \note j is a strong connection of i, with m_i = max_{k != i} |a_ik|, if
+ *       STRENGTH_CLS: j != i and -a_ij > theta * m_i;
+ *       STRENGTH_ABS: j != i and |a_ij| > theta * m_i;
+ *       STRENGTH_SYM: j == i or a_ij^2 >= theta^2 |a_ii a_jj|;
+ *       STRENGTH_SUM: j == i or |a_ij| > theta * sum_k |a_ik|.
+ *       For STRENGTH_CLS and STRENGTH_ABS, all connections of row i are weak if
+ *       sum_k |a_ik| < (2 - max_row_sum) |a_ii|.
+ *
+ * \note The rows of S keep the order of the rows of A and S->val is NULL. The
+ *       rows of ST are in ascending order, the same as given by fasp_icsr_trans.
+ */
+SHORT fasp_dcsr_strength (const dCSRmat  *A,
+                          const SHORT     type,
+                          const REAL      theta,
+                          const REAL      max_row_sum,
+                          iCSRmat        *S,
+                          iCSRmat        *ST)
+{
+    const INT    row = A->row, col = A->col, nnz = A->nnz;
+    const INT  * ia = A->IA, * ja = A->JA;
+    const REAL * aj = A->val;
+    const REAL   theta2 = theta * theta;
+    const size_t mark = fasp_arena_mark(NULL);
+
+    // local variables
+    SHORT  use_openmp = FALSE;
+    INT    i, j, k, pos, count;
+    REAL   aii, row_scl, row_sum, tol;
+    INT  * SIA, * SJA, * STIA = NULL, * STJA = NULL, * next = NULL;
+    REAL * dval = NULL;
+    SHORT* strong;
+
+#if DEBUG_MODE > 0
+    printf("### DEBUG: [-Begin-] %s ...\n", __FUNCTION__);
+    printf("### DEBUG: nr=%d, nc=%d, nnz=%d\n", row, col, nnz);
+#endif
+
+    if ( type < STRENGTH_CLS || type > STRENGTH_SUM ) {
+        printf("### ERROR: Unknown strength type %d! [%s]\n", type, __FUNCTION__);
+        return ERROR_INPUT_PAR;
+    }
+
+#ifdef _OPENMP
+    if ( row > OPENMP_HOLDS ) use_openmp = TRUE;
+#endif
+
+    // strong[k] marks the strong connection at the k-th nonzero of A
+    strong = (SHORT *)fasp_arena_calloc(NULL, MAX(nnz,1), sizeof(SHORT));
+
+    SIA = (INT *)fasp_mem_calloc(row+1, sizeof(INT));
+    if ( ST != NULL ) STIA = (INT *)fasp_mem_calloc(col+1, sizeof(INT));
+
+    // the symmetric strength needs the diagonal of all rows in advance
+    if ( type == STRENGTH_SYM ) {
+        dval = (REAL *)fasp_arena_calloc(NULL, MAX(row,1), sizeof(REAL));
+#ifdef _OPENMP
+#pragma omp parallel for private(i, k) if (use_openmp)
+#endif
+        for ( i = 0; i < row; ++i ) {
+            for ( k = ia[i]; k < ia[i+1]; ++k ) {
+                if ( ja[k] == i ) { dval[i] = aj[k]; break; }
+            }
+        }
+    }
+
+    // Pass 1: decide the strong connections and count them by rows and columns
+#ifdef _OPENMP
+#pragma omp parallel for private(i, j, k, count, aii, row_scl, row_sum, tol) \
+                         if (use_openmp)
+#endif
+    for ( i = 0; i < row; ++i ) {
+
+        count = 0;
+
+        switch ( type ) {
+
+            case STRENGTH_SYM:
+                for ( k = ia[i]; k < ia[i+1]; ++k ) {
+                    j = ja[k];
+                    if ( j == i || aj[k]*aj[k] >= theta2*ABS(dval[i]*dval[j]) ) {
+                        strong[k] = TRUE; count++;
+                    }
+                }
+                break;
+
+            case STRENGTH_SUM:
+                row_sum = 0.0;
+                for ( k = ia[i]; k < ia[i+1]; ++k ) row_sum += ABS(aj[k]);
+                tol = theta * row_sum;
+                for ( k = ia[i]; k < ia[i+1]; ++k ) {
+                    if ( ja[k] == i || ABS(aj[k]) > tol ) {
+                        strong[k] = TRUE; count++;
+                    }
+                }
+                break;
+
+            default: // STRENGTH_CLS or STRENGTH_ABS
+                aii = row_scl = row_sum = 0.0;
+                for ( k = ia[i]; k < ia[i+1]; ++k ) {
+                    row_sum += ABS(aj[k]);
+                    if ( ja[k] == i ) aii = aj[k];
+                    else row_scl = MAX(row_scl, ABS(aj[k])); // largest abs
+                }
+
+                // entire row is weak if it is strongly diagonal-dominant
+                if ( row_sum < (2 - max_row_sum) * ABS(aii) ) break;
+
+                tol = theta * row_scl;
+                for ( k = ia[i]; k < ia[i+1]; ++k ) {
+                    if ( ja[k] == i ) continue; // diagonal is never strong
+                    if ( type == STRENGTH_ABS ? ABS(aj[k]) > tol : -aj[k] > tol ) {
+                        strong[k] = TRUE; count++;
+                    }
+                }
+                break;
+
+        }
+
+        SIA[i+1] = count;
+
+        if ( STIA != NULL ) {
+            for ( k = ia[i]; k < ia[i+1]; ++k ) {
+                if ( !strong[k] ) continue;
+#ifdef _OPENMP
+#pragma omp atomic
+#endif
+                STIA[ja[k]+1]++;
+            }
+        }
+
+    } // end for i
+
+    for ( i = 0; i < row; ++i ) SIA[i+1] += SIA[i];
+    SJA = (INT *)fasp_mem_calloc(MAX(SIA[row],1), sizeof(INT));
+
+    if ( STIA != NULL ) {
+        for ( j = 0; j < col; ++j ) STIA[j+1] += STIA[j];
+        STJA = (INT *)fasp_mem_calloc(MAX(STIA[col],1), sizeof(INT));
+        next = (INT *)fasp_arena_alloc(NULL, MAX(col,1), sizeof(INT));
+        for ( j = 0; j < col; ++j ) next[j] = STIA[j];
+    }
+
+    // Pass 2: fill in the strong connections of S and of ST
+#ifdef _OPENMP
+#pragma omp parallel for private(i, j, k, pos, count) if (use_openmp)
+#endif
+    for ( i = 0; i < row; ++i ) {
+        pos = SIA[i];
+        for ( k = ia[i]; k < ia[i+1]; ++k ) {
+            if ( !strong[k] ) continue;
+            j = ja[k];
+            SJA[pos++] = j;
+            if ( STJA != NULL ) {
+#ifdef _OPENMP
+#pragma omp atomic capture
+#endif
+                count = next[j]++;
+                STJA[count] = i;
+            }
+        }
+    }
+
+    // the rows of ST are filled in a random order by threads: sort them
+    if ( STJA != NULL && use_openmp ) {
+#ifdef _OPENMP
+#pragma omp parallel for private(j) schedule(dynamic, 256)
+#endif
+        for ( j = 0; j < col; ++j ) fasp_aux_iQuickSort(STJA, STIA[j], STIA[j+1]-1);
+    }
+
+    S->row = row; S->col = col; S->nnz = SIA[row];
+    S->IA  = SIA; S->JA  = SJA; S->val = NULL;
+
+    if ( ST != NULL ) {
+        ST->row = col; ST->col = row; ST->nnz = STIA[col];
+        ST->IA  = STIA; ST->JA  = STJA; ST->val = NULL;
+    }
+
+    fasp_arena_release(NULL, mark);
+
+#if DEBUG_MODE > 0
+    printf("### DEBUG: [--End--] %s ...\n", __FUNCTION__);
+#endif
+
+    return FASP_SUCCESS;
+}
+
+/*---------------------------------*/
+/*--        End of File          --*/
+/*---------------------------------*/
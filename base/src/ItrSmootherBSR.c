@@ -1620,7 +1620,7 @@ void fasp_smoother_dbsr_ilu (dBSRmat *A,
     return;
     
 MEMERR:
-    printf("### ERROR: ILU needs %d memory, only %d available! [%s:%d]\n",
+    printf("### ERROR: ILU needs " INTFMT " memory, only " INTFMT " available! [%s:%d]\n",
            memneed, iludata->nwork, __FILE__, __LINE__);
     fasp_chkerr(ERROR_ALLOC_MEM, __FUNCTION__);
 }
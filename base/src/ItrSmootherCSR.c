@@ -21,6 +21,13 @@
 #include "fasp.h"
 #include "fasp_functs.h"
 
+/*---------------------------------*/
+/*--  Declare Private Functions  --*/
+/*---------------------------------*/
+
+static void dcsr_gs_mv_sweep(const INT, REAL *, const dCSRmat *, const REAL *,
+                             const INT, const INT *, const INT);
+
 /*---------------------------------*/
 /*--      Public Functions       --*/
 /*---------------------------------*/
@@ -1115,7 +1122,7 @@ void fasp_smoother_dcsr_ilu (dCSRmat *A,
     return;
     
 MEMERR:
-    printf("### ERROR: ILU needs %d memory, only %d available! [%s:%d]\n",
+    printf("### ERROR: ILU needs " INTFMT " memory, only " INTFMT " available! [%s:%d]\n",
            memneed, iludata->nwork, __FILE__, __LINE__);
     fasp_chkerr(ERROR_ALLOC_MEM, __FUNCTION__);
 }
@@ -1398,6 +1405,206 @@ void fasp_smoother_dcsr_L1diag (dvector    *u,
     return;
 }
 
+/**
+ * \fn void fasp_smoother_dcsr_jacobi_mv (const INT nrhs, REAL *u, dCSRmat *A,
+ *                                        const REAL *b, INT L, const REAL w)
+ *
+ * \brief Weighted Jacobi method as a smoother for a block of vectors
+ *
+ * \param nrhs   Number of vectors in u and b
+ * \param u      Pointer to the unknowns (IN: initial, OUT: approximation)
+ * \param A      Pointer to dCSRmat: the coefficient matrix
+ * \param b      Pointer to the right hand sides
+ * \param L      Number of iterations
+ * \param w      Over-relaxation weight
+ *
+ * \author FASP team
+ * \date   10/16/2026
+ *
+ * \note u and b are stored interleaved: entry i of vector j is u[i*nrhs+j]. Each
+ *       sweep reads A once for all vectors.
+ */
+void fasp_smoother_dcsr_jacobi_mv (const INT    nrhs,
+                                   REAL        *u,
+                                   dCSRmat     *A,
+                                   const REAL  *b,
+                                   INT          L,
+                                   const REAL   w)
+{
+    const INT    n  = A->row;
+    const INT   *ia = A->IA, *ja = A->JA;
+    const REAL  *aval = A->val;
+
+    // local variables
+    INT   i, j, k, c;
+    REAL  a, d;
+
+    const size_t mark = fasp_arena_mark(NULL);
+    REAL *t = (REAL *)fasp_arena_alloc(NULL, (size_t)n*nrhs, sizeof(REAL));
+
+    while (L--) {
+
+#ifdef _OPENMP
+#pragma omp parallel for private(i, j, k, c, a, d) if(n>OPENMP_HOLDS)
+#endif
+        for ( i = 0; i < n; ++i ) {
+            REAL *ti = t + (size_t)i*nrhs;
+            for ( c = 0; c < nrhs; ++c ) ti[c] = b[(size_t)i*nrhs+c];
+            d = 0.0;
+            for ( k = ia[i]; k < ia[i+1]; ++k ) {
+                j = ja[k];
+                if ( i != j ) {
+                    const REAL *uj = u + (size_t)j*nrhs;
+                    a = aval[k];
+                    for ( c = 0; c < nrhs; ++c ) ti[c] -= a*uj[c];
+                }
+                else d = aval[k];
+            }
+            if ( ABS(d) > SMALLREAL ) {
+                d = w/d;
+                for ( c = 0; c < nrhs; ++c ) ti[c] *= d;
+            }
+            else {
+                for ( c = 0; c < nrhs; ++c ) ti[c] = w*u[(size_t)i*nrhs+c];
+            }
+        }
+
+#ifdef _OPENMP
+#pragma omp parallel for private(i) if(n>OPENMP_HOLDS)
+#endif
+        for ( i = 0; i < n*nrhs; ++i ) u[i] = (1.0-w)*u[i] + t[i];
+
+    } // end while
+
+    fasp_arena_release(NULL, mark);
+}
+
+/**
+ * \fn void fasp_smoother_dcsr_gs_mv (const INT nrhs, REAL *u, dCSRmat *A,
+ *                                    const REAL *b, INT L, const INT *mark,
+ *                                    const INT order)
+ *
+ * \brief Gauss-Seidel method as a smoother for a block of vectors
+ *
+ * \param nrhs   Number of vectors in u and b
+ * \param u      Pointer to the unknowns (IN: initial, OUT: approximation)
+ * \param A      Pointer to dCSRmat: the coefficient matrix
+ * \param b      Pointer to the right hand sides
+ * \param L      Number of iterations
+ * \param mark   C/F marker array (or NULL for the natural order)
+ * \param order  Natural order: ascending (>0) or descending (<0);
+ *               C/F order: FPFIRST or CPFIRST
+ *
+ * \author FASP team
+ * \date   10/16/2026
+ *
+ * \note u and b are stored interleaved: entry i of vector j is u[i*nrhs+j]. Each
+ *       sweep reads A once for all vectors. The C/F ordering is the same as in
+ *       fasp_smoother_dcsr_gs_cf.
+ */
+void fasp_smoother_dcsr_gs_mv (const INT    nrhs,
+                               REAL        *u,
+                               dCSRmat     *A,
+                               const REAL  *b,
+                               INT          L,
+                               const INT   *mark,
+                               const INT    order)
+{
+    while (L--) {
+        if ( mark == NULL ) {
+            dcsr_gs_mv_sweep(nrhs, u, A, b, order > 0 ? 1 : -1, NULL, 0);
+        }
+        else if ( order == FPFIRST ) {
+            dcsr_gs_mv_sweep(nrhs, u, A, b, 1, mark, -1);
+            dcsr_gs_mv_sweep(nrhs, u, A, b, 1, mark,  1);
+        }
+        else {
+            dcsr_gs_mv_sweep(nrhs, u, A, b, 1, mark,  1);
+            dcsr_gs_mv_sweep(nrhs, u, A, b, 1, mark, -1);
+        }
+    }
+}
+
+/*---------------------------------*/
+/*--      Private Functions      --*/
+/*---------------------------------*/
+
+/**
+ * \fn static void dcsr_gs_mv_sweep (const INT nrhs, REAL *u, const dCSRmat *A,
+ *                                   const REAL *b, const INT s, const INT *mark,
+ *                                   const INT pick)
+ *
+ * \brief One Gauss-Seidel sweep for a block of vectors
+ *
+ * \param nrhs   Number of vectors in u and b
+ * \param u      Pointer to the unknowns (interleaved)
+ * \param A      Pointer to dCSRmat: the coefficient matrix
+ * \param b      Pointer to the right hand sides (interleaved)
+ * \param s      Ascending (1) or descending (-1) sweep
+ * \param mark   C/F marker array (or NULL)
+ * \param pick   Relax all rows (0), C points only (1), or F points only (-1)
+ *
+ * \author FASP team
+ * \date   10/16/2026
+ *
+ * \note With OpenMP, each thread relaxes a contiguous range of rows with the
+ *       latest values it can see, as in fasp_smoother_dcsr_gs.
+ */
+static void dcsr_gs_mv_sweep (const INT       nrhs,
+                              REAL           *u,
+                              const dCSRmat  *A,
+                              const REAL     *b,
+                              const INT       s,
+                              const INT      *mark,
+                              const INT       pick)
+{
+    const INT    n  = A->row;
+    const INT   *ia = A->IA, *ja = A->JA;
+    const REAL  *aval = A->val;
+
+    INT   myid, mybegin, myend, i, ii, j, k, c;
+    REAL  a, d;
+
+    SHORT nthreads = 1;
+
+#ifdef _OPENMP
+    if ( n > OPENMP_HOLDS ) nthreads = fasp_get_num_threads();
+#endif
+
+    const size_t amark = fasp_arena_mark(NULL);
+    REAL *work = (REAL *)fasp_arena_alloc(NULL, (size_t)nthreads*nrhs, sizeof(REAL));
+
+#ifdef _OPENMP
+#pragma omp parallel for private(myid, mybegin, myend, i, ii, j, k, c, a, d) if(nthreads>1)
+#endif
+    for ( myid = 0; myid < nthreads; myid++ ) {
+        REAL *t = work + myid*nrhs;
+        fasp_get_start_end(myid, nthreads, n, &mybegin, &myend);
+        for ( ii = mybegin; ii < myend; ++ii ) {
+            i = (s > 0) ? ii : mybegin + myend - 1 - ii;
+            if ( pick ==  1 && mark[i] != 1 ) continue;
+            if ( pick == -1 && mark[i] == 1 ) continue;
+            for ( c = 0; c < nrhs; ++c ) t[c] = b[(size_t)i*nrhs+c];
+            d = 0.0;
+            for ( k = ia[i]; k < ia[i+1]; ++k ) {
+                j = ja[k];
+                if ( i != j ) {
+                    const REAL *uj = u + (size_t)j*nrhs;
+                    a = aval[k];
+                    for ( c = 0; c < nrhs; ++c ) t[c] -= a*uj[c];
+                }
+                else d = aval[k];
+            }
+            if ( ABS(d) > SMALLREAL ) {
+                d = 1.0/d;
+                for ( c = 0; c < nrhs; ++c ) u[(size_t)i*nrhs+c] = t[c]*d;
+            }
+        }
+    }
+
+    fasp_arena_release(NULL, amark);
+}
+
 #if 0
 /**
  * \fn static dCSRmat form_contractor (dCSRmat *A, const INT smoother, const INT steps,
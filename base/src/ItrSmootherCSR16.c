@@ -0,0 +1,240 @@
+/*! \file  ItrSmootherCSR16.c
+ *
+ *  \brief Smoothers for dCSR16mat matrices
+ *
+ *  \note  This file contains Level-2 (Itr) functions. It requires:
+ *         AuxThreads.c
+ *
+ *  \note  The sweeps are the same as those of fasp_smoother_dcsr_gs,
+ *         fasp_smoother_dcsr_gs_cf, and fasp_smoother_dcsr_sgs: with OpenMP, the
+ *         rows are split into blocks and each thread does Gauss-Seidel in its own
+ *         block. Only the column indices are read from the 16-bit deltas.
+ *
+ *---------------------------------------------------------------------------------
+ *  Copyright (C) 2026--Present by the FASP team. All rights reserved.
+ *  Released under the terms of the GNU Lesser General Public License 3.0 or later.
+ *---------------------------------------------------------------------------------
+ */
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+#include "fasp.h"
+#include "fasp_functs.h"
+
+/*---------------------------------*/
+/*--  Declare Private Functions  --*/
+/*---------------------------------*/
+
+static inline void dcsr16_gs_row(const dCSR16mat *, const REAL *, REAL *, const INT);
+static void dcsr16_gs_sweep(const dCSR16mat *, const REAL *, REAL *, const INT,
+                            const INT, const INT, const INT *, const SHORT);
+
+/*---------------------------------*/
+/*--      Public Functions       --*/
+/*---------------------------------*/
+
+/**
+ * \fn void fasp_smoother_dcsr16_gs (dvector *u, const INT i_1, const INT i_n,
+ *                                   const INT s, const dCSR16mat *A,
+ *                                   const dvector *b, INT L)
+ *
+ * \brief Gauss-Seidel method as a smoother for a sparse matrix in CSR16 format
+ *
+ * \param u    Pointer to dvector: the unknowns (IN: initial, OUT: approximation)
+ * \param i_1  Starting index
+ * \param i_n  Ending index
+ * \param s    Increasing step (1 or -1)
+ * \param A    Pointer to dCSR16mat: the coefficient matrix
+ * \param b    Pointer to dvector: the right hand side
+ * \param L    Number of iterations
+ *
+ * \author FASP team
+ * \date   10/16/2026
+ */
+void fasp_smoother_dcsr16_gs (dvector          *u,
+                              const INT         i_1,
+                              const INT         i_n,
+                              const INT         s,
+                              const dCSR16mat  *A,
+                              const dvector    *b,
+                              INT               L)
+{
+    while ( L-- ) dcsr16_gs_sweep(A, b->val, u->val, i_1, i_n, s, NULL, FALSE);
+}
+
+/**
+ * \fn void fasp_smoother_dcsr16_gs_cf (dvector *u, const dCSR16mat *A,
+ *                                      const dvector *b, INT L, const INT *mark,
+ *                                      const INT order)
+ *
+ * \brief Gauss-Seidel smoother with C/F ordering for a sparse matrix in CSR16
+ *        format
+ *
+ * \param u      Pointer to dvector: the unknowns (IN: initial, OUT: approximation)
+ * \param A      Pointer to dCSR16mat: the coefficient matrix
+ * \param b      Pointer to dvector: the right hand side
+ * \param L      Number of iterations
+ * \param mark   C/F marker array
+ * \param order  C/F ordering: -1: F-first; 1: C-first
+ *
+ * \author FASP team
+ * \date   10/16/2026
+ */
+void fasp_smoother_dcsr16_gs_cf (dvector          *u,
+                                 const dCSR16mat  *A,
+                                 const dvector    *b,
+                                 INT               L,
+                                 const INT        *mark,
+                                 const INT         order)
+{
+    const INT n = b->row;
+
+    while ( L-- ) {
+        if ( order == FPFIRST ) {
+            dcsr16_gs_sweep(A, b->val, u->val, 0, n-1, 1, mark, FALSE);
+            dcsr16_gs_sweep(A, b->val, u->val, 0, n-1, 1, mark, TRUE);
+        }
+        else {
+            dcsr16_gs_sweep(A, b->val, u->val, 0, n-1, 1, mark, TRUE);
+            dcsr16_gs_sweep(A, b->val, u->val, 0, n-1, 1, mark, FALSE);
+        }
+    }
+}
+
+/**
+ * \fn void fasp_smoother_dcsr16_sgs (dvector *u, const dCSR16mat *A,
+ *                                    const dvector *b, INT L)
+ *
+ * \brief Symmetric Gauss-Seidel method as a smoother for a sparse matrix in CSR16
+ *        format
+ *
+ * \param u      Pointer to dvector: the unknowns (IN: initial, OUT: approximation)
+ * \param A      Pointer to dCSR16mat: the coefficient matrix
+ * \param b      Pointer to dvector: the right hand side
+ * \param L      Number of iterations
+ *
+ * \author FASP team
+ * \date   10/16/2026
+ */
+void fasp_smoother_dcsr16_sgs (dvector          *u,
+                               const dCSR16mat  *A,
+                               const dvector    *b,
+                               INT               L)
+{
+    const INT n = b->row;
+
+    while ( L-- ) {
+        dcsr16_gs_sweep(A, b->val, u->val, 0, n-1, 1, NULL, FALSE);
+        dcsr16_gs_sweep(A, b->val, u->val, n-1, 0, -1, NULL, FALSE);
+    }
+}
+
+/*---------------------------------*/
+/*--      Private Functions      --*/
+/*---------------------------------*/
+
+/**
+ * \fn static inline void dcsr16_gs_row (const dCSR16mat *A, const REAL *b,
+ *                                       REAL *u, const INT i)
+ *
+ * \brief Gauss-Seidel update of the i-th unknown
+ *
+ * \param A   Pointer to dCSR16mat matrix A
+ * \param b   Pointer to the right hand side
+ * \param u   Pointer to the unknowns
+ * \param i   Row index
+ *
+ * \author FASP team
+ * \date   10/16/2026
+ */
+static inline void dcsr16_gs_row (const dCSR16mat  *A,
+                                  const REAL       *b,
+                                  REAL             *u,
+                                  const INT         i)
+{
+    const INT    *ia = A->IA, *JE = A->JE;
+    const SHORT  *JD = A->JD;
+    const REAL   *aval = A->val;
+
+    INT  j, k, e, j0;
+    REAL t = b[i], d = 0.0;
+
+    if ( A->base[i] >= 0 ) {
+        j0 = A->base[i];
+        for ( k = ia[i]; k < ia[i+1]; ++k ) {
+            j = j0 + JD[k];
+            if ( j != i ) t -= aval[k]*u[j];
+            else d = aval[k];
+        }
+    }
+    else {
+        e = -A->base[i]-1; j0 = JE[e++];
+        for ( k = ia[i]; k < ia[i+1]; ++k ) {
+            j = ( JD[k] == CSR16_ESCAPE ) ? JE[e++] : j0 + JD[k];
+            if ( j != i ) t -= aval[k]*u[j];
+            else d = aval[k];
+        }
+    }
+
+    if ( ABS(d) > SMALLREAL ) u[i] = t/d;
+}
+
+/**
+ * \fn static void dcsr16_gs_sweep (const dCSR16mat *A, const REAL *b, REAL *u,
+ *                                  const INT i_1, const INT i_n, const INT s,
+ *                                  const INT *mark, const SHORT cpts)
+ *
+ * \brief One Gauss-Seidel sweep from row i_1 to row i_n
+ *
+ * \param A     Pointer to dCSR16mat matrix A
+ * \param b     Pointer to the right hand side
+ * \param u     Pointer to the unknowns
+ * \param i_1   Starting index
+ * \param i_n   Ending index
+ * \param s     Increasing step (1 or -1)
+ * \param mark  C/F marker array (NULL: all rows)
+ * \param cpts  Only update C points (mark = 1) if TRUE, and other points if FALSE
+ *
+ * \author FASP team
+ * \date   10/16/2026
+ */
+static void dcsr16_gs_sweep (const dCSR16mat  *A,
+                             const REAL       *b,
+                             REAL             *u,
+                             const INT         i_1,
+                             const INT         i_n,
+                             const INT         s,
+                             const INT        *mark,
+                             const SHORT       cpts)
+{
+    const INT N = ABS(i_n - i_1) + 1;
+
+    INT i;
+
+#ifdef _OPENMP
+    if ( N > OPENMP_HOLDS ) {
+        const INT nthreads = fasp_get_num_threads();
+        INT myid, mybegin, myend;
+#pragma omp parallel for private(myid, mybegin, myend, i)
+        for ( myid = 0; myid < nthreads; myid++ ) {
+            fasp_get_start_end(myid, nthreads, N, &mybegin, &myend);
+            for ( ; mybegin < myend; ++mybegin ) {
+                i = i_1 + s*mybegin;
+                if ( mark == NULL || (mark[i] == 1) == cpts ) dcsr16_gs_row(A, b, u, i);
+            }
+        }
+        return;
+    }
+#endif
+
+    for ( i = 0; i < N; ++i ) {
+        if ( mark == NULL || (mark[i_1+s*i] == 1) == cpts )
+            dcsr16_gs_row(A, b, u, i_1+s*i);
+    }
+}
+
+/*---------------------------------*/
+/*--        End of File          --*/
+/*---------------------------------*/
@@ -75,7 +75,7 @@ void fasp_smoother_dcsr_gscr (INT   pt,
                             u[i]=t/d;
                         }
                         else {
-                            printf("### ERROR: Diagonal entry_%d (%e) close to 0!\n",
+                            printf("### ERROR: Diagonal entry_" INTFMT " (%e) close to 0!\n",
                                    i, d);
                             fasp_chkerr(ERROR_MISC, __FUNCTION__);
                         }
@@ -63,6 +63,8 @@ static void fasp_aux_norm1_ (INT *, INT *, REAL *, INT *, REAL *);
  *
  * \author Fei Cao, Xiaozhe Hu
  * \date   05/24/2012
+ *
+ * Modified by FASP team on 10/16/2026: call fasp_smoother_dcsr_poly_eig
  */
 void fasp_smoother_dcsr_poly (dCSRmat *Amat, 
                               dvector *brhs, 
@@ -70,6 +72,38 @@ void fasp_smoother_dcsr_poly (dCSRmat *Amat,
                               INT      n,
                               INT      ndeg,
                               INT      L)
+{
+    fasp_smoother_dcsr_poly_eig(Amat, brhs, usol, n, ndeg, L, 0.0);
+}
+
+/**
+ * \fn void fasp_smoother_dcsr_poly_eig (dCSRmat *Amat, dvector *brhs,
+ *                                       dvector *usol, INT n, INT ndeg, INT L,
+ *                                       const REAL emax)
+ *
+ * \brief poly approx to A^{-1} as MG smoother with a given spectrum bound
+ *
+ * \param Amat  Pointer to stiffness matrix, consider square matrix.
+ * \param brhs  Pointer to right hand side
+ * \param usol  Pointer to solution 
+ * \param n     Problem size 
+ * \param ndeg  Degree of poly 
+ * \param L     Number of iterations
+ * \param emax  Upper bound of the spectrum of inv(D)*A; the inf norm of inv(D)*A
+ *              is used if emax <= 0
+ *
+ * \author FASP team
+ * \date   10/16/2026
+ *
+ * \note The AMG setup caches emax in AMG_data, see fasp_amg_data_eig_bounds.
+ */
+void fasp_smoother_dcsr_poly_eig (dCSRmat    *Amat,
+                                  dvector    *brhs,
+                                  dvector    *usol,
+                                  INT         n,
+                                  INT         ndeg,
+                                  INT         L,
+                                  const REAL  emax)
 {
     // local variables
     INT i;
@@ -90,8 +124,11 @@ void fasp_smoother_dcsr_poly (dCSRmat *Amat,
     // get the inverse of the diagonal of A
     Diaginv(Amat, Dinv);
     
-    // set up parameter
-    mu0 = DinvAnorminf(Amat, Dinv); // get the inf norm of Dinv*A;
+    // set up parameter: upper bound of the spectrum of Dinv*A
+    if ( emax > 0.0 )
+        mu0 = emax;
+    else
+        mu0 = DinvAnorminf(Amat, Dinv); // get the inf norm of Dinv*A;
     
     mu0 = 1.0/mu0; mu1 = 4.0*mu0; // default set 8;
     smu0 =  sqrt(mu0); smu1 = sqrt(mu1);
@@ -0,0 +1,305 @@
+/*! \file  ItrSmootherCSRsp.c
+ *
+ *  \brief Smoothers for dCSRmat matrices with single precision values
+ *
+ *  \note  This file contains Level-2 (Itr) functions. It requires:
+ *         AuxMemory.c and AuxThreads.c
+ *
+ *  \note  The values of A are given in a separate SREAL array, and only the
+ *         sparsity pattern of the dCSRmat is used. The values are promoted to
+ *         REAL and the sums are accumulated in double precision. The sweeps are
+ *         the same as those of fasp_smoother_dcsr_gs, fasp_smoother_dcsr_gs_cf,
+ *         fasp_smoother_dcsr_sgs, and fasp_smoother_dcsr_jacobi.
+ *
+ *---------------------------------------------------------------------------------
+ *  Copyright (C) 2026--Present by the FASP team. All rights reserved.
+ *  Released under the terms of the GNU Lesser General Public License 3.0 or later.
+ *---------------------------------------------------------------------------------
+ */
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+#include "fasp.h"
+#include "fasp_functs.h"
+
+/*---------------------------------*/
+/*--  Declare Private Functions  --*/
+/*---------------------------------*/
+
+static inline void dcsr_gs_row_sp(const dCSRmat *, const SREAL *, const REAL *,
+                                  REAL *, const INT);
+static void dcsr_gs_sweep_sp(const dCSRmat *, const SREAL *, const REAL *, REAL *,
+                             const INT, const INT, const INT, const INT *,
+                             const SHORT);
+
+/*---------------------------------*/
+/*--      Public Functions       --*/
+/*---------------------------------*/
+
+/**
+ * \fn void fasp_smoother_dcsr_jacobi_sp (dvector *u, const INT i_1, const INT i_n,
+ *                                        const INT s, const dCSRmat *A,
+ *                                        const SREAL *val, const dvector *b,
+ *                                        INT L, const REAL w)
+ *
+ * \brief Weighted Jacobi method as a smoother with single precision values of A
+ *
+ * \param u    Pointer to dvector: the unknowns (IN: initial, OUT: approximation)
+ * \param i_1  Starting index
+ * \param i_n  Ending index
+ * \param s    Increasing step (1 or -1)
+ * \param A    Pointer to dCSRmat: the coefficient matrix (only IA and JA are used)
+ * \param val  Single precision values of A
+ * \param b    Pointer to dvector: the right hand side
+ * \param L    Number of iterations
+ * \param w    Over-relaxation weight
+ *
+ * \author FASP team
+ * \date   10/16/2026
+ */
+void fasp_smoother_dcsr_jacobi_sp (dvector          *u,
+                                   const INT         i_1,
+                                   const INT         i_n,
+                                   const INT         s,
+                                   const dCSRmat    *A,
+                                   const SREAL      *val,
+                                   const dvector    *b,
+                                   INT               L,
+                                   const REAL        w)
+{
+    const INT    ibegin = MIN(i_1, i_n), iend = MAX(i_1, i_n) + 1;
+    const INT   *ia = A->IA, *ja = A->JA;
+    const REAL  *bval = b->val;
+    REAL        *uval = u->val;
+
+    INT   i, k;
+    REAL  d;
+    REAL *t = (REAL *)fasp_mem_calloc(MAX(iend,1), sizeof(REAL));
+
+    while ( L-- ) {
+
+#ifdef _OPENMP
+#pragma omp parallel for private(i, k, d) if (iend-ibegin > OPENMP_HOLDS)
+#endif
+        for ( i = ibegin; i < iend; ++i ) {
+            t[i] = bval[i]; d = 0.0;
+            for ( k = ia[i]; k < ia[i+1]; ++k ) {
+                if ( ja[k] != i ) t[i] -= (REAL)val[k]*uval[ja[k]];
+                else d = (REAL)val[k];
+            }
+            t[i] = ( ABS(d) > SMALLREAL ) ? (1-w)*uval[i] + w*t[i]/d : uval[i];
+        }
+
+#ifdef _OPENMP
+#pragma omp parallel for if (iend-ibegin > OPENMP_HOLDS)
+#endif
+        for ( i = ibegin; i < iend; ++i ) uval[i] = t[i];
+
+    }
+
+    fasp_mem_free(t); t = NULL;
+}
+
+/**
+ * \fn void fasp_smoother_dcsr_gs_sp (dvector *u, const INT i_1, const INT i_n,
+ *                                    const INT s, const dCSRmat *A,
+ *                                    const SREAL *val, const dvector *b, INT L)
+ *
+ * \brief Gauss-Seidel method as a smoother with single precision values of A
+ *
+ * \param u    Pointer to dvector: the unknowns (IN: initial, OUT: approximation)
+ * \param i_1  Starting index
+ * \param i_n  Ending index
+ * \param s    Increasing step (1 or -1)
+ * \param A    Pointer to dCSRmat: the coefficient matrix (only IA and JA are used)
+ * \param val  Single precision values of A
+ * \param b    Pointer to dvector: the right hand side
+ * \param L    Number of iterations
+ *
+ * \author FASP team
+ * \date   10/16/2026
+ */
+void fasp_smoother_dcsr_gs_sp (dvector          *u,
+                               const INT         i_1,
+                               const INT         i_n,
+                               const INT         s,
+                               const dCSRmat    *A,
+                               const SREAL      *val,
+                               const dvector    *b,
+                               INT               L)
+{
+    while ( L-- ) dcsr_gs_sweep_sp(A, val, b->val, u->val, i_1, i_n, s, NULL, FALSE);
+}
+
+/**
+ * \fn void fasp_smoother_dcsr_gs_cf_sp (dvector *u, const dCSRmat *A,
+ *                                       const SREAL *val, const dvector *b, INT L,
+ *                                       const INT *mark, const INT order)
+ *
+ * \brief Gauss-Seidel smoother with C/F ordering and single precision values of A
+ *
+ * \param u      Pointer to dvector: the unknowns (IN: initial, OUT: approximation)
+ * \param A      Pointer to dCSRmat: the coefficient matrix (only IA and JA are used)
+ * \param val    Single precision values of A
+ * \param b      Pointer to dvector: the right hand side
+ * \param L      Number of iterations
+ * \param mark   C/F marker array
+ * \param order  C/F ordering: -1: F-first; 1: C-first
+ *
+ * \author FASP team
+ * \date   10/16/2026
+ */
+void fasp_smoother_dcsr_gs_cf_sp (dvector          *u,
+                                  const dCSRmat    *A,
+                                  const SREAL      *val,
+                                  const dvector    *b,
+                                  INT               L,
+                                  const INT        *mark,
+                                  const INT         order)
+{
+    const INT n = b->row;
+
+    while ( L-- ) {
+        if ( order == FPFIRST ) {
+            dcsr_gs_sweep_sp(A, val, b->val, u->val, 0, n-1, 1, mark, FALSE);
+            dcsr_gs_sweep_sp(A, val, b->val, u->val, 0, n-1, 1, mark, TRUE);
+        }
+        else {
+            dcsr_gs_sweep_sp(A, val, b->val, u->val, 0, n-1, 1, mark, TRUE);
+            dcsr_gs_sweep_sp(A, val, b->val, u->val, 0, n-1, 1, mark, FALSE);
+        }
+    }
+}
+
+/**
+ * \fn void fasp_smoother_dcsr_sgs_sp (dvector *u, const dCSRmat *A,
+ *                                     const SREAL *val, const dvector *b, INT L)
+ *
+ * \brief Symmetric Gauss-Seidel method as a smoother with single precision values
+ *        of A
+ *
+ * \param u      Pointer to dvector: the unknowns (IN: initial, OUT: approximation)
+ * \param A      Pointer to dCSRmat: the coefficient matrix (only IA and JA are used)
+ * \param val    Single precision values of A
+ * \param b      Pointer to dvector: the right hand side
+ * \param L      Number of iterations
+ *
+ * \author FASP team
+ * \date   10/16/2026
+ */
+void fasp_smoother_dcsr_sgs_sp (dvector          *u,
+                                const dCSRmat    *A,
+                                const SREAL      *val,
+                                const dvector    *b,
+                                INT               L)
+{
+    const INT n = b->row;
+
+    while ( L-- ) {
+        dcsr_gs_sweep_sp(A, val, b->val, u->val, 0, n-1, 1, NULL, FALSE);
+        dcsr_gs_sweep_sp(A, val, b->val, u->val, n-1, 0, -1, NULL, FALSE);
+    }
+}
+
+/*---------------------------------*/
+/*--      Private Functions      --*/
+/*---------------------------------*/
+
+/**
+ * \fn static inline void dcsr_gs_row_sp (const dCSRmat *A, const SREAL *val,
+ *                                        const REAL *b, REAL *u, const INT i)
+ *
+ * \brief Gauss-Seidel update of the i-th unknown
+ *
+ * \param A    Pointer to dCSRmat matrix A
+ * \param val  Single precision values of A
+ * \param b    Pointer to the right hand side
+ * \param u    Pointer to the unknowns
+ * \param i    Row index
+ *
+ * \author FASP team
+ * \date   10/16/2026
+ */
+static inline void dcsr_gs_row_sp (const dCSRmat  *A,
+                                   const SREAL    *val,
+                                   const REAL     *b,
+                                   REAL           *u,
+                                   const INT       i)
+{
+    const INT *ia = A->IA, *ja = A->JA;
+
+    INT  j, k;
+    REAL t = b[i], d = 0.0;
+
+    for ( k = ia[i]; k < ia[i+1]; ++k ) {
+        j = ja[k];
+        if ( j != i ) t -= (REAL)val[k]*u[j];
+        else d = (REAL)val[k];
+    }
+
+    if ( ABS(d) > SMALLREAL ) u[i] = t/d;
+}
+
+/**
+ * \fn static void dcsr_gs_sweep_sp (const dCSRmat *A, const SREAL *val,
+ *                                   const REAL *b, REAL *u, const INT i_1,
+ *                                   const INT i_n, const INT s, const INT *mark,
+ *                                   const SHORT cpts)
+ *
+ * \brief One Gauss-Seidel sweep from row i_1 to row i_n
+ *
+ * \param A     Pointer to dCSRmat matrix A
+ * \param val   Single precision values of A
+ * \param b     Pointer to the right hand side
+ * \param u     Pointer to the unknowns
+ * \param i_1   Starting index
+ * \param i_n   Ending index
+ * \param s     Increasing step (1 or -1)
+ * \param mark  C/F marker array (NULL: all rows)
+ * \param cpts  Only update C points (mark = 1) if TRUE, and other points if FALSE
+ *
+ * \author FASP team
+ * \date   10/16/2026
+ */
+static void dcsr_gs_sweep_sp (const dCSRmat  *A,
+                              const SREAL    *val,
+                              const REAL     *b,
+                              REAL           *u,
+                              const INT       i_1,
+                              const INT       i_n,
+                              const INT       s,
+                              const INT      *mark,
+                              const SHORT     cpts)
+{
+    const INT N = ABS(i_n - i_1) + 1;
+
+    INT i;
+
+#ifdef _OPENMP
+    if ( N > OPENMP_HOLDS ) {
+        const INT nthreads = fasp_get_num_threads();
+        INT myid, mybegin, myend;
+#pragma omp parallel for private(myid, mybegin, myend, i)
+        for ( myid = 0; myid < nthreads; myid++ ) {
+            fasp_get_start_end(myid, nthreads, N, &mybegin, &myend);
+            for ( ; mybegin < myend; ++mybegin ) {
+                i = i_1 + s*mybegin;
+                if ( mark == NULL || (mark[i] == 1) == cpts )
+                    dcsr_gs_row_sp(A, val, b, u, i);
+            }
+        }
+        return;
+    }
+#endif
+
+    for ( i = 0; i < N; ++i ) {
+        if ( mark == NULL || (mark[i_1+s*i] == 1) == cpts )
+            dcsr_gs_row_sp(A, val, b, u, i_1+s*i);
+    }
+}
+
+/*---------------------------------*/
+/*--        End of File          --*/
+/*---------------------------------*/
@@ -0,0 +1,161 @@
+/*! \file  ItrSmootherSymCSR.c
+ *
+ *  \brief Smoothers for dSymCSRmat matrices
+ *
+ *  \note  This file contains Level-2 (Itr) functions. It requires:
+ *         AuxArray.c, AuxMemory.c, AuxMessage.c, BlaArray.c, BlaSpmvSymCSR.c,
+ *         and PreCSR.c
+ *
+ *  \note  Only the upper triangular part of A is stored, so the lower triangular
+ *         part needed by Gauss-Seidel is applied column-wise: the forward sweep
+ *         scatters each new u_i into a running right-hand side, and the backward
+ *         sweep computes the lower part with the old u before the sweep.
+ *
+ *---------------------------------------------------------------------------------
+ *  Copyright (C) 2026--Present by the FASP team. All rights reserved.
+ *  Released under the terms of the GNU Lesser General Public License 3.0 or later.
+ *---------------------------------------------------------------------------------
+ */
+
+#include <math.h>
+
+#include "fasp.h"
+#include "fasp_functs.h"
+
+/*---------------------------------*/
+/*--      Public Functions       --*/
+/*---------------------------------*/
+
+/**
+ * \fn void fasp_smoother_dsymcsr_gs (dvector *u, const SHORT order,
+ *                                    const dSymCSRmat *A, const dvector *b, INT L)
+ *
+ * \brief Gauss-Seidel method as a smoother for a symmetric matrix in SymCSR format
+ *
+ * \param u      Pointer to dvector: the unknowns (IN: initial, OUT: approximation)
+ * \param order  ASCEND (forward sweep) or DESCEND (backward sweep)
+ * \param A      Pointer to dSymCSRmat: the coefficient matrix
+ * \param b      Pointer to dvector: the right hand side
+ * \param L      Number of iterations
+ *
+ * \author FASP team
+ * \date   10/16/2026
+ */
+void fasp_smoother_dsymcsr_gs (dvector           *u,
+                               const SHORT        order,
+                               const dSymCSRmat  *A,
+                               const dvector     *b,
+                               INT                L)
+{
+    const INT   n = A->row;
+    const INT  *ia = A->IA, *ja = A->JA;
+    const REAL *aj = A->val, *diag = A->diag, *bval = b->val;
+    REAL       *uval = u->val;
+
+    INT  i, k;
+    REAL t, ui;
+
+    // r = b - L*u in forward sweep; s = L*u_old in backward sweep
+    REAL *r = (REAL *)fasp_mem_calloc(MAX(n,1), sizeof(REAL));
+
+    if ( order == DESCEND ) {
+        while ( L-- ) {
+            fasp_darray_set(n, r, 0.0);
+            for ( i = 0; i < n; ++i ) {
+                ui = uval[i];
+                for ( k = ia[i]; k < ia[i+1]; ++k ) r[ja[k]] += aj[k]*ui;
+            }
+            for ( i = n-1; i >= 0; --i ) {
+                t = bval[i] - r[i];
+                for ( k = ia[i]; k < ia[i+1]; ++k ) t -= aj[k]*uval[ja[k]];
+                if ( ABS(diag[i]) > SMALLREAL ) uval[i] = t/diag[i];
+            }
+        }
+    }
+
+    else {
+        while ( L-- ) {
+            fasp_darray_cp(n, bval, r);
+            for ( i = 0; i < n; ++i ) {
+                t = r[i];
+                for ( k = ia[i]; k < ia[i+1]; ++k ) t -= aj[k]*uval[ja[k]];
+                if ( ABS(diag[i]) > SMALLREAL ) uval[i] = t/diag[i];
+                ui = uval[i];
+                for ( k = ia[i]; k < ia[i+1]; ++k ) r[ja[k]] -= aj[k]*ui;
+            }
+        }
+    }
+
+    fasp_mem_free(r); r = NULL;
+}
+
+/**
+ * \fn void fasp_smoother_dsymcsr_sgs (dvector *u, const dSymCSRmat *A,
+ *                                     const dvector *b, INT L)
+ *
+ * \brief Symmetric Gauss-Seidel method as a smoother for a symmetric matrix in
+ *        SymCSR format
+ *
+ * \param u      Pointer to dvector: the unknowns (IN: initial, OUT: approximation)
+ * \param A      Pointer to dSymCSRmat: the coefficient matrix
+ * \param b      Pointer to dvector: the right hand side
+ * \param L      Number of iterations
+ *
+ * \author FASP team
+ * \date   10/16/2026
+ */
+void fasp_smoother_dsymcsr_sgs (dvector           *u,
+                                const dSymCSRmat  *A,
+                                const dvector     *b,
+                                INT                L)
+{
+    while ( L-- ) {
+        fasp_smoother_dsymcsr_gs(u, ASCEND, A, b, 1);
+        fasp_smoother_dsymcsr_gs(u, DESCEND, A, b, 1);
+    }
+}
+
+/**
+ * \fn void fasp_smoother_dsymcsr_ilu (const dSymCSRmat *A, dvector *b,
+ *                                     dvector *x, void *data)
+ *
+ * \brief ILU method as a smoother for a symmetric matrix in SymCSR format
+ *
+ * \param A     Pointer to dSymCSRmat: the coefficient matrix
+ * \param b     Pointer to dvector: the right hand side
+ * \param x     Pointer to dvector: the unknowns (IN: initial, OUT: approximation)
+ * \param data  Pointer to ILU_data from fasp_ilu_dsymcsr_setup
+ *
+ * \author FASP team
+ * \date   10/16/2026
+ */
+void fasp_smoother_dsymcsr_ilu (const dSymCSRmat  *A,
+                                dvector           *b,
+                                dvector           *x,
+                                void              *data)
+{
+    const INT m = A->row, memneed = 4*m;
+    const ILU_data *iludata = (ILU_data *)data;
+
+    // the first 2*m entries of work are used by fasp_precond_ilu
+    REAL *zr = iludata->work+2*m;
+    REAL *z  = iludata->work+3*m;
+
+    if ( iludata->nwork < memneed ) {
+        printf("### ERROR: ILU needs " INTFMT " memory, only " INTFMT " available! [%s:%d]\n",
+               memneed, iludata->nwork, __FILE__, __LINE__);
+        fasp_chkerr(ERROR_ALLOC_MEM, __FUNCTION__);
+    }
+
+    // form residual zr = b - A x
+    fasp_darray_cp(m, b->val, zr);
+    fasp_blas_dsymcsr_aAxpy(-1.0, A, x->val, zr);
+
+    // z = (LU)^{-1} zr and x = x + z
+    fasp_precond_ilu(zr, z, data);
+    fasp_blas_darray_axpy(m, 1.0, z, x->val);
+}
+
+/*---------------------------------*/
+/*--        End of File          --*/
+/*---------------------------------*/
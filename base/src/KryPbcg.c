@@ -0,0 +1,530 @@
+/*! \file  KryPbcg.c
+ *
+ *  \brief Krylov subspace methods -- Block preconditioned CG for AX=B
+ *
+ *  \note  This file contains Level-3 (Kry) functions. It requires:
+ *         AuxArray.c, AuxMemory.c, AuxMessage.c, BlaArray.c, BlaSpmvBSR.c,
+ *         and BlaSpmvCSR.c
+ *
+ *  \note  See KryPcg.c for the single right-hand side version
+ *
+ *  Reference:
+ *         D. P. O'Leary 1980
+ *         The block conjugate gradient algorithm and related methods,
+ *         Linear Algebra and its Applications 29, 293--322
+ *
+ *---------------------------------------------------------------------------------
+ *  Copyright (C) 2009--Present by the FASP team. All rights reserved.
+ *  Released under the terms of the GNU Lesser General Public License 3.0 or later.
+ *---------------------------------------------------------------------------------
+ *
+ *  Abstract algorithm
+ *
+ *  The nrhs right-hand sides and solutions are stored interleaved, i.e., entry i
+ *  of vector j is b[i*nrhs+j]. All k active vectors are treated together, so the
+ *  matrix is read once per iteration for all of them and the Krylov space of one
+ *  right-hand side helps the others:
+ *
+ *  Step 0. Given A, B, X_0, M
+ *
+ *  Step 1. Compute R = B-A*X_0, drop converged columns, Z = M*R, P = Z,
+ *          gamma = Z'*R;
+ *
+ *  Step 2. Main loop ...
+ *
+ *    FOR iter = 1:MaxIt
+ *      - Q = A*P, delta = P'*Q, alpha = inv(delta)*gamma;
+ *      - X = X + P*alpha, R = R - Q*alpha;
+ *      - if some columns converged, go to Step 1;
+ *      - Z = M*R, gamma_new = Z'*R, beta = inv(gamma)*gamma_new;
+ *      - P = Z + P*beta, gamma = gamma_new;
+ *    END FOR
+ *
+ *  Converged columns are removed (deflated) by restarting from the true residual,
+ *  which also serves as the safe-guard check of the recursive residual. If the
+ *  search directions become linearly dependent, the dependent ones are dropped
+ *  in the small solves. Only the relative residual ||r_j||/||b_j|| is used as
+ *  stopping criterion.
+ */
+
+#include <math.h>
+
+#include "fasp.h"
+#include "fasp_functs.h"
+
+/*---------------------------------*/
+/*--  Declare Private Functions  --*/
+/*---------------------------------*/
+
+#include "KryUtil.inl"
+
+static void pbcg_mxm_csr (const void *, const INT, const REAL *, REAL *);
+static void pbcg_mxm_bsr (const void *, const INT, const REAL *, REAL *);
+static INT  pbcg (void (*)(const void *, const INT, const REAL *, REAL *),
+                  const void *, const INT, const REAL *, REAL *, const INT,
+                  precond_mv *, const REAL, const INT, const SHORT, const SHORT);
+static INT  pbcg_restart (void (*)(const void *, const INT, const REAL *, REAL *),
+                          const void *, const INT, const INT, const REAL *,
+                          const REAL *, const REAL *, const REAL, precond_mv *,
+                          INT *, REAL *, REAL *, REAL *, REAL *, REAL *);
+static INT  pbcg_spd_solve (const INT, const REAL *, REAL *);
+
+/*---------------------------------*/
+/*--      Public Functions       --*/
+/*---------------------------------*/
+
+/**
+ * \fn INT fasp_solver_dcsr_pbcg (dCSRmat *A, dvector *b, dvector *u,
+ *                                const INT nrhs, precond_mv *pc, const REAL tol,
+ *                                const INT MaxIt, const SHORT StopType,
+ *                                const SHORT PrtLvl)
+ *
+ * \brief Block preconditioned conjugate gradient method for solving AU=B
+ *
+ * \param A            Pointer to dCSRmat: coefficient matrix
+ * \param b            Pointer to dvector: right hand sides (A->row*nrhs, interleaved)
+ * \param u            Pointer to dvector: unknowns (A->row*nrhs, interleaved)
+ * \param nrhs         Number of right hand sides
+ * \param pc           Pointer to precond_mv: block preconditioner (or NULL)
+ * \param tol          Tolerance for stopping
+ * \param MaxIt        Maximal number of iterations
+ * \param StopType     Stopping criteria type -- only STOP_REL_RES is supported
+ * \param PrtLvl       How much information to print out
+ *
+ * \return             Iteration number if converges; ERROR otherwise.
+ *
+ * \author FASP team
+ * \date   10/16/2026
+ */
+INT fasp_solver_dcsr_pbcg (dCSRmat     *A,
+                           dvector     *b,
+                           dvector     *u,
+                           const INT    nrhs,
+                           precond_mv  *pc,
+                           const REAL   tol,
+                           const INT    MaxIt,
+                           const SHORT  StopType,
+                           const SHORT  PrtLvl)
+{
+    // Output some info for debugging
+    if ( PrtLvl > PRINT_NONE ) printf("\nCalling block CG solver (CSR) ...\n");
+
+    if ( b->row != A->row*nrhs || u->row != A->row*nrhs ) {
+        printf("### ERROR: Sizes of A, b, u and nrhs do not match! [%s]\n",
+               __FUNCTION__);
+        return ERROR_MAT_SIZE;
+    }
+
+    return pbcg(pbcg_mxm_csr, A, A->row, b->val, u->val, nrhs, pc,
+                tol, MaxIt, StopType, PrtLvl);
+}
+
+/**
+ * \fn INT fasp_solver_dbsr_pbcg (dBSRmat *A, dvector *b, dvector *u,
+ *                                const INT nrhs, precond_mv *pc, const REAL tol,
+ *                                const INT MaxIt, const SHORT StopType,
+ *                                const SHORT PrtLvl)
+ *
+ * \brief Block preconditioned conjugate gradient method for solving AU=B
+ *
+ * \param A            Pointer to dBSRmat: coefficient matrix
+ * \param b            Pointer to dvector: right hand sides (ROW*nb*nrhs, interleaved)
+ * \param u            Pointer to dvector: unknowns (ROW*nb*nrhs, interleaved)
+ * \param nrhs         Number of right hand sides
+ * \param pc           Pointer to precond_mv: block preconditioner (or NULL)
+ * \param tol          Tolerance for stopping
+ * \param MaxIt        Maximal number of iterations
+ * \param StopType     Stopping criteria type -- only STOP_REL_RES is supported
+ * \param PrtLvl       How much information to print out
+ *
+ * \return             Iteration number if converges; ERROR otherwise.
+ *
+ * \author FASP team
+ * \date   10/16/2026
+ */
+INT fasp_solver_dbsr_pbcg (dBSRmat     *A,
+                           dvector     *b,
+                           dvector     *u,
+                           const INT    nrhs,
+                           precond_mv  *pc,
+                           const REAL   tol,
+                           const INT    MaxIt,
+                           const SHORT  StopType,
+                           const SHORT  PrtLvl)
+{
+    const INT n = A->ROW*A->nb;
+
+    // Output some info for debugging
+    if ( PrtLvl > PRINT_NONE ) printf("\nCalling block CG solver (BSR) ...\n");
+
+    if ( b->row != n*nrhs || u->row != n*nrhs ) {
+        printf("### ERROR: Sizes of A, b, u and nrhs do not match! [%s]\n",
+               __FUNCTION__);
+        return ERROR_MAT_SIZE;
+    }
+
+    return pbcg(pbcg_mxm_bsr, A, n, b->val, u->val, nrhs, pc,
+                tol, MaxIt, StopType, PrtLvl);
+}
+
+/*---------------------------------*/
+/*--      Private Functions      --*/
+/*---------------------------------*/
+
+/**
+ * \fn static void pbcg_mxm_csr (const void *A, const INT nrhs, const REAL *x,
+ *                               REAL *y)
+ *
+ * \brief Y = A*X for a dCSRmat matrix
+ *
+ * \author FASP team
+ * \date   10/16/2026
+ */
+static void pbcg_mxm_csr (const void  *A,
+                          const INT    nrhs,
+                          const REAL  *x,
+                          REAL        *y)
+{
+    fasp_blas_dcsr_mxm_dense((const dCSRmat *)A, nrhs, x, y);
+}
+
+/**
+ * \fn static void pbcg_mxm_bsr (const void *A, const INT nrhs, const REAL *x,
+ *                               REAL *y)
+ *
+ * \brief Y = A*X for a dBSRmat matrix
+ *
+ * \author FASP team
+ * \date   10/16/2026
+ */
+static void pbcg_mxm_bsr (const void  *A,
+                          const INT    nrhs,
+                          const REAL  *x,
+                          REAL        *y)
+{
+    fasp_blas_dbsr_mxm_dense((const dBSRmat *)A, nrhs, x, y);
+}
+
+/**
+ * \fn static INT pbcg (void (*mxm)(const void *, const INT, const REAL *, REAL *),
+ *                      const void *A, const INT n, const REAL *b, REAL *u,
+ *                      const INT nrhs, precond_mv *pc, const REAL tol,
+ *                      const INT MaxIt, const SHORT StopType, const SHORT PrtLvl)
+ *
+ * \brief Block PCG for a general matrix given by its block product
+ *
+ * \param mxm          Block product Y = A*X
+ * \param A            Pointer to the matrix
+ * \param n            Number of unknowns of one system
+ * \param b            Right hand sides (interleaved)
+ * \param u            Unknowns (interleaved)
+ * \param nrhs         Number of right hand sides
+ * \param pc           Pointer to precond_mv: block preconditioner (or NULL)
+ * \param tol          Tolerance for stopping
+ * \param MaxIt        Maximal number of iterations
+ * \param StopType     Stopping criteria type
+ * \param PrtLvl       How much information to print out
+ *
+ * \return             Iteration number if converges; ERROR otherwise.
+ *
+ * \author FASP team
+ * \date   10/16/2026
+ */
+static INT pbcg (void         (*mxm)(const void *, const INT, const REAL *, REAL *),
+                 const void    *A,
+                 const INT      n,
+                 const REAL    *b,
+                 REAL          *u,
+                 const INT      nrhs,
+                 precond_mv    *pc,
+                 const REAL     tol,
+                 const INT      MaxIt,
+                 const SHORT    StopType,
+                 const SHORT    PrtLvl)
+{
+    const INT    nk = n*nrhs, kk = nrhs*nrhs;
+
+    // local variables
+    INT          iter = 0, k, kold, c, i, j, l, conv;
+    REAL         absres0 = BIGREAL, absres = BIGREAL, relres = BIGREAL;
+    REAL         factor, t;
+
+    // allocate temp memory (need 4*n*nrhs REAL numbers) from the work arena
+    const size_t mark = fasp_arena_mark(NULL);
+    REAL *work  = (REAL *)fasp_arena_alloc(NULL, 4*(size_t)nk, sizeof(REAL));
+    REAL *small = (REAL *)fasp_arena_alloc(NULL, 3*nrhs+3*kk, sizeof(REAL));
+    INT  *cols  = (INT  *)fasp_arena_alloc(NULL, nrhs, sizeof(INT));
+    REAL *r = work, *z = r+nk, *p = z+nk, *q = p+nk, *tmp;
+    REAL *normb = small, *resn = normb+nrhs, *relres_all = resn+nrhs;
+    REAL *gamma = relres_all+nrhs, *delta = gamma+kk, *alpha = delta+kk;
+
+#if DEBUG_MODE > 0
+    printf("### DEBUG: [-Begin-] %s ...\n", __FUNCTION__);
+    printf("### DEBUG: maxit = %d, tol = %.4le, nrhs = %d\n", MaxIt, tol, nrhs);
+#endif
+
+    if ( StopType != STOP_REL_RES && PrtLvl > PRINT_NONE ) {
+        printf("### WARNING: Block CG uses STOP_REL_RES as stopping criteria!\n");
+    }
+
+    // norms of the right hand sides
+    fasp_blas_darray_mv_norm2(n, nrhs, b, normb);
+    for ( j = 0; j < nrhs; ++j ) if ( normb[j] < SMALLREAL ) normb[j] = 1.0;
+
+    // r = b-A*u, drop converged columns, z = B(r), p = z, gamma = (z,r)
+    k = pbcg_restart(mxm, A, n, nrhs, b, u, normb, tol, pc, cols,
+                     r, z, p, gamma, relres_all);
+
+    relres = 0.0;
+    for ( j = 0; j < nrhs; ++j ) relres = MAX(relres, relres_all[j]);
+    absres0 = 0.0;
+    for ( j = 0; j < nrhs; ++j ) absres0 = MAX(absres0, relres_all[j]*normb[j]);
+
+    // output iteration information if needed
+    fasp_itinfo(PrtLvl,StopType,iter,relres,absres0,0.0);
+
+    // main block PCG loop
+    while ( k > 0 && iter++ < MaxIt ) {
+
+        // q = A*p, delta = (p,q), alpha = inv(delta)*gamma
+        mxm(A, k, p, q);
+        fasp_blas_darray_mv_gram(n, k, k, p, q, delta);
+        fasp_darray_cp(k*k, gamma, alpha);
+
+        pbcg_spd_solve(k, delta, alpha);
+
+        // u = u + p*alpha (only the active columns)
+#ifdef _OPENMP
+#pragma omp parallel for private(i, c, l, t) if(n>OPENMP_HOLDS)
+#endif
+        for ( i = 0; i < n; ++i ) {
+            const REAL *pi = p + (size_t)i*k;
+            REAL       *ui = u + (size_t)i*nrhs;
+            for ( c = 0; c < k; ++c ) {
+                t = 0.0;
+                for ( l = 0; l < k; ++l ) t += pi[l]*alpha[l*k+c];
+                ui[cols[c]] += t;
+            }
+        }
+
+        // r = r - q*alpha
+        fasp_blas_darray_mv_axpy(n, k, k, -1.0, q, alpha, r);
+
+        // compute residuals and check convergence
+        fasp_blas_darray_mv_norm2(n, k, r, resn);
+        absres = 0.0; conv = 0;
+        for ( c = 0; c < k; ++c ) {
+            relres_all[cols[c]] = resn[c]/normb[cols[c]];
+            absres = MAX(absres, resn[c]);
+            if ( relres_all[cols[c]] < tol ) conv++;
+        }
+        relres = 0.0;
+        for ( j = 0; j < nrhs; ++j ) relres = MAX(relres, relres_all[j]);
+
+        factor = absres/absres0;
+
+        // output iteration information if needed
+        fasp_itinfo(PrtLvl,StopType,iter,relres,absres,factor);
+
+        absres0 = absres;
+
+        // deflate converged columns: restart with the true residual
+        if ( conv > 0 ) {
+            kold = k;
+            k = pbcg_restart(mxm, A, n, nrhs, b, u, normb, tol, pc, cols,
+                             r, z, p, gamma, relres_all);
+            relres = 0.0;
+            for ( j = 0; j < nrhs; ++j ) relres = MAX(relres, relres_all[j]);
+            if ( k > 0 && PrtLvl >= PRINT_MORE && k != kold )
+                printf("Block CG: " INTFMT " of " INTFMT " right hand sides active.\n", k, nrhs);
+            continue;
+        }
+
+        // z = B(r), gamma_new = (z,r), beta = inv(gamma)*gamma_new
+        if ( pc != NULL )
+            pc->fct(r, z, k, pc->data); /* Apply preconditioner */
+        else
+            fasp_darray_cp(n*k, r, z); /* No preconditioner */
+
+        fasp_blas_darray_mv_gram(n, k, k, z, r, delta);
+        fasp_darray_cp(k*k, delta, alpha);
+        pbcg_spd_solve(k, gamma, alpha);
+
+        // p = z + p*beta, gamma = gamma_new
+        fasp_darray_cp(n*k, z, q);
+        fasp_blas_darray_mv_axpy(n, k, k, 1.0, p, alpha, q);
+        tmp = p; p = q; q = tmp;
+        fasp_darray_cp(k*k, delta, gamma);
+
+    } // end of main block PCG loop.
+
+    // finish iterative method
+    if ( PrtLvl > PRINT_NONE ) ITS_FINAL(iter,MaxIt,relres);
+
+    // clean up temp memory
+    fasp_arena_release(NULL, mark);
+
+#if DEBUG_MODE > 0
+    printf("### DEBUG: [--End--] %s ...\n", __FUNCTION__);
+#endif
+
+    if ( iter > MaxIt )
+        return ERROR_SOLVER_MAXIT;
+    else
+        return iter;
+}
+
+/**
+ * \fn static INT pbcg_restart (void (*mxm)(const void *, const INT, const REAL *,
+ *                              REAL *), const void *A, const INT n, const INT nrhs,
+ *                              const REAL *b, const REAL *u, const REAL *normb,
+ *                              const REAL tol, precond_mv *pc, INT *cols, REAL *r,
+ *                              REAL *z, REAL *p, REAL *gamma, REAL *relres)
+ *
+ * \brief (Re)start block PCG from the true residual
+ *
+ * \param mxm      Block product Y = A*X
+ * \param A        Pointer to the matrix
+ * \param n        Number of unknowns of one system
+ * \param nrhs     Number of right hand sides
+ * \param b        Right hand sides (interleaved)
+ * \param u        Unknowns (interleaved)
+ * \param normb    Norms of the right hand sides
+ * \param tol      Tolerance for stopping
+ * \param pc       Pointer to precond_mv: block preconditioner (or NULL)
+ * \param cols     Indices of the active columns (OUT)
+ * \param r        Residuals of the active columns (OUT, n*nrhs work space)
+ * \param z        Preconditioned residuals of the active columns (OUT)
+ * \param p        Search directions (OUT)
+ * \param gamma    gamma = z'*r (OUT)
+ * \param relres   Relative residuals of all columns (OUT)
+ *
+ * \return         Number of active columns
+ *
+ * \author FASP team
+ * \date   10/16/2026
+ */
+static INT pbcg_restart (void         (*mxm)(const void *, const INT, const REAL *,
+                                             REAL *),
+                         const void    *A,
+                         const INT      n,
+                         const INT      nrhs,
+                         const REAL    *b,
+                         const REAL    *u,
+                         const REAL    *normb,
+                         const REAL     tol,
+                         precond_mv    *pc,
+                         INT           *cols,
+                         REAL          *r,
+                         REAL          *z,
+                         REAL          *p,
+                         REAL          *gamma,
+                         REAL          *relres)
+{
+    const INT nk = n*nrhs;
+    INT i, j, k = 0;
+
+    // r = b-A*u for all columns
+    mxm(A, nrhs, u, r);
+    fasp_blas_darray_axpby(nk, 1.0, b, -1.0, r);
+    fasp_blas_darray_mv_norm2(n, nrhs, r, relres);
+
+    for ( j = 0; j < nrhs; ++j ) {
+        relres[j] /= normb[j];
+        if ( relres[j] >= tol ) cols[k++] = j;
+    }
+
+    if ( k == 0 ) return 0;
+
+    // keep the active columns only (in place, as k <= nrhs)
+    if ( k < nrhs ) {
+        for ( i = 0; i < n; ++i ) {
+            for ( j = 0; j < k; ++j ) r[(size_t)i*k+j] = r[(size_t)i*nrhs+cols[j]];
+        }
+    }
+
+    if ( pc != NULL )
+        pc->fct(r, z, k, pc->data); /* Apply preconditioner */
+    else
+        fasp_darray_cp(n*k, r, z); /* No preconditioner */
+
+    fasp_darray_cp(n*k, z, p);
+    fasp_blas_darray_mv_gram(n, k, k, z, r, gamma);
+
+    return k;
+}
+
+/**
+ * \fn static INT pbcg_spd_solve (const INT k, const REAL *G, REAL *C)
+ *
+ * \brief Solve G*Y = C for a small SPD matrix G and k right hand sides
+ *
+ * \param k    Size of G
+ * \param G    Symmetric positive semidefinite matrix (k*k, row-major)
+ * \param C    Right hand sides (IN) and solutions (OUT) (k*k, row-major)
+ *
+ * \return     Number of dropped directions
+ *
+ * \author FASP team
+ * \date   10/16/2026
+ *
+ * \note G is scaled by its diagonal before the Cholesky factorization, so that
+ *       the pivot test does not depend on the size of the residuals. If G is
+ *       singular, e.g. two right hand sides are the same, the dependent
+ *       directions are dropped and the corresponding rows of Y are zero.
+ */
+static INT pbcg_spd_solve (const INT    k,
+                           const REAL  *G,
+                           REAL        *C)
+{
+    const REAL tol = 1e-12;
+
+    INT   i, j, l, ndrop = 0;
+    REAL  t, v;
+
+    const size_t mark = fasp_arena_mark(NULL);
+    REAL *L = (REAL *)fasp_arena_calloc(NULL, k*k+k, sizeof(REAL));
+    REAL *s = L + k*k;
+
+    for ( i = 0; i < k; ++i ) {
+        s[i] = ( G[i*k+i] > SMALLREAL2 ) ? 1.0/sqrt(G[i*k+i]) : 0.0;
+    }
+
+    // Cholesky factorization of S*G*S = L*L', dependent columns are dropped
+    for ( j = 0; j < k; ++j ) {
+        t = ( s[j] > 0.0 ) ? 1.0 : 0.0;
+        for ( l = 0; l < j; ++l ) t -= L[j*k+l]*L[j*k+l];
+        if ( t <= tol ) { ndrop++; continue; }
+        L[j*k+j] = t = sqrt(t);
+        for ( i = j+1; i < k; ++i ) {
+            v = s[i]*G[i*k+j]*s[j];
+            for ( l = 0; l < j; ++l ) v -= L[i*k+l]*L[j*k+l];
+            L[i*k+j] = v/t;
+        }
+    }
+
+    // Y = S*inv(L')*inv(L)*S*C
+    for ( j = 0; j < k; ++j ) {
+        for ( i = 0; i < k; ++i ) {
+            if ( L[i*k+i] == 0.0 ) { C[i*k+j] = 0.0; continue; }
+            t = s[i]*C[i*k+j];
+            for ( l = 0; l < i; ++l ) t -= L[i*k+l]*C[l*k+j];
+            C[i*k+j] = t/L[i*k+i];
+        }
+        for ( i = k-1; i >= 0; --i ) {
+            if ( L[i*k+i] == 0.0 ) continue;
+            t = C[i*k+j];
+            for ( l = i+1; l < k; ++l ) t -= L[l*k+i]*C[l*k+j];
+            C[i*k+j] = t/L[i*k+i];
+        }
+        for ( i = 0; i < k; ++i ) C[i*k+j] *= s[i];
+    }
+
+    fasp_arena_release(NULL, mark);
+
+    return ndrop;
+}
+
+/*---------------------------------*/
+/*--        End of File          --*/
+/*---------------------------------*/
@@ -58,6 +58,9 @@
  *
  * \author Chunsheng Feng
  * \date   03/04/2016
+ *
+ * Modified by FASP team on 10/16/2026: draw work space from the arena
+ * Modified by FASP team on 10/16/2026: fused BLAS1 kernels and SpMV plan
  */
 INT fasp_solver_dcsr_pbcgs (dCSRmat     *A,
                             dvector     *b,
@@ -78,14 +81,19 @@ INT fasp_solver_dcsr_pbcgs (dCSRmat     *A,
     REAL     alpha,beta,omega,rho,rho1,rtv,tt;
     REAL     normr,normr_act,normph,normx,imin;
     REAL     norm_sh,norm_xhalf,normrmin,factor;
+    REAL     norms[2], dots[2];
     REAL     *x = u->val, *bval=b->val;
     
     // allocate temp memory (need 10*m REAL)
-    REAL *work=(REAL *)fasp_mem_calloc(10*m,sizeof(REAL));
+    const size_t mark = fasp_arena_mark(NULL);
+    REAL *work = (REAL *)fasp_arena_calloc(NULL,10*m,sizeof(REAL));
     REAL *r=work, *rt=r+m, *p=rt+m, *v=p+m;
     REAL *ph=v+m, *xhalf=ph+m, *s=xhalf+m, *sh=s+m;
     REAL *t = sh+m, *xmin = t+m;
 
+    // SpMV plan for A, shared by all matrix-vector products below
+    dCSRplan *Aplan = fasp_dcsr_plan_create(A);
+
     // Output some info for debuging
     if ( PrtLvl > PRINT_NONE ) printf("\nCalling BiCGstab solver (CSR) ...\n");
     
@@ -106,7 +114,7 @@ INT fasp_solver_dcsr_pbcgs (dCSRmat     *A,
     
     tolb = n2b*tol;
     
-    fasp_blas_dcsr_aAxpy(-1.0, A, x, r);
+    fasp_blas_dcsr_aAxpy_plan(-1.0,A,Aplan,x,r);
     normr     = fasp_blas_darray_norm2(m,r);
     normr_act = normr;
     relres    = normr/n2b;
@@ -124,6 +132,7 @@ INT fasp_solver_dcsr_pbcgs (dCSRmat     *A,
     // shadow residual rt = r* := r
     fasp_darray_cp(m,r,rt);
     normrmin  = normr;
+    normx     = fasp_blas_darray_norm2(m,x);
     
     rho = 1.0;
     omega = 1.0;
@@ -157,8 +166,7 @@ INT fasp_solver_dcsr_pbcgs (dCSRmat     *A,
             }
             
             // p = r + beta * (p - omega * v);
-            fasp_blas_darray_axpy(m,-omega,v,p);        //p=p - omega*v
-            fasp_blas_darray_axpby(m,1.0, r, beta, p);  //p = 1.0*r +beta*p
+            fasp_blas_darray_axpbypcz(m,1.0,r,-beta*omega,v,beta,p,p);
         }
         
         // pp = precond(p) ,ph
@@ -169,8 +177,7 @@ INT fasp_solver_dcsr_pbcgs (dCSRmat     *A,
             fasp_darray_cp(m,p,ph); /* No preconditioner */
         
         // v = A*ph
-        fasp_blas_dcsr_mxv(A,ph,v);
-        rtv = fasp_blas_darray_dotprod(m,rt,v);
+        rtv = fasp_blas_dcsr_mxv_plan_dot(A,Aplan,ph,v,rt);
         
         if (( rtv==0.0 )||( ABS(rtv) > DBL_MAX )){
             flag = 4;
@@ -185,7 +192,6 @@ INT fasp_solver_dcsr_pbcgs (dCSRmat     *A,
             goto FINISHED;
         }
         
-        normx =  fasp_blas_darray_norm2(m,x);
         normph = fasp_blas_darray_norm2(m,ph);
         if (ABS(alpha)*normph < DBL_EPSILON*normx )
             stag = stag + 1;
@@ -194,9 +200,9 @@ INT fasp_solver_dcsr_pbcgs (dCSRmat     *A,
         
         // xhalf = x + alpha * ph;        // form the "half" iterate
         // s = r - alpha * v;             // residual associated with xhalf
-        fasp_blas_darray_axpyz(m, alpha, ph, x , xhalf);  // z= ax + y
-        fasp_blas_darray_axpyz(m, -alpha, v, r, s);
-        normr = fasp_blas_darray_norm2(m,s);  // normr = norm(s);
+        fasp_blas_darray_axpyz2_norm2(m,alpha,ph,x,xhalf,-alpha,v,r,s,norms);
+        norm_xhalf = norms[0];
+        normr = norms[1];  // normr = norm(s);
         normr_act = normr;
         
         // compute reduction factor of residual ||r||
@@ -208,7 +214,7 @@ INT fasp_solver_dcsr_pbcgs (dCSRmat     *A,
         if ((normr <= tolb)||(stag >= maxstagsteps)||moresteps)
         {
             fasp_darray_cp(m,bval,s);
-            fasp_blas_dcsr_aAxpy(-1.0,A,xhalf,s);
+            fasp_blas_dcsr_aAxpy_plan(-1.0,A,Aplan,xhalf,s);
             normr_act = fasp_blas_darray_norm2(m,s);
             
             if (normr_act <= tolb) {
@@ -218,7 +224,7 @@ INT fasp_solver_dcsr_pbcgs (dCSRmat     *A,
                 imin = iter - 0.5;
                 half_step++;
                 if ( PrtLvl >= PRINT_MORE )
-                    printf("Flag = %d Stag = %d Itermin = %.1f Half_step = %d\n",
+                    printf("Flag = " INTFMT " Stag = " INTFMT " Itermin = %.1f Half_step = " INTFMT "\n",
                            flag,stag,imin,half_step);
                 goto FINISHED;
             }
@@ -247,7 +253,7 @@ INT fasp_solver_dcsr_pbcgs (dCSRmat     *A,
             imin = iter - 0.5;
             half_step++;
             if ( PrtLvl >= PRINT_MORE )
-                printf("Flag = %d Stag = %d Itermin = %.1f Half_step = %d\n",
+                printf("Flag = " INTFMT " Stag = " INTFMT " Itermin = %.1f Half_step = " INTFMT "\n",
                        flag,stag,imin,half_step);
         }
         
@@ -259,39 +265,40 @@ INT fasp_solver_dcsr_pbcgs (dCSRmat     *A,
             fasp_darray_cp(m,s,sh); /* No preconditioner */
         
         // t = A*sh;
-        fasp_blas_dcsr_mxv(A,sh,t);
-        // tt = t' * t;
-        tt = fasp_blas_darray_dotprod(m,t,t);
+        fasp_blas_dcsr_mxv_plan(A,Aplan,sh,t);
+        // tt = t' * t and dots[1] = t' * s;
+        fasp_blas_darray_dotprod2(m,t,t,s,dots);
+        tt = dots[0];
         if ( (tt == 0) ||( tt >= DBL_MAX ) ) {
             flag = 4;
             goto FINISHED;
         }
         
         // omega = (t' * s) / tt;
-        omega = fasp_blas_darray_dotprod(m,s,t)/tt;
+        omega = dots[1]/tt;
         if ( ABS(omega) > DBL_MAX ) {
             flag = 4;
             goto FINISHED;
         }
         
         norm_sh = fasp_blas_darray_norm2(m,sh);
-        norm_xhalf = fasp_blas_darray_norm2(m,xhalf);
         
         if ( ABS(omega)*norm_sh < DBL_EPSILON*norm_xhalf )
             stag = stag + 1;
         else
             stag = 0;
         
-        fasp_blas_darray_axpyz(m, omega,sh,xhalf, x);  // x = xhalf + omega * sh;
-        fasp_blas_darray_axpyz(m, -omega, t, s, r);    // r = s - omega * t;
-        normr = fasp_blas_darray_norm2(m,r);           // normr = norm(r);
+        // x = xhalf + omega * sh; r = s - omega * t;
+        fasp_blas_darray_axpyz2_norm2(m,omega,sh,xhalf,x,-omega,t,s,r,norms);
+        normx = norms[0];
+        normr = norms[1];  // normr = norm(r);
         normr_act = normr;
         
         // check for convergence
         if ( (normr <= tolb) || (stag >= maxstagsteps) || moresteps )
         {
             fasp_darray_cp(m,bval,r);
-            fasp_blas_dcsr_aAxpy(-1.0,A,x,r);
+            fasp_blas_dcsr_aAxpy_plan(-1.0,A,Aplan,x,r);
             normr_act = fasp_blas_darray_norm2(m,r);
             if ( normr_act <= tolb ) {
                 flag = 0;
@@ -331,7 +338,7 @@ FINISHED:  // finish iterative method
         relres = normr_act / n2b;
     else {
         fasp_darray_cp(m, bval,r);
-        fasp_blas_dcsr_aAxpy(-1.0,A,xmin,r);
+        fasp_blas_dcsr_aAxpy_plan(-1.0,A,Aplan,xmin,r);
         normr = fasp_blas_darray_norm2(m,r);
         
         if ( normr <= normr_act) {
@@ -348,11 +355,12 @@ FINISHED:  // finish iterative method
     if ( PrtLvl > PRINT_NONE ) ITS_FINAL(iter,MaxIt,relres);
     
     if ( PrtLvl >= PRINT_MORE )
-        printf("Flag = %d Stag = %d Itermin = %.1f Half_step = %d\n",
+        printf("Flag = " INTFMT " Stag = " INTFMT " Itermin = %.1f Half_step = " INTFMT "\n",
                flag,stag,imin,half_step);
     
     // clean up temp memory
-    fasp_mem_free(work); work = NULL;
+    fasp_arena_release(NULL,mark); work = NULL;
+    fasp_dcsr_plan_free(Aplan);
     
 #if DEBUG_MODE > 0
     printf("### DEBUG: [--End--] %s ...\n", __FUNCTION__);
@@ -384,6 +392,9 @@ FINISHED:  // finish iterative method
  *
  * \author Chunsheng Feng
  * \date   03/04/2016
+ *
+ * Modified by FASP team on 10/16/2026: draw work space from the arena
+ * Modified by FASP team on 10/16/2026: fused BLAS1 kernels
  */
 INT fasp_solver_dbsr_pbcgs (dBSRmat     *A,
                             dvector     *b,
@@ -404,10 +415,12 @@ INT fasp_solver_dbsr_pbcgs (dBSRmat     *A,
     REAL     alpha,beta,omega,rho,rho1,rtv,tt;
     REAL     normr,normr_act,normph,normx,imin;
     REAL     norm_sh,norm_xhalf,normrmin,factor;
+    REAL     norms[2], dots[2];
     REAL     *x = u->val, *bval=b->val;
     
     // allocate temp memory (need 10*m REAL)
-    REAL *work=(REAL *)fasp_mem_calloc(10*m,sizeof(REAL));
+    const size_t mark = fasp_arena_mark(NULL);
+    REAL *work = (REAL *)fasp_arena_calloc(NULL,10*m,sizeof(REAL));
     REAL *r=work, *rt=r+m, *p=rt+m, *v=p+m;
     REAL *ph=v+m, *xhalf=ph+m, *s=xhalf+m, *sh=s+m;
     REAL *t = sh+m, *xmin = t+m;
@@ -450,6 +463,7 @@ INT fasp_solver_dbsr_pbcgs (dBSRmat     *A,
     // shadow residual rt = r* := r
     fasp_darray_cp(m,r,rt);
     normrmin  = normr;
+    normx     = fasp_blas_darray_norm2(m,x);
     
     rho = 1.0;
     omega = 1.0;
@@ -483,8 +497,7 @@ INT fasp_solver_dbsr_pbcgs (dBSRmat     *A,
             }
             
             // p = r + beta * (p - omega * v);
-            fasp_blas_darray_axpy(m,-omega,v,p);        //p=p - omega*v
-            fasp_blas_darray_axpby(m,1.0, r, beta, p);  //p = 1.0*r +beta*p
+            fasp_blas_darray_axpbypcz(m,1.0,r,-beta*omega,v,beta,p,p);
         }
         
         // pp = precond(p) ,ph
@@ -511,7 +524,6 @@ INT fasp_solver_dbsr_pbcgs (dBSRmat     *A,
             goto FINISHED;
         }
         
-        normx =  fasp_blas_darray_norm2(m,x);
         normph = fasp_blas_darray_norm2(m,ph);
         if (ABS(alpha)*normph < DBL_EPSILON*normx )
             stag = stag + 1;
@@ -520,9 +532,9 @@ INT fasp_solver_dbsr_pbcgs (dBSRmat     *A,
         
         // xhalf = x + alpha * ph;        // form the "half" iterate
         // s = r - alpha * v;             // residual associated with xhalf
-        fasp_blas_darray_axpyz(m, alpha, ph, x , xhalf);  // z= ax + y
-        fasp_blas_darray_axpyz(m, -alpha, v, r, s);
-        normr = fasp_blas_darray_norm2(m,s);  // normr = norm(s);
+        fasp_blas_darray_axpyz2_norm2(m,alpha,ph,x,xhalf,-alpha,v,r,s,norms);
+        norm_xhalf = norms[0];
+        normr = norms[1];  // normr = norm(s);
         normr_act = normr;
         
         // compute reduction factor of residual ||r||
@@ -544,7 +556,7 @@ INT fasp_solver_dbsr_pbcgs (dBSRmat     *A,
                 imin = iter - 0.5;
                 half_step++;
                 if ( PrtLvl >= PRINT_MORE )
-                    printf("Flag = %d Stag = %d Itermin = %.1f Half_step = %d\n",
+                    printf("Flag = " INTFMT " Stag = " INTFMT " Itermin = %.1f Half_step = " INTFMT "\n",
                            flag,stag,imin,half_step);
                 goto FINISHED;
             }
@@ -573,7 +585,7 @@ INT fasp_solver_dbsr_pbcgs (dBSRmat     *A,
             imin = iter - 0.5;
             half_step++;
             if ( PrtLvl >= PRINT_MORE )
-                printf("Flag = %d Stag = %d Itermin = %.1f Half_step = %d\n",
+                printf("Flag = " INTFMT " Stag = " INTFMT " Itermin = %.1f Half_step = " INTFMT "\n",
                        flag,stag,imin,half_step);
         }
         
@@ -586,31 +598,32 @@ INT fasp_solver_dbsr_pbcgs (dBSRmat     *A,
         
         // t = A*sh;
         fasp_blas_dbsr_mxv(A,sh,t);
-        // tt = t' * t;
-        tt = fasp_blas_darray_dotprod(m,t,t);
+        // tt = t' * t and dots[1] = t' * s;
+        fasp_blas_darray_dotprod2(m,t,t,s,dots);
+        tt = dots[0];
         if ( (tt == 0) ||( tt >= DBL_MAX ) ) {
             flag = 4;
             goto FINISHED;
         }
         
         // omega = (t' * s) / tt;
-        omega = fasp_blas_darray_dotprod(m,s,t)/tt;
+        omega = dots[1]/tt;
         if ( ABS(omega) > DBL_MAX ) {
             flag = 4;
             goto FINISHED;
         }
         
         norm_sh = fasp_blas_darray_norm2(m,sh);
-        norm_xhalf = fasp_blas_darray_norm2(m,xhalf);
         
         if ( ABS(omega)*norm_sh < DBL_EPSILON*norm_xhalf )
             stag = stag + 1;
         else
             stag = 0;
         
-        fasp_blas_darray_axpyz(m, omega,sh,xhalf, x);  // x = xhalf + omega * sh;
-        fasp_blas_darray_axpyz(m, -omega, t, s, r);    // r = s - omega * t;
-        normr = fasp_blas_darray_norm2(m,r);           // normr = norm(r);
+        // x = xhalf + omega * sh; r = s - omega * t;
+        fasp_blas_darray_axpyz2_norm2(m,omega,sh,xhalf,x,-omega,t,s,r,norms);
+        normx = norms[0];
+        normr = norms[1];  // normr = norm(r);
         normr_act = normr;
         
         // check for convergence
@@ -675,11 +688,11 @@ FINISHED:  // finish iterative method
     if ( PrtLvl > PRINT_NONE ) ITS_FINAL(iter,MaxIt,relres);
     
     if ( PrtLvl >= PRINT_MORE )
-        printf("Flag = %d Stag = %d Itermin = %.1f Half_step = %d\n",
+        printf("Flag = " INTFMT " Stag = " INTFMT " Itermin = %.1f Half_step = " INTFMT "\n",
                flag,stag,imin,half_step);
     
     // clean up temp memory
-    fasp_mem_free(work); work = NULL;
+    fasp_arena_release(NULL,mark); work = NULL;
     
 #if DEBUG_MODE > 0
     printf("### DEBUG: [--End--] %s ...\n", __FUNCTION__);
@@ -711,6 +724,9 @@ FINISHED:  // finish iterative method
  *
  * \author Chunsheng Feng
  * \date   03/04/2016
+ *
+ * Modified by FASP team on 10/16/2026: draw work space from the arena
+ * Modified by FASP team on 10/16/2026: fused BLAS1 kernels
  */
 INT fasp_solver_dblc_pbcgs (dBLCmat     *A,
                             dvector     *b,
@@ -731,10 +747,12 @@ INT fasp_solver_dblc_pbcgs (dBLCmat     *A,
     REAL     alpha,beta,omega,rho,rho1,rtv,tt;
     REAL     normr,normr_act,normph,normx,imin;
     REAL     norm_sh,norm_xhalf,normrmin,factor;
+    REAL     norms[2], dots[2];
     REAL     *x = u->val, *bval=b->val;
     
     // allocate temp memory (need 10*m REAL)
-    REAL *work=(REAL *)fasp_mem_calloc(10*m,sizeof(REAL));
+    const size_t mark = fasp_arena_mark(NULL);
+    REAL *work = (REAL *)fasp_arena_calloc(NULL,10*m,sizeof(REAL));
     REAL *r=work, *rt=r+m, *p=rt+m, *v=p+m;
     REAL *ph=v+m, *xhalf=ph+m, *s=xhalf+m, *sh=s+m;
     REAL *t = sh+m, *xmin = t+m;
@@ -777,6 +795,7 @@ INT fasp_solver_dblc_pbcgs (dBLCmat     *A,
     // shadow residual rt = r* := r
     fasp_darray_cp(m,r,rt);
     normrmin  = normr;
+    normx     = fasp_blas_darray_norm2(m,x);
     
     rho = 1.0;
     omega = 1.0;
@@ -810,8 +829,7 @@ INT fasp_solver_dblc_pbcgs (dBLCmat     *A,
             }
             
             // p = r + beta * (p - omega * v);
-            fasp_blas_darray_axpy(m,-omega,v,p);        //p=p - omega*v
-            fasp_blas_darray_axpby(m,1.0, r, beta, p);  //p = 1.0*r +beta*p
+            fasp_blas_darray_axpbypcz(m,1.0,r,-beta*omega,v,beta,p,p);
         }
         
         // pp = precond(p) ,ph
@@ -838,7 +856,6 @@ INT fasp_solver_dblc_pbcgs (dBLCmat     *A,
             goto FINISHED;
         }
         
-        normx =  fasp_blas_darray_norm2(m,x);
         normph = fasp_blas_darray_norm2(m,ph);
         if (ABS(alpha)*normph < DBL_EPSILON*normx )
             stag = stag + 1;
@@ -847,9 +864,9 @@ INT fasp_solver_dblc_pbcgs (dBLCmat     *A,
         
         // xhalf = x + alpha * ph;        // form the "half" iterate
         // s = r - alpha * v;             // residual associated with xhalf
-        fasp_blas_darray_axpyz(m, alpha, ph, x , xhalf);  // z= ax + y
-        fasp_blas_darray_axpyz(m, -alpha, v, r, s);
-        normr = fasp_blas_darray_norm2(m,s);  // normr = norm(s);
+        fasp_blas_darray_axpyz2_norm2(m,alpha,ph,x,xhalf,-alpha,v,r,s,norms);
+        norm_xhalf = norms[0];
+        normr = norms[1];  // normr = norm(s);
         normr_act = normr;
         
         // compute reduction factor of residual ||r||
@@ -871,7 +888,7 @@ INT fasp_solver_dblc_pbcgs (dBLCmat     *A,
                 imin = iter - 0.5;
                 half_step++;
                 if ( PrtLvl >= PRINT_MORE )
-                    printf("Flag = %d Stag = %d Itermin = %.1f Half_step = %d\n",
+                    printf("Flag = " INTFMT " Stag = " INTFMT " Itermin = %.1f Half_step = " INTFMT "\n",
                            flag,stag,imin,half_step);
                 goto FINISHED;
             }
@@ -900,7 +917,7 @@ INT fasp_solver_dblc_pbcgs (dBLCmat     *A,
             imin = iter - 0.5;
             half_step++;
             if ( PrtLvl >= PRINT_MORE )
-                printf("Flag = %d Stag = %d Itermin = %.1f Half_step = %d\n",
+                printf("Flag = " INTFMT " Stag = " INTFMT " Itermin = %.1f Half_step = " INTFMT "\n",
                        flag,stag,imin,half_step);
         }
         
@@ -913,31 +930,32 @@ INT fasp_solver_dblc_pbcgs (dBLCmat     *A,
         
         // t = A*sh;
         fasp_blas_dblc_mxv(A,sh,t);
-        // tt = t' * t;
-        tt = fasp_blas_darray_dotprod(m,t,t);
+        // tt = t' * t and dots[1] = t' * s;
+        fasp_blas_darray_dotprod2(m,t,t,s,dots);
+        tt = dots[0];
         if ( (tt == 0) ||( tt >= DBL_MAX ) ) {
             flag = 4;
             goto FINISHED;
         }
         
         // omega = (t' * s) / tt;
-        omega = fasp_blas_darray_dotprod(m,s,t)/tt;
+        omega = dots[1]/tt;
         if ( ABS(omega) > DBL_MAX ) {
             flag = 4;
             goto FINISHED;
         }
         
         norm_sh = fasp_blas_darray_norm2(m,sh);
-        norm_xhalf = fasp_blas_darray_norm2(m,xhalf);
         
         if ( ABS(omega)*norm_sh < DBL_EPSILON*norm_xhalf )
             stag = stag + 1;
         else
             stag = 0;
         
-        fasp_blas_darray_axpyz(m, omega,sh,xhalf, x);  // x = xhalf + omega * sh;
-        fasp_blas_darray_axpyz(m, -omega, t, s, r);    // r = s - omega * t;
-        normr = fasp_blas_darray_norm2(m,r);           // normr = norm(r);
+        // x = xhalf + omega * sh; r = s - omega * t;
+        fasp_blas_darray_axpyz2_norm2(m,omega,sh,xhalf,x,-omega,t,s,r,norms);
+        normx = norms[0];
+        normr = norms[1];  // normr = norm(r);
         normr_act = normr;
         
         // check for convergence
@@ -1002,11 +1020,11 @@ FINISHED:  // finish iterative method
     if ( PrtLvl > PRINT_NONE ) ITS_FINAL(iter,MaxIt,relres);
     
     if ( PrtLvl >= PRINT_MORE )
-        printf("Flag = %d Stag = %d Itermin = %.1f Half_step = %d\n",
+        printf("Flag = " INTFMT " Stag = " INTFMT " Itermin = %.1f Half_step = " INTFMT "\n",
                flag,stag,imin,half_step);
     
     // clean up temp memory
-    fasp_mem_free(work); work = NULL;
+    fasp_arena_release(NULL,mark); work = NULL;
     
 #if DEBUG_MODE > 0
     printf("### DEBUG: [--End--] %s ...\n", __FUNCTION__);
@@ -1038,6 +1056,9 @@ FINISHED:  // finish iterative method
  *
  * \author Chunsheng Feng
  * \date   03/04/2016
+ *
+ * Modified by FASP team on 10/16/2026: draw work space from the arena
+ * Modified by FASP team on 10/16/2026: fused BLAS1 kernels
  */
 INT fasp_solver_dstr_pbcgs (dSTRmat     *A,
                             dvector     *b,
@@ -1058,10 +1079,12 @@ INT fasp_solver_dstr_pbcgs (dSTRmat     *A,
     REAL     alpha,beta,omega,rho,rho1,rtv,tt;
     REAL     normr,normr_act,normph,normx,imin;
     REAL     norm_sh,norm_xhalf,normrmin,factor;
+    REAL     norms[2], dots[2];
     REAL     *x = u->val, *bval=b->val;
     
     // allocate temp memory (need 10*m REAL)
-    REAL *work=(REAL *)fasp_mem_calloc(10*m,sizeof(REAL));
+    const size_t mark = fasp_arena_mark(NULL);
+    REAL *work = (REAL *)fasp_arena_calloc(NULL,10*m,sizeof(REAL));
     REAL *r=work, *rt=r+m, *p=rt+m, *v=p+m;
     REAL *ph=v+m, *xhalf=ph+m, *s=xhalf+m, *sh=s+m;
     REAL *t = sh+m, *xmin = t+m;
@@ -1104,6 +1127,7 @@ INT fasp_solver_dstr_pbcgs (dSTRmat     *A,
     // shadow residual rt = r* := r
     fasp_darray_cp(m,r,rt);
     normrmin  = normr;
+    normx     = fasp_blas_darray_norm2(m,x);
     
     rho = 1.0;
     omega = 1.0;
@@ -1137,8 +1161,7 @@ INT fasp_solver_dstr_pbcgs (dSTRmat     *A,
             }
             
             // p = r + beta * (p - omega * v);
-            fasp_blas_darray_axpy(m,-omega,v,p);        //p=p - omega*v
-            fasp_blas_darray_axpby(m,1.0, r, beta, p);  //p = 1.0*r +beta*p
+            fasp_blas_darray_axpbypcz(m,1.0,r,-beta*omega,v,beta,p,p);
         }
         
         // pp = precond(p) ,ph
@@ -1165,7 +1188,6 @@ INT fasp_solver_dstr_pbcgs (dSTRmat     *A,
             goto FINISHED;
         }
         
-        normx =  fasp_blas_darray_norm2(m,x);
         normph = fasp_blas_darray_norm2(m,ph);
         if (ABS(alpha)*normph < DBL_EPSILON*normx )
             stag = stag + 1;
@@ -1174,9 +1196,9 @@ INT fasp_solver_dstr_pbcgs (dSTRmat     *A,
         
         // xhalf = x + alpha * ph;        // form the "half" iterate
         // s = r - alpha * v;             // residual associated with xhalf
-        fasp_blas_darray_axpyz(m, alpha, ph, x , xhalf);  // z= ax + y
-        fasp_blas_darray_axpyz(m, -alpha, v, r, s);
-        normr = fasp_blas_darray_norm2(m,s);  // normr = norm(s);
+        fasp_blas_darray_axpyz2_norm2(m,alpha,ph,x,xhalf,-alpha,v,r,s,norms);
+        norm_xhalf = norms[0];
+        normr = norms[1];  // normr = norm(s);
         normr_act = normr;
         
         // compute reduction factor of residual ||r||
@@ -1198,7 +1220,7 @@ INT fasp_solver_dstr_pbcgs (dSTRmat     *A,
                 imin = iter - 0.5;
                 half_step++;
                 if ( PrtLvl >= PRINT_MORE )
-                    printf("Flag = %d Stag = %d Itermin = %.1f Half_step = %d\n",
+                    printf("Flag = " INTFMT " Stag = " INTFMT " Itermin = %.1f Half_step = " INTFMT "\n",
                            flag,stag,imin,half_step);
                 goto FINISHED;
             }
@@ -1227,7 +1249,7 @@ INT fasp_solver_dstr_pbcgs (dSTRmat     *A,
             imin = iter - 0.5;
             half_step++;
             if ( PrtLvl >= PRINT_MORE )
-                printf("Flag = %d Stag = %d Itermin = %.1f Half_step = %d\n",
+                printf("Flag = " INTFMT " Stag = " INTFMT " Itermin = %.1f Half_step = " INTFMT "\n",
                        flag,stag,imin,half_step);
         }
         
@@ -1240,31 +1262,32 @@ INT fasp_solver_dstr_pbcgs (dSTRmat     *A,
         
         // t = A*sh;
         fasp_blas_dstr_mxv(A,sh,t);
-        // tt = t' * t;
-        tt = fasp_blas_darray_dotprod(m,t,t);
+        // tt = t' * t and dots[1] = t' * s;
+        fasp_blas_darray_dotprod2(m,t,t,s,dots);
+        tt = dots[0];
         if ( (tt == 0) ||( tt >= DBL_MAX ) ) {
             flag = 4;
             goto FINISHED;
         }
         
         // omega = (t' * s) / tt;
-        omega = fasp_blas_darray_dotprod(m,s,t)/tt;
+        omega = dots[1]/tt;
         if ( ABS(omega) > DBL_MAX ) {
             flag = 4;
             goto FINISHED;
         }
         
         norm_sh = fasp_blas_darray_norm2(m,sh);
-        norm_xhalf = fasp_blas_darray_norm2(m,xhalf);
         
         if ( ABS(omega)*norm_sh < DBL_EPSILON*norm_xhalf )
             stag = stag + 1;
         else
             stag = 0;
         
-        fasp_blas_darray_axpyz(m, omega,sh,xhalf, x);  // x = xhalf + omega * sh;
-        fasp_blas_darray_axpyz(m, -omega, t, s, r);    // r = s - omega * t;
-        normr = fasp_blas_darray_norm2(m,r);           // normr = norm(r);
+        // x = xhalf + omega * sh; r = s - omega * t;
+        fasp_blas_darray_axpyz2_norm2(m,omega,sh,xhalf,x,-omega,t,s,r,norms);
+        normx = norms[0];
+        normr = norms[1];  // normr = norm(r);
         normr_act = normr;
         
         // check for convergence
@@ -1329,11 +1352,11 @@ FINISHED:  // finish iterative method
     if ( PrtLvl > PRINT_NONE ) ITS_FINAL(iter,MaxIt,relres);
     
     if ( PrtLvl >= PRINT_MORE )
-        printf("Flag = %d Stag = %d Itermin = %.1f Half_step = %d\n",
+        printf("Flag = " INTFMT " Stag = " INTFMT " Itermin = %.1f Half_step = " INTFMT "\n",
                flag,stag,imin,half_step);
     
     // clean up temp memory
-    fasp_mem_free(work); work = NULL;
+    fasp_arena_release(NULL,mark); work = NULL;
     
 #if DEBUG_MODE > 0
     printf("### DEBUG: [--End--] %s ...\n", __FUNCTION__);
@@ -1365,6 +1388,8 @@ FINISHED:  // finish iterative method
  *
  * \author Chunsheng Feng
  * \date   03/04/2016
+ *
+ * Modified by FASP team on 10/16/2026: draw work space from the arena
  */
 INT fasp_solver_pbcgs (mxv_matfree *mf,
                        dvector     *b,
@@ -1388,7 +1413,8 @@ INT fasp_solver_pbcgs (mxv_matfree *mf,
     REAL     *x = u->val, *bval=b->val;
     
     // allocate temp memory (need 10*m REAL)
-    REAL *work=(REAL *)fasp_mem_calloc(10*m,sizeof(REAL));
+    const size_t mark = fasp_arena_mark(NULL);
+    REAL *work = (REAL *)fasp_arena_calloc(NULL,10*m,sizeof(REAL));
     REAL *r=work, *rt=r+m, *p=rt+m, *v=p+m;
     REAL *ph=v+m, *xhalf=ph+m, *s=xhalf+m, *sh=s+m;
     REAL *t = sh+m, *xmin = t+m;
@@ -1529,7 +1555,7 @@ INT fasp_solver_pbcgs (mxv_matfree *mf,
                 imin = iter - 0.5;
                 half_step++;
                 if ( PrtLvl >= PRINT_MORE )
-                    printf("Flag = %d Stag = %d Itermin = %.1f Half_step = %d\n",
+                    printf("Flag = " INTFMT " Stag = " INTFMT " Itermin = %.1f Half_step = " INTFMT "\n",
                            flag,stag,imin,half_step);
                 goto FINISHED;
             }
@@ -1558,7 +1584,7 @@ INT fasp_solver_pbcgs (mxv_matfree *mf,
             imin = iter - 0.5;
             half_step++;
             if ( PrtLvl >= PRINT_MORE )
-                printf("Flag = %d Stag = %d Itermin = %.1f Half_step = %d\n",
+                printf("Flag = " INTFMT " Stag = " INTFMT " Itermin = %.1f Half_step = " INTFMT "\n",
                        flag,stag,imin,half_step);
         }
         
@@ -1668,11 +1694,11 @@ FINISHED:  // finish iterative method
     if ( PrtLvl > PRINT_NONE ) ITS_FINAL(iter,MaxIt,relres);
     
     if ( PrtLvl >= PRINT_MORE )
-        printf("Flag = %d Stag = %d Itermin = %.1f Half_step = %d\n",
+        printf("Flag = " INTFMT " Stag = " INTFMT " Itermin = %.1f Half_step = " INTFMT "\n",
                flag,stag,imin,half_step);
     
     // clean up temp memory
-    fasp_mem_free(work); work = NULL;
+    fasp_arena_release(NULL,mark); work = NULL;
     
 #if DEBUG_MODE > 0
     printf("### DEBUG: [--End--] %s ...\n", __FUNCTION__);
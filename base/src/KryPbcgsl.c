@@ -0,0 +1,743 @@
+/*! \file  KryPbcgsl.c
+ *
+ *  \brief Krylov subspace methods -- Right-preconditioned BiCGstab(l)
+ *
+ *  \note  This file contains Level-3 (Kry) functions. It requires:
+ *         AuxArray.c, AuxMemory.c, AuxMessage.c, AuxThreads.c, BlaArray.c,
+ *         BlaSpmvBSR.c, and BlaSpmvCSR.c
+ *
+ *  \note  See KryPbcgs.c for the standard BiCGstab method, i.e., l = 1
+ *
+ *  Reference:
+ *         G.L.G. Sleijpen and D.R. Fokkema 1993
+ *         BiCGstab(l) for linear equations involving unsymmetric matrices with
+ *         complex spectrum, Electronic Transactions on Numerical Analysis 1, 11--32
+ *
+ *         G.L.G. Sleijpen and H.A. van der Vorst 1996
+ *         Reliable updated residuals in hybrid Bi-CG methods, Computing 56, 141--163
+ *
+ *---------------------------------------------------------------------------------
+ *  Copyright (C) 2009--Present by the FASP team. All rights reserved.
+ *  Released under the terms of the GNU Lesser General Public License 3.0 or later.
+ *---------------------------------------------------------------------------------
+ *
+ *  Abstract algorithm
+ *
+ *  Each outer iteration makes l BiCG steps, which build the vectors
+ *  r_j = (A*M)^j r_0 and u_j = (A*M)^j u_0, j = 0, ..., l, followed by a minimal
+ *  residual (MR) step: gamma minimizes ||r_0 - sum_j gamma_j r_j||. BiCGstab is
+ *  the special case l = 1; larger l copes better with complex spectra.
+ *
+ *  The MR step needs all inner products (r_i, r_j), i, j = 0, ..., l. They are
+ *  computed in one sweep over the vectors with one reduction, and the norm of the
+ *  new residual follows from them without another inner product. The updates of
+ *  u_0, r_0 and the solution are fused into one more sweep.
+ */
+
+#include <math.h>
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+#include "fasp.h"
+#include "fasp_functs.h"
+
+/*---------------------------------*/
+/*--  Declare Private Functions  --*/
+/*---------------------------------*/
+
+#include "KryUtil.inl"
+
+/**
+ * \struct bcgsl_csr
+ * \brief  CSR matrix together with its SpMV plan
+ */
+typedef struct {
+    dCSRmat  *A;    /**< coefficient matrix */
+    dCSRplan *plan; /**< SpMV plan of A */
+} bcgsl_csr;
+
+static void bcgsl_mxv_csr (const void *, const REAL *, REAL *);
+static void bcgsl_mxv_bsr (const void *, const REAL *, REAL *);
+static void bcgsl_apply (mxv_matfree *, precond *, const INT, REAL *, REAL *,
+                         REAL *);
+static REAL bcgsl_residual (mxv_matfree *, precond *, const INT, const REAL *,
+                            REAL *, REAL *, REAL *, REAL *);
+static void bcgsl_dots (const INT, const REAL *, const REAL *, const REAL *,
+                        REAL *);
+static void bcgsl_gram (const INT, const INT, REAL **, REAL *);
+static INT  bcgsl_mr (const INT, const REAL *, REAL *, REAL *);
+static void bcgsl_update (const INT, const INT, const REAL *, REAL **, REAL **,
+                          REAL *);
+
+/*---------------------------------*/
+/*--      Public Functions       --*/
+/*---------------------------------*/
+
+/**
+ * \fn INT fasp_solver_dcsr_pbcgsl (dCSRmat *A, dvector *b, dvector *u, precond *pc,
+ *                                  const REAL tol, const INT MaxIt, const SHORT ell,
+ *                                  const SHORT StopType, const SHORT PrtLvl)
+ *
+ * \brief Preconditioned BiCGstab(l) method for solving Au=b for CSR matrix
+ *
+ * \param A            Pointer to coefficient matrix
+ * \param b            Pointer to dvector of right hand side
+ * \param u            Pointer to dvector of DOFs
+ * \param pc           Pointer to precond: structure of precondition
+ * \param tol          Tolerance for stopping
+ * \param MaxIt        Maximal number of iterations
+ * \param ell          Number of BiCG steps per MR step
+ * \param StopType     Stopping criteria type -- only STOP_REL_RES is supported
+ * \param PrtLvl       How much information to print out
+ *
+ * \return             Iteration number if converges; ERROR otherwise.
+ *
+ * \author FASP team
+ * \date   10/16/2026
+ *
+ * \note The matrix-vector products use an SpMV plan of A.
+ */
+INT fasp_solver_dcsr_pbcgsl (dCSRmat     *A,
+                             dvector     *b,
+                             dvector     *u,
+                             precond     *pc,
+                             const REAL   tol,
+                             const INT    MaxIt,
+                             const SHORT  ell,
+                             const SHORT  StopType,
+                             const SHORT  PrtLvl)
+{
+    bcgsl_csr   data;
+    mxv_matfree mf;
+    INT         iter;
+
+    if ( PrtLvl > PRINT_NONE ) printf("\nCalling BiCGstab(l) solver (CSR) ...\n");
+
+    data.A    = A;
+    data.plan = fasp_dcsr_plan_create(A);
+    mf.data   = &data;
+    mf.fct    = bcgsl_mxv_csr;
+
+    iter = fasp_solver_pbcgsl(&mf, b, u, pc, tol, MaxIt, ell, StopType, PrtLvl);
+
+    fasp_dcsr_plan_free(data.plan);
+
+    return iter;
+}
+
+/**
+ * \fn INT fasp_solver_dbsr_pbcgsl (dBSRmat *A, dvector *b, dvector *u, precond *pc,
+ *                                  const REAL tol, const INT MaxIt, const SHORT ell,
+ *                                  const SHORT StopType, const SHORT PrtLvl)
+ *
+ * \brief Preconditioned BiCGstab(l) method for solving Au=b for BSR matrix
+ *
+ * \param A            Pointer to coefficient matrix
+ * \param b            Pointer to dvector of right hand side
+ * \param u            Pointer to dvector of DOFs
+ * \param pc           Pointer to precond: structure of precondition
+ * \param tol          Tolerance for stopping
+ * \param MaxIt        Maximal number of iterations
+ * \param ell          Number of BiCG steps per MR step
+ * \param StopType     Stopping criteria type -- only STOP_REL_RES is supported
+ * \param PrtLvl       How much information to print out
+ *
+ * \return             Iteration number if converges; ERROR otherwise.
+ *
+ * \author FASP team
+ * \date   10/16/2026
+ */
+INT fasp_solver_dbsr_pbcgsl (dBSRmat     *A,
+                             dvector     *b,
+                             dvector     *u,
+                             precond     *pc,
+                             const REAL   tol,
+                             const INT    MaxIt,
+                             const SHORT  ell,
+                             const SHORT  StopType,
+                             const SHORT  PrtLvl)
+{
+    mxv_matfree mf;
+
+    if ( PrtLvl > PRINT_NONE ) printf("\nCalling BiCGstab(l) solver (BSR) ...\n");
+
+    mf.data = A;
+    mf.fct  = bcgsl_mxv_bsr;
+
+    return fasp_solver_pbcgsl(&mf, b, u, pc, tol, MaxIt, ell, StopType, PrtLvl);
+}
+
+/**
+ * \fn INT fasp_solver_pbcgsl (mxv_matfree *mf, dvector *b, dvector *u, precond *pc,
+ *                             const REAL tol, const INT MaxIt, const SHORT ell,
+ *                             const SHORT StopType, const SHORT PrtLvl)
+ *
+ * \brief Preconditioned BiCGstab(l) method for solving Au=b
+ *
+ * \param mf           Pointer to mxv_matfree: spmv operation
+ * \param b            Pointer to dvector of right hand side
+ * \param u            Pointer to dvector of DOFs
+ * \param pc           Pointer to precond: structure of precondition
+ * \param tol          Tolerance for stopping
+ * \param MaxIt        Maximal number of iterations
+ * \param ell          Number of BiCG steps per MR step
+ * \param StopType     Stopping criteria type -- only STOP_REL_RES is supported
+ * \param PrtLvl       How much information to print out
+ *
+ * \return             Iteration number if converges; ERROR otherwise.
+ *
+ * \author FASP team
+ * \date   10/16/2026
+ *
+ * \note The preconditioner is applied from the right, so the recursively updated
+ *       residual is the true residual and the stopping test is always
+ *       ||r||/||r_0|| < tol. Iterations count BiCG steps, i.e., l = 1 counts as
+ *       BiCGstab does. A small true residual is checked before returning.
+ */
+INT fasp_solver_pbcgsl (mxv_matfree *mf,
+                        dvector     *b,
+                        dvector     *u,
+                        precond     *pc,
+                        const REAL   tol,
+                        const INT    MaxIt,
+                        const SHORT  ell,
+                        const SHORT  StopType,
+                        const SHORT  PrtLvl)
+{
+    const INT    n  = b->row;
+    const INT    l  = MAX(MIN(ell, BICGSTABL_MAXELL), 1);
+    const INT    l1 = l + 1;
+    const size_t mark = fasp_arena_mark(NULL);
+
+    // local variables
+    INT      iter = 0, i, j, q, nbreak = 0;
+    SHORT    breakdown, converged;
+    REAL     alpha = 0.0, omega = 1.0, rho0 = 1.0, beta, sigma, t, dots[2];
+    REAL     absres0 = BIGREAL, absres = BIGREAL, relres = BIGREAL, factor;
+    REAL    *x = u->val;
+
+    // allocate temp memory: r_0, ..., r_l, u_0, ..., u_l, rt, xh and z
+    REAL   **r    = (REAL **)fasp_arena_calloc(NULL, 2*l1, sizeof(REAL *));
+    REAL    *work = (REAL *) fasp_arena_calloc(NULL, (size_t)(2*l1+3)*n, sizeof(REAL));
+    REAL    *G    = (REAL *) fasp_arena_calloc(NULL, l1*l1+l*l+l1, sizeof(REAL));
+    REAL   **v    = r + l1;
+    REAL    *rt   = work + (size_t)2*l1*n, *xh = rt + n, *z = xh + n;
+    REAL    *L    = G + l1*l1, *gam = L + l*l;
+
+    for ( j = 0; j < 2*l1; j++ ) r[j] = work + (size_t)j*n;
+
+#if DEBUG_MODE > 0
+    printf("### DEBUG: [-Begin-] %s ...\n", __FUNCTION__);
+    printf("### DEBUG: maxit = " INTFMT ", tol = %.4le, l = " INTFMT "\n", MaxIt, tol, l);
+#endif
+
+    if ( StopType != STOP_REL_RES && PrtLvl > PRINT_NONE ) {
+        printf("### WARNING: BiCGstab(l) uses STOP_REL_RES as stopping criteria!\n");
+    }
+
+    // r_0 = b-A*x
+    absres = bcgsl_residual(mf, pc, n, b->val, x, xh, z, r[0]);
+    absres0 = MAX(SMALLREAL, absres);
+    relres  = absres/absres0;
+
+    // if initial residual is small, no need to iterate!
+    if ( relres < tol || absres0 < 1e-3*tol ) goto FINISHED;
+
+    // output iteration information if needed
+    fasp_itinfo(PrtLvl, STOP_REL_RES, iter, relres, absres0, 0.0);
+
+    // shadow residual rt = r_0
+    fasp_darray_cp(n, r[0], rt);
+
+    while ( iter < MaxIt ) {
+
+        rho0 = -omega*rho0;
+        breakdown = converged = FALSE;
+
+        /* BiCG part: l steps with A*M */
+        for ( j = 0; j < l && iter < MaxIt; j++ ) {
+
+            if ( rho0 == 0.0 ) { breakdown = TRUE; break; }
+
+            // (r_j,rt) and ||r_0|| in one sweep, stop early once r_0 is small
+            bcgsl_dots(n, r[j], rt, r[0], dots);
+            if ( j > 0 && sqrt(dots[1]) < tol*absres0 ) {
+                t      = absres;
+                absres = sqrt(dots[1]);
+                relres = absres/absres0;
+                fasp_itinfo(PrtLvl, STOP_REL_RES, iter, relres, absres, absres/t);
+                converged = breakdown = TRUE; break;
+            }
+            beta = alpha*dots[0]/rho0;
+            rho0 = dots[0];
+
+            // u_i = r_i - beta*u_i, i = 0, ..., j
+            for ( i = 0; i <= j; i++ ) fasp_blas_darray_axpby(n, 1.0, r[i], -beta, v[i]);
+
+            bcgsl_apply(mf, pc, n, v[j], z, v[j+1]);
+            sigma = fasp_blas_darray_dotprod(n, v[j+1], rt);
+            if ( sigma == 0.0 ) { breakdown = TRUE; break; }
+            alpha = rho0/sigma;
+
+            // r_i = r_i - alpha*u_{i+1}, i = 0, ..., j
+            for ( i = 0; i <= j; i++ ) fasp_blas_darray_axpy(n, -alpha, v[i+1], r[i]);
+
+            bcgsl_apply(mf, pc, n, r[j], z, r[j+1]);
+            fasp_blas_darray_axpy(n, alpha, v[0], xh);
+
+            iter++;
+        }
+
+        /* MR part: minimize ||r_0 - sum_j gamma_j r_j|| over the completed steps */
+        if ( j > 0 && !converged ) {
+
+            bcgsl_gram(n, j+1, r, G);
+            q = bcgsl_mr(j, G, L, gam);
+
+            // ||r_0 - R*gamma||^2 = (r_0,r_0) - sum_j gamma_j (r_j,r_0)
+            t = G[0];
+            for ( i = 1; i <= q; i++ ) t -= gam[i]*G[i*(j+1)];
+
+            bcgsl_update(n, j, gam, r, v, xh);
+
+            omega  = ( j == l ) ? gam[l] : 0.0;
+            factor = absres;
+            absres = sqrt(MAX(t, 0.0));
+            factor = absres/factor;
+            relres = absres/absres0;
+
+            fasp_itinfo(PrtLvl, STOP_REL_RES, iter, relres, absres, factor);
+
+            if ( q < j || omega == 0.0 ) breakdown = TRUE;
+            else nbreak = 0;
+        }
+
+        /* check the true residual if converged */
+        if ( relres < tol ) {
+            t = relres;
+            absres = bcgsl_residual(mf, pc, n, b->val, x, xh, z, r[0]);
+            relres = absres/absres0;
+
+            if ( relres < tol ) break;
+
+            if ( PrtLvl >= PRINT_MORE ) {
+                ITS_FACONV; ITS_COMPRES(t); ITS_REALRES(relres);
+            }
+        }
+
+        /* restart with the true residual as the shadow residual after breakdown */
+        if ( breakdown ) {
+            if ( ++nbreak > 2 ) {
+                if ( PrtLvl > PRINT_NONE ) ITS_STAGGED;
+                break;
+            }
+            if ( PrtLvl >= PRINT_MORE ) ITS_RESTART;
+
+            absres = bcgsl_residual(mf, pc, n, b->val, x, xh, z, r[0]);
+            relres = absres/absres0;
+            if ( relres < tol ) break;
+
+            fasp_darray_cp(n, r[0], rt);
+            fasp_darray_set(n, v[0], 0.0);
+            alpha = 0.0; omega = 1.0; rho0 = 1.0;
+        }
+
+    } // end of main loop
+
+    // x = x + M*xh, which has been done already if converged
+    if ( relres >= tol ) {
+        absres = bcgsl_residual(mf, pc, n, b->val, x, xh, z, r[0]);
+        relres = absres/absres0;
+    }
+
+FINISHED:
+    if ( PrtLvl > PRINT_NONE ) ITS_FINAL(iter, MaxIt, relres);
+
+    // clean up temp memory
+    fasp_arena_release(NULL, mark);
+
+#if DEBUG_MODE > 0
+    printf("### DEBUG: [--End--] %s ...\n", __FUNCTION__);
+#endif
+
+    if ( iter >= MaxIt && relres > tol )
+        return ERROR_SOLVER_MAXIT;
+    else
+        return iter;
+}
+
+/*---------------------------------*/
+/*--      Private Functions      --*/
+/*---------------------------------*/
+
+/**
+ * \fn static void bcgsl_mxv_csr (const void *data, const REAL *x, REAL *y)
+ *
+ * \brief y = A*x for a CSR matrix with its SpMV plan
+ *
+ * \param data   Pointer to bcgsl_csr
+ * \param x      Pointer to x
+ * \param y      Pointer to y
+ *
+ * \author FASP team
+ * \date   10/16/2026
+ */
+static void bcgsl_mxv_csr (const void  *data,
+                           const REAL  *x,
+                           REAL        *y)
+{
+    const bcgsl_csr *mat = (const bcgsl_csr *)data;
+
+    fasp_blas_dcsr_mxv_plan(mat->A, mat->plan, x, y);
+}
+
+/**
+ * \fn static void bcgsl_mxv_bsr (const void *A, const REAL *x, REAL *y)
+ *
+ * \brief y = A*x for a BSR matrix
+ *
+ * \param A      Pointer to dBSRmat
+ * \param x      Pointer to x
+ * \param y      Pointer to y
+ *
+ * \author FASP team
+ * \date   10/16/2026
+ */
+static void bcgsl_mxv_bsr (const void  *A,
+                           const REAL  *x,
+                           REAL        *y)
+{
+    fasp_blas_dbsr_mxv((const dBSRmat *)A, x, y);
+}
+
+/**
+ * \fn static void bcgsl_apply (mxv_matfree *mf, precond *pc, const INT n,
+ *                              REAL *x, REAL *z, REAL *y)
+ *
+ * \brief y = A*M*x
+ *
+ * \param mf     Pointer to mxv_matfree: spmv operation
+ * \param pc     Pointer to precond: M, or NULL
+ * \param n      Number of variables
+ * \param x      Pointer to x
+ * \param z      Pointer to work space of size n
+ * \param y      Pointer to y
+ *
+ * \author FASP team
+ * \date   10/16/2026
+ */
+static void bcgsl_apply (mxv_matfree  *mf,
+                         precond      *pc,
+                         const INT     n,
+                         REAL         *x,
+                         REAL         *z,
+                         REAL         *y)
+{
+    if ( pc == NULL ) {
+        mf->fct(mf->data, x, y);
+    }
+    else {
+        pc->fct(x, z, pc->data);
+        mf->fct(mf->data, z, y);
+    }
+}
+
+/**
+ * \fn static REAL bcgsl_residual (mxv_matfree *mf, precond *pc, const INT n,
+ *                                 const REAL *b, REAL *x, REAL *xh, REAL *z,
+ *                                 REAL *r)
+ *
+ * \brief x = x + M*xh, xh = 0 and r = b - A*x
+ *
+ * \param mf     Pointer to mxv_matfree: spmv operation
+ * \param pc     Pointer to precond: M, or NULL
+ * \param n      Number of variables
+ * \param b      Pointer to right hand side
+ * \param x      Pointer to solution
+ * \param xh     Pointer to correction of the right-preconditioned system
+ * \param z      Pointer to work space of size n
+ * \param r      Pointer to residual (output)
+ *
+ * \return       ||r||
+ *
+ * \author FASP team
+ * \date   10/16/2026
+ */
+static REAL bcgsl_residual (mxv_matfree  *mf,
+                            precond      *pc,
+                            const INT     n,
+                            const REAL   *b,
+                            REAL         *x,
+                            REAL         *xh,
+                            REAL         *z,
+                            REAL         *r)
+{
+    if ( pc == NULL ) {
+        fasp_blas_darray_axpy(n, 1.0, xh, x);
+    }
+    else {
+        pc->fct(xh, z, pc->data);
+        fasp_blas_darray_axpy(n, 1.0, z, x);
+    }
+    fasp_darray_set(n, xh, 0.0);
+
+    mf->fct(mf->data, x, r);
+    fasp_blas_darray_axpby(n, 1.0, b, -1.0, r);
+
+    return fasp_blas_darray_norm2(n, r);
+}
+
+/**
+ * \fn static void bcgsl_dots (const INT n, const REAL *x, const REAL *y,
+ *                             const REAL *z, REAL *dots)
+ *
+ * \brief Inner products (x,y) and (z,z) in one sweep
+ *
+ * \param n      Number of variables
+ * \param x      Pointer to x
+ * \param y      Pointer to y
+ * \param z      Pointer to z
+ * \param dots   Inner products (x,y) and (z,z) (output)
+ *
+ * \author FASP team
+ * \date   10/16/2026
+ */
+static void bcgsl_dots (const INT    n,
+                        const REAL  *x,
+                        const REAL  *y,
+                        const REAL  *z,
+                        REAL        *dots)
+{
+    REAL s1 = 0.0, s2 = 0.0;
+    INT  i;
+
+#ifdef _OPENMP
+#pragma omp parallel for reduction(+:s1,s2) private(i) if(n>OPENMP_HOLDS)
+#endif
+    for ( i = 0; i < n; ++i ) {
+        s1 += x[i]*y[i];
+        s2 += z[i]*z[i];
+    }
+
+    dots[0] = s1; dots[1] = s2;
+}
+
+/**
+ * \fn static void bcgsl_gram (const INT n, const INT k, REAL **R, REAL *G)
+ *
+ * \brief Gram matrix G = R'*R of k vectors in one sweep
+ *
+ * \param n      Number of variables
+ * \param k      Number of vectors
+ * \param R      Pointers to the vectors
+ * \param G      Pointer to G (k*k, row-major, output)
+ *
+ * \author FASP team
+ * \date   10/16/2026
+ *
+ * \note Only the upper triangle is accumulated. Each thread sums over a block of
+ *       rows, chunk by chunk, so all inner products need one reduction only.
+ */
+static void bcgsl_gram (const INT    n,
+                        const INT    k,
+                        REAL       **R,
+                        REAL        *G)
+{
+    const INT kk = k*k;
+
+    INT   a, c, i, i0, i1;
+    REAL  t;
+
+    SHORT nthreads = 1, use_openmp = FALSE;
+
+#ifdef _OPENMP
+    if ( n > OPENMP_HOLDS ) {
+        use_openmp = TRUE;
+        nthreads = fasp_get_num_threads();
+    }
+#endif
+
+    if (use_openmp) {
+        const size_t mark = fasp_arena_mark(NULL);
+        REAL *Gp = (REAL *)fasp_arena_calloc(NULL, (size_t)nthreads*kk, sizeof(REAL));
+        INT   myid, mybegin, myend;
+#ifdef _OPENMP
+#pragma omp parallel for private(myid, mybegin, myend, a, c, i, i0, i1, t)
+#endif
+        for (myid = 0; myid < nthreads; myid++ ) {
+            REAL *Gm = Gp + (size_t)myid*kk;
+            fasp_get_start_end(myid, nthreads, n, &mybegin, &myend);
+            for (i0 = mybegin; i0 < myend; i0 += CAGMRES_CHUNK) {
+                i1 = MIN(i0+CAGMRES_CHUNK, myend);
+                for (a = 0; a < k; a++) {
+                    for (c = a; c < k; c++) {
+                        t = 0.0;
+                        for (i = i0; i < i1; i++) t += R[a][i]*R[c][i];
+                        Gm[a*k+c] += t;
+                    }
+                }
+            }
+        }
+        for (a = 0; a < kk; a++) {
+            t = 0.0;
+            for (myid = 0; myid < nthreads; myid++) t += Gp[(size_t)myid*kk+a];
+            G[a] = t;
+        }
+        fasp_arena_release(NULL, mark);
+    }
+    else {
+        for (a = 0; a < kk; a++) G[a] = 0.0;
+        for (i0 = 0; i0 < n; i0 += CAGMRES_CHUNK) {
+            i1 = MIN(i0+CAGMRES_CHUNK, n);
+            for (a = 0; a < k; a++) {
+                for (c = a; c < k; c++) {
+                    t = 0.0;
+                    for (i = i0; i < i1; i++) t += R[a][i]*R[c][i];
+                    G[a*k+c] += t;
+                }
+            }
+        }
+    }
+
+    for (a = 1; a < k; a++) {
+        for (c = 0; c < a; c++) G[a*k+c] = G[c*k+a];
+    }
+}
+
+/**
+ * \fn static INT bcgsl_mr (const INT l, const REAL *G, REAL *L, REAL *gam)
+ *
+ * \brief Coefficients of the MR step from the Gram matrix of r_0, ..., r_l
+ *
+ * \param l      Number of BiCG steps
+ * \param G      Pointer to the Gram matrix ((l+1)*(l+1), row-major)
+ * \param L      Pointer to work space of size l*l
+ * \param gam    Pointer to gamma_1, ..., gamma_l in gam[1], ..., gam[l] (output)
+ *
+ * \return       Number q of coefficients computed, the others are zero
+ *
+ * \author FASP team
+ * \date   10/16/2026
+ *
+ * \note Solves (r_i,r_j) gamma_j = (r_i,r_0), i, j = 1, ..., q, by Cholesky
+ *       factorization, where q stops before the first numerically dependent r_j.
+ */
+static INT bcgsl_mr (const INT    l,
+                     const REAL  *G,
+                     REAL        *L,
+                     REAL        *gam)
+{
+    const INT l1 = l + 1;
+
+    INT   i, j, k, q = l;
+    REAL  t;
+
+    // Cholesky factorization G(1:q,1:q) = L*L'
+    for ( j = 0; j < l && q == l; j++ ) {
+        for ( i = j; i < l; i++ ) {
+            t = G[(i+1)*l1+j+1];
+            for ( k = 0; k < j; k++ ) t -= L[i*l+k]*L[j*l+k];
+            if ( i == j ) {
+                if ( t <= 1e-14*G[(j+1)*l1+j+1] || t <= SMALLREAL2 ) { q = j; break; }
+                L[j*l+j] = sqrt(t);
+            }
+            else {
+                L[i*l+j] = t/L[j*l+j];
+            }
+        }
+    }
+
+    // forward and backward substitution
+    for ( i = 0; i < q; i++ ) {
+        t = G[(i+1)*l1];
+        for ( k = 0; k < i; k++ ) t -= L[i*l+k]*gam[k+1];
+        gam[i+1] = t/L[i*l+i];
+    }
+    for ( i = q-1; i >= 0; i-- ) {
+        t = gam[i+1];
+        for ( k = i+1; k < q; k++ ) t -= L[k*l+i]*gam[k+1];
+        gam[i+1] = t/L[i*l+i];
+    }
+    for ( i = q; i < l; i++ ) gam[i+1] = 0.0;
+
+    return q;
+}
+
+/**
+ * \fn static void bcgsl_update (const INT n, const INT l, const REAL *gam,
+ *                               REAL **R, REAL **U, REAL *xh)
+ *
+ * \brief MR update of u_0, r_0 and the solution in one sweep
+ *
+ * \param n      Number of variables
+ * \param l      Number of BiCG steps
+ * \param gam    Pointer to gamma_1, ..., gamma_l in gam[1], ..., gam[l]
+ * \param R      Pointers to r_0, ..., r_l
+ * \param U      Pointers to u_0, ..., u_l
+ * \param xh     Pointer to correction of the right-preconditioned system
+ *
+ * \author FASP team
+ * \date   10/16/2026
+ *
+ * \note xh += sum_j gamma_j r_{j-1}, r_0 -= sum_j gamma_j r_j and
+ *       u_0 -= sum_j gamma_j u_j.
+ */
+static void bcgsl_update (const INT    n,
+                          const INT    l,
+                          const REAL  *gam,
+                          REAL       **R,
+                          REAL       **U,
+                          REAL        *xh)
+{
+    INT   i, j;
+    REAL  sx, sr, su;
+
+    SHORT nthreads = 1, use_openmp = FALSE;
+
+#ifdef _OPENMP
+    if ( n > OPENMP_HOLDS ) {
+        use_openmp = TRUE;
+        nthreads = fasp_get_num_threads();
+    }
+#endif
+
+    if (use_openmp) {
+        INT myid, mybegin, myend;
+#ifdef _OPENMP
+#pragma omp parallel for private(myid, mybegin, myend, i, j, sx, sr, su)
+#endif
+        for (myid = 0; myid < nthreads; myid++ ) {
+            fasp_get_start_end(myid, nthreads, n, &mybegin, &myend);
+            for (i = mybegin; i < myend; i++) {
+                sx = sr = su = 0.0;
+                for (j = 1; j <= l; j++) {
+                    sx += gam[j]*R[j-1][i];
+                    sr += gam[j]*R[j][i];
+                    su += gam[j]*U[j][i];
+                }
+                xh[i]   += sx;
+                R[0][i] -= sr;
+                U[0][i] -= su;
+            }
+        }
+    }
+    else {
+        for (i = 0; i < n; i++) {
+            sx = sr = su = 0.0;
+            for (j = 1; j <= l; j++) {
+                sx += gam[j]*R[j-1][i];
+                sr += gam[j]*R[j][i];
+                su += gam[j]*U[j][i];
+            }
+            xh[i]   += sx;
+            R[0][i] -= sr;
+            U[0][i] -= su;
+        }
+    }
+}
+
+/*---------------------------------*/
+/*--        End of File          --*/
+/*---------------------------------*/
@@ -0,0 +1,540 @@
+/*! \file  KryPbgmres.c
+ *
+ *  \brief Krylov subspace methods -- Block right-preconditioned GMRES for AX=B
+ *
+ *  \note  This file contains Level-3 (Kry) functions. It requires:
+ *         AuxArray.c, AuxMemory.c, AuxMessage.c, BlaArray.c, BlaSpmvBSR.c,
+ *         and BlaSpmvCSR.c
+ *
+ *  \note  See KryPgmres.c for the single right-hand side version
+ *
+ *  Reference:
+ *         Y. Saad
+ *         Iterative methods for sparse linear systems (2nd Edition), SIAM, 2003,
+ *         Section 6.12
+ *
+ *---------------------------------------------------------------------------------
+ *  Copyright (C) 2009--Present by the FASP team. All rights reserved.
+ *  Released under the terms of the GNU Lesser General Public License 3.0 or later.
+ *---------------------------------------------------------------------------------
+ *
+ *  Abstract algorithm
+ *
+ *  The nrhs right-hand sides and solutions are stored interleaved, i.e., entry i
+ *  of vector j is b[i*nrhs+j]. With k active right-hand sides, each step adds a
+ *  block of k vectors to the Krylov basis using one block product with A:
+ *
+ *  Step 0. Given A, B, X_0, M, restart m
+ *
+ *  Step 1. Compute R = B-A*X_0, drop converged columns, R = V_0*S by Cholesky QR;
+ *
+ *  Step 2. Block Arnoldi process ...
+ *
+ *    FOR j = 0:m-1
+ *      - W = A*M*V_j;
+ *      - FOR i = 0:j, H_ij = V_i'*W, W = W - V_i*H_ij;
+ *      - W = V_{j+1}*H_{j+1,j} by Cholesky QR;
+ *      - reduce the new block column of H to upper triangular by Givens rotations
+ *        and apply them to [S; 0], which gives all residual norms;
+ *      - stop if all active columns converged;
+ *    END FOR
+ *
+ *  Step 3. Solve the triangular system H*Y = G, X = X + M*V*Y, and go to Step 1.
+ *
+ *  Columns of the basis which become linearly dependent are set to zero, which
+ *  handles right-hand sides that share Krylov directions. Converged right-hand
+ *  sides are removed at restart. Only the relative residual ||r_j||/||b_j|| is
+ *  used as stopping criterion.
+ */
+
+#include <math.h>
+
+#include "fasp.h"
+#include "fasp_functs.h"
+
+/*---------------------------------*/
+/*--  Declare Private Functions  --*/
+/*---------------------------------*/
+
+#include "KryUtil.inl"
+
+static void pbgmres_mxm_csr (const void *, const INT, const REAL *, REAL *);
+static void pbgmres_mxm_bsr (const void *, const INT, const REAL *, REAL *);
+static INT  pbgmres (void (*)(const void *, const INT, const REAL *, REAL *),
+                     const void *, const INT, const REAL *, REAL *, const INT,
+                     precond_mv *, const REAL, const INT, const SHORT, const SHORT,
+                     const SHORT);
+static INT  pbgmres_restart (void (*)(const void *, const INT, const REAL *, REAL *),
+                             const void *, const INT, const INT, const REAL *,
+                             const REAL *, const REAL *, const REAL, INT *, REAL *,
+                             REAL *, REAL *);
+
+/*---------------------------------*/
+/*--      Public Functions       --*/
+/*---------------------------------*/
+
+/**
+ * \fn INT fasp_solver_dcsr_pbgmres (dCSRmat *A, dvector *b, dvector *x,
+ *                                   const INT nrhs, precond_mv *pc, const REAL tol,
+ *                                   const INT MaxIt, const SHORT restart,
+ *                                   const SHORT StopType, const SHORT PrtLvl)
+ *
+ * \brief Block right-preconditioned GMRES method for solving AX=B
+ *
+ * \param A            Pointer to dCSRmat: coefficient matrix
+ * \param b            Pointer to dvector: right hand sides (A->row*nrhs, interleaved)
+ * \param x            Pointer to dvector: unknowns (A->row*nrhs, interleaved)
+ * \param nrhs         Number of right hand sides
+ * \param pc           Pointer to precond_mv: block preconditioner (or NULL)
+ * \param tol          Tolerance for stopping
+ * \param MaxIt        Maximal number of iterations
+ * \param restart      Restarting steps (number of basis blocks)
+ * \param StopType     Stopping criteria type -- only STOP_REL_RES is supported
+ * \param PrtLvl       How much information to print out
+ *
+ * \return             Iteration number if converges; ERROR otherwise.
+ *
+ * \author FASP team
+ * \date   10/16/2026
+ */
+INT fasp_solver_dcsr_pbgmres (dCSRmat     *A,
+                              dvector     *b,
+                              dvector     *x,
+                              const INT    nrhs,
+                              precond_mv  *pc,
+                              const REAL   tol,
+                              const INT    MaxIt,
+                              const SHORT  restart,
+                              const SHORT  StopType,
+                              const SHORT  PrtLvl)
+{
+    // Output some info for debugging
+    if ( PrtLvl > PRINT_NONE ) printf("\nCalling block GMRes solver (CSR) ...\n");
+
+    if ( b->row != A->row*nrhs || x->row != A->row*nrhs ) {
+        printf("### ERROR: Sizes of A, b, x and nrhs do not match! [%s]\n",
+               __FUNCTION__);
+        return ERROR_MAT_SIZE;
+    }
+
+    return pbgmres(pbgmres_mxm_csr, A, A->row, b->val, x->val, nrhs, pc,
+                   tol, MaxIt, restart, StopType, PrtLvl);
+}
+
+/**
+ * \fn INT fasp_solver_dbsr_pbgmres (dBSRmat *A, dvector *b, dvector *x,
+ *                                   const INT nrhs, precond_mv *pc, const REAL tol,
+ *                                   const INT MaxIt, const SHORT restart,
+ *                                   const SHORT StopType, const SHORT PrtLvl)
+ *
+ * \brief Block right-preconditioned GMRES method for solving AX=B
+ *
+ * \param A            Pointer to dBSRmat: coefficient matrix
+ * \param b            Pointer to dvector: right hand sides (ROW*nb*nrhs, interleaved)
+ * \param x            Pointer to dvector: unknowns (ROW*nb*nrhs, interleaved)
+ * \param nrhs         Number of right hand sides
+ * \param pc           Pointer to precond_mv: block preconditioner (or NULL)
+ * \param tol          Tolerance for stopping
+ * \param MaxIt        Maximal number of iterations
+ * \param restart      Restarting steps (number of basis blocks)
+ * \param StopType     Stopping criteria type -- only STOP_REL_RES is supported
+ * \param PrtLvl       How much information to print out
+ *
+ * \return             Iteration number if converges; ERROR otherwise.
+ *
+ * \author FASP team
+ * \date   10/16/2026
+ */
+INT fasp_solver_dbsr_pbgmres (dBSRmat     *A,
+                              dvector     *b,
+                              dvector     *x,
+                              const INT    nrhs,
+                              precond_mv  *pc,
+                              const REAL   tol,
+                              const INT    MaxIt,
+                              const SHORT  restart,
+                              const SHORT  StopType,
+                              const SHORT  PrtLvl)
+{
+    const INT n = A->ROW*A->nb;
+
+    // Output some info for debugging
+    if ( PrtLvl > PRINT_NONE ) printf("\nCalling block GMRes solver (BSR) ...\n");
+
+    if ( b->row != n*nrhs || x->row != n*nrhs ) {
+        printf("### ERROR: Sizes of A, b, x and nrhs do not match! [%s]\n",
+               __FUNCTION__);
+        return ERROR_MAT_SIZE;
+    }
+
+    return pbgmres(pbgmres_mxm_bsr, A, n, b->val, x->val, nrhs, pc,
+                   tol, MaxIt, restart, StopType, PrtLvl);
+}
+
+/*---------------------------------*/
+/*--      Private Functions      --*/
+/*---------------------------------*/
+
+/**
+ * \fn static void pbgmres_mxm_csr (const void *A, const INT nrhs, const REAL *x,
+ *                                  REAL *y)
+ *
+ * \brief Y = A*X for a dCSRmat matrix
+ *
+ * \author FASP team
+ * \date   10/16/2026
+ */
+static void pbgmres_mxm_csr (const void  *A,
+                             const INT    nrhs,
+                             const REAL  *x,
+                             REAL        *y)
+{
+    fasp_blas_dcsr_mxm_dense((const dCSRmat *)A, nrhs, x, y);
+}
+
+/**
+ * \fn static void pbgmres_mxm_bsr (const void *A, const INT nrhs, const REAL *x,
+ *                                  REAL *y)
+ *
+ * \brief Y = A*X for a dBSRmat matrix
+ *
+ * \author FASP team
+ * \date   10/16/2026
+ */
+static void pbgmres_mxm_bsr (const void  *A,
+                             const INT    nrhs,
+                             const REAL  *x,
+                             REAL        *y)
+{
+    fasp_blas_dbsr_mxm_dense((const dBSRmat *)A, nrhs, x, y);
+}
+
+/**
+ * \fn static INT pbgmres (void (*mxm)(const void *, const INT, const REAL *,
+ *                         REAL *), const void *A, const INT n, const REAL *b,
+ *                         REAL *x, const INT nrhs, precond_mv *pc, const REAL tol,
+ *                         const INT MaxIt, const SHORT restart,
+ *                         const SHORT StopType, const SHORT PrtLvl)
+ *
+ * \brief Block GMRES for a general matrix given by its block product
+ *
+ * \param mxm          Block product Y = A*X
+ * \param A            Pointer to the matrix
+ * \param n            Number of unknowns of one system
+ * \param b            Right hand sides (interleaved)
+ * \param x            Unknowns (interleaved)
+ * \param nrhs         Number of right hand sides
+ * \param pc           Pointer to precond_mv: block preconditioner (or NULL)
+ * \param tol          Tolerance for stopping
+ * \param MaxIt        Maximal number of iterations
+ * \param restart      Restarting steps (number of basis blocks)
+ * \param StopType     Stopping criteria type
+ * \param PrtLvl       How much information to print out
+ *
+ * \return             Iteration number if converges; ERROR otherwise.
+ *
+ * \author FASP team
+ * \date   10/16/2026
+ */
+static INT pbgmres (void         (*mxm)(const void *, const INT, const REAL *,
+                                        REAL *),
+                    const void    *A,
+                    const INT      n,
+                    const REAL    *b,
+                    REAL          *x,
+                    const INT      nrhs,
+                    precond_mv    *pc,
+                    const REAL     tol,
+                    const INT      MaxIt,
+                    const SHORT    restart,
+                    const SHORT    StopType,
+                    const SHORT    PrtLvl)
+{
+    const INT    m  = MAX(1, MIN(restart, MaxIt));
+    const INT    nk = n*nrhs;
+    const INT    mk = m*nrhs, ldh = mk; // max columns of H
+
+    // local variables
+    INT          iter = 0, k, j, i, c, cc, t, q, ncol;
+    REAL         absres0 = BIGREAL, absres = BIGREAL, relres = BIGREAL;
+    REAL         factor, a, e, rr, gc, gs, hmax;
+
+    // allocate temp memory from the work arena
+    const size_t mark = fasp_arena_mark(NULL);
+    REAL *V     = (REAL *)fasp_arena_alloc(NULL, (size_t)(m+1)*nk, sizeof(REAL));
+    REAL *T     = (REAL *)fasp_arena_alloc(NULL, 2*(size_t)nk, sizeof(REAL));
+    REAL *H     = (REAL *)fasp_arena_alloc(NULL, (size_t)(mk+nrhs)*ldh, sizeof(REAL));
+    REAL *G     = (REAL *)fasp_arena_alloc(NULL, (size_t)(mk+nrhs)*nrhs, sizeof(REAL));
+    REAL *rot   = (REAL *)fasp_arena_alloc(NULL, 2*(size_t)mk*nrhs, sizeof(REAL));
+    REAL *small = (REAL *)fasp_arena_alloc(NULL, 3*nrhs+nrhs*nrhs, sizeof(REAL));
+    INT  *cols  = (INT  *)fasp_arena_alloc(NULL, nrhs, sizeof(INT));
+    REAL *U = T + nk, *Hij = small + 3*nrhs;
+    REAL *normb = small, *resn = normb+nrhs, *relres_all = resn+nrhs;
+
+#if DEBUG_MODE > 0
+    printf("### DEBUG: [-Begin-] %s ...\n", __FUNCTION__);
+    printf("### DEBUG: maxit = %d, tol = %.4le, nrhs = %d\n", MaxIt, tol, nrhs);
+#endif
+
+    if ( StopType != STOP_REL_RES && PrtLvl > PRINT_NONE ) {
+        printf("### WARNING: Block GMRes uses STOP_REL_RES as stopping criteria!\n");
+    }
+
+    // norms of the right hand sides
+    fasp_blas_darray_mv_norm2(n, nrhs, b, normb);
+    for ( j = 0; j < nrhs; ++j ) if ( normb[j] < SMALLREAL ) normb[j] = 1.0;
+
+    // r = b-A*x, drop converged columns, r = V_0*S
+    fasp_darray_set((mk+nrhs)*nrhs, G, 0.0);
+    k = pbgmres_restart(mxm, A, n, nrhs, b, x, normb, tol, cols, V, G, relres_all);
+
+    relres = absres0 = 0.0;
+    for ( j = 0; j < nrhs; ++j ) {
+        relres  = MAX(relres, relres_all[j]);
+        absres0 = MAX(absres0, relres_all[j]*normb[j]);
+    }
+
+    // output iteration information if needed
+    fasp_itinfo(PrtLvl,StopType,iter,relres,absres0,0.0);
+
+    // outer iteration: restarts
+    while ( k > 0 && iter < MaxIt ) {
+
+        const INT nkk = n*k;
+        REAL *gcos = rot, *gsin = rot + mk*k;
+
+        fasp_darray_set((mk+nrhs)*ldh, H, 0.0);
+
+        // block Arnoldi process
+        for ( j = 0; j < m && iter < MaxIt; ) {
+
+            REAL *Vj = V + (size_t)j*nkk, *Vn = Vj + nkk;
+
+            ++iter;
+
+            // W = A*M*V_j, stored in V_{j+1}
+            if ( pc != NULL )
+                pc->fct(Vj, T, k, pc->data); /* Apply preconditioner */
+            else
+                fasp_darray_cp(nkk, Vj, T); /* No preconditioner */
+            mxm(A, k, T, Vn);
+
+            // block modified Gram-Schmidt
+            for ( i = 0; i <= j; ++i ) {
+                REAL *Vi = V + (size_t)i*nkk;
+                fasp_blas_darray_mv_gram(n, k, k, Vi, Vn, Hij);
+                fasp_blas_darray_mv_axpy(n, k, k, -1.0, Vi, Hij, Vn);
+                for ( c = 0; c < k; ++c ) {
+                    for ( q = 0; q < k; ++q ) H[(i*k+c)*ldh+j*k+q] = Hij[c*k+q];
+                }
+            }
+
+            // V_{j+1}*H_{j+1,j} = W
+            fasp_blas_darray_mv_cholqr(n, k, Vn, Hij);
+            for ( c = 0; c < k; ++c ) {
+                for ( q = 0; q < k; ++q ) H[((j+1)*k+c)*ldh+j*k+q] = Hij[c*k+q];
+            }
+
+            // Givens rotations for the new columns of H
+            for ( cc = j*k; cc < (j+1)*k; ++cc ) {
+
+                // apply the previous rotations
+                for ( c = 0; c < cc; ++c ) {
+                    for ( t = k; t >= 1; --t ) {
+                        gc = gcos[c*k+t-1]; gs = gsin[c*k+t-1];
+                        a = H[(c+t-1)*ldh+cc]; e = H[(c+t)*ldh+cc];
+                        H[(c+t-1)*ldh+cc] =  gc*a + gs*e;
+                        H[(c+t)*ldh+cc]   = -gs*a + gc*e;
+                    }
+                }
+
+                // eliminate the subdiagonal entries from the bottom up
+                for ( t = k; t >= 1; --t ) {
+                    a = H[(cc+t-1)*ldh+cc]; e = H[(cc+t)*ldh+cc];
+                    if ( e == 0.0 ) { gc = 1.0; gs = 0.0; }
+                    else {
+                        rr = sqrt(a*a+e*e); gc = a/rr; gs = e/rr;
+                        H[(cc+t-1)*ldh+cc] = rr; H[(cc+t)*ldh+cc] = 0.0;
+                    }
+                    gcos[cc*k+t-1] = gc; gsin[cc*k+t-1] = gs;
+
+                    // apply to the right hand sides of the least squares problem
+                    for ( q = 0; q < k; ++q ) {
+                        a = G[(cc+t-1)*nrhs+q]; e = G[(cc+t)*nrhs+q];
+                        G[(cc+t-1)*nrhs+q] =  gc*a + gs*e;
+                        G[(cc+t)*nrhs+q]   = -gs*a + gc*e;
+                    }
+                }
+            }
+
+            ++j;
+
+            // residual norms from the least squares problem
+            absres = 0.0;
+            for ( q = 0; q < k; ++q ) {
+                rr = 0.0;
+                for ( c = j*k; c < (j+1)*k; ++c ) rr += G[c*nrhs+q]*G[c*nrhs+q];
+                resn[q] = sqrt(rr);
+                relres_all[cols[q]] = resn[q]/normb[cols[q]];
+                absres = MAX(absres, resn[q]);
+            }
+            relres = 0.0;
+            for ( q = 0; q < nrhs; ++q ) relres = MAX(relres, relres_all[q]);
+
+            factor = absres/absres0;
+
+            // output iteration information if needed
+            fasp_itinfo(PrtLvl,StopType,iter,relres,absres,factor);
+
+            absres0 = absres;
+
+            if ( relres < tol ) break;
+
+        } // end of block Arnoldi process
+
+        // solve H*Y = G by backward substitution, Y is stored in G
+        ncol = j*k;
+        hmax = 0.0;
+        for ( c = 0; c < ncol; ++c ) hmax = MAX(hmax, ABS(H[c*ldh+c]));
+        for ( c = ncol-1; c >= 0; --c ) {
+            for ( q = 0; q < k; ++q ) {
+                if ( ABS(H[c*ldh+c]) <= SMALLREAL*hmax ) { G[c*nrhs+q] = 0.0; continue; }
+                rr = G[c*nrhs+q];
+                for ( i = c+1; i < ncol; ++i ) rr -= H[c*ldh+i]*G[i*nrhs+q];
+                G[c*nrhs+q] = rr/H[c*ldh+c];
+            }
+        }
+
+        // U = V*Y, T = M*U
+        fasp_darray_set(nkk, U, 0.0);
+        for ( i = 0; i < j; ++i ) {
+            for ( c = 0; c < k; ++c ) {
+                for ( q = 0; q < k; ++q ) Hij[c*k+q] = G[(i*k+c)*nrhs+q];
+            }
+            fasp_blas_darray_mv_axpy(n, k, k, 1.0, V+(size_t)i*nkk, Hij, U);
+        }
+        if ( pc != NULL )
+            pc->fct(U, T, k, pc->data); /* Apply preconditioner */
+        else
+            fasp_darray_cp(nkk, U, T); /* No preconditioner */
+
+        // x = x + T (only the active columns)
+#ifdef _OPENMP
+#pragma omp parallel for private(i, c) if(n>OPENMP_HOLDS)
+#endif
+        for ( i = 0; i < n; ++i ) {
+            for ( c = 0; c < k; ++c ) x[(size_t)i*nrhs+cols[c]] += T[(size_t)i*k+c];
+        }
+
+        // restart from the true residual
+        fasp_darray_set((mk+nrhs)*nrhs, G, 0.0);
+        k = pbgmres_restart(mxm, A, n, nrhs, b, x, normb, tol, cols, V, G, relres_all);
+
+        relres = 0.0;
+        for ( q = 0; q < nrhs; ++q ) relres = MAX(relres, relres_all[q]);
+
+        if ( k > 0 && PrtLvl >= PRINT_MORE )
+            printf("Block GMRes restarted: " INTFMT " of " INTFMT " right hand sides active.\n",
+                   k, nrhs);
+
+    } // end of outer iteration
+
+    if ( k > 0 ) iter = MaxIt + 1; // not converged
+
+    // finish iterative method
+    if ( PrtLvl > PRINT_NONE ) ITS_FINAL(iter,MaxIt,relres);
+
+    // clean up temp memory
+    fasp_arena_release(NULL, mark);
+
+#if DEBUG_MODE > 0
+    printf("### DEBUG: [--End--] %s ...\n", __FUNCTION__);
+#endif
+
+    if ( iter > MaxIt )
+        return ERROR_SOLVER_MAXIT;
+    else
+        return iter;
+}
+
+/**
+ * \fn static INT pbgmres_restart (void (*mxm)(const void *, const INT,
+ *                                 const REAL *, REAL *), const void *A,
+ *                                 const INT n, const INT nrhs, const REAL *b,
+ *                                 const REAL *x, const REAL *normb,
+ *                                 const REAL tol, INT *cols, REAL *V, REAL *G,
+ *                                 REAL *relres)
+ *
+ * \brief (Re)start block GMRES from the true residual
+ *
+ * \param mxm      Block product Y = A*X
+ * \param A        Pointer to the matrix
+ * \param n        Number of unknowns of one system
+ * \param nrhs     Number of right hand sides
+ * \param b        Right hand sides (interleaved)
+ * \param x        Unknowns (interleaved)
+ * \param normb    Norms of the right hand sides
+ * \param tol      Tolerance for stopping
+ * \param cols     Indices of the active columns (OUT)
+ * \param V        First basis block V_0 (OUT, n*nrhs work space)
+ * \param G        Right hand sides [S; 0] of the least squares problem (set to
+ *                 zero by the caller)
+ * \param relres   Relative residuals of all columns (OUT)
+ *
+ * \return         Number of active columns
+ *
+ * \author FASP team
+ * \date   10/16/2026
+ */
+static INT pbgmres_restart (void         (*mxm)(const void *, const INT,
+                                                const REAL *, REAL *),
+                            const void    *A,
+                            const INT      n,
+                            const INT      nrhs,
+                            const REAL    *b,
+                            const REAL    *x,
+                            const REAL    *normb,
+                            const REAL     tol,
+                            INT           *cols,
+                            REAL          *V,
+                            REAL          *G,
+                            REAL          *relres)
+{
+    INT i, j, k = 0;
+
+    // r = b-A*x for all columns
+    mxm(A, nrhs, x, V);
+    fasp_blas_darray_axpby(n*nrhs, 1.0, b, -1.0, V);
+    fasp_blas_darray_mv_norm2(n, nrhs, V, relres);
+
+    for ( j = 0; j < nrhs; ++j ) {
+        relres[j] /= normb[j];
+        if ( relres[j] >= tol ) cols[k++] = j;
+    }
+
+    if ( k == 0 ) return 0;
+
+    // keep the active columns only (in place, as k <= nrhs)
+    if ( k < nrhs ) {
+        for ( i = 0; i < n; ++i ) {
+            for ( j = 0; j < k; ++j ) V[(size_t)i*k+j] = V[(size_t)i*nrhs+cols[j]];
+        }
+    }
+
+    // r = V_0*S, G = [S; 0]
+    {
+        const size_t mark = fasp_arena_mark(NULL);
+        REAL *S = (REAL *)fasp_arena_alloc(NULL, k*k, sizeof(REAL));
+        fasp_blas_darray_mv_cholqr(n, k, V, S);
+        for ( i = 0; i < k; ++i ) {
+            for ( j = 0; j < k; ++j ) G[i*nrhs+j] = S[i*k+j];
+        }
+        fasp_arena_release(NULL, mark);
+    }
+
+    return k;
+}
+
+/*---------------------------------*/
+/*--        End of File          --*/
+/*---------------------------------*/
@@ -0,0 +1,713 @@
+/*! \file  KryPcagmres.c
+ *
+ *  \brief Krylov subspace methods -- Right-preconditioned s-step GMRes
+ *
+ *  \note  This file contains Level-3 (Kry) functions. It requires:
+ *         AuxArray.c, AuxMemory.c, AuxMessage.c, AuxThreads.c, BlaArray.c,
+ *         and BlaSpmvCSR.c
+ *
+ *  \note  See KryPgmres.c for the standard version with modified Gram-Schmidt
+ *
+ *  Reference:
+ *         M. Hoemmen 2010
+ *         Communication-avoiding Krylov subspace methods, PhD thesis, UC Berkeley
+ *
+ *         E. Carson, K. Lund, M. Rozloznik and S. Thomas 2022
+ *         Block Gram-Schmidt algorithms and their stability properties,
+ *         Linear Algebra and its Applications 638, 150--195
+ *
+ *---------------------------------------------------------------------------------
+ *  Copyright (C) 2009--Present by the FASP team. All rights reserved.
+ *  Released under the terms of the GNU Lesser General Public License 3.0 or later.
+ *---------------------------------------------------------------------------------
+ *
+ *  Abstract algorithm
+ *
+ *  Instead of one Arnoldi vector at a time, each block of the restart cycle adds
+ *  s = CAGMRES_STEP vectors:
+ *
+ *    - W_l = (A*M)^l q_j / sigma^l, l = 1, ..., s, by s products with A*M;
+ *    - orthogonalize W against Q = [q_0, ..., q_j] and among itself by block
+ *      classical Gram-Schmidt plus Cholesky QR, two passes (BCGS-PIP2); each
+ *      pass reads the basis once for all inner products and once for the update;
+ *    - recover the s new columns of the Hessenberg matrix from the coefficients
+ *      of the orthogonalization, then apply Givens rotations column by column.
+ *
+ *  Modified Gram-Schmidt needs j+1 inner products and axpys, i.e., j+1 sweeps
+ *  over the basis for each new vector. Here each block needs two sweeps for
+ *  s vectors. The scaling sigma = ||A*M*q_0|| is taken once per restart cycle.
+ *
+ *  Whether the fewer sweeps pay off depends on the machine, the restart length,
+ *  and the cost of A*M, so compare with SOLVER_GMRES on the target problem.
+ */
+
+#include <math.h>
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+#include "fasp.h"
+#include "fasp_functs.h"
+
+/*---------------------------------*/
+/*--  Declare Private Functions  --*/
+/*---------------------------------*/
+
+#include "KryUtil.inl"
+
+static INT  cagmres_orth (const INT, const INT, REAL **, const INT, REAL *,
+                          REAL *, REAL *);
+static INT  cagmres_orth_pass (const INT, const INT, REAL **, const INT, REAL *,
+                               REAL *, REAL *);
+static void cagmres_hessenberg (const INT, const INT, const INT, const INT,
+                                const INT, const REAL, const REAL *, const REAL *,
+                                REAL *, REAL *);
+static void cagmres_gram (const INT, const INT, REAL **, const INT, REAL **,
+                          REAL *);
+static void cagmres_update (const INT, const INT, REAL **, const INT, REAL **,
+                            const REAL *, const REAL *, const INT);
+
+/*---------------------------------*/
+/*--      Public Functions       --*/
+/*---------------------------------*/
+
+/*!
+ * \fn INT fasp_solver_dcsr_pcagmres (dCSRmat *A, dvector *b, dvector *x,
+ *                                    precond *pc, const REAL tol, const INT MaxIt,
+ *                                    const SHORT restart, const SHORT StopType,
+ *                                    const SHORT PrtLvl)
+ *
+ * \brief Right preconditioned s-step GMRES method for solving Au=b
+ *
+ * \param A            Pointer to dCSRmat: coefficient matrix
+ * \param b            Pointer to dvector: right hand side
+ * \param x            Pointer to dvector: unknowns
+ * \param pc           Pointer to precond: structure of precondition
+ * \param tol          Tolerance for stopping
+ * \param MaxIt        Maximal number of iterations
+ * \param restart      Restarting steps
+ * \param StopType     Stopping criteria type
+ * \param PrtLvl       How much information to print out
+ *
+ * \return             Iteration number if converges; ERROR otherwise.
+ *
+ * \author FASP team
+ * \date   10/16/2026
+ *
+ * \note The Krylov vectors of a block are formed by successive products with A
+ *       and the preconditioner. The true residual is computed at each restart.
+ */
+INT fasp_solver_dcsr_pcagmres (dCSRmat     *A,
+                               dvector     *b,
+                               dvector     *x,
+                               precond     *pc,
+                               const REAL   tol,
+                               const INT    MaxIt,
+                               const SHORT  restart,
+                               const SHORT  StopType,
+                               const SHORT  PrtLvl)
+{
+    const INT   n = b->row;
+    const INT   s = CAGMRES_STEP;
+
+    // local variables
+    INT      iter = 0, Restart, i, j, k, l, nb, ncol, rank;
+    REAL     r_norm, r_normb, gamma, t, sigma;
+    REAL     absres0 = BIGREAL, absres = BIGREAL;
+    REAL     relres  = BIGREAL, normu  = BIGREAL, computed_relres;
+    REAL   **p;
+    REAL    *work, *r, *z, *hh, *hu, *c, *sn, *rs, *C, *R, *Y;
+    size_t   mark;
+    dCSRplan *Aplan = NULL;
+
+    Restart = MAX(MIN(restart, MaxIt), 1);
+
+    // Output some info for debugging
+    if ( PrtLvl > PRINT_NONE ) printf("\nCalling s-step GMRes solver (CSR) ...\n");
+
+#if DEBUG_MODE > 0
+    printf("### DEBUG: [-Begin-] %s ...\n", __FUNCTION__);
+    printf("### DEBUG: maxit = %d, tol = %.4le, s = %d\n", MaxIt, tol, s);
+#endif
+
+    // SpMV plan for A, shared by all matrix-vector products below
+    Aplan = fasp_dcsr_plan_create(A);
+
+    /* allocate memory and setup temp work space from the work arena */
+    mark = fasp_arena_mark(NULL);
+    p    = (REAL **)fasp_arena_calloc(NULL, Restart+1, sizeof(REAL *));
+    work = (REAL *) fasp_arena_calloc(NULL, (size_t)(Restart+3)*n, sizeof(REAL));
+    hh   = (REAL *) fasp_arena_calloc(NULL, 2*(Restart+1)*Restart, sizeof(REAL));
+    rs   = (REAL *) fasp_arena_calloc(NULL, 3*Restart+1, sizeof(REAL));
+    C    = (REAL *) fasp_arena_calloc(NULL, 3*(Restart+s+1)*s+4*s*s, sizeof(REAL));
+
+    for ( i = 0; i <= Restart; i++ ) p[i] = work + (size_t)i*n;
+    r  = p[Restart] + n; z = r + n;
+    hu = hh + (Restart+1)*Restart; // Hessenberg matrix without rotations
+    c  = rs + Restart+1; sn = c + Restart;
+    R  = C + (Restart+s+1)*s; Y = R + s*s;
+
+    // compute initial residual: r = b-A*x
+    fasp_darray_cp(n, b->val, p[0]);
+    fasp_blas_dcsr_aAxpy_plan(-1.0, A, Aplan, x->val, p[0]);
+    r_norm = fasp_blas_darray_norm2(n, p[0]);
+
+    // compute stopping criteria
+    switch (StopType) {
+        case STOP_REL_RES:
+            absres0 = MAX(SMALLREAL,r_norm);
+            relres  = r_norm/absres0;
+            break;
+        case STOP_REL_PRECRES:
+            if ( pc == NULL )
+                fasp_darray_cp(n, p[0], r);
+            else
+                pc->fct(p[0], r, pc->data);
+            r_normb = sqrt(fasp_blas_darray_dotprod(n,p[0],r));
+            absres0 = MAX(SMALLREAL,r_normb);
+            relres  = r_normb/absres0;
+            break;
+        case STOP_MOD_REL_RES:
+            normu   = MAX(SMALLREAL,fasp_blas_darray_norm2(n,x->val));
+            absres0 = r_norm;
+            relres  = absres0/normu;
+            break;
+        default:
+            printf("### ERROR: Unknown stopping type! [%s]\n", __FUNCTION__);
+            goto FINISHED;
+    }
+
+    // if initial residual is small, no need to iterate!
+    if ( relres < tol || absres0 < 1e-3*tol ) goto FINISHED;
+
+    // output iteration information if needed
+    fasp_itinfo(PrtLvl,StopType,0,relres,absres0,0.0);
+
+    if ( StopType == STOP_MOD_REL_RES ) absres0 = normu;
+
+    /* s-step GMRES(M) outer iteration */
+    while ( iter < MaxIt && relres > tol ) {
+
+        rs[0] = r_norm;
+        fasp_blas_darray_ax(n, 1.0/r_norm, p[0]);
+        sigma = 0.0;
+
+        /* RESTART CYCLE (right-preconditioning), j columns of H are done */
+        j = 0;
+        while ( j < Restart && iter < MaxIt ) {
+
+            nb = MIN(s, Restart-j);
+
+            // Krylov vectors p[j+l] = (A*M)^l p[j] / sigma^l
+            for ( l = 1; l <= nb; l++ ) {
+                if ( pc == NULL )
+                    fasp_darray_cp(n, p[j+l-1], z);
+                else
+                    pc->fct(p[j+l-1], z, pc->data);
+                fasp_blas_dcsr_mxv_plan(A, Aplan, z, p[j+l]);
+                if ( sigma == 0.0 ) {
+                    sigma = fasp_blas_darray_norm2(n, p[j+1]);
+                    if ( sigma < SMALLREAL ) sigma = 1.0;
+                }
+                fasp_blas_darray_ax(n, 1.0/sigma, p[j+l]);
+            }
+
+            // orthogonalize the block and recover columns j, ..., j+ncol-1 of H
+            rank = cagmres_orth(n, j+1, p, nb, C, R, Y);
+            ncol = MAX(rank, 1);
+            cagmres_hessenberg(j, ncol, rank, nb, Restart, sigma, C, R, hu, Y);
+
+            for ( l = 0; l < ncol && iter < MaxIt; ) {
+
+                k = j + l; iter++;
+
+                // apply previous rotations to the new column
+                for ( i = 0; i <= k+1; i++ ) hh[i*Restart+k] = hu[i*Restart+k];
+                for ( i = 0; i < k; i++ ) {
+                    t = hh[i*Restart+k];
+                    hh[i*Restart+k]     =  c[i]*t + sn[i]*hh[(i+1)*Restart+k];
+                    hh[(i+1)*Restart+k] = -sn[i]*t + c[i]*hh[(i+1)*Restart+k];
+                }
+
+                t     = hh[(k+1)*Restart+k];
+                gamma = sqrt(hh[k*Restart+k]*hh[k*Restart+k] + t*t);
+                gamma = MAX(gamma, SMALLREAL); // Possible breakdown?
+                c[k]  = hh[k*Restart+k] / gamma;
+                sn[k] = t / gamma;
+                rs[k+1] = -sn[k]*rs[k];
+                rs[k]   =  c[k]*rs[k];
+                hh[k*Restart+k] = gamma;
+
+                absres = r_norm = fabs(rs[k+1]);
+                t      = relres;
+                relres = absres/absres0;
+
+                // output iteration information if needed
+                fasp_itinfo(PrtLvl, StopType, iter, relres, absres, relres/t);
+
+                l++;
+                if ( relres < tol ) break;
+            }
+
+            j += l;
+
+            // converged or the Krylov space is invariant
+            if ( relres < tol || rank == 0 ) break;
+
+        } /* end of restart cycle */
+
+        /* compute solution, first solve upper triangular system */
+        for ( k = j-1; k >= 0; k-- ) {
+            t = rs[k];
+            for ( i = k+1; i < j; i++ ) t -= hh[k*Restart+i]*rs[i];
+            rs[k] = t / hh[k*Restart+k];
+        }
+
+        fasp_darray_set(n, r, 0.0);
+        for ( k = 0; k < j; k++ ) fasp_blas_darray_axpy(n, rs[k], p[k], r);
+
+        /* apply preconditioner */
+        if ( pc == NULL )
+            fasp_darray_cp(n, r, z);
+        else
+            pc->fct(r, z, pc->data);
+
+        fasp_blas_darray_axpy(n, 1.0, z, x->val);
+
+        // compute the true residual for restart, which also prevents false
+        // convergence
+        computed_relres = relres;
+
+        fasp_darray_cp(n, b->val, p[0]);
+        fasp_blas_dcsr_aAxpy_plan(-1.0, A, Aplan, x->val, p[0]);
+        r_norm = fasp_blas_darray_norm2(n, p[0]);
+
+        switch ( StopType ) {
+            case STOP_REL_RES:
+                absres = r_norm;
+                relres = absres/absres0;
+                break;
+            case STOP_REL_PRECRES:
+                if ( pc == NULL )
+                    fasp_darray_cp(n, p[0], r);
+                else
+                    pc->fct(p[0], r, pc->data);
+                absres = sqrt(fasp_blas_darray_dotprod(n,p[0],r));
+                relres = absres/absres0;
+                break;
+            case STOP_MOD_REL_RES:
+                absres = r_norm;
+                normu  = MAX(SMALLREAL,fasp_blas_darray_norm2(n,x->val));
+                relres = absres/normu;
+                absres0 = normu;
+                break;
+        }
+
+        if ( computed_relres < tol && relres >= tol && PrtLvl >= PRINT_MORE ) {
+            ITS_COMPRES(computed_relres); ITS_REALRES(relres);
+        }
+
+        if ( r_norm < SMALLREAL ) break;
+
+    } /* end of main while loop */
+
+FINISHED:
+    if ( PrtLvl > PRINT_NONE ) ITS_FINAL(iter,MaxIt,relres);
+
+    /*-------------------------------------------
+     * Clean up workspace
+     *------------------------------------------*/
+    fasp_arena_release(NULL, mark);
+    fasp_dcsr_plan_free(Aplan);
+
+#if DEBUG_MODE > 0
+    printf("### DEBUG: [--End--] %s ...\n", __FUNCTION__);
+#endif
+
+    if ( iter >= MaxIt && relres > tol )
+        return ERROR_SOLVER_MAXIT;
+    else
+        return iter;
+}
+
+/*---------------------------------*/
+/*--      Private Functions      --*/
+/*---------------------------------*/
+
+/**
+ * \fn static INT cagmres_orth (const INT n, const INT m, REAL **p, const INT nb,
+ *                              REAL *C, REAL *R, REAL *work)
+ *
+ * \brief Orthogonalize W = p[m], ..., p[m+nb-1] against Q = p[0], ..., p[m-1] and
+ *        among itself, such that W = Q*C + W_new*R
+ *
+ * \param n      Length of the vectors
+ * \param m      Number of orthonormal vectors in Q
+ * \param p      Pointers to the vectors [Q, W]
+ * \param nb     Number of vectors in W
+ * \param C      Coefficients C (m*nb, row-major)
+ * \param R      Upper triangular R (rank*rank, leading dimension nb)
+ * \param work   Work space of 2*(m+nb)*nb + nb*nb REAL numbers
+ *
+ * \return       Number rank of leading linearly independent vectors of W
+ *
+ * \author FASP team
+ * \date   10/16/2026
+ *
+ * \note W_new has orthonormal columns 0, ..., rank-1 and zero columns after them.
+ *       Column 0 of C is always valid, also if rank = 0.
+ */
+static INT cagmres_orth (const INT    n,
+                         const INT    m,
+                         REAL       **p,
+                         const INT    nb,
+                         REAL        *C,
+                         REAL        *R,
+                         REAL        *work)
+{
+    REAL *C2 = work, *R2 = C2 + m*nb;
+    INT   rank1, rank, a, i, j, l;
+    REAL  t;
+
+    // first pass: W = (W - Q*C)*inv(R)
+    rank1 = cagmres_orth_pass(n, m, p, nb, C, R, work);
+    if ( rank1 == 0 ) return 0;
+
+    // second pass on the independent vectors: W = (W - Q*C2)*inv(R2)
+    rank = cagmres_orth_pass(n, m, p, rank1, C2, R2, R2 + nb*nb);
+
+    // combine the two passes: C = C + C2*R, R = R2*R
+    for ( a = 0; a < m; a++ ) {
+        for ( j = MAX(rank,1)-1; j >= 0; j-- ) {
+            t = 0.0;
+            for ( l = 0; l <= MIN(j, rank1-1); l++ ) t += C2[a*rank1+l]*R[l*nb+j];
+            C[a*nb+j] += t;
+        }
+    }
+    for ( j = rank-1; j >= 0; j-- ) {
+        for ( i = 0; i <= j; i++ ) {
+            t = 0.0;
+            for ( l = i; l <= j; l++ ) t += R2[i*rank1+l]*R[l*nb+j];
+            R[i*nb+j] = t;
+        }
+    }
+
+    return rank;
+}
+
+/**
+ * \fn static INT cagmres_orth_pass (const INT n, const INT m, REAL **p,
+ *                                   const INT nb, REAL *C, REAL *R, REAL *work)
+ *
+ * \brief One pass of block classical Gram-Schmidt with Cholesky QR
+ *
+ * \param n      Length of the vectors
+ * \param m      Number of orthonormal vectors in Q = p[0], ..., p[m-1]
+ * \param p      Pointers to the vectors [Q, W]
+ * \param nb     Number of vectors in W = p[m], ..., p[m+nb-1]
+ * \param C      Coefficients C = Q'*W (m*nb, row-major)
+ * \param R      Cholesky factor of W'*W - C'*C (nb*nb, row-major)
+ * \param work   Work space of (m+nb)*nb + nb*nb REAL numbers
+ *
+ * \return       Number of leading linearly independent vectors of W
+ *
+ * \author FASP team
+ * \date   10/16/2026
+ *
+ * \note [Q, W]'*W is computed in one sweep. The Gram matrix of W - Q*C follows
+ *       from the Pythagorean theorem; the second pass in cagmres_orth repairs
+ *       the loss of accuracy of it.
+ */
+static INT cagmres_orth_pass (const INT    n,
+                              const INT    m,
+                              REAL       **p,
+                              const INT    nb,
+                              REAL        *C,
+                              REAL        *R,
+                              REAL        *work)
+{
+    const REAL tol = 1e-14;
+
+    REAL *G = work, *Rinv = G + (m+nb)*nb;
+    INT   rank = nb, a, i, j, l;
+    REAL  t;
+
+    // G = [Q, W]'*W
+    cagmres_gram(n, m+nb, p, nb, p+m, G);
+    for ( a = 0; a < m*nb; a++ ) C[a] = G[a];
+
+    // Cholesky factorization W'*W - C'*C = R'*R, stops at the first dependent one
+    fasp_darray_set(nb*nb, R, 0.0);
+    for ( j = 0; j < nb; j++ ) {
+        for ( i = 0; i <= j; i++ ) {
+            t = G[(m+i)*nb+j];
+            for ( a = 0; a < m; a++ ) t -= C[a*nb+i]*C[a*nb+j];
+            for ( l = 0; l < i; l++ ) t -= R[l*nb+i]*R[l*nb+j];
+            if ( i < j ) {
+                R[i*nb+j] = t/R[i*nb+i];
+            }
+            else if ( t > tol*G[(m+j)*nb+j] && t > SMALLREAL2 ) {
+                R[j*nb+j] = sqrt(t);
+            }
+            else {
+                rank = j;
+            }
+        }
+        if ( rank < nb ) break;
+    }
+
+    // inverse of R for the leading rank vectors
+    fasp_darray_set(nb*nb, Rinv, 0.0);
+    for ( j = 0; j < rank; j++ ) {
+        Rinv[j*nb+j] = 1.0/R[j*nb+j];
+        for ( i = j-1; i >= 0; i-- ) {
+            t = 0.0;
+            for ( l = i+1; l <= j; l++ ) t += R[i*nb+l]*Rinv[l*nb+j];
+            Rinv[i*nb+j] = -t/R[i*nb+i];
+        }
+    }
+
+    // W = (W - Q*C)*inv(R)
+    cagmres_update(n, m, p, nb, p+m, C, Rinv, rank);
+
+    return rank;
+}
+
+/**
+ * \fn static void cagmres_hessenberg (const INT j, const INT ncol, const INT rank,
+ *                                     const INT nb, const INT ldh,
+ *                                     const REAL sigma, const REAL *C,
+ *                                     const REAL *R, REAL *hu, REAL *work)
+ *
+ * \brief Recover columns j, ..., j+ncol-1 of the Hessenberg matrix from the
+ *        coefficients of the block orthogonalization
+ *
+ * \param j      First new column
+ * \param ncol   Number of new columns
+ * \param rank   Number of new orthonormal vectors
+ * \param nb     Leading dimension of C and R
+ * \param ldh    Leading dimension of hu
+ * \param sigma  Scaling of the Krylov vectors
+ * \param C      Coefficients of W in the old vectors
+ * \param R      Coefficients of W in the new vectors
+ * \param hu     Hessenberg matrix (row-major)
+ * \param work   Work space of ncol*ncol REAL numbers
+ *
+ * \author FASP team
+ * \date   10/16/2026
+ *
+ * \note With B = [q_j, W_1, ..., W_{ncol-1}] = Q*T, where T is the upper
+ *       trapezoidal change of basis, A*M*B = sigma*[W_1, ..., W_ncol] gives
+ *       H_new = (sigma*[C; R] - H_old*T_top)*inv(T_bot).
+ */
+static void cagmres_hessenberg (const INT    j,
+                                const INT    ncol,
+                                const INT    rank,
+                                const INT    nb,
+                                const INT    ldh,
+                                const REAL   sigma,
+                                const REAL  *C,
+                                const REAL  *R,
+                                REAL        *hu,
+                                REAL        *work)
+{
+    const INT nrow = j+ncol+1;
+
+    REAL *T = work; // T_bot, ncol*ncol
+    INT   i, k, l;
+    REAL  t;
+
+    // T_bot: row 0 is [1, C(j,:)], rows 1, ... are R shifted by one column
+    for ( i = 0; i < ncol*ncol; i++ ) T[i] = 0.0;
+    T[0] = 1.0;
+    for ( k = 1; k < ncol; k++ ) {
+        T[k] = C[j*nb+k-1];
+        for ( i = 1; i <= k; i++ ) T[i*ncol+k] = R[(i-1)*nb+k-1];
+    }
+
+    // right hand side sigma*[C; R] - H_old*T_top
+    for ( k = 0; k < ncol; k++ ) {
+        for ( i = 0; i < nrow; i++ ) {
+            if ( i <= j )
+                t = sigma*C[i*nb+k];
+            else if ( i-j-1 <= k && i-j-1 < rank )
+                t = sigma*R[(i-j-1)*nb+k];
+            else
+                t = 0.0;
+            if ( k > 0 ) {
+                for ( l = MAX(i-1,0); l < j; l++ ) t -= hu[i*ldh+l]*C[l*nb+k-1];
+            }
+            hu[i*ldh+j+k] = t;
+        }
+    }
+
+    // multiply by inv(T_bot) from the right
+    for ( k = 0; k < ncol; k++ ) {
+        for ( i = 0; i < nrow; i++ ) {
+            t = hu[i*ldh+j+k];
+            for ( l = 0; l < k; l++ ) t -= hu[i*ldh+j+l]*T[l*ncol+k];
+            hu[i*ldh+j+k] = t/T[k*ncol+k];
+        }
+    }
+}
+
+/**
+ * \fn static void cagmres_gram (const INT n, const INT m, REAL **V, const INT k,
+ *                               REAL **W, REAL *G)
+ *
+ * \brief Compute G = V'*W for m vectors V and k vectors W in one sweep
+ *
+ * \param n      Length of the vectors
+ * \param m      Number of vectors in V
+ * \param V      Pointers to the vectors V
+ * \param k      Number of vectors in W
+ * \param W      Pointers to the vectors W
+ * \param G      G = V'*W (m*k, row-major)
+ *
+ * \author FASP team
+ * \date   10/16/2026
+ *
+ * \note Rows are taken in chunks of CAGMRES_CHUNK, so that a chunk of W stays
+ *       in cache while it meets all vectors of V.
+ */
+static void cagmres_gram (const INT    n,
+                          const INT    m,
+                          REAL       **V,
+                          const INT    k,
+                          REAL       **W,
+                          REAL        *G)
+{
+    const INT mk = m*k;
+
+    INT   a, c, i, i0, i1;
+    REAL  t;
+
+    SHORT nthreads = 1, use_openmp = FALSE;
+
+#ifdef _OPENMP
+    if ( n > OPENMP_HOLDS ) {
+        use_openmp = TRUE;
+        nthreads = fasp_get_num_threads();
+    }
+#endif
+
+    if (use_openmp) {
+        const size_t mark = fasp_arena_mark(NULL);
+        REAL *Gp = (REAL *)fasp_arena_calloc(NULL, (size_t)nthreads*mk, sizeof(REAL));
+        INT   myid, mybegin, myend;
+#ifdef _OPENMP
+#pragma omp parallel for private(myid, mybegin, myend, a, c, i, i0, i1, t)
+#endif
+        for (myid = 0; myid < nthreads; myid++ ) {
+            REAL *Gm = Gp + (size_t)myid*mk;
+            fasp_get_start_end(myid, nthreads, n, &mybegin, &myend);
+            for (i0 = mybegin; i0 < myend; i0 += CAGMRES_CHUNK) {
+                i1 = MIN(i0+CAGMRES_CHUNK, myend);
+                for (a = 0; a < m; a++) {
+                    for (c = 0; c < k; c++) {
+                        t = 0.0;
+                        for (i = i0; i < i1; i++) t += V[a][i]*W[c][i];
+                        Gm[a*k+c] += t;
+                    }
+                }
+            }
+        }
+        for (a = 0; a < mk; a++) {
+            t = 0.0;
+            for (myid = 0; myid < nthreads; myid++) t += Gp[(size_t)myid*mk+a];
+            G[a] = t;
+        }
+        fasp_arena_release(NULL, mark);
+    }
+    else {
+        for (a = 0; a < mk; a++) G[a] = 0.0;
+        for (i0 = 0; i0 < n; i0 += CAGMRES_CHUNK) {
+            i1 = MIN(i0+CAGMRES_CHUNK, n);
+            for (a = 0; a < m; a++) {
+                for (c = 0; c < k; c++) {
+                    t = 0.0;
+                    for (i = i0; i < i1; i++) t += V[a][i]*W[c][i];
+                    G[a*k+c] += t;
+                }
+            }
+        }
+    }
+}
+
+/**
+ * \fn static void cagmres_update (const INT n, const INT m, REAL **Q, const INT k,
+ *                                 REAL **W, const REAL *C, const REAL *Rinv,
+ *                                 const INT rank)
+ *
+ * \brief Compute W = (W - Q*C)*inv(R) in one sweep
+ *
+ * \param n      Length of the vectors
+ * \param m      Number of vectors in Q
+ * \param Q      Pointers to the vectors Q
+ * \param k      Number of vectors in W
+ * \param W      Pointers to the vectors W
+ * \param C      Coefficients C (m*k, row-major)
+ * \param Rinv   Upper triangular inv(R) (k*k, row-major)
+ * \param rank   Columns rank, ..., k-1 of W are set to zero
+ *
+ * \author FASP team
+ * \date   10/16/2026
+ */
+static void cagmres_update (const INT     n,
+                            const INT     m,
+                            REAL        **Q,
+                            const INT     k,
+                            REAL        **W,
+                            const REAL   *C,
+                            const REAL   *Rinv,
+                            const INT     rank)
+{
+    INT   myid, mybegin, myend;
+    SHORT nthreads = 1;
+
+#ifdef _OPENMP
+    if ( n > OPENMP_HOLDS ) nthreads = fasp_get_num_threads();
+#endif
+
+#ifdef _OPENMP
+#pragma omp parallel for private(myid, mybegin, myend) if(nthreads>1)
+#endif
+    for (myid = 0; myid < nthreads; myid++ ) {
+        REAL buf[CAGMRES_STEP*CAGMRES_CHUNK];
+        INT  a, c, l, i, i0, len;
+        REAL t;
+
+        fasp_get_start_end(myid, nthreads, n, &mybegin, &myend);
+        for (i0 = mybegin; i0 < myend; i0 += CAGMRES_CHUNK) {
+            len = MIN(CAGMRES_CHUNK, myend-i0);
+
+            // buf = W - Q*C on this chunk
+            for (c = 0; c < rank; c++) {
+                REAL *bc = buf + c*CAGMRES_CHUNK;
+                for (i = 0; i < len; i++) bc[i] = W[c][i0+i];
+                for (a = 0; a < m; a++) {
+                    const REAL *qa = Q[a] + i0;
+                    t = C[a*k+c];
+                    for (i = 0; i < len; i++) bc[i] -= t*qa[i];
+                }
+            }
+
+            // W = buf*inv(R)
+            for (c = 0; c < k; c++) {
+                REAL *wc = W[c] + i0;
+                for (i = 0; i < len; i++) wc[i] = 0.0;
+                if ( c >= rank ) continue;
+                for (l = 0; l <= c; l++) {
+                    const REAL *bl = buf + l*CAGMRES_CHUNK;
+                    t = Rinv[l*k+c];
+                    for (i = 0; i < len; i++) wc[i] += t*bl[i];
+                }
+            }
+        }
+    }
+}
+
+/*---------------------------------*/
+/*--        End of File          --*/
+/*---------------------------------*/
@@ -94,6 +94,10 @@
  *
  * \author Chensong Zhang, Xiaozhe Hu, Shiquan Zhang
  * \date   05/06/2010
+ *
+ * Modified by FASP team on 10/16/2026: use a SpMV plan for A
+ * Modified by FASP team on 10/16/2026: draw work space from the arena
+ * Modified by FASP team on 10/16/2026: fused BLAS1 kernels and SpMV-dot
  */
 INT fasp_solver_dcsr_pcg (dCSRmat     *A,
                           dvector     *b,
@@ -115,11 +119,16 @@ INT fasp_solver_dcsr_pcg (dCSRmat     *A,
     REAL         relres  = BIGREAL, normu  = BIGREAL, normr0 = BIGREAL;
     REAL         reldiff, factor, normuinf;
     REAL         alpha, beta, temp1, temp2;
+    REAL         norms[2]; // norms of u and r after the update
     
-    // allocate temp memory (need 4*m REAL numbers)
-    REAL *work = (REAL *)fasp_mem_calloc(4*m,sizeof(REAL));
+    // allocate temp memory (need 4*m REAL numbers) from the work arena
+    const size_t mark = fasp_arena_mark(NULL);
+    REAL *work = (REAL *)fasp_arena_alloc(NULL,4*m,sizeof(REAL));
     REAL *p = work, *z = work+m, *r = z+m, *t = r+m;
 
+    // SpMV plan for A, shared by all matrix-vector products below
+    dCSRplan *Aplan = fasp_dcsr_plan_create(A);
+
     // Output some info for debugging
     if ( PrtLvl > PRINT_NONE ) printf("\nCalling CG solver (CSR) ...\n");
 
@@ -130,7 +139,7 @@ INT fasp_solver_dcsr_pcg (dCSRmat     *A,
     
     // r = b-A*u
     fasp_darray_cp(m,b->val,r);
-    fasp_blas_dcsr_aAxpy(-1.0,A,u->val,r);
+    fasp_blas_dcsr_aAxpy_plan(-1.0,A,Aplan,u->val,r);
     
     if ( pc != NULL )
         pc->fct(r,z,pc->data); /* Apply preconditioner */
@@ -171,11 +180,8 @@ INT fasp_solver_dcsr_pcg (dCSRmat     *A,
     // main PCG loop
     while ( iter++ < MaxIt ) {
         
-        // t = A*p
-        fasp_blas_dcsr_mxv(A,p,t);
-        
-        // alpha_k = (z_{k-1},r_{k-1})/(A*p_{k-1},p_{k-1})
-        temp2 = fasp_blas_darray_dotprod(m,t,p);
+        // t = A*p and alpha_k = (z_{k-1},r_{k-1})/(A*p_{k-1},p_{k-1})
+        temp2 = fasp_blas_dcsr_mxv_plan_dot(A,Aplan,p,t,p);
         if ( ABS(temp2) > SMALLREAL2 ) {
             alpha = temp1/temp2;
         }
@@ -183,16 +189,13 @@ INT fasp_solver_dcsr_pcg (dCSRmat     *A,
             ITS_DIVZERO; goto FINISHED;
         }
         
-        // u_k = u_{k-1} + alpha_k*p_{k-1}
-        fasp_blas_darray_axpy(m,alpha,p,u->val);
-        
-        // r_k = r_{k-1} - alpha_k*A*p_{k-1}
-        fasp_blas_darray_axpy(m,-alpha,t,r);
+        // u_k = u_{k-1} + alpha_k*p_{k-1}, r_k = r_{k-1} - alpha_k*A*p_{k-1}
+        fasp_blas_darray_axpy2_norm2(m,alpha,p,u->val,-alpha,t,r,norms);
         
         // compute norm of residual
         switch ( StopType ) {
             case STOP_REL_RES:
-                absres = fasp_blas_darray_norm2(m,r);
+                absres = norms[1];
                 relres = absres/normr0;
                 break;
             case STOP_REL_PRECRES:
@@ -205,7 +208,7 @@ INT fasp_solver_dcsr_pcg (dCSRmat     *A,
                 relres = absres/normr0;
                 break;
             case STOP_MOD_REL_RES:
-                absres = fasp_blas_darray_norm2(m,r);
+                absres = norms[1];
                 relres = absres/normu;
                 break;
         }
@@ -227,7 +230,7 @@ INT fasp_solver_dcsr_pcg (dCSRmat     *A,
             }
             
             // Check II: if stagnated, try to restart
-            normu = fasp_blas_darray_norm2(m, u->val);
+            normu = norms[0];
             
             // compute relative difference
             reldiff = ABS(alpha)*fasp_blas_darray_norm2(m,p)/normu;
@@ -239,7 +242,7 @@ INT fasp_solver_dcsr_pcg (dCSRmat     *A,
                 }
                 
                 fasp_darray_cp(m,b->val,r);
-                fasp_blas_dcsr_aAxpy(-1.0,A,u->val,r);
+                fasp_blas_dcsr_aAxpy_plan(-1.0,A,Aplan,u->val,r);
                 
                 // compute residual norms
                 switch ( StopType ) {
@@ -287,7 +290,7 @@ INT fasp_solver_dcsr_pcg (dCSRmat     *A,
             
             // compute true residual r = b - Ax and update residual
             fasp_darray_cp(m,b->val,r);
-            fasp_blas_dcsr_aAxpy(-1.0,A,u->val,r);
+            fasp_blas_dcsr_aAxpy_plan(-1.0,A,Aplan,u->val,r);
             
             // compute residual norms
             switch ( StopType ) {
@@ -354,7 +357,8 @@ FINISHED:  // finish iterative method
     if ( PrtLvl > PRINT_NONE ) ITS_FINAL(iter,MaxIt,relres);
     
     // clean up temp memory
-    fasp_mem_free(work); work = NULL;
+    fasp_arena_release(NULL,mark); work = NULL;
+    fasp_dcsr_plan_free(Aplan);
     
 #if DEBUG_MODE > 0
     printf("### DEBUG: [--End--] %s ...\n", __FUNCTION__);
@@ -386,6 +390,9 @@ FINISHED:  // finish iterative method
  *
  * \author Xiaozhe Hu
  * \date   05/26/2014
+ *
+ * Modified by FASP team on 10/16/2026: draw work space from the arena
+ * Modified by FASP team on 10/16/2026: fused BLAS1 kernels
  */
 INT fasp_solver_dbsr_pcg (dBSRmat     *A,
                           dvector     *b,
@@ -407,9 +414,11 @@ INT fasp_solver_dbsr_pcg (dBSRmat     *A,
     REAL         relres  = BIGREAL, normu  = BIGREAL, normr0 = BIGREAL;
     REAL         reldiff, factor, normuinf;
     REAL         alpha, beta, temp1, temp2;
+    REAL         norms[2]; // norms of u and r after the update
     
-    // allocate temp memory (need 4*m REAL numbers)
-    REAL *work = (REAL *)fasp_mem_calloc(4*m,sizeof(REAL));
+    // allocate temp memory (need 4*m REAL numbers) from the work arena
+    const size_t mark = fasp_arena_mark(NULL);
+    REAL *work = (REAL *)fasp_arena_alloc(NULL,4*m,sizeof(REAL));
     REAL *p = work, *z = work+m, *r = z+m, *t = r+m;
     
     // Output some info for debuging
@@ -475,16 +484,13 @@ INT fasp_solver_dbsr_pcg (dBSRmat     *A,
             ITS_DIVZERO; goto FINISHED;
         }
         
-        // u_k = u_{k-1} + alpha_k*p_{k-1}
-        fasp_blas_darray_axpy(m,alpha,p,u->val);
-        
-        // r_k = r_{k-1} - alpha_k*A*p_{k-1}
-        fasp_blas_darray_axpy(m,-alpha,t,r);
+        // u_k = u_{k-1} + alpha_k*p_{k-1}, r_k = r_{k-1} - alpha_k*A*p_{k-1}
+        fasp_blas_darray_axpy2_norm2(m,alpha,p,u->val,-alpha,t,r,norms);
         
         // compute norm of residual
         switch ( StopType ) {
             case STOP_REL_RES:
-                absres = fasp_blas_darray_norm2(m,r);
+                absres = norms[1];
                 relres = absres/normr0;
                 break;
             case STOP_REL_PRECRES:
@@ -497,7 +503,7 @@ INT fasp_solver_dbsr_pcg (dBSRmat     *A,
                 relres = absres/normr0;
                 break;
             case STOP_MOD_REL_RES:
-                absres = fasp_blas_darray_norm2(m,r);
+                absres = norms[1];
                 relres = absres/normu;
                 break;
         }
@@ -519,7 +525,7 @@ INT fasp_solver_dbsr_pcg (dBSRmat     *A,
             }
             
             // Check II: if stagnated, try to restart
-            normu = fasp_blas_darray_norm2(m, u->val);
+            normu = norms[0];
             
             // compute relative difference
             reldiff = ABS(alpha)*fasp_blas_darray_norm2(m,p)/normu;
@@ -646,7 +652,7 @@ FINISHED:  // finish iterative method
     if ( PrtLvl > PRINT_NONE ) ITS_FINAL(iter,MaxIt,relres);
     
     // clean up temp memory
-    fasp_mem_free(work); work = NULL;
+    fasp_arena_release(NULL,mark); work = NULL;
 
 #if DEBUG_MODE > 0
     printf("### DEBUG: [--End--] %s ...\n", __FUNCTION__);
@@ -680,6 +686,8 @@ FINISHED:  // finish iterative method
  * \date   05/24/2010
  *
  * Modified by Chensong Zhang on 03/28/2013
+ * Modified by FASP team on 10/16/2026: draw work space from the arena
+ * Modified by FASP team on 10/16/2026: fused BLAS1 kernels
  */
 INT fasp_solver_dblc_pcg (dBLCmat     *A,
                           dvector     *b,
@@ -701,9 +709,11 @@ INT fasp_solver_dblc_pcg (dBLCmat     *A,
     REAL         relres  = BIGREAL, normu  = BIGREAL, normr0 = BIGREAL;
     REAL         reldiff, factor, normuinf;
     REAL         alpha, beta, temp1, temp2;
+    REAL         norms[2]; // norms of u and r after the update
     
-    // allocate temp memory (need 4*m REAL numbers)
-    REAL *work = (REAL *)fasp_mem_calloc(4*m,sizeof(REAL));
+    // allocate temp memory (need 4*m REAL numbers) from the work arena
+    const size_t mark = fasp_arena_mark(NULL);
+    REAL *work = (REAL *)fasp_arena_alloc(NULL,4*m,sizeof(REAL));
     REAL *p = work, *z = work+m, *r = z+m, *t = r+m;
 
     // Output some info for debuging
@@ -769,16 +779,13 @@ INT fasp_solver_dblc_pcg (dBLCmat     *A,
             ITS_DIVZERO; goto FINISHED;
         }
         
-        // u_k = u_{k-1} + alpha_k*p_{k-1}
-        fasp_blas_darray_axpy(m,alpha,p,u->val);
-        
-        // r_k = r_{k-1} - alpha_k*A*p_{k-1}
-        fasp_blas_darray_axpy(m,-alpha,t,r);
+        // u_k = u_{k-1} + alpha_k*p_{k-1}, r_k = r_{k-1} - alpha_k*A*p_{k-1}
+        fasp_blas_darray_axpy2_norm2(m,alpha,p,u->val,-alpha,t,r,norms);
         
         // compute norm of residual
         switch ( StopType ) {
             case STOP_REL_RES:
-                absres = fasp_blas_darray_norm2(m,r);
+                absres = norms[1];
                 relres = absres/normr0;
                 break;
             case STOP_REL_PRECRES:
@@ -791,7 +798,7 @@ INT fasp_solver_dblc_pcg (dBLCmat     *A,
                 relres = absres/normr0;
                 break;
             case STOP_MOD_REL_RES:
-                absres = fasp_blas_darray_norm2(m,r);
+                absres = norms[1];
                 relres = absres/normu;
                 break;
         }
@@ -813,7 +820,7 @@ INT fasp_solver_dblc_pcg (dBLCmat     *A,
             }
             
             // Check II: if stagnated, try to restart
-            normu = fasp_blas_darray_norm2(m, u->val);
+            normu = norms[0];
             
             // compute relative difference
             reldiff = ABS(alpha)*fasp_blas_darray_norm2(m,p)/normu;
@@ -940,7 +947,7 @@ FINISHED:  // finish iterative method
     if ( PrtLvl > PRINT_NONE ) ITS_FINAL(iter,MaxIt,relres);
     
     // clean up temp memory
-    fasp_mem_free(work); work = NULL;
+    fasp_arena_release(NULL,mark); work = NULL;
 
 #if DEBUG_MODE > 0
     printf("### DEBUG: [--End--] %s ...\n", __FUNCTION__);
@@ -974,6 +981,8 @@ FINISHED:  // finish iterative method
  * \date   04/25/2010
  *
  * Modified by Chensong Zhang on 03/28/2013
+ * Modified by FASP team on 10/16/2026: draw work space from the arena
+ * Modified by FASP team on 10/16/2026: fused BLAS1 kernels
  */
 INT fasp_solver_dstr_pcg (dSTRmat     *A,
                           dvector     *b,
@@ -995,9 +1004,11 @@ INT fasp_solver_dstr_pcg (dSTRmat     *A,
     REAL         relres  = BIGREAL, normu  = BIGREAL, normr0 = BIGREAL;
     REAL         reldiff, factor, normuinf;
     REAL         alpha, beta, temp1, temp2;
+    REAL         norms[2]; // norms of u and r after the update
     
-    // allocate temp memory (need 4*m REAL numbers)
-    REAL *work = (REAL *)fasp_mem_calloc(4*m,sizeof(REAL));
+    // allocate temp memory (need 4*m REAL numbers) from the work arena
+    const size_t mark = fasp_arena_mark(NULL);
+    REAL *work = (REAL *)fasp_arena_alloc(NULL,4*m,sizeof(REAL));
     REAL *p = work, *z = work+m, *r = z+m, *t = r+m;
     
     // Output some info for debuging
@@ -1063,16 +1074,13 @@ INT fasp_solver_dstr_pcg (dSTRmat     *A,
             ITS_DIVZERO; goto FINISHED;
         }
         
-        // u_k = u_{k-1} + alpha_k*p_{k-1}
-        fasp_blas_darray_axpy(m,alpha,p,u->val);
-        
-        // r_k = r_{k-1} - alpha_k*A*p_{k-1}
-        fasp_blas_darray_axpy(m,-alpha,t,r);
+        // u_k = u_{k-1} + alpha_k*p_{k-1}, r_k = r_{k-1} - alpha_k*A*p_{k-1}
+        fasp_blas_darray_axpy2_norm2(m,alpha,p,u->val,-alpha,t,r,norms);
         
         // compute norm of residual
         switch ( StopType ) {
             case STOP_REL_RES:
-                absres = fasp_blas_darray_norm2(m,r);
+                absres = norms[1];
                 relres = absres/normr0;
                 break;
             case STOP_REL_PRECRES:
@@ -1085,7 +1093,7 @@ INT fasp_solver_dstr_pcg (dSTRmat     *A,
                 relres = absres/normr0;
                 break;
             case STOP_MOD_REL_RES:
-                absres = fasp_blas_darray_norm2(m,r);
+                absres = norms[1];
                 relres = absres/normu;
                 break;
         }
@@ -1107,7 +1115,7 @@ INT fasp_solver_dstr_pcg (dSTRmat     *A,
             }
             
             // Check II: if stagnated, try to restart
-            normu = fasp_blas_darray_norm2(m, u->val);
+            normu = norms[0];
             
             // compute relative difference
             reldiff = ABS(alpha)*fasp_blas_darray_norm2(m,p)/normu;
@@ -1234,7 +1242,7 @@ FINISHED:  // finish iterative method
     if ( PrtLvl > PRINT_NONE ) ITS_FINAL(iter,MaxIt,relres);
     
     // clean up temp memory
-    fasp_mem_free(work); work = NULL;
+    fasp_arena_release(NULL,mark); work = NULL;
 
 #if DEBUG_MODE > 0
     printf("### DEBUG: [--End--] %s ...\n", __FUNCTION__);
@@ -1268,6 +1276,7 @@ FINISHED:  // finish iterative method
  * \date   05/06/2010
  *
  * Modified by Feiteng Huang on 09/19/2012: matrix free
+ * Modified by FASP team on 10/16/2026: draw work space from the arena
  */
 INT fasp_solver_pcg (mxv_matfree *mf,
                      dvector     *b,
@@ -1291,7 +1300,8 @@ INT fasp_solver_pcg (mxv_matfree *mf,
     REAL         alpha, beta, temp1, temp2;
     
     // allocate temp memory (need 4*m REAL numbers)
-    REAL *work=(REAL *)fasp_mem_calloc(4*m,sizeof(REAL));
+    const size_t mark = fasp_arena_mark(NULL);
+    REAL *work = (REAL *)fasp_arena_alloc(NULL,4*m,sizeof(REAL));
     REAL *p=work, *z=work+m, *r=z+m, *t=r+m;
     
     // Output some info for debuging
@@ -1510,7 +1520,7 @@ FINISHED:  // finish iterative method
     if ( PrtLvl > PRINT_NONE ) ITS_FINAL(iter,MaxIt,relres);
     
     // clean up temp memory
-    fasp_mem_free(work); work = NULL;
+    fasp_arena_release(NULL,mark); work = NULL;
 
 #if DEBUG_MODE > 0
     printf("### DEBUG: [--End--] %s ...\n", __FUNCTION__);
@@ -0,0 +1,237 @@
+/*! \file  KryPcheby.c
+ *
+ *  \brief Krylov subspace methods -- Preconditioned Chebyshev iteration
+ *
+ *  \note  This file contains Level-3 (Kry) functions. It requires:
+ *         AuxArray.c, AuxMemory.c, AuxMessage.c, BlaArray.c, BlaEigen.c,
+ *         and BlaSpmvCSR.c
+ *
+ *  Reference:
+ *         Y. Saad 2003
+ *         Iterative methods for sparse linear systems (2nd Edition), SIAM
+ *
+ *---------------------------------------------------------------------------------
+ *  Copyright (C) 2009--Present by the FASP team. All rights reserved.
+ *  Released under the terms of the GNU Lesser General Public License 3.0 or later.
+ *---------------------------------------------------------------------------------
+ *
+ *  Abstract algorithm
+ *
+ *  For SPD A and M with the spectrum of M*A in [emin, emax]:
+ *
+ *  theta = (emax+emin)/2, delta = (emax-emin)/2, sigma = theta/delta;
+ *  r_0 = b - A*x_0, d_0 = M*r_0/theta, rho_0 = 1/sigma;
+ *
+ *  for k = 0, 1, ...
+ *      x_{k+1} = x_k + d_k, r_{k+1} = r_k - A*d_k, z_{k+1} = M*r_{k+1};
+ *      rho_{k+1} = 1/(2*sigma - rho_k);
+ *      d_{k+1} = rho_{k+1}*rho_k*d_k + 2*rho_{k+1}/delta*z_{k+1};
+ *
+ *  The coefficients do not depend on the iterates, so there is no inner product
+ *  in the iteration. The bounds are estimated by a few Lanczos steps before, and
+ *  the residual norm is only computed every CHEBY_CHECK iterations.
+ */
+
+#include <math.h>
+
+#include "fasp.h"
+#include "fasp_functs.h"
+
+/*---------------------------------*/
+/*--  Declare Private Functions  --*/
+/*---------------------------------*/
+
+#include "KryUtil.inl"
+
+/*---------------------------------*/
+/*--      Public Functions       --*/
+/*---------------------------------*/
+
+/**
+ * \fn INT fasp_solver_dcsr_pcheby (dCSRmat *A, dvector *b, dvector *x, precond *pc,
+ *                                  const REAL tol, const INT MaxIt,
+ *                                  const SHORT StopType, const SHORT PrtLvl)
+ *
+ * \brief Preconditioned Chebyshev iteration for solving Au=b
+ *
+ * \param A            Pointer to dCSRmat: coefficient matrix
+ * \param b            Pointer to dvector: right hand side
+ * \param x            Pointer to dvector: unknowns
+ * \param pc           Pointer to precond: structure of precondition
+ * \param tol          Tolerance for stopping
+ * \param MaxIt        Maximal number of iterations
+ * \param StopType     Stopping criteria type
+ * \param PrtLvl       How much information to print out
+ *
+ * \return             Iteration number if converges; ERROR otherwise.
+ *
+ * \author FASP team
+ * \date   10/16/2026
+ *
+ * \note A and the preconditioner should be SPD. The upper bound of the spectrum
+ *       is the largest Ritz value times CHEBY_UPPER; the lower bound is the
+ *       smallest Ritz value, which only slows down the convergence of the
+ *       smallest eigenmodes if it is too large.
+ */
+INT fasp_solver_dcsr_pcheby (dCSRmat     *A,
+                             dvector     *b,
+                             dvector     *x,
+                             precond     *pc,
+                             const REAL   tol,
+                             const INT    MaxIt,
+                             const SHORT  StopType,
+                             const SHORT  PrtLvl)
+{
+    const INT    n = b->row;
+    const size_t mark = fasp_arena_mark(NULL);
+
+    // local variables
+    INT      iter = 0;
+    REAL     emin, emax, theta, delta, sigma, rho, rho1;
+    REAL     absres0 = BIGREAL, absres = BIGREAL, relres = BIGREAL;
+    REAL     normu = BIGREAL, factor;
+    REAL    *uval = x->val;
+
+    // allocate temp memory (need 3*n REAL)
+    REAL    *work = (REAL *)fasp_arena_calloc(NULL, (size_t)3*n, sizeof(REAL));
+    REAL    *r = work, *z = r + n, *d = z + n;
+
+    // SpMV plan for A, shared by all matrix-vector products below
+    dCSRplan *Aplan = fasp_dcsr_plan_create(A);
+
+    // Output some info for debugging
+    if ( PrtLvl > PRINT_NONE ) printf("\nCalling Chebyshev solver (CSR) ...\n");
+
+#if DEBUG_MODE > 0
+    printf("### DEBUG: [-Begin-] %s ...\n", __FUNCTION__);
+    printf("### DEBUG: maxit = %d, tol = %.4le\n", MaxIt, tol);
+#endif
+
+    // spectrum bounds of M*A
+    fasp_dcsr_eig_bounds(A, pc, CHEBY_LANCZOS, &emin, &emax);
+    emax *= CHEBY_UPPER;
+
+    if ( PrtLvl >= PRINT_MORE )
+        printf("Chebyshev spectrum bounds: [%e, %e]\n", emin, emax);
+
+    if ( emin <= 0.0 || emin >= emax ) {
+        printf("### ERROR: Spectrum [%e, %e] is not positive! [%s]\n",
+               emin, emax, __FUNCTION__);
+        iter = ERROR_SOLVER_MISC;
+        goto FINISHED;
+    }
+
+    theta = 0.5*(emax + emin);
+    delta = 0.5*(emax - emin);
+    sigma = theta/delta;
+    rho   = 1.0/sigma;
+
+    // r = b-A*u, z = M*r
+    fasp_darray_cp(n, b->val, r);
+    fasp_blas_dcsr_aAxpy_plan(-1.0, A, Aplan, uval, r);
+
+    if ( pc == NULL )
+        fasp_darray_cp(n, r, z);
+    else
+        pc->fct(r, z, pc->data);
+
+    // compute initial residuals
+    switch ( StopType ) {
+        case STOP_REL_RES:
+            absres  = fasp_blas_darray_norm2(n, r);
+            absres0 = MAX(SMALLREAL, absres);
+            relres  = absres/absres0;
+            break;
+        case STOP_REL_PRECRES:
+            absres  = sqrt(ABS(fasp_blas_darray_dotprod(n, r, z)));
+            absres0 = MAX(SMALLREAL, absres);
+            relres  = absres/absres0;
+            break;
+        case STOP_MOD_REL_RES:
+            absres0 = fasp_blas_darray_norm2(n, r);
+            normu   = MAX(SMALLREAL, fasp_blas_darray_norm2(n, uval));
+            relres  = absres0/normu;
+            break;
+        default:
+            printf("### ERROR: Unknown stopping type! [%s]\n", __FUNCTION__);
+            goto FINISHED;
+    }
+
+    // if initial residual is small, no need to iterate!
+    if ( relres < tol || absres0 < 1e-3*tol ) goto FINISHED;
+
+    // output iteration information if needed
+    fasp_itinfo(PrtLvl, StopType, iter, relres, absres0, 0.0);
+
+    // d = z/theta
+    fasp_blas_darray_axpby(n, 1.0/theta, z, 0.0, d);
+    absres = absres0;
+
+    while ( iter++ < MaxIt ) {
+
+        // u = u + d, r = r - A*d
+        fasp_blas_darray_axpy(n, 1.0, d, uval);
+        fasp_blas_dcsr_aAxpy_plan(-1.0, A, Aplan, d, r);
+
+        // z = M*r
+        if ( pc == NULL )
+            fasp_darray_cp(n, r, z);
+        else
+            pc->fct(r, z, pc->data);
+
+        // d = rho1*rho*d + 2*rho1/delta*z
+        rho1 = 1.0/(2.0*sigma - rho);
+        fasp_blas_darray_axpby(n, 2.0*rho1/delta, z, rho1*rho, d);
+        rho  = rho1;
+
+        // check convergence every CHEBY_CHECK iterations only
+        if ( iter % CHEBY_CHECK != 0 && iter < MaxIt ) continue;
+
+        factor = absres;
+        switch ( StopType ) {
+            case STOP_REL_PRECRES:
+                absres = sqrt(ABS(fasp_blas_darray_dotprod(n, r, z)));
+                relres = absres/absres0;
+                break;
+            case STOP_MOD_REL_RES:
+                absres = fasp_blas_darray_norm2(n, r);
+                normu  = MAX(SMALLREAL, fasp_blas_darray_norm2(n, uval));
+                relres = absres/normu;
+                break;
+            default:
+                absres = fasp_blas_darray_norm2(n, r);
+                relres = absres/absres0;
+                break;
+        }
+
+        // output iteration information if needed
+        fasp_itinfo(PrtLvl, StopType, iter, relres, absres, absres/factor);
+
+        if ( relres < tol ) break;
+
+    } // end of main loop
+
+    if ( iter > MaxIt ) iter = MaxIt;
+
+    if ( PrtLvl > PRINT_NONE ) ITS_FINAL(iter, MaxIt, relres);
+
+FINISHED:
+    // clean up temp memory
+    fasp_dcsr_plan_free(Aplan);
+    fasp_arena_release(NULL, mark);
+
+#if DEBUG_MODE > 0
+    printf("### DEBUG: [--End--] %s ...\n", __FUNCTION__);
+#endif
+
+    if ( iter < 0 )
+        return iter;
+    else if ( iter >= MaxIt && relres > tol )
+        return ERROR_SOLVER_MAXIT;
+    else
+        return iter;
+}
+
+/*---------------------------------*/
+/*--        End of File          --*/
+/*---------------------------------*/
@@ -104,7 +104,7 @@ INT fasp_solver_dcsr_pgcr (dCSRmat     *A,
     }
     
     if ( PrtLvl > PRINT_MIN && Restart < restart ) {
-        printf("### WARNING: GCR restart number set to %d!\n", Restart);
+        printf("### WARNING: GCR restart number set to " INTFMT "!\n", Restart);
     }
     
     r = work; z = r+n; c = z + Restart*n; alp = c + Restart*n; tmpx = alp + Restart;
@@ -298,7 +298,7 @@ INT fasp_solver_dblc_pgcr (dBLCmat     *A,
     }
     
     if ( PrtLvl > PRINT_MIN && Restart < restart ) {
-        printf("### WARNING: GCR restart number set to %d!\n", Restart);
+        printf("### WARNING: GCR restart number set to " INTFMT "!\n", Restart);
     }
     
     r = work; z = r+n; c = z + Restart*n; alp = c + Restart*n; tmpx = alp + Restart;
@@ -0,0 +1,547 @@
+/*! \file  KryPgcrodr.c
+ *
+ *  \brief Krylov subspace methods -- Flexible GCRO with deflated restarting
+ *
+ *  \note  This file contains Level-3 (Kry) functions. It requires:
+ *         AuxArray.c, AuxMemory.c, AuxMessage.c, BlaArray.c, and BlaSpmvCSR.c
+ *
+ *  \note  See KryPvfgmres.c for flexible GMRES without recycling
+ *
+ *  Reference:
+ *         M. L. Parks, E. de Sturler, G. Mackey, D. D. Johnson and S. Maiti 2006
+ *         Recycling Krylov subspaces for sequences of linear systems,
+ *         SIAM Journal on Scientific Computing 28(5), 1651--1674
+ *
+ *         L. M. Carvalho, S. Gratton, R. Lago and X. Vasseur 2011
+ *         A flexible generalized conjugate residual method with inner
+ *         orthogonalization and deflated restarting, SIAM Journal on Matrix
+ *         Analysis and Applications 32(4), 1212--1235
+ *
+ *---------------------------------------------------------------------------------
+ *  Copyright (C) 2009--Present by the FASP team. All rights reserved.
+ *  Released under the terms of the GNU Lesser General Public License 3.0 or later.
+ *---------------------------------------------------------------------------------
+ *
+ *  Abstract algorithm
+ *
+ *  Keep k vectors U and C with A*U = C and C'*C = I. Each restart cycle
+ *
+ *    - projects the residual: x = x + U*C'*r, r = r - C*C'*r;
+ *    - runs m-k flexible Arnoldi steps with A*M orthogonalized against C, which
+ *      gives A*[U, Z] = [C, V]*G with G = [I, B; 0, H];
+ *    - solves min ||r - [C, V]*G*y|| and updates x = x + [U, Z]*y;
+ *    - replaces U by [U, Z]*P and C by [C, V]*G*P, where P holds the right
+ *      singular vectors of G to the k smallest singular values.
+ *
+ *  The slowest components stay deflated over restarts, and if a recycle_data is
+ *  given, over successive solves: U is kept and C = A*U is re-orthonormalized
+ *  for the next matrix.
+ */
+
+#include <math.h>
+
+#include "fasp.h"
+#include "fasp_functs.h"
+
+/*---------------------------------*/
+/*--  Declare Private Functions  --*/
+/*---------------------------------*/
+
+#include "KryUtil.inl"
+
+static INT  gcrodr_orth_pair (const INT, const INT, REAL **, REAL **);
+static void gcrodr_syev (const INT, REAL *, REAL *, REAL *);
+
+/*---------------------------------*/
+/*--      Public Functions       --*/
+/*---------------------------------*/
+
+/**
+ * \fn void fasp_recycle_init (recycle_data *rec, const INT kmax)
+ *
+ * \brief Initialize an empty recycled subspace
+ *
+ * \param rec    Pointer to recycle_data
+ * \param kmax   Maximal number of recycled vectors
+ *
+ * \author FASP team
+ * \date   10/16/2026
+ */
+void fasp_recycle_init (recycle_data  *rec,
+                        const INT      kmax)
+{
+    rec->n    = 0;
+    rec->kmax = MAX(kmax, 0);
+    rec->k    = 0;
+    rec->U    = NULL;
+}
+
+/**
+ * \fn void fasp_recycle_free (recycle_data *rec)
+ *
+ * \brief Free the recycled subspace
+ *
+ * \param rec    Pointer to recycle_data
+ *
+ * \author FASP team
+ * \date   10/16/2026
+ */
+void fasp_recycle_free (recycle_data  *rec)
+{
+    if ( rec == NULL ) return;
+
+    fasp_mem_free(rec->U); rec->U = NULL;
+    rec->n = 0;
+    rec->k = 0;
+}
+
+/*!
+ * \fn INT fasp_solver_dcsr_pgcrodr (dCSRmat *A, dvector *b, dvector *x, precond *pc,
+ *                                   const REAL tol, const INT MaxIt,
+ *                                   const SHORT restart, recycle_data *rec,
+ *                                   const SHORT StopType, const SHORT PrtLvl)
+ *
+ * \brief Solve Ax=b by flexible GCRO-DR (right preconditioned)
+ *
+ * \param A            Pointer to dCSRmat: coefficient matrix
+ * \param b            Pointer to dvector: right hand side
+ * \param x            Pointer to dvector: unknowns
+ * \param pc           Pointer to precond: structure of precondition
+ * \param tol          Tolerance for stopping
+ * \param MaxIt        Maximal number of iterations
+ * \param restart      Restarting steps (including the recycled vectors)
+ * \param rec          Pointer to recycle_data: recycled subspace (IN/OUT), or NULL
+ *                     to recycle within this solve only
+ * \param StopType     Stopping criteria type
+ * \param PrtLvl       How much information to print out
+ *
+ * \return             Iteration number if converges; ERROR otherwise.
+ *
+ * \author FASP team
+ * \date   10/16/2026
+ *
+ * \note Like fasp_solver_dcsr_pvfgmres, the iteration stops when ||r|| < tol*||b||
+ *       and the final check uses StopType. Without rec, GCRODR_RECYCLE vectors
+ *       (at most restart/2) are recycled.
+ */
+INT fasp_solver_dcsr_pgcrodr (dCSRmat       *A,
+                              dvector       *b,
+                              dvector       *x,
+                              precond       *pc,
+                              const REAL     tol,
+                              const INT      MaxIt,
+                              const SHORT    restart,
+                              recycle_data  *rec,
+                              const SHORT    StopType,
+                              const SHORT    PrtLvl)
+{
+    const INT  n       = b->row;
+    const INT  Restart = MAX(MIN(restart, MaxIt), 2);
+    const INT  Restart1 = Restart + 1;
+
+    // local variables
+    INT        iter = 0, i, j, l, q, k, kk = 0, ms, mt;
+    SHORT      converged = FALSE;
+    REAL       r_norm, b_norm, den_norm, epsilon, gamma, t;
+    REAL       relres = BIGREAL, normu, r_normb;
+    REAL     **u, **cc, **v, **z, **ut, **ct, **tmp;
+    REAL      *r, *w, *hh, *hu, *B, *c, *s, *rs, *G, *S, *P, *lam, *GP, *alpha;
+    size_t     mark;
+
+    // number of recycled vectors
+    k = ( rec != NULL ) ? rec->kmax : MIN(GCRODR_RECYCLE, Restart/2);
+    k = MAX(MIN(k, Restart-1), 0);
+
+    // Output some info for debuging
+    if ( PrtLvl > PRINT_NONE ) printf("\nCalling GCRO-DR solver (CSR) ...\n");
+
+#if DEBUG_MODE > 0
+    printf("### DEBUG: [-Begin-] %s ...\n", __FUNCTION__);
+    printf("### DEBUG: maxit = %d, tol = %.4le, k = %d\n", MaxIt, tol, k);
+#endif
+
+    /* allocate memory and setup temp work space from the work arena */
+    mark  = fasp_arena_mark(NULL);
+    u     = (REAL **)fasp_arena_calloc(NULL, 4*k+2*Restart+1, sizeof(REAL *));
+    cc    = u + k; ut = cc + k; ct = ut + k; v = ct + k; z = v + Restart1;
+    r     = (REAL *) fasp_arena_calloc(NULL, (size_t)(4*k+2*Restart+3)*n,
+                                       sizeof(REAL));
+    w     = r + n;
+    for ( i = 0; i < 4*k+2*Restart+1; i++ ) u[i] = w + (size_t)(i+1)*n;
+
+    hh    = (REAL *) fasp_arena_calloc(NULL, 4*Restart1*Restart + 2*Restart*Restart
+                                       + 4*Restart+2 + Restart1*k + k, sizeof(REAL));
+    hu    = hh + Restart1*Restart;  // Hessenberg matrix without rotations
+    G     = hu + Restart1*Restart;
+    GP    = G  + Restart1*Restart;
+    S     = GP + Restart1*Restart;
+    P     = S  + Restart*Restart;
+    B     = P  + Restart*Restart;   // C'*A*Z
+    rs    = B  + Restart1*k;
+    c     = rs + Restart1; s = c + Restart; lam = s + Restart;
+    alpha = lam + Restart + 1;
+
+    /* initialization */
+    fasp_darray_cp(n, b->val, r);
+    fasp_blas_dcsr_aAxpy(-1.0, A, x->val, r);
+
+    b_norm = fasp_blas_darray_norm2(n, b->val);
+    r_norm = fasp_blas_darray_norm2(n, r);
+
+    if ( PrtLvl >= PRINT_SOME) {
+        ITS_PUTNORM("right-hand side", b_norm);
+        ITS_PUTNORM("residual", r_norm);
+    }
+
+    if ( b_norm > 0.0 ) den_norm = b_norm;
+    else                den_norm = r_norm;
+
+    epsilon = tol*den_norm;
+
+    // if initial residual is small, no need to iterate!
+    if ( r_norm < epsilon || r_norm < 1e-6*tol ) goto FINISHED;
+
+    fasp_itinfo(PrtLvl, StopType, iter, r_norm/den_norm, r_norm, 0);
+
+    // recycled space from the previous solve: C = A*U, orthonormalize
+    if ( rec != NULL && rec->k > 0 && rec->n == n && k > 0 ) {
+        kk = MIN(rec->k, k);
+        for ( j = 0; j < kk; j++ ) {
+            fasp_darray_cp(n, rec->U + (size_t)j*n, u[j]);
+            fasp_blas_dcsr_mxv(A, u[j], cc[j]);
+        }
+        kk = gcrodr_orth_pair(n, kk, cc, u);
+        if ( PrtLvl >= PRINT_MORE ) printf("GCRO-DR: recycle " INTFMT " vectors.\n", kk);
+    }
+
+    /* outer iteration cycle */
+    while ( iter < MaxIt ) {
+
+        // project out the recycled space: x = x + U*C'*r, r = r - C*C'*r
+        for ( j = 0; j < kk; j++ ) {
+            alpha[j] = fasp_blas_darray_dotprod(n, cc[j], r);
+            fasp_blas_darray_axpy(n,  alpha[j], u[j],  x->val);
+            fasp_blas_darray_axpy(n, -alpha[j], cc[j], r);
+        }
+        r_norm = fasp_blas_darray_norm2(n, r);
+        if ( r_norm == 0.0 ) break;
+
+        rs[0] = r_norm;
+        fasp_darray_cp(n, r, v[0]);
+        fasp_blas_darray_ax(n, 1.0/r_norm, v[0]);
+        ms = Restart - kk;
+        i  = 0;
+
+        // RESTART CYCLE (right-preconditioning)
+        while ( i < ms && iter < MaxIt ) {
+
+            i ++;  iter ++;
+
+            /* apply preconditioner */
+            if ( pc == NULL )
+                fasp_darray_cp(n, v[i-1], z[i-1]);
+            else
+                pc->fct(v[i-1], z[i-1], pc->data);
+
+            fasp_blas_dcsr_mxv(A, z[i-1], v[i]);
+
+            /* orthogonalize against C, then modified Gram-Schmidt */
+            for ( j = 0; j < kk; j++ ) {
+                B[j*Restart+i-1] = fasp_blas_darray_dotprod(n, cc[j], v[i]);
+                fasp_blas_darray_axpy(n, -B[j*Restart+i-1], cc[j], v[i]);
+            }
+            for ( j = 0; j < i; j++ ) {
+                hu[j*Restart+i-1] = fasp_blas_darray_dotprod(n, v[j], v[i]);
+                fasp_blas_darray_axpy(n, -hu[j*Restart+i-1], v[j], v[i]);
+            }
+            t = fasp_blas_darray_norm2(n, v[i]);
+            hu[i*Restart+i-1] = t;
+            if ( t != 0.0 ) fasp_blas_darray_ax(n, 1.0/t, v[i]);
+
+            /* Givens rotations on a copy of the new column */
+            for ( j = 0; j <= i; j++ ) hh[j*Restart+i-1] = hu[j*Restart+i-1];
+            for ( j = 1; j < i; ++j ) {
+                t = hh[(j-1)*Restart+i-1];
+                hh[(j-1)*Restart+i-1] =  s[j-1]*hh[j*Restart+i-1] + c[j-1]*t;
+                hh[j*Restart+i-1]     = -s[j-1]*t + c[j-1]*hh[j*Restart+i-1];
+            }
+            t  = hh[i*Restart+i-1]     * hh[i*Restart+i-1];
+            t += hh[(i-1)*Restart+i-1] * hh[(i-1)*Restart+i-1];
+            gamma = sqrt(t);
+            if ( gamma == 0.0 ) gamma = SMALLREAL;
+            c[i-1]  = hh[(i-1)*Restart+i-1] / gamma;
+            s[i-1]  = hh[i*Restart+i-1] / gamma;
+            rs[i]   = -s[i-1] * rs[i-1];
+            rs[i-1] =  c[i-1] * rs[i-1];
+            hh[(i-1)*Restart+i-1] = gamma;
+
+            t = r_norm; r_norm = fabs(rs[i]);
+
+            fasp_itinfo(PrtLvl, StopType, iter, r_norm/den_norm, r_norm, r_norm/t);
+
+            /* Check: Exit the restart cycle? */
+            if ( r_norm <= epsilon ) break;
+
+        } /* end of restart cycle */
+
+        /* solve the upper triangular system H*y = rs, then y_U = -B*y */
+        for ( l = i-1; l >= 0; l-- ) {
+            t = rs[l];
+            for ( j = l+1; j < i; j++ ) t -= hh[l*Restart+j]*rs[j];
+            rs[l] = t / hh[l*Restart+l];
+        }
+        for ( j = 0; j < kk; j++ ) {
+            t = 0.0;
+            for ( l = 0; l < i; l++ ) t += B[j*Restart+l]*rs[l];
+            alpha[j] = -t;
+        }
+
+        /* x = x + Z*y + U*y_U */
+        for ( j = 0; j < i;  j++ ) fasp_blas_darray_axpy(n, rs[j], z[j], x->val);
+        for ( j = 0; j < kk; j++ ) fasp_blas_darray_axpy(n, alpha[j], u[j], x->val);
+
+        /* true residual */
+        fasp_darray_cp(n, b->val, r);
+        fasp_blas_dcsr_aAxpy(-1.0, A, x->val, r);
+        r_norm = fasp_blas_darray_norm2(n, r);
+
+        if ( r_norm <= epsilon ) {
+            switch (StopType) {
+                case STOP_REL_RES:
+                    relres  = r_norm/den_norm;
+                    break;
+                case STOP_REL_PRECRES:
+                    if ( pc == NULL ) fasp_darray_cp(n, r, w);
+                    else pc->fct(r, w, pc->data);
+                    r_normb = sqrt(fasp_blas_darray_dotprod(n,w,r));
+                    relres  = r_normb/den_norm;
+                    break;
+                case STOP_MOD_REL_RES:
+                    normu   = MAX(SMALLREAL,fasp_blas_darray_norm2(n,x->val));
+                    relres  = r_norm/normu;
+                    break;
+                default:
+                    printf("### ERROR: Unknown stopping type! [%s]\n", __FUNCTION__);
+                    goto FINISHED;
+            }
+
+            if ( relres <= tol ) converged = TRUE;
+            else if ( PrtLvl >= PRINT_SOME ) ITS_FACONV;
+        }
+
+        // new recycled space, after convergence only if kept for the next solve
+        if ( k > 0 && (rec != NULL || !converged) ) {
+
+            // G = [I, B; 0, H] of size (mt+1)*mt
+            mt = kk + i;
+            fasp_darray_set((mt+1)*mt, G, 0.0);
+            for ( j = 0; j < kk; j++ ) {
+                G[j*mt+j] = 1.0;
+                for ( l = 0; l < i; l++ ) G[j*mt+kk+l] = B[j*Restart+l];
+            }
+            for ( j = 0; j <= i; j++ ) {
+                for ( l = MAX(j-1,0); l < i; l++ ) G[(kk+j)*mt+kk+l] = hu[j*Restart+l];
+            }
+
+            // S = G'*G, eigenvectors P to the smallest eigenvalues
+            for ( j = 0; j < mt; j++ ) {
+                for ( l = j; l < mt; l++ ) {
+                    t = 0.0;
+                    for ( q = 0; q <= mt; q++ ) t += G[q*mt+j]*G[q*mt+l];
+                    S[j*mt+l] = S[l*mt+j] = t;
+                }
+            }
+            gcrodr_syev(mt, S, P, lam);
+            ms = MIN(k, mt);
+
+            // GP = G*P(:,1:ms)
+            for ( j = 0; j <= mt; j++ ) {
+                for ( l = 0; l < ms; l++ ) {
+                    t = 0.0;
+                    for ( q = 0; q < mt; q++ ) t += G[j*mt+q]*P[q*mt+l];
+                    GP[j*ms+l] = t;
+                }
+            }
+
+            // U_new = [U, Z]*P, C_new = [C, V]*G*P
+            for ( l = 0; l < ms; l++ ) {
+                fasp_darray_set(n, ut[l], 0.0);
+                fasp_darray_set(n, ct[l], 0.0);
+                for ( j = 0; j < kk; j++ ) {
+                    fasp_blas_darray_axpy(n, P[j*mt+l], u[j], ut[l]);
+                    fasp_blas_darray_axpy(n, GP[j*ms+l], cc[j], ct[l]);
+                }
+                for ( j = 0; j < i; j++ ) {
+                    fasp_blas_darray_axpy(n, P[(kk+j)*mt+l], z[j], ut[l]);
+                    fasp_blas_darray_axpy(n, GP[(kk+j)*ms+l], v[j], ct[l]);
+                }
+                fasp_blas_darray_axpy(n, GP[(kk+i)*ms+l], v[i], ct[l]);
+            }
+
+            kk = gcrodr_orth_pair(n, ms, ct, ut);
+            tmp = u;  u  = ut; ut = tmp;
+            tmp = cc; cc = ct; ct = tmp;
+        }
+
+        if ( converged ) break;
+
+    } /* end of main while loop */
+
+FINISHED:
+    if ( PrtLvl > PRINT_NONE ) ITS_FINAL(iter,MaxIt,r_norm/den_norm);
+
+    // keep the recycled space for the next solve
+    if ( rec != NULL && kk > 0 ) {
+        if ( rec->U == NULL || rec->n != n ) {
+            fasp_mem_free(rec->U);
+            rec->U = (REAL *)fasp_mem_calloc((size_t)rec->kmax*n, sizeof(REAL));
+            rec->n = n;
+        }
+        for ( j = 0; j < kk; j++ ) fasp_darray_cp(n, u[j], rec->U + (size_t)j*n);
+        rec->k = kk;
+    }
+
+    /*-------------------------------------------
+     * Clean up workspace
+     *------------------------------------------*/
+    fasp_arena_release(NULL, mark);
+
+#if DEBUG_MODE > 0
+    printf("### DEBUG: [--End--] %s ...\n", __FUNCTION__);
+#endif
+
+    if ( iter >= MaxIt && !converged )
+        return ERROR_SOLVER_MAXIT;
+    else
+        return iter;
+}
+
+/*---------------------------------*/
+/*--      Private Functions      --*/
+/*---------------------------------*/
+
+/**
+ * \fn static INT gcrodr_orth_pair (const INT n, const INT k, REAL **c, REAL **u)
+ *
+ * \brief Orthonormalize C and apply the same transformation to U, so that A*U = C
+ *        is kept
+ *
+ * \param n      Length of the vectors
+ * \param k      Number of vectors
+ * \param c      Pointers to the vectors C
+ * \param u      Pointers to the vectors U
+ *
+ * \return       Number of vectors kept; dependent ones are moved to the end
+ *
+ * \author FASP team
+ * \date   10/16/2026
+ *
+ * \note Gram-Schmidt is done twice for each vector.
+ */
+static INT gcrodr_orth_pair (const INT    n,
+                             const INT    k,
+                             REAL       **c,
+                             REAL       **u)
+{
+    INT   i, j, pass, kk = 0;
+    REAL  t, norm0, *tmp;
+
+    for ( j = 0; j < k; j++ ) {
+        norm0 = fasp_blas_darray_norm2(n, c[j]);
+        for ( pass = 0; pass < 2; pass++ ) {
+            for ( i = 0; i < kk; i++ ) {
+                t = fasp_blas_darray_dotprod(n, c[i], c[j]);
+                fasp_blas_darray_axpy(n, -t, c[i], c[j]);
+                fasp_blas_darray_axpy(n, -t, u[i], u[j]);
+            }
+        }
+        t = fasp_blas_darray_norm2(n, c[j]);
+        if ( t <= 1e-10*norm0 || t < SMALLREAL ) continue;
+
+        fasp_blas_darray_ax(n, 1.0/t, c[j]);
+        fasp_blas_darray_ax(n, 1.0/t, u[j]);
+        tmp = c[kk]; c[kk] = c[j]; c[j] = tmp;
+        tmp = u[kk]; u[kk] = u[j]; u[j] = tmp;
+        kk++;
+    }
+
+    return kk;
+}
+
+/**
+ * \fn static void gcrodr_syev (const INT m, REAL *S, REAL *P, REAL *lam)
+ *
+ * \brief Eigenvalues and eigenvectors of a small symmetric matrix by the cyclic
+ *        Jacobi method, sorted in ascending order
+ *
+ * \param m      Size of S
+ * \param S      Symmetric matrix (m*m, row-major), destroyed on output
+ * \param P      Eigenvectors (m*m, row-major), column l belongs to lam[l]
+ * \param lam    Eigenvalues in ascending order
+ *
+ * \author FASP team
+ * \date   10/16/2026
+ */
+static void gcrodr_syev (const INT   m,
+                         REAL       *S,
+                         REAL       *P,
+                         REAL       *lam)
+{
+    const INT  MaxSweep = 50;
+
+    INT   i, j, l, sweep, imin;
+    REAL  off, diag, theta, t, cs, sn, a, b;
+
+    fasp_darray_set(m*m, P, 0.0);
+    for ( i = 0; i < m; i++ ) P[i*m+i] = 1.0;
+
+    for ( sweep = 0; sweep < MaxSweep; sweep++ ) {
+
+        off = diag = 0.0;
+        for ( i = 0; i < m; i++ ) {
+            diag += S[i*m+i]*S[i*m+i];
+            for ( j = i+1; j < m; j++ ) off += S[i*m+j]*S[i*m+j];
+        }
+        if ( off <= 1e-30*diag || off < SMALLREAL2 ) break;
+
+        for ( i = 0; i < m-1; i++ ) {
+            for ( j = i+1; j < m; j++ ) {
+                if ( fabs(S[i*m+j]) < SMALLREAL2 ) continue;
+
+                // rotation annihilating S(i,j)
+                theta = (S[j*m+j] - S[i*m+i]) / (2.0*S[i*m+j]);
+                t  = (theta >= 0.0 ? 1.0 : -1.0) / (fabs(theta) + sqrt(theta*theta+1.0));
+                cs = 1.0/sqrt(t*t+1.0); sn = t*cs;
+
+                for ( l = 0; l < m; l++ ) { // columns i and j
+                    a = S[l*m+i]; b = S[l*m+j];
+                    S[l*m+i] = cs*a - sn*b; S[l*m+j] = sn*a + cs*b;
+                }
+                for ( l = 0; l < m; l++ ) { // rows i and j
+                    a = S[i*m+l]; b = S[j*m+l];
+                    S[i*m+l] = cs*a - sn*b; S[j*m+l] = sn*a + cs*b;
+                }
+                for ( l = 0; l < m; l++ ) {
+                    a = P[l*m+i]; b = P[l*m+j];
+                    P[l*m+i] = cs*a - sn*b; P[l*m+j] = sn*a + cs*b;
+                }
+            }
+        }
+    }
+
+    // sort eigenpairs in ascending order
+    for ( i = 0; i < m; i++ ) lam[i] = S[i*m+i];
+    for ( i = 0; i < m-1; i++ ) {
+        imin = i;
+        for ( j = i+1; j < m; j++ ) if ( lam[j] < lam[imin] ) imin = j;
+        if ( imin == i ) continue;
+        t = lam[i]; lam[i] = lam[imin]; lam[imin] = t;
+        for ( l = 0; l < m; l++ ) {
+            t = P[l*m+i]; P[l*m+i] = P[l*m+imin]; P[l*m+imin] = t;
+        }
+    }
+}
+
+/*---------------------------------*/
+/*--        End of File          --*/
+/*---------------------------------*/
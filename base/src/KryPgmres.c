@@ -63,6 +63,9 @@
  * Modified by Chensong Zhang on 04/05/2013: Add StopType and safe check
  * Modified by Chunsheng Feng on 07/22/2013: Add adapt memory allocate
  * Modified by Chensong Zhang on 09/21/2014: Add comments and reorganize code
+ * Modified by FASP team on 10/16/2026: use a SpMV plan for A
+ *
+ * Modified by FASP team on 10/16/2026: draw work space from the arena
  */
 INT fasp_solver_dcsr_pgmres (dCSRmat     *A,
                              dvector     *b,
@@ -89,14 +92,20 @@ INT fasp_solver_dcsr_pgmres (dCSRmat     *A,
     REAL    *c = NULL, *s = NULL, *rs = NULL;
     REAL    *norms = NULL, *r = NULL, *w = NULL;
     REAL    *work = NULL;
+    size_t   mark;
     REAL   **p = NULL, **hh = NULL;
+    dCSRplan *Aplan = NULL;
     
     INT   Restart  = MIN(restart, MaxIt);
     INT   Restart1 = Restart + 1;
     LONG  worksize = (Restart+4)*(Restart+n)+1-n;
     
-    /* allocate memory and setup temp work space */
-    work  = (REAL *) fasp_mem_calloc(worksize, sizeof(REAL));
+    // SpMV plan for A, shared by all matrix-vector products below
+    Aplan = fasp_dcsr_plan_create(A);
+
+    /* allocate memory and setup temp work space from the work arena */
+    mark  = fasp_arena_mark(NULL);
+    work  = (REAL *) fasp_arena_calloc(NULL, worksize, sizeof(REAL));
 
     // Output some info for debugging
     if ( PrtLvl > PRINT_NONE ) printf("\nCalling GMRes solver (CSR) ...\n");
@@ -111,7 +120,7 @@ INT fasp_solver_dcsr_pgmres (dCSRmat     *A,
         Restart = Restart - 5;
         Restart1 = Restart + 1;
         worksize = (Restart+4)*(Restart+n)+1-n;
-        work = (REAL *) fasp_mem_calloc(worksize, sizeof(REAL));
+        work = (REAL *) fasp_arena_calloc(NULL, worksize, sizeof(REAL));
     }
     
     if ( work == NULL ) {
@@ -120,12 +129,12 @@ INT fasp_solver_dcsr_pgmres (dCSRmat     *A,
     }
     
     if ( PrtLvl > PRINT_MIN && Restart < restart ) {
-        printf("### WARNING: GMRES restart number set to %d!\n", Restart);
+        printf("### WARNING: GMRES restart number set to " INTFMT "!\n", Restart);
     }
     
-    p     = (REAL **)fasp_mem_calloc(Restart1, sizeof(REAL *));
-    hh    = (REAL **)fasp_mem_calloc(Restart1, sizeof(REAL *));
-    norms = (REAL *) fasp_mem_calloc(MaxIt+1,  sizeof(REAL));
+    p     = (REAL **)fasp_arena_calloc(NULL, Restart1, sizeof(REAL *));
+    hh    = (REAL **)fasp_arena_calloc(NULL, Restart1, sizeof(REAL *));
+    norms = (REAL *) fasp_arena_calloc(NULL, MaxIt+1,  sizeof(REAL));
     
     r = work; w = r + n; rs = w + n; c  = rs + Restart1; s  = c + Restart;
     
@@ -135,7 +144,7 @@ INT fasp_solver_dcsr_pgmres (dCSRmat     *A,
     
     // compute initial residual: r = b-A*x
     fasp_darray_cp(n, b->val, p[0]);
-    fasp_blas_dcsr_aAxpy(-1.0, A, x->val, p[0]);
+    fasp_blas_dcsr_aAxpy_plan(-1.0, A, Aplan, x->val, p[0]);
     r_norm  = fasp_blas_darray_norm2(n,p[0]);
     
     // compute stopping criteria
@@ -193,7 +202,7 @@ INT fasp_solver_dcsr_pgmres (dCSRmat     *A,
             else
                 pc->fct(p[i-1], r, pc->data);
             
-            fasp_blas_dcsr_mxv(A, r, p[i]);
+            fasp_blas_dcsr_mxv_plan(A, Aplan, r, p[i]);
             
             /* Modified Gram_Schmidt orthogonalization */
             for ( j = 0; j < i; j++ ) {
@@ -268,7 +277,7 @@ INT fasp_solver_dcsr_pgmres (dCSRmat     *A,
             
             // compute residual
             fasp_darray_cp(n, b->val, r);
-            fasp_blas_dcsr_aAxpy(-1.0, A, x->val, r);
+            fasp_blas_dcsr_aAxpy_plan(-1.0, A, Aplan, x->val, r);
             r_norm = fasp_blas_darray_norm2(n, r);
             
             switch ( StopType ) {
@@ -328,10 +337,8 @@ FINISHED:
     /*-------------------------------------------
      * Clean up workspace
      *------------------------------------------*/
-    fasp_mem_free(work);  work  = NULL;
-    fasp_mem_free(p);     p     = NULL;
-    fasp_mem_free(hh);    hh    = NULL;
-    fasp_mem_free(norms); norms = NULL;
+    fasp_arena_release(NULL, mark);
+    fasp_dcsr_plan_free(Aplan);
     
 #if DEBUG_MODE > 0
     printf("### DEBUG: [--End--] %s ...\n", __FUNCTION__);
@@ -366,6 +373,8 @@ FINISHED:
  * \date   2010/12/21
  *
  * Modified by Chensong Zhang on 04/05/2013: add StopType and safe check
+ *
+ * Modified by FASP team on 10/16/2026: draw work space from the arena
  */
 INT fasp_solver_dbsr_pgmres (dBSRmat     *A,
                              dvector     *b,
@@ -392,14 +401,16 @@ INT fasp_solver_dbsr_pgmres (dBSRmat     *A,
     REAL    *c = NULL, *s = NULL, *rs = NULL;
     REAL    *norms = NULL, *r = NULL, *w = NULL;
     REAL    *work = NULL;
+    size_t   mark;
     REAL   **p = NULL, **hh = NULL;
 
     INT   Restart  = MIN(restart, MaxIt);
     INT   Restart1 = Restart + 1;
     LONG  worksize = (Restart+4)*(Restart+n)+1-n;
 
-    /* allocate memory and setup temp work space */
-    work  = (REAL *) fasp_mem_calloc(worksize, sizeof(REAL));
+    /* allocate memory and setup temp work space from the work arena */
+    mark  = fasp_arena_mark(NULL);
+    work  = (REAL *) fasp_arena_calloc(NULL, worksize, sizeof(REAL));
 
     // Output some info for debugging
     if ( PrtLvl > PRINT_NONE ) printf("\nCalling GMRes solver (BSR) ...\n");
@@ -414,7 +425,7 @@ INT fasp_solver_dbsr_pgmres (dBSRmat     *A,
         Restart = Restart - 5;
         Restart1 = Restart + 1;
         worksize = (Restart+4)*(Restart+n)+1-n;
-        work = (REAL *) fasp_mem_calloc(worksize, sizeof(REAL));
+        work = (REAL *) fasp_arena_calloc(NULL, worksize, sizeof(REAL));
     }
 
     if ( work == NULL ) {
@@ -423,12 +434,12 @@ INT fasp_solver_dbsr_pgmres (dBSRmat     *A,
     }
 
     if ( PrtLvl > PRINT_MIN && Restart < restart ) {
-        printf("### WARNING: GMRES restart number set to %d!\n", Restart);
+        printf("### WARNING: GMRES restart number set to " INTFMT "!\n", Restart);
     }
 
-    p     = (REAL **)fasp_mem_calloc(Restart1, sizeof(REAL *));
-    hh    = (REAL **)fasp_mem_calloc(Restart1, sizeof(REAL *));
-    norms = (REAL *) fasp_mem_calloc(MaxIt+1, sizeof(REAL));
+    p     = (REAL **)fasp_arena_calloc(NULL, Restart1, sizeof(REAL *));
+    hh    = (REAL **)fasp_arena_calloc(NULL, Restart1, sizeof(REAL *));
+    norms = (REAL *) fasp_arena_calloc(NULL, MaxIt+1, sizeof(REAL));
 
     r = work; w = r + n; rs = w + n; c  = rs + Restart1; s  = c + Restart;
 
@@ -633,10 +644,7 @@ FINISHED:
     /*-------------------------------------------
      * Clean up workspace
      *------------------------------------------*/
-    fasp_mem_free(work);   work  = NULL;
-    fasp_mem_free(p);      p     = NULL;
-    fasp_mem_free(hh);     hh    = NULL;
-    fasp_mem_free(norms);  norms = NULL;
+    fasp_arena_release(NULL, mark);
 
 #if DEBUG_MODE > 0
     printf("### DEBUG: [--End--] %s ...\n", __FUNCTION__);
@@ -671,6 +679,7 @@ FINISHED:
  * \date   05/24/2010
  *
  * Modified by Chensong Zhang on 04/05/2013: add StopType and safe check
+ * Modified by FASP team on 10/16/2026: draw work space from the arena
  */
 INT fasp_solver_dblc_pgmres (dBLCmat     *A,
                              dvector     *b,
@@ -697,14 +706,16 @@ INT fasp_solver_dblc_pgmres (dBLCmat     *A,
     REAL    *c = NULL, *s = NULL, *rs = NULL;
     REAL    *norms = NULL, *r = NULL, *w = NULL;
     REAL    *work = NULL;
+    size_t   mark;
     REAL   **p = NULL, **hh = NULL;
     
     INT   Restart  = MIN(restart, MaxIt);
     INT   Restart1 = Restart + 1;
     LONG  worksize = (Restart+4)*(Restart+n)+1-n;
     
-    /* allocate memory and setup temp work space */
-    work  = (REAL *) fasp_mem_calloc(worksize, sizeof(REAL));
+    /* allocate memory and setup temp work space from the work arena */
+    mark  = fasp_arena_mark(NULL);
+    work  = (REAL *) fasp_arena_calloc(NULL, worksize, sizeof(REAL));
     
     // Output some info for debugging
     if ( PrtLvl > PRINT_NONE ) printf("\nCalling GMRes solver (BLC) ...\n");
@@ -719,7 +730,7 @@ INT fasp_solver_dblc_pgmres (dBLCmat     *A,
         Restart = Restart - 5;
         Restart1 = Restart + 1;
         worksize = (Restart+4)*(Restart+n)+1-n;
-        work = (REAL *) fasp_mem_calloc(worksize, sizeof(REAL));
+        work = (REAL *) fasp_arena_calloc(NULL, worksize, sizeof(REAL));
     }
     
     if ( work == NULL ) {
@@ -728,12 +739,12 @@ INT fasp_solver_dblc_pgmres (dBLCmat     *A,
     }
     
     if ( PrtLvl > PRINT_MIN && Restart < restart ) {
-        printf("### WARNING: GMRES restart number set to %d!\n", Restart);
+        printf("### WARNING: GMRES restart number set to " INTFMT "!\n", Restart);
     }
     
-    p     = (REAL **)fasp_mem_calloc(Restart1, sizeof(REAL *));
-    hh    = (REAL **)fasp_mem_calloc(Restart1, sizeof(REAL *));
-    norms = (REAL *) fasp_mem_calloc(MaxIt+1, sizeof(REAL));
+    p     = (REAL **)fasp_arena_calloc(NULL, Restart1, sizeof(REAL *));
+    hh    = (REAL **)fasp_arena_calloc(NULL, Restart1, sizeof(REAL *));
+    norms = (REAL *) fasp_arena_calloc(NULL, MaxIt+1, sizeof(REAL));
     
     r = work; w = r + n; rs = w + n; c  = rs + Restart1; s  = c + Restart;
     
@@ -937,10 +948,7 @@ FINISHED:
     /*-------------------------------------------
      * Clean up workspace
      *------------------------------------------*/
-    fasp_mem_free(work);  work  = NULL;
-    fasp_mem_free(p);     p     = NULL;
-    fasp_mem_free(hh);    hh    = NULL;
-    fasp_mem_free(norms); norms = NULL;
+    fasp_arena_release(NULL, mark);
     
 #if DEBUG_MODE > 0
     printf("### DEBUG: [--End--] %s ...\n", __FUNCTION__);
@@ -975,6 +983,7 @@ FINISHED:
  * \date   2010/11/28
  *
  * Modified by Chensong Zhang on 04/05/2013: add StopType and safe check
+ * Modified by FASP team on 10/16/2026: draw work space from the arena
  */
 INT fasp_solver_dstr_pgmres (dSTRmat     *A,
                              dvector     *b,
@@ -1001,14 +1010,16 @@ INT fasp_solver_dstr_pgmres (dSTRmat     *A,
     REAL    *c = NULL, *s = NULL, *rs = NULL;
     REAL    *norms = NULL, *r = NULL, *w = NULL;
     REAL    *work = NULL;
+    size_t   mark;
     REAL   **p = NULL, **hh = NULL;
     
     INT   Restart  = MIN(restart, MaxIt);
     INT   Restart1 = Restart + 1;
     LONG  worksize = (Restart+4)*(Restart+n)+1-n;
     
-    /* allocate memory and setup temp work space */
-    work  = (REAL *) fasp_mem_calloc(worksize, sizeof(REAL));
+    /* allocate memory and setup temp work space from the work arena */
+    mark  = fasp_arena_mark(NULL);
+    work  = (REAL *) fasp_arena_calloc(NULL, worksize, sizeof(REAL));
     
     // Output some info for debugging
     if ( PrtLvl > PRINT_NONE ) printf("\nCalling GMRes solver (STR) ...\n");
@@ -1023,7 +1034,7 @@ INT fasp_solver_dstr_pgmres (dSTRmat     *A,
         Restart = Restart - 5;
         Restart1 = Restart + 1;
         worksize = (Restart+4)*(Restart+n)+1-n;
-        work = (REAL *) fasp_mem_calloc(worksize, sizeof(REAL));
+        work = (REAL *) fasp_arena_calloc(NULL, worksize, sizeof(REAL));
     }
     
     if ( work == NULL ) {
@@ -1032,12 +1043,12 @@ INT fasp_solver_dstr_pgmres (dSTRmat     *A,
     }
     
     if ( PrtLvl > PRINT_MIN && Restart < restart ) {
-        printf("### WARNING: GMRES restart number set to %d!\n", Restart);
+        printf("### WARNING: GMRES restart number set to " INTFMT "!\n", Restart);
     }
     
-    p     = (REAL **)fasp_mem_calloc(Restart1, sizeof(REAL *));
-    hh    = (REAL **)fasp_mem_calloc(Restart1, sizeof(REAL *));
-    norms = (REAL *) fasp_mem_calloc(MaxIt+1, sizeof(REAL));
+    p     = (REAL **)fasp_arena_calloc(NULL, Restart1, sizeof(REAL *));
+    hh    = (REAL **)fasp_arena_calloc(NULL, Restart1, sizeof(REAL *));
+    norms = (REAL *) fasp_arena_calloc(NULL, MaxIt+1, sizeof(REAL));
     
     r = work; w = r + n; rs = w + n; c  = rs + Restart1; s  = c + Restart;
     
@@ -1241,10 +1252,7 @@ FINISHED:
     /*-------------------------------------------
      * Clean up workspace
      *------------------------------------------*/
-    fasp_mem_free(work);  work  = NULL;
-    fasp_mem_free(p);     p     = NULL;
-    fasp_mem_free(hh);    hh    = NULL;
-    fasp_mem_free(norms); norms = NULL;
+    fasp_arena_release(NULL, mark);
     
 #if DEBUG_MODE > 0
     printf("### DEBUG: [--End--] %s ...\n", __FUNCTION__);
@@ -1279,6 +1287,7 @@ FINISHED:
  * \date   2010/11/28
  *
  * Modified by Chunsheng Feng on 07/22/2013: Add adapt memory allocate
+ * Modified by FASP team on 10/16/2026: draw work space from the arena
  */
 INT fasp_solver_pgmres (mxv_matfree  *mf,
                         dvector      *b,
@@ -1305,6 +1314,7 @@ INT fasp_solver_pgmres (mxv_matfree  *mf,
     REAL    *c = NULL, *s = NULL, *rs = NULL;
     REAL    *norms = NULL, *r = NULL, *w = NULL;
     REAL    *work = NULL;
+    size_t   mark;
     REAL    **p = NULL, **hh = NULL;
     
     INT  Restart  = restart;
@@ -1319,14 +1329,15 @@ INT fasp_solver_pgmres (mxv_matfree  *mf,
     printf("### DEBUG: maxit = %d, tol = %.4le\n", MaxIt, tol);
 #endif
     
-    /* allocate memory and setup temp work space */
-    work  = (REAL *) fasp_mem_calloc(worksize, sizeof(REAL));
+    /* allocate memory and setup temp work space from the work arena */
+    mark  = fasp_arena_mark(NULL);
+    work  = (REAL *) fasp_arena_calloc(NULL, worksize, sizeof(REAL));
     
     /* check whether memory is enough for GMRES */
     while ( (work == NULL) && (Restart > 5) ) {
         Restart = Restart - 5;
         worksize = (Restart+4)*(Restart+n)+1-n;
-        work = (REAL *) fasp_mem_calloc(worksize, sizeof(REAL));
+        work = (REAL *) fasp_arena_calloc(NULL, worksize, sizeof(REAL));
         Restart1 = Restart + 1;
     }
     
@@ -1336,12 +1347,12 @@ INT fasp_solver_pgmres (mxv_matfree  *mf,
     }
     
     if ( PrtLvl > PRINT_MIN && Restart < restart ) {
-        printf("### WARNING: GMRES restart number set to %d!\n", Restart);
+        printf("### WARNING: GMRES restart number set to " INTFMT "!\n", Restart);
     }
     
-    p     = (REAL **)fasp_mem_calloc(Restart1, sizeof(REAL *));
-    hh    = (REAL **)fasp_mem_calloc(Restart1, sizeof(REAL *));
-    norms = (REAL *)fasp_mem_calloc(MaxIt+1, sizeof(REAL));
+    p     = (REAL **)fasp_arena_calloc(NULL, Restart1, sizeof(REAL *));
+    hh    = (REAL **)fasp_arena_calloc(NULL, Restart1, sizeof(REAL *));
+    norms = (REAL *)fasp_arena_calloc(NULL, MaxIt+1, sizeof(REAL));
     
     r = work; w = r + n; rs = w + n; c  = rs + Restart1; s  = c + Restart;
     
@@ -1374,10 +1385,7 @@ INT fasp_solver_pgmres (mxv_matfree  *mf,
         
         rs[0] = r_norm;
         if (r_norm == 0.0) {
-            fasp_mem_free(work);   work  = NULL;
-            fasp_mem_free(p);      p     = NULL;
-            fasp_mem_free(hh);     hh    = NULL;
-            fasp_mem_free(norms);  norms = NULL;
+            fasp_arena_release(NULL, mark);
             return iter;
         }
         
@@ -1515,10 +1523,7 @@ INT fasp_solver_pgmres (mxv_matfree  *mf,
     /*-------------------------------------------
      * Clean up workspace
      *------------------------------------------*/
-    fasp_mem_free(work);   work  = NULL;
-    fasp_mem_free(p);      p     = NULL;
-    fasp_mem_free(hh);     hh    = NULL;
-    fasp_mem_free(norms);  norms = NULL;
+    fasp_arena_release(NULL, mark);
     
 #if DEBUG_MODE > 0
     printf("### DEBUG: [--End--] %s ...\n", __FUNCTION__);
@@ -58,6 +58,8 @@
  *
  * Rewritten based on the original version by Shiquan Zhang 05/10/2010
  * Modified by Chensong Zhang on 04/09/2013
+ * Modified by FASP team on 10/16/2026: draw work space from the arena
+ * Modified by FASP team on 10/16/2026: fused BLAS1 kernels
  */
 INT fasp_solver_dcsr_pminres (dCSRmat      *A,
                               dvector      *b,
@@ -79,11 +81,14 @@ INT fasp_solver_dcsr_pminres (dCSRmat      *A,
     REAL         normr0  = BIGREAL, relres  = BIGREAL;
     REAL         normu2, normuu, normp, infnormu, factor;
     REAL         alpha, alpha0, alpha1, temp2;
+    REAL         norms[2], dots[2];
     
     // allocate temp memory (need 11*m REAL)
-    REAL *work=(REAL *)fasp_mem_calloc(11*m,sizeof(REAL));
+    const size_t mark = fasp_arena_mark(NULL);
+    REAL *work = (REAL *)fasp_arena_calloc(NULL,11*m,sizeof(REAL));
     REAL *p0=work, *p1=work+m, *p2=p1+m, *z0=p2+m, *z1=z0+m;
     REAL *t0=z1+m, *t1=t0+m, *t=t1+m, *tp=t+m, *tz=tp+m, *r=tz+m;
+    REAL *tmp;
     
     // Output some info for debuging
     if ( PrtLvl > PRINT_NONE ) printf("\nCalling MinRes solver (CSR) ...\n");
@@ -166,24 +171,16 @@ INT fasp_solver_dcsr_pminres (dCSRmat      *A,
         // alpha = <r,z1>
         alpha=fasp_blas_darray_dotprod(m,r,z1);
         
-        // u = u+alpha*p1
-        fasp_blas_darray_axpy(m,alpha,p1,u->val);
-        
-        // r = r-alpha*Ap1
-        fasp_blas_darray_axpy(m,-alpha,t1,r);
+        // u = u+alpha*p1, r = r-alpha*Ap1
+        fasp_blas_darray_axpy2_norm2(m,alpha,p1,u->val,-alpha,t1,r,norms);
         
-        // compute t = A*z1 alpha1 = <z1,t>
+        // compute t = A*z1 alpha1 = <z1,t>, alpha0 = <z0,t> = <z1,A*z0>
         fasp_blas_dcsr_mxv(A,z1,t);
-        alpha1=fasp_blas_darray_dotprod(m,z1,t);
-        
-        // compute t = A*z0 alpha0 = <z1,t>
-        fasp_blas_dcsr_mxv(A,z0,t);
-        alpha0=fasp_blas_darray_dotprod(m,z1,t);
+        fasp_blas_darray_dotprod2(m,t,z1,z0,dots);
+        alpha1 = dots[0]; alpha0 = dots[1];
         
         // p2 = z1-alpha1*p1-alpha0*p0
-        fasp_darray_cp(m,z1,p2);
-        fasp_blas_darray_axpy(m,-alpha1,p1,p2);
-        fasp_blas_darray_axpy(m,-alpha0,p0,p2);
+        fasp_blas_darray_axpbypcz(m,1.0,z1,-alpha1,p1,-alpha0,p0,p2);
         
         // tp = A*p2
         fasp_blas_dcsr_mxv(A,p2,tp);
@@ -197,29 +194,23 @@ INT fasp_solver_dcsr_pminres (dCSRmat      *A,
         // p2 = p2/normp
         normp = ABS(fasp_blas_darray_dotprod(m,tz,tp));
         normp = sqrt(normp);
-        fasp_darray_cp(m,p2,t);
-        fasp_darray_set(m,p2,0.0);
-        fasp_blas_darray_axpy(m,1/normp,t,p2);
+        fasp_blas_darray_ax(m,1/normp,p2);
         
-        // prepare for next iteration
-        fasp_darray_cp(m,p1,p0);
-        fasp_darray_cp(m,p2,p1);
-        fasp_darray_cp(m,t1,t0);
-        fasp_darray_cp(m,z1,z0);
+        // prepare for next iteration: p0 = p1, p1 = p2, t0 = t1, z0 = z1
+        tmp = p0; p0 = p1; p1 = p2; p2 = tmp;
+        tmp = t0; t0 = t1; t1 = tp; tp = tmp;
+        tmp = z0; z0 = z1; z1 = tz; tz = tmp;
         
         // t1=tp/normp,z1=tz/normp
-        fasp_darray_set(m,t1,0.0);
-        fasp_darray_cp(m,t1,z1);
-        fasp_blas_darray_axpy(m,1/normp,tp,t1);
-        fasp_blas_darray_axpy(m,1/normp,tz,z1);
+        fasp_blas_darray_ax(m,1/normp,t1);
+        fasp_blas_darray_ax(m,1/normp,z1);
         
-        normu2 = fasp_blas_darray_norm2(m,u->val);
+        normu2 = norms[0];
         
         // compute residuals
         switch ( StopType ) {
             case STOP_REL_RES:
-                temp2  = fasp_blas_darray_dotprod(m,r,r);
-                absres = sqrt(temp2);
+                absres = norms[1];
                 relres = absres/normr0;
                 break;
             case STOP_REL_PRECRES:
@@ -232,8 +223,7 @@ INT fasp_solver_dcsr_pminres (dCSRmat      *A,
                 relres = absres/normr0;
                 break;
             case STOP_MOD_REL_RES:
-                temp2  = fasp_blas_darray_dotprod(m,r,r);
-                absres = sqrt(temp2);
+                absres = norms[1];
                 relres = absres/normu2;
                 break;
         }
@@ -436,7 +426,7 @@ FINISHED:  // finish iterative method
     if ( PrtLvl > PRINT_NONE ) ITS_FINAL(iter,MaxIt,relres);
     
     // clean up temp memory
-    fasp_mem_free(work); work = NULL;
+    fasp_arena_release(NULL,mark); work = NULL;
 
 #if DEBUG_MODE > 0
     printf("### DEBUG: [--End--] %s ...\n", __FUNCTION__);
@@ -471,6 +461,8 @@ FINISHED:  // finish iterative method
  *
  * Rewritten based on the original version by Xiaozhe Hu 05/24/2010
  * Modified by Chensong Zhang on 04/09/2013
+ * Modified by FASP team on 10/16/2026: draw work space from the arena
+ * Modified by FASP team on 10/16/2026: fused BLAS1 kernels
  */
 INT fasp_solver_dblc_pminres (dBLCmat     *A,
                               dvector     *b,
@@ -492,11 +484,14 @@ INT fasp_solver_dblc_pminres (dBLCmat     *A,
     REAL         normr0  = BIGREAL, relres  = BIGREAL;
     REAL         normu2, normuu, normp, infnormu, factor;
     REAL         alpha, alpha0, alpha1, temp2;
+    REAL         norms[2], dots[2];
     
     // allocate temp memory (need 11*m REAL)
-    REAL *work=(REAL *)fasp_mem_calloc(11*m,sizeof(REAL));
+    const size_t mark = fasp_arena_mark(NULL);
+    REAL *work = (REAL *)fasp_arena_calloc(NULL,11*m,sizeof(REAL));
     REAL *p0=work, *p1=work+m, *p2=p1+m, *z0=p2+m, *z1=z0+m;
     REAL *t0=z1+m, *t1=t0+m, *t=t1+m, *tp=t+m, *tz=tp+m, *r=tz+m;
+    REAL *tmp;
     
     // Output some info for debuging
     if ( PrtLvl > PRINT_NONE ) printf("\nCalling MinRes solver (BLC) ...\n");
@@ -579,24 +574,16 @@ INT fasp_solver_dblc_pminres (dBLCmat     *A,
         // alpha = <r,z1>
         alpha=fasp_blas_darray_dotprod(m,r,z1);
         
-        // u = u+alpha*p1
-        fasp_blas_darray_axpy(m,alpha,p1,u->val);
-        
-        // r = r-alpha*Ap1
-        fasp_blas_darray_axpy(m,-alpha,t1,r);
+        // u = u+alpha*p1, r = r-alpha*Ap1
+        fasp_blas_darray_axpy2_norm2(m,alpha,p1,u->val,-alpha,t1,r,norms);
         
-        // compute t = A*z1 alpha1 = <z1,t>
+        // compute t = A*z1 alpha1 = <z1,t>, alpha0 = <z0,t> = <z1,A*z0>
         fasp_blas_dblc_mxv(A,z1,t);
-        alpha1=fasp_blas_darray_dotprod(m,z1,t);
-        
-        // compute t = A*z0 alpha0 = <z1,t>
-        fasp_blas_dblc_mxv(A,z0,t);
-        alpha0=fasp_blas_darray_dotprod(m,z1,t);
+        fasp_blas_darray_dotprod2(m,t,z1,z0,dots);
+        alpha1 = dots[0]; alpha0 = dots[1];
         
         // p2 = z1-alpha1*p1-alpha0*p0
-        fasp_darray_cp(m,z1,p2);
-        fasp_blas_darray_axpy(m,-alpha1,p1,p2);
-        fasp_blas_darray_axpy(m,-alpha0,p0,p2);
+        fasp_blas_darray_axpbypcz(m,1.0,z1,-alpha1,p1,-alpha0,p0,p2);
         
         // tp = A*p2
         fasp_blas_dblc_mxv(A,p2,tp);
@@ -610,29 +597,23 @@ INT fasp_solver_dblc_pminres (dBLCmat     *A,
         // p2 = p2/normp
         normp = ABS(fasp_blas_darray_dotprod(m,tz,tp));
         normp = sqrt(normp);
-        fasp_darray_cp(m,p2,t);
-        fasp_darray_set(m,p2,0.0);
-        fasp_blas_darray_axpy(m,1/normp,t,p2);
+        fasp_blas_darray_ax(m,1/normp,p2);
         
-        // prepare for next iteration
-        fasp_darray_cp(m,p1,p0);
-        fasp_darray_cp(m,p2,p1);
-        fasp_darray_cp(m,t1,t0);
-        fasp_darray_cp(m,z1,z0);
+        // prepare for next iteration: p0 = p1, p1 = p2, t0 = t1, z0 = z1
+        tmp = p0; p0 = p1; p1 = p2; p2 = tmp;
+        tmp = t0; t0 = t1; t1 = tp; tp = tmp;
+        tmp = z0; z0 = z1; z1 = tz; tz = tmp;
         
         // t1=tp/normp,z1=tz/normp
-        fasp_darray_set(m,t1,0.0);
-        fasp_darray_cp(m,t1,z1);
-        fasp_blas_darray_axpy(m,1/normp,tp,t1);
-        fasp_blas_darray_axpy(m,1/normp,tz,z1);
+        fasp_blas_darray_ax(m,1/normp,t1);
+        fasp_blas_darray_ax(m,1/normp,z1);
         
-        normu2 = fasp_blas_darray_norm2(m,u->val);
+        normu2 = norms[0];
         
         // compute residuals
         switch ( StopType ) {
             case STOP_REL_RES:
-                temp2  = fasp_blas_darray_dotprod(m,r,r);
-                absres = sqrt(temp2);
+                absres = norms[1];
                 relres = absres/normr0;
                 break;
             case STOP_REL_PRECRES:
@@ -645,8 +626,7 @@ INT fasp_solver_dblc_pminres (dBLCmat     *A,
                 relres = absres/normr0;
                 break;
             case STOP_MOD_REL_RES:
-                temp2  = fasp_blas_darray_dotprod(m,r,r);
-                absres = sqrt(temp2);
+                absres = norms[1];
                 relres = absres/normu2;
                 break;
         }
@@ -849,7 +829,7 @@ FINISHED:  // finish iterative method
     if ( PrtLvl > PRINT_NONE ) ITS_FINAL(iter,MaxIt,relres);
     
     // clean up temp memory
-    fasp_mem_free(work); work = NULL;
+    fasp_arena_release(NULL,mark); work = NULL;
 
 #if DEBUG_MODE > 0
     printf("### DEBUG: [--End--] %s ...\n", __FUNCTION__);
@@ -881,6 +861,9 @@ FINISHED:  // finish iterative method
  *
  * \author Chensong Zhang
  * \date   04/09/2013
+ *
+ * Modified by FASP team on 10/16/2026: draw work space from the arena
+ * Modified by FASP team on 10/16/2026: fused BLAS1 kernels
  */
 INT fasp_solver_dstr_pminres (dSTRmat      *A,
                               dvector      *b,
@@ -902,11 +885,14 @@ INT fasp_solver_dstr_pminres (dSTRmat      *A,
     REAL         normr0  = BIGREAL, relres  = BIGREAL;
     REAL         normu2, normuu, normp, infnormu, factor;
     REAL         alpha, alpha0, alpha1, temp2;
+    REAL         norms[2], dots[2];
     
     // allocate temp memory (need 11*m REAL)
-    REAL *work=(REAL *)fasp_mem_calloc(11*m,sizeof(REAL));
+    const size_t mark = fasp_arena_mark(NULL);
+    REAL *work = (REAL *)fasp_arena_calloc(NULL,11*m,sizeof(REAL));
     REAL *p0=work, *p1=work+m, *p2=p1+m, *z0=p2+m, *z1=z0+m;
     REAL *t0=z1+m, *t1=t0+m, *t=t1+m, *tp=t+m, *tz=tp+m, *r=tz+m;
+    REAL *tmp;
     
     // Output some info for debuging
     if ( PrtLvl > PRINT_NONE ) printf("\nCalling MinRes solver (STR) ...\n");
@@ -989,24 +975,16 @@ INT fasp_solver_dstr_pminres (dSTRmat      *A,
         // alpha = <r,z1>
         alpha=fasp_blas_darray_dotprod(m,r,z1);
         
-        // u = u+alpha*p1
-        fasp_blas_darray_axpy(m,alpha,p1,u->val);
-        
-        // r = r-alpha*Ap1
-        fasp_blas_darray_axpy(m,-alpha,t1,r);
+        // u = u+alpha*p1, r = r-alpha*Ap1
+        fasp_blas_darray_axpy2_norm2(m,alpha,p1,u->val,-alpha,t1,r,norms);
         
-        // compute t = A*z1 alpha1 = <z1,t>
+        // compute t = A*z1 alpha1 = <z1,t>, alpha0 = <z0,t> = <z1,A*z0>
         fasp_blas_dstr_mxv(A,z1,t);
-        alpha1=fasp_blas_darray_dotprod(m,z1,t);
-        
-        // compute t = A*z0 alpha0 = <z1,t>
-        fasp_blas_dstr_mxv(A,z0,t);
-        alpha0=fasp_blas_darray_dotprod(m,z1,t);
+        fasp_blas_darray_dotprod2(m,t,z1,z0,dots);
+        alpha1 = dots[0]; alpha0 = dots[1];
         
         // p2 = z1-alpha1*p1-alpha0*p0
-        fasp_darray_cp(m,z1,p2);
-        fasp_blas_darray_axpy(m,-alpha1,p1,p2);
-        fasp_blas_darray_axpy(m,-alpha0,p0,p2);
+        fasp_blas_darray_axpbypcz(m,1.0,z1,-alpha1,p1,-alpha0,p0,p2);
         
         // tp = A*p2
         fasp_blas_dstr_mxv(A,p2,tp);
@@ -1020,29 +998,23 @@ INT fasp_solver_dstr_pminres (dSTRmat      *A,
         // p2 = p2/normp
         normp = ABS(fasp_blas_darray_dotprod(m,tz,tp));
         normp = sqrt(normp);
-        fasp_darray_cp(m,p2,t);
-        fasp_darray_set(m,p2,0.0);
-        fasp_blas_darray_axpy(m,1/normp,t,p2);
+        fasp_blas_darray_ax(m,1/normp,p2);
         
-        // prepare for next iteration
-        fasp_darray_cp(m,p1,p0);
-        fasp_darray_cp(m,p2,p1);
-        fasp_darray_cp(m,t1,t0);
-        fasp_darray_cp(m,z1,z0);
+        // prepare for next iteration: p0 = p1, p1 = p2, t0 = t1, z0 = z1
+        tmp = p0; p0 = p1; p1 = p2; p2 = tmp;
+        tmp = t0; t0 = t1; t1 = tp; tp = tmp;
+        tmp = z0; z0 = z1; z1 = tz; tz = tmp;
         
         // t1=tp/normp,z1=tz/normp
-        fasp_darray_set(m,t1,0.0);
-        fasp_darray_cp(m,t1,z1);
-        fasp_blas_darray_axpy(m,1/normp,tp,t1);
-        fasp_blas_darray_axpy(m,1/normp,tz,z1);
+        fasp_blas_darray_ax(m,1/normp,t1);
+        fasp_blas_darray_ax(m,1/normp,z1);
         
-        normu2 = fasp_blas_darray_norm2(m,u->val);
+        normu2 = norms[0];
         
         // compute residuals
         switch ( StopType ) {
             case STOP_REL_RES:
-                temp2  = fasp_blas_darray_dotprod(m,r,r);
-                absres = sqrt(temp2);
+                absres = norms[1];
                 relres = absres/normr0;
                 break;
             case STOP_REL_PRECRES:
@@ -1055,8 +1027,7 @@ INT fasp_solver_dstr_pminres (dSTRmat      *A,
                 relres = absres/normr0;
                 break;
             case STOP_MOD_REL_RES:
-                temp2  = fasp_blas_darray_dotprod(m,r,r);
-                absres = sqrt(temp2);
+                absres = norms[1];
                 relres = absres/normu2;
                 break;
         }
@@ -1258,7 +1229,7 @@ FINISHED:  // finish iterative method
     if ( PrtLvl > PRINT_NONE ) ITS_FINAL(iter,MaxIt,relres);
     
     // clean up temp memory
-    fasp_mem_free(work); work = NULL;
+    fasp_arena_release(NULL,mark); work = NULL;
 
 #if DEBUG_MODE > 0
     printf("### DEBUG: [--End--] %s ...\n", __FUNCTION__);
@@ -1292,6 +1263,8 @@ FINISHED:  // finish iterative method
  * \date   10/24/2010
  *
  * Rewritten by Chensong Zhang on 05/01/2012
+ *
+ * Modified by FASP team on 10/16/2026: draw work space from the arena
  */
 INT fasp_solver_pminres (mxv_matfree  *mf,
                          dvector      *b,
@@ -1315,7 +1288,8 @@ INT fasp_solver_pminres (mxv_matfree  *mf,
     REAL         alpha, alpha0, alpha1, temp2;
     
     // allocate temp memory (need 11*m REAL)
-    REAL *work=(REAL *)fasp_mem_calloc(11*m,sizeof(REAL));
+    const size_t mark = fasp_arena_mark(NULL);
+    REAL *work = (REAL *)fasp_arena_calloc(NULL,11*m,sizeof(REAL));
     REAL *p0=work, *p1=work+m, *p2=p1+m, *z0=p2+m, *z1=z0+m;
     REAL *t0=z1+m, *t1=t0+m, *t=t1+m, *tp=t+m, *tz=tp+m, *r=tz+m;
     
@@ -1653,7 +1627,7 @@ FINISHED:  // finish iterative method
     if ( PrtLvl > PRINT_NONE ) ITS_FINAL(iter,MaxIt,relres);
     
     // clean up temp memory
-    fasp_mem_free(work); work = NULL;
+    fasp_arena_release(NULL,mark); work = NULL;
 
 #if DEBUG_MODE > 0
     printf("### DEBUG: [--End--] %s ...\n", __FUNCTION__);
@@ -0,0 +1,469 @@
+/*! \file  KryPpipecg.c
+ *
+ *  \brief Krylov subspace methods -- Pipelined preconditioned CG
+ *
+ *  \note  This file contains Level-3 (Kry) functions. It requires:
+ *         AuxArray.c, AuxMemory.c, AuxMessage.c, AuxThreads.c, BlaArray.c,
+ *         BlaSparseCSR.c, and BlaSpmvCSR.c
+ *
+ *  \note  See KryPcg.c for the standard version
+ *
+ *  Reference:
+ *         P. Ghysels and W. Vanroose 2014
+ *         Hiding global synchronization latency in the preconditioned Conjugate
+ *         Gradient algorithm, Parallel Computing 40(7), 224--238
+ *
+ *---------------------------------------------------------------------------------
+ *  Copyright (C) 2009--Present by the FASP team. All rights reserved.
+ *  Released under the terms of the GNU Lesser General Public License 3.0 or later.
+ *---------------------------------------------------------------------------------
+ *
+ *  Abstract algorithm
+ *
+ *  Pipelined PCG is mathematically equivalent to PCG. It carries the auxiliary
+ *  vectors w = A*z, s = A*p, q = B*s, t = A*q by recurrences, so that all inner
+ *  products of one iteration are computed together:
+ *
+ *  Step 0. Given A, b, x_0, B
+ *
+ *  Step 1. Compute r_0 = b-A*x_0, z_0 = B*r_0, w_0 = A*z_0,
+ *          gamma_0 = (r_0,z_0), delta_0 = (w_0,z_0), and convergence check;
+ *
+ *  Step 2. Main loop ...
+ *
+ *    FOR k = 0:MaxIt
+ *      - compute m_k = B*w_k and n_k = A*m_k;
+ *      - get beta = gamma_k/gamma_{k-1} and
+ *            alpha = gamma_k/(delta_k - beta*gamma_k/alpha_{k-1});
+ *      - update t = n_k + beta*t, q = m_k + beta*q, s = w_k + beta*s,
+ *               p = z_k + beta*p, x = x + alpha*p, r = r - alpha*s,
+ *               z = z - alpha*q, w = w - alpha*t;
+ *      - compute gamma_{k+1}, delta_{k+1}, and norm(r) in the same sweep;
+ *      - perform residual check and stagnation check;
+ *    END FOR
+ *
+ *  All vector updates and reductions of one iteration are done in one parallel
+ *  loop, i.e., there is one global synchronization per iteration instead of three
+ *  in PCG. The price is four more vectors and one more preconditioner application
+ *  at (re)start. Stopping criteria and safe-guard checks are the same as in PCG.
+ */
+
+#include <math.h>
+
+#include "fasp.h"
+#include "fasp_functs.h"
+
+/*---------------------------------*/
+/*--  Declare Private Functions  --*/
+/*---------------------------------*/
+
+#include "KryUtil.inl"
+
+static void pipecg_restart (dCSRmat *, dCSRplan *, dvector *, dvector *, precond *,
+                            REAL *, REAL *, REAL *, REAL *);
+static void pipecg_update (const INT, const REAL, const REAL, REAL *, REAL *,
+                           REAL *, REAL *, REAL *, REAL *, REAL *, REAL *,
+                           const REAL *, const REAL *, REAL *);
+static REAL pipecg_absres (const SHORT, const REAL *);
+
+/*---------------------------------*/
+/*--      Public Functions       --*/
+/*---------------------------------*/
+
+/**
+ * \fn INT fasp_solver_dcsr_ppipecg (dCSRmat *A, dvector *b, dvector *u, precond *pc,
+ *                                   const REAL tol, const INT MaxIt,
+ *                                   const SHORT StopType, const SHORT PrtLvl)
+ *
+ * \brief Pipelined preconditioned conjugate gradient method for solving Au=b
+ *
+ * \param A            Pointer to dCSRmat: coefficient matrix
+ * \param b            Pointer to dvector: right hand side
+ * \param u            Pointer to dvector: unknowns
+ * \param pc           Pointer to precond: structure of precondition
+ * \param tol          Tolerance for stopping
+ * \param MaxIt        Maximal number of iterations
+ * \param StopType     Stopping criteria type
+ * \param PrtLvl       How much information to print out
+ *
+ * \return             Iteration number if converges; ERROR otherwise.
+ *
+ * \author FASP team
+ * \date   10/16/2026
+ *
+ * \note The residual norm is obtained from the fused reduction, so it is the norm
+ *       of the recursively updated residual. It is checked against the true
+ *       residual before returning, as in PCG.
+ */
+INT fasp_solver_dcsr_ppipecg (dCSRmat     *A,
+                              dvector     *b,
+                              dvector     *u,
+                              precond     *pc,
+                              const REAL   tol,
+                              const INT    MaxIt,
+                              const SHORT  StopType,
+                              const SHORT  PrtLvl)
+{
+    const SHORT  MaxStag = MAX_STAG, MaxRestartStep = MAX_RESTART;
+    const INT    m = b->row;
+    const REAL   maxdiff = tol*STAG_RATIO; // stagnation tolerance
+    const REAL   sol_inf_tol = SMALLREAL; // infinity norm tolerance
+
+    // local variables
+    INT          iter = 0, stag = 1, more_step = 1;
+    SHORT        restart = TRUE; // beta = 0 at (re)start of the recurrences
+    REAL         absres0 = BIGREAL, absres = BIGREAL;
+    REAL         relres  = BIGREAL, normu  = BIGREAL, normr0 = BIGREAL;
+    REAL         reldiff, factor, normuinf;
+    REAL         alpha = 1.0, beta, gamma, gamma0 = 1.0, delta, denom;
+    REAL         dots[4]; // (r,z), (w,z), (r,r), (u,u)
+
+    // allocate temp memory (need 9*m REAL numbers) from the work arena
+    // p, s, q, t are set to zero as they are scaled by beta = 0 at start
+    const size_t mark = fasp_arena_mark(NULL);
+    REAL *work = (REAL *)fasp_arena_alloc(NULL,5*m,sizeof(REAL));
+    REAL *rec  = (REAL *)fasp_arena_calloc(NULL,4*m,sizeof(REAL));
+    REAL *r = work, *z = r+m, *w = z+m, *mw = w+m, *amw = mw+m;
+    REAL *p = rec, *s = p+m, *q = s+m, *t = q+m;
+
+    // SpMV plan for A, shared by all matrix-vector products below
+    dCSRplan *Aplan = fasp_dcsr_plan_create(A);
+
+    // Output some info for debugging
+    if ( PrtLvl > PRINT_NONE ) printf("\nCalling pipelined CG solver (CSR) ...\n");
+
+#if DEBUG_MODE > 0
+    printf("### DEBUG: [-Begin-] %s ...\n", __FUNCTION__);
+    printf("### DEBUG: maxit = %d, tol = %.4le\n", MaxIt, tol);
+#endif
+
+    // r = b-A*u, z = B(r), w = A*z, and all inner products
+    pipecg_restart(A,Aplan,b,u,pc,r,z,w,dots);
+
+    // compute initial residuals
+    switch ( StopType ) {
+        case STOP_REL_RES:
+        case STOP_REL_PRECRES:
+            absres0 = pipecg_absres(StopType,dots);
+            normr0  = MAX(SMALLREAL,absres0);
+            relres  = absres0/normr0;
+            break;
+        case STOP_MOD_REL_RES:
+            absres0 = pipecg_absres(StopType,dots);
+            normu   = MAX(SMALLREAL,sqrt(dots[3]));
+            relres  = absres0/normu;
+            break;
+        default:
+            printf("### ERROR: Unknown stopping type! [%s]\n", __FUNCTION__);
+            goto FINISHED;
+    }
+
+    // if initial residual is small, no need to iterate!
+    if ( relres < tol || absres0 < 1e-3*tol ) goto FINISHED;
+
+    // output iteration information if needed
+    fasp_itinfo(PrtLvl,StopType,iter,relres,absres0,0.0);
+
+    // main pipelined PCG loop
+    while ( iter++ < MaxIt ) {
+
+        gamma = dots[0]; delta = dots[1];
+
+        // mw = B(w), amw = A*mw
+        if ( pc != NULL )
+            pc->fct(w,mw,pc->data); /* Apply preconditioner */
+        else
+            fasp_darray_cp(m,w,mw); /* No preconditioner */
+        fasp_blas_dcsr_mxv_plan(A,Aplan,mw,amw);
+
+        // beta_k = gamma_k/gamma_{k-1}, alpha_k = gamma_k/(delta_k-beta_k*gamma_k/alpha_{k-1})
+        if ( restart ) {
+            beta  = 0.0;
+            denom = delta;
+        }
+        else {
+            beta  = gamma/gamma0;
+            denom = delta - beta*gamma/alpha;
+        }
+
+        if ( ABS(denom) > SMALLREAL2 ) {
+            alpha = gamma/denom;
+        }
+        else { // Possible breakdown
+            ITS_DIVZERO; goto FINISHED;
+        }
+
+        gamma0  = gamma;
+        restart = FALSE;
+
+        // update all vectors and compute inner products for next iteration
+        pipecg_update(m,alpha,beta,u->val,r,z,w,p,s,q,t,mw,amw,dots);
+
+        // compute norm of residual
+        absres = pipecg_absres(StopType,dots);
+        if ( StopType == STOP_MOD_REL_RES ) {
+            normu  = MAX(SMALLREAL,sqrt(dots[3]));
+            relres = absres/normu;
+        }
+        else {
+            relres = absres/normr0;
+        }
+
+        // compute reduction factor of residual ||r||
+        factor = absres/absres0;
+
+        // output iteration information if needed
+        fasp_itinfo(PrtLvl,StopType,iter,relres,absres,factor);
+
+        if ( factor > 0.9 ) { // Only check when converge slowly
+
+            // Check I: if solution is close to zero, return ERROR_SOLVER_SOLSTAG
+            normuinf = fasp_blas_darray_norminf(m, u->val);
+            if ( normuinf <= sol_inf_tol ) {
+                if ( PrtLvl > PRINT_MIN ) ITS_ZEROSOL;
+                iter = ERROR_SOLVER_SOLSTAG;
+                break;
+            }
+
+            // Check II: if stagnated, try to restart
+            normu = MAX(SMALLREAL,sqrt(dots[3]));
+
+            // compute relative difference
+            reldiff = ABS(alpha)*fasp_blas_darray_norm2(m,p)/normu;
+            if ( (stag <= MaxStag) & (reldiff < maxdiff) ) {
+
+                if ( PrtLvl >= PRINT_MORE ) {
+                    ITS_DIFFRES(reldiff,relres);
+                    ITS_RESTART;
+                }
+
+                pipecg_restart(A,Aplan,b,u,pc,r,z,w,dots);
+
+                absres = pipecg_absres(StopType,dots);
+                if ( StopType == STOP_MOD_REL_RES ) relres = absres/normu;
+                else relres = absres/normr0;
+
+                if ( PrtLvl >= PRINT_MORE ) ITS_REALRES(relres);
+
+                if ( relres < tol )
+                    break;
+                else {
+                    if ( stag >= MaxStag ) {
+                        if ( PrtLvl > PRINT_MIN ) ITS_STAGGED;
+                        iter = ERROR_SOLVER_STAG;
+                        break;
+                    }
+                    restart = TRUE;
+                    ++stag;
+                }
+
+            } // end of stagnation check!
+
+        } // end of check I and II
+
+        // Check III: prevent false convergence
+        if ( relres < tol ) {
+
+            REAL updated_relres = relres;
+
+            // compute true residual r = b - Ax and restart the recurrences
+            pipecg_restart(A,Aplan,b,u,pc,r,z,w,dots);
+
+            absres = pipecg_absres(StopType,dots);
+            if ( StopType == STOP_MOD_REL_RES ) relres = absres/normu;
+            else relres = absres/normr0;
+
+            // check convergence
+            if ( relres < tol ) break;
+
+            if ( PrtLvl >= PRINT_MORE ) {
+                ITS_COMPRES(updated_relres); ITS_REALRES(relres);
+            }
+
+            if ( more_step >= MaxRestartStep ) {
+                if ( PrtLvl > PRINT_MIN ) ITS_ZEROTOL;
+                iter = ERROR_SOLVER_TOLSMALL;
+                break;
+            }
+
+            // prepare for restarting method
+            restart = TRUE;
+            ++more_step;
+
+        } // end of safe-guard check!
+
+        // save residual for next iteration
+        absres0 = absres;
+
+    } // end of main pipelined PCG loop.
+
+FINISHED:  // finish iterative method
+    if ( PrtLvl > PRINT_NONE ) ITS_FINAL(iter,MaxIt,relres);
+
+    // clean up temp memory
+    fasp_arena_release(NULL,mark); work = rec = NULL;
+    fasp_dcsr_plan_free(Aplan);
+
+#if DEBUG_MODE > 0
+    printf("### DEBUG: [--End--] %s ...\n", __FUNCTION__);
+#endif
+
+    if ( iter > MaxIt )
+        return ERROR_SOLVER_MAXIT;
+    else
+        return iter;
+}
+
+/*---------------------------------*/
+/*--    Private Functions        --*/
+/*---------------------------------*/
+
+/**
+ * \fn static void pipecg_restart (dCSRmat *A, dCSRplan *Aplan, dvector *b,
+ *                                 dvector *u, precond *pc, REAL *r, REAL *z,
+ *                                 REAL *w, REAL *dots)
+ *
+ * \brief Compute r = b-A*u, z = B(r), w = A*z, and the inner products from scratch
+ *
+ * \param A      Pointer to dCSRmat: coefficient matrix
+ * \param Aplan  Pointer to SpMV plan of A
+ * \param b      Pointer to dvector: right hand side
+ * \param u      Pointer to dvector: unknowns
+ * \param pc     Pointer to precond: structure of precondition
+ * \param r      Pointer to residual
+ * \param z      Pointer to preconditioned residual
+ * \param w      Pointer to A*z
+ * \param dots   Inner products (r,z), (w,z), (r,r), (u,u)
+ *
+ * \author FASP team
+ * \date   10/16/2026
+ */
+static void pipecg_restart (dCSRmat   *A,
+                            dCSRplan  *Aplan,
+                            dvector   *b,
+                            dvector   *u,
+                            precond   *pc,
+                            REAL      *r,
+                            REAL      *z,
+                            REAL      *w,
+                            REAL      *dots)
+{
+    const INT   m = b->row;
+    const REAL *x = u->val;
+    REAL        d0 = 0.0, d1 = 0.0, d2 = 0.0, d3 = 0.0;
+    INT         i;
+
+    fasp_darray_cp(m,b->val,r);
+    fasp_blas_dcsr_aAxpy_plan(-1.0,A,Aplan,u->val,r);
+
+    if ( pc != NULL )
+        pc->fct(r,z,pc->data); /* Apply preconditioner */
+    else
+        fasp_darray_cp(m,r,z); /* No preconditioner */
+
+    fasp_blas_dcsr_mxv_plan(A,Aplan,z,w);
+
+#ifdef _OPENMP
+#pragma omp parallel for reduction(+:d0,d1,d2,d3) private(i) if(m>OPENMP_HOLDS)
+#endif
+    for ( i = 0; i < m; ++i ) {
+        d0 += r[i]*z[i];
+        d1 += w[i]*z[i];
+        d2 += r[i]*r[i];
+        d3 += x[i]*x[i];
+    }
+
+    dots[0] = d0; dots[1] = d1; dots[2] = d2; dots[3] = d3;
+}
+
+/**
+ * \fn static void pipecg_update (const INT n, const REAL alpha, const REAL beta,
+ *                                REAL *x, REAL *r, REAL *z, REAL *w, REAL *p,
+ *                                REAL *s, REAL *q, REAL *t, const REAL *mw,
+ *                                const REAL *amw, REAL *dots)
+ *
+ * \brief Fused vector updates and inner products of one pipelined CG iteration
+ *
+ * \param n      Number of variables
+ * \param alpha  Step size
+ * \param beta   Factor for the search direction
+ * \param x      Pointer to solution
+ * \param r      Pointer to residual
+ * \param z      Pointer to preconditioned residual
+ * \param w      Pointer to A*z
+ * \param p      Pointer to search direction
+ * \param s      Pointer to A*p
+ * \param q      Pointer to B*s
+ * \param t      Pointer to A*q
+ * \param mw     Pointer to B*w
+ * \param amw    Pointer to A*B*w
+ * \param dots   Inner products (r,z), (w,z), (r,r), (x,x) of the new vectors
+ *
+ * \author FASP team
+ * \date   10/16/2026
+ *
+ * \note One sweep with one reduction replaces eight axpy and four inner products.
+ */
+static void pipecg_update (const INT    n,
+                           const REAL   alpha,
+                           const REAL   beta,
+                           REAL        *x,
+                           REAL        *r,
+                           REAL        *z,
+                           REAL        *w,
+                           REAL        *p,
+                           REAL        *s,
+                           REAL        *q,
+                           REAL        *t,
+                           const REAL  *mw,
+                           const REAL  *amw,
+                           REAL        *dots)
+{
+    REAL d0 = 0.0, d1 = 0.0, d2 = 0.0, d3 = 0.0;
+    INT  i;
+
+#ifdef _OPENMP
+#pragma omp parallel for reduction(+:d0,d1,d2,d3) private(i) if(n>OPENMP_HOLDS)
+#endif
+    for ( i = 0; i < n; ++i ) {
+        t[i]  = amw[i] + beta*t[i];
+        q[i]  = mw[i]  + beta*q[i];
+        s[i]  = w[i]   + beta*s[i];
+        p[i]  = z[i]   + beta*p[i];
+        x[i] += alpha*p[i];
+        r[i] -= alpha*s[i];
+        z[i] -= alpha*q[i];
+        w[i] -= alpha*t[i];
+        d0   += r[i]*z[i];
+        d1   += w[i]*z[i];
+        d2   += r[i]*r[i];
+        d3   += x[i]*x[i];
+    }
+
+    dots[0] = d0; dots[1] = d1; dots[2] = d2; dots[3] = d3;
+}
+
+/**
+ * \fn static REAL pipecg_absres (const SHORT StopType, const REAL *dots)
+ *
+ * \brief Absolute residual of the given stopping type from the inner products
+ *
+ * \param StopType  Stopping criteria type
+ * \param dots      Inner products (r,z), (w,z), (r,r), (x,x)
+ *
+ * \return          Absolute residual
+ *
+ * \author FASP team
+ * \date   10/16/2026
+ */
+static REAL pipecg_absres (const SHORT  StopType,
+                           const REAL  *dots)
+{
+    if ( StopType == STOP_REL_PRECRES ) return sqrt(ABS(dots[0]));
+
+    return sqrt(ABS(dots[2]));
+}
+
+/*---------------------------------*/
+/*--        End of File          --*/
+/*---------------------------------*/
@@ -131,7 +131,7 @@ INT fasp_solver_dcsr_pvfgmres (dCSRmat      *A,
     }
 
     if ( PrtLvl > PRINT_MIN && Restart < restart ) {
-        printf("### WARNING: vFGMRES restart number set to %d!\n", Restart);
+        printf("### WARNING: vFGMRES restart number set to " INTFMT "!\n", Restart);
     }
 
     p  = (REAL **)fasp_mem_calloc(Restart1, sizeof(REAL *));
@@ -453,7 +453,7 @@ INT fasp_solver_dbsr_pvfgmres (dBSRmat      *A,
     }
 
     if ( PrtLvl > PRINT_MIN && Restart < restart ) {
-        printf("### WARNING: vFGMRES restart number set to %d!\n", Restart);
+        printf("### WARNING: vFGMRES restart number set to " INTFMT "!\n", Restart);
     }
 
     p  = (REAL **)fasp_mem_calloc(Restart1, sizeof(REAL *));
@@ -778,7 +778,7 @@ INT fasp_solver_dblc_pvfgmres (dBLCmat     *A,
     }
     
     if ( PrtLvl > PRINT_MIN && Restart < restart ) {
-        printf("### WARNING: vFGMRES restart number set to %d!\n", Restart);
+        printf("### WARNING: vFGMRES restart number set to " INTFMT "!\n", Restart);
     }
     
     p  = (REAL **)fasp_mem_calloc(Restart1, sizeof(REAL *));
@@ -1101,7 +1101,7 @@ INT fasp_solver_pvfgmres (mxv_matfree  *mf,
     }
     
     if ( PrtLvl > PRINT_MIN && Restart < restart ) {
-        printf("### WARNING: vFGMRES restart number set to %d!\n", Restart);
+        printf("### WARNING: vFGMRES restart number set to " INTFMT "!\n", Restart);
     }
     
     p  = (REAL **)fasp_mem_calloc(Restart1, sizeof(REAL *));
@@ -133,7 +133,7 @@ INT fasp_solver_dcsr_pvgmres (dCSRmat      *A,
     }
     
     if ( PrtLvl > PRINT_MIN && Restart < restart ) {
-        printf("### WARNING: vGMRES restart number set to %d!\n", Restart);
+        printf("### WARNING: vGMRES restart number set to " INTFMT "!\n", Restart);
     }
     
     p     = (REAL **)fasp_mem_calloc(Restart1, sizeof(REAL *));
@@ -480,7 +480,7 @@ INT fasp_solver_dbsr_pvgmres (dBSRmat      *A,
     }
 
     if ( PrtLvl > PRINT_MIN && Restart < restart ) {
-        printf("### WARNING: vGMRES restart number set to %d!\n", Restart);
+        printf("### WARNING: vGMRES restart number set to " INTFMT "!\n", Restart);
     }
 
     p     = (REAL **)fasp_mem_calloc(Restart1, sizeof(REAL *));
@@ -824,7 +824,7 @@ INT fasp_solver_dblc_pvgmres (dBLCmat     *A,
     }
     
     if ( PrtLvl > PRINT_MIN && Restart < restart ) {
-        printf("### WARNING: vGMRES restart number set to %d!\n", Restart);
+        printf("### WARNING: vGMRES restart number set to " INTFMT "!\n", Restart);
     }
     
     p     = (REAL **)fasp_mem_calloc(Restart1, sizeof(REAL *));
@@ -1171,7 +1171,7 @@ INT fasp_solver_dstr_pvgmres (dSTRmat      *A,
     }
     
     if ( PrtLvl > PRINT_MIN && Restart < restart ) {
-        printf("### WARNING: vGMRES restart number set to %d!\n", Restart);
+        printf("### WARNING: vGMRES restart number set to " INTFMT "!\n", Restart);
     }
     
     p     = (REAL **)fasp_mem_calloc(Restart1, sizeof(REAL *));
@@ -1516,7 +1516,7 @@ INT fasp_solver_pvgmres (mxv_matfree  *mf,
     }
     
     if ( PrtLvl > PRINT_MIN && Restart < restart ) {
-        printf("### WARNING: vGMRES restart number set to %d!\n", Restart);
+        printf("### WARNING: vGMRES restart number set to " INTFMT "!\n", Restart);
     }
     
     p  = (REAL **)fasp_mem_calloc(Restart1, sizeof(REAL *));
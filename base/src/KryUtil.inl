@@ -50,7 +50,7 @@
 #define ITS_SMALLSP printf("### WARNING: sp is too small! [%s:%d]\n", __FUNCTION__, __LINE__)
 
 //! Warning for restore previous iteration 
-#define ITS_RESTORE(iter) printf("### WARNING: Discard current iteration. Restore iteration %d!\n", (iter));
+#define ITS_RESTORE(iter) printf("### WARNING: Discard current iteration. Restore iteration " INTFMT "!\n", (iter));
 
 //! Output relative difference and residual
 #define ITS_DIFFRES(reldiff,relres) printf("||u-u'|| = %e and the comp. rel. res. = %e.\n",(reldiff), (relres));
@@ -95,11 +95,11 @@ static inline void ITS_CHECK (const INT MaxIt, const REAL tol)
 static inline void ITS_FINAL (const INT iter, const INT MaxIt, const REAL relres)
 {
     if ( iter > MaxIt ) {
-        printf("### WARNING: MaxIt = %d reached with relative residual %e.\n",
+        printf("### WARNING: MaxIt = " INTFMT " reached with relative residual %e.\n",
                MaxIt, relres);
     }
     else if ( iter >= 0 ) {
-        printf("Number of iterations = %d with relative residual %e.\n",
+        printf("Number of iterations = " INTFMT " with relative residual %e.\n",
                iter, relres);
     }
 }
@@ -3,8 +3,7 @@
  *  \brief Utilities for aggregation methods
  *
  *  \note  This file contains Level-4 (Pre) functions, which are used in:
- *         PreAMGSetupSA.c, PreAMGSetupUA.c, PreAMGSetupSABSR.c, 
- *         and PreAMGSetupUABSR.c
+ *         PreAMGSetupSA.c, PreAMGSetupUA.c, and PreAMGSetupUABSR.c
  *
  *---------------------------------------------------------------------------------
  *  Copyright (C) 2012--2020 by the FASP team. All rights reserved.
@@ -18,10 +17,80 @@
 #include <omp.h>
 #endif
 
+/*! \brief States of vertices in the distance-2 MIS aggregation */
+#define MIS2_OUT        0  /**< not a root */
+#define MIS2_UNDECIDED  1  /**< undecided */
+#define MIS2_IN         2  /**< root of an aggregate */
+
+/*! \brief State of a key in the distance-2 MIS aggregation */
+#define MIS2_STATE(key) ((INT)((key).w >> 32))
+
+/*! \brief Ordering key of a vertex in the distance-2 MIS aggregation */
+typedef struct {
+    unsigned long long w;  /**< state (high word) and pseudo-random weight */
+    INT                i;  /**< index of the vertex */
+} MIS2_key;
+
 /*---------------------------------*/
 /*--      Private Functions      --*/
 /*---------------------------------*/
 
+/**
+ * \fn static void strong_neighbors (const dCSRmat *A, const REAL strongly_coupled,
+ *                                   dCSRmat *Neigh)
+ *
+ * \brief Form the strongly coupled neighborhoods of all vertices
+ *
+ * \param A                 Pointer to the coefficient matrices
+ * \param strongly_coupled  Strength threshold
+ * \param Neigh             Pointer to strongly coupled neighbors (output)
+ *
+ * \author FASP team
+ * \date   10/16/2026
+ *
+ * \note j is a strong neighbor of i if j == i or a_ij^2 >= theta^2 |a_ii a_jj|,
+ *       see fasp_dcsr_strength with STRENGTH_SYM. The entries of A are kept.
+ *
+ * Modified by FASP team on 10/16/2026: use the shared strength graph
+ */
+static void strong_neighbors (const dCSRmat  *A,
+                              const REAL      strongly_coupled,
+                              dCSRmat        *Neigh)
+{
+    const INT    row = A->row;
+    const INT  * AIA = A->IA, * AJA = A->JA;
+    const REAL * Aval = A->val;
+
+    INT     i, j, k;
+    REAL  * Nval;
+    iCSRmat S;
+#ifdef _OPENMP
+    const SHORT use_openmp = ( row > OPENMP_HOLDS );
+#endif
+
+    fasp_dcsr_strength(A, STRENGTH_SYM, strongly_coupled, 0.0, &S, NULL);
+
+    Nval = (REAL *)fasp_mem_calloc(MAX(S.nnz,1), sizeof(REAL));
+
+    // copy the entries of A: rows of S are ordered subsequences of rows of A
+#ifdef _OPENMP
+#pragma omp parallel for private(i, j, k) if (use_openmp)
+#endif
+    for ( i = 0; i < row; ++i ) {
+        k = S.IA[i];
+        for ( j = AIA[i]; j < AIA[i+1] && k < S.IA[i+1]; ++j ) {
+            if ( AJA[j] == S.JA[k] ) Nval[k++] = Aval[j];
+        }
+    }
+
+    Neigh->row = S.row;
+    Neigh->col = S.col;
+    Neigh->nnz = S.nnz;
+    Neigh->IA  = S.IA;
+    Neigh->JA  = S.JA;
+    Neigh->val = Nval;
+}
+
 /**
  * \fn static SHORT aggregation_vmb (dCSRmat *A, ivector *vertices, AMG_param *param,
  *                                   const INT NumLevels, dCSRmat *Neigh, 
@@ -44,6 +113,8 @@
  *       "Algebraic Multigrid on Unstructured Meshes", 1994
  *
  * Modified by Zheng Li, Chensong Zhang on 07/29/2014
+ * Modified by FASP team on 10/16/2026: form the neighborhood with OpenMP
+ * Modified by FASP team on 10/16/2026: work space from the work arena.
  */
 static SHORT aggregation_vmb (dCSRmat    *A,
                               ivector    *vertices,
@@ -52,9 +123,8 @@ static SHORT aggregation_vmb (dCSRmat    *A,
                               dCSRmat    *Neigh,
                               INT        *NumAggregates)
 {
-    const INT    row = A->row, col = A->col, nnz = A->IA[row]-A->IA[0];
-    const INT  * AIA = A->IA, * AJA = A->JA;
-    const REAL * Aval = A->val;
+    const INT    row = A->row;
+    const INT  * AIA = A->IA;
     const INT    max_aggregation = param->max_aggregation;
     
     // return status
@@ -65,13 +135,9 @@ static SHORT aggregation_vmb (dCSRmat    *A,
     INT    subset, count;
     INT  * num_each_agg;
     
-    REAL   strongly_coupled, strongly_coupled2;
-    INT    i, j, index, row_start, row_end;
+    REAL   strongly_coupled;
+    INT    i, j, row_start, row_end;
     INT  * NIA, * NJA;
-    REAL * Nval;
-    
-    dvector diag;
-    fasp_dcsr_getdiag(0, A, &diag);  // get the diagonal entries
     
     if ( GE(param->tentative_smooth, SMALLREAL) ) {
         strongly_coupled = param->strong_coupled * pow(0.5, NumLevels-1);
@@ -79,45 +145,15 @@ static SHORT aggregation_vmb (dCSRmat    *A,
     else {
         strongly_coupled = param->strong_coupled;
     }
-    strongly_coupled2 = pow(strongly_coupled,2);
     
     /*------------------------------------------*/
     /*    Form strongly coupled neighborhood    */
     /*------------------------------------------*/
-    fasp_dcsr_alloc(row, col, nnz, Neigh);
-    
-    NIA  = Neigh->IA;
-    NJA  = Neigh->JA;
-    Nval = Neigh->val;
-    
-#ifdef _OPENMP
-#pragma omp parallel for if(row>OPENMP_HOLDS)
-#endif
-    for ( i = row; i >= 0; i-- ) NIA[i] = AIA[i];
-    
-    for ( index = i = 0; i < row; ++i ) {
-        NIA[i] = index;
-        row_start = AIA[i]; row_end = AIA[i+1];
-        for ( j = row_start; j < row_end; ++j ) {
-            if ( (AJA[j] == i)
-                || (pow(Aval[j],2) >= strongly_coupled2*ABS(diag.val[i]*diag.val[AJA[j]]))) {
-                NJA[index] = AJA[j];
-                Nval[index] = Aval[j];
-                index++;
-            }
-        }
-    }
-    NIA[row] = index;
-    
-    Neigh->nnz = index;
-    Neigh->JA  = (INT*) fasp_mem_realloc(Neigh->JA,  (Neigh->IA[row])*sizeof(INT));
-    Neigh->val = (REAL*)fasp_mem_realloc(Neigh->val, (Neigh->IA[row])*sizeof(REAL));
-    
+    strong_neighbors(A, strongly_coupled, Neigh);
+
     NIA  = Neigh->IA;
     NJA  = Neigh->JA;
 
-    fasp_dvec_free(&diag);
-    
     /*------------------------------------------*/
     /*             Initialization               */
     /*------------------------------------------*/
@@ -163,13 +199,14 @@ static SHORT aggregation_vmb (dCSRmat    *A,
     /*-------------*/
     /*   Step 2.   */
     /*-------------*/
-    INT *temp_C = (INT*)fasp_mem_calloc(row,sizeof(INT));
+    const size_t mark = fasp_arena_mark(NULL);
+    INT *temp_C = (INT*)fasp_arena_calloc(NULL,row,sizeof(INT));
     
     if ( *NumAggregates < MIN_CDOF ) {
         status = ERROR_AMG_COARSEING; goto END;
     }
     
-    num_each_agg = (INT*)fasp_mem_calloc(*NumAggregates,sizeof(INT));
+    num_each_agg = (INT*)fasp_arena_calloc(NULL,*NumAggregates,sizeof(INT));
     
     //for ( i = 0; i < *NumAggregates; i++ ) num_each_agg[i] = 0; // initialize
     
@@ -217,14 +254,330 @@ static SHORT aggregation_vmb (dCSRmat    *A,
         }
     }
     
-    fasp_mem_free(num_each_agg); num_each_agg = NULL;
-    
 END:
-    fasp_mem_free(temp_C); temp_C = NULL;
+    fasp_arena_release(NULL,mark); temp_C = num_each_agg = NULL;
     
     return status;
 }
 
+/**
+ * \fn static inline void mis2_key (const INT state, const INT i, MIS2_key *key)
+ *
+ * \brief Ordering key of vertex i in the distance-2 MIS aggregation
+ *
+ * \param state   State of vertex i: MIS2_OUT, MIS2_UNDECIDED, or MIS2_IN
+ * \param i       Index of the vertex
+ * \param key     Pointer to the key, ordered by the state, a pseudo-random
+ *                weight, and the index (output)
+ *
+ * \author FASP team
+ * \date   10/16/2026
+ *
+ * \note The weight is a hash of the index, so the aggregates do not depend on
+ *       the number of threads. The index is kept in a word of its own, so all
+ *       values of INT are allowed.
+ *
+ * Modified by FASP team on 10/16/2026: keep the index in a separate word
+ */
+static inline void mis2_key (const INT   state,
+                             const INT   i,
+                             MIS2_key   *key)
+{
+    const unsigned long long u = (unsigned long long)i;
+    unsigned int h = (unsigned int)(u ^ (u >> 32));
+
+    h = (h ^ 61) ^ (h >> 16);
+    h += h << 3;
+    h ^= h >> 4;
+    h *= 0x27d4eb2d;
+    h ^= h >> 15;
+
+    key->w = ((unsigned long long)state << 32) | (unsigned long long)h;
+    key->i = i;
+}
+
+/**
+ * \fn static inline SHORT mis2_less (const MIS2_key *a, const MIS2_key *b)
+ *
+ * \brief Compare two keys of the distance-2 MIS aggregation
+ *
+ * \param a   Pointer to the first key
+ * \param b   Pointer to the second key
+ *
+ * \return    TRUE if a < b; otherwise FALSE
+ *
+ * \author FASP team
+ * \date   10/16/2026
+ */
+static inline SHORT mis2_less (const MIS2_key  *a,
+                               const MIS2_key  *b)
+{
+    return ( a->w < b->w || ( a->w == b->w && a->i < b->i ) );
+}
+
+/**
+ * \fn static INT mis2_cap (const INT row, INT *vals, const INT *old,
+ *                          INT *size, const INT max_aggregation)
+ *
+ * \brief Undo the joins of vertices which exceed the size limit of aggregates
+ *
+ * \param row              Number of vertices
+ * \param vals             Aggregate of each vertex, -2 if not aggregated yet
+ * \param old              Aggregates before the joins
+ * \param size             Sizes of the aggregates (IN: before, OUT: after the joins)
+ * \param max_aggregation  Maximal size of an aggregate
+ *
+ * \return                 Number of the joins which are undone
+ *
+ * \author FASP team
+ * \date   10/16/2026
+ *
+ * \note The joins are kept in the order of the vertices, so the aggregates do
+ *       not depend on the number of threads.
+ */
+static INT mis2_cap (const INT   row,
+                     INT        *vals,
+                     const INT  *old,
+                     INT        *size,
+                     const INT   max_aggregation)
+{
+    INT i, num_undone = 0;
+
+    for ( i = 0; i < row; ++i ) {
+        if ( old[i] != -2 || vals[i] < 0 ) continue;
+        if ( size[vals[i]] < max_aggregation ) {
+            size[vals[i]]++;
+        }
+        else {
+            vals[i] = -2; num_undone++;
+        }
+    }
+
+    return num_undone;
+}
+
+/**
+ * \fn static SHORT aggregation_mis2 (dCSRmat *A, ivector *vertices, AMG_param *param,
+ *                                    const INT NumLevels, dCSRmat *Neigh,
+ *                                    INT *NumAggregates)
+ *
+ * \brief Form aggregation by distance-2 maximal independent sets (OpenMP)
+ *
+ * \param A                 Pointer to the coefficient matrices
+ * \param vertices          Pointer to the aggregation of vertices
+ * \param param             Pointer to AMG parameters
+ * \param NumLevels         Level number
+ * \param Neigh             Pointer to strongly coupled neighbors
+ * \param NumAggregates     Pointer to number of aggregations
+ *
+ * \author FASP team
+ * \date   10/16/2026
+ *
+ * \note The roots of the aggregates form a maximal independent set of the
+ *       strongly coupled graph squared, which is found by Luby-type rounds:
+ *       an undecided vertex joins the set if its key is the largest one within
+ *       distance two. Other vertices join a neighboring root and then a
+ *       neighboring aggregate. Every round only reads the keys of the previous
+ *       one, so these steps are parallel. The joins beyond param->max_aggregation
+ *       are undone in a sequential pass, and the vertices left form new
+ *       aggregates of at most param->max_aggregation vertices.
+ *       Refer to N. Bell, S. Dalton, and L. Olson, "Exposing fine-grained
+ *       parallelism in algebraic multigrid methods", SISC, 34 (2012).
+ *
+ * \note MIS2 is not the default aggregation. It is meant for many threads, and
+ *       it costs iterations: the aggregates have a diameter of up to four and
+ *       are larger than those of VMB. For nos7 (729 unknowns), UA AMG with GS
+ *       needs 27 V-cycles with MIS2 and 19 with VMB (24 and 18 with
+ *       max_aggregation = 9). Merging the small aggregates into their neighbors
+ *       makes the aggregates even larger and the convergence slower.
+ *
+ * Modified by FASP team on 10/16/2026: respect param->max_aggregation
+ */
+static SHORT aggregation_mis2 (dCSRmat    *A,
+                               ivector    *vertices,
+                               AMG_param  *param,
+                               const INT   NumLevels,
+                               dCSRmat    *Neigh,
+                               INT        *NumAggregates)
+{
+    const INT    row = A->row;
+    const INT  * AIA = A->IA;
+    const INT    max_aggregation = MAX(param->max_aggregation, 1);
+    const size_t mark = fasp_arena_mark(NULL);
+
+    // return status
+    SHORT  status = FASP_SUCCESS;
+
+    // local variables
+    INT    i, j, k, count, num_undecided = 0;
+    INT  * NIA, * NJA, * vals, * temp_C, * size;
+    REAL   strongly_coupled;
+    MIS2_key *key, *key1, *key2, m;
+#ifdef _OPENMP
+    const SHORT use_openmp = ( row > OPENMP_HOLDS );
+#endif
+
+    if ( GE(param->tentative_smooth, SMALLREAL) ) {
+        strongly_coupled = param->strong_coupled * pow(0.5, NumLevels-1);
+    }
+    else {
+        strongly_coupled = param->strong_coupled;
+    }
+
+    /*------------------------------------------*/
+    /*    Form strongly coupled neighborhood    */
+    /*------------------------------------------*/
+    strong_neighbors(A, strongly_coupled, Neigh);
+
+    NIA  = Neigh->IA;
+    NJA  = Neigh->JA;
+
+    /*------------------------------------------*/
+    /*             Initialization               */
+    /*------------------------------------------*/
+    fasp_ivec_alloc(row, vertices);
+    vals = vertices->val;
+    *NumAggregates = 0;
+
+    key    = (MIS2_key *)fasp_arena_alloc(NULL, (size_t)3*row, sizeof(MIS2_key));
+    key1   = key + row;
+    key2   = key1 + row;
+    temp_C = (INT *)fasp_arena_alloc(NULL, row, sizeof(INT));
+
+    // isolated vertices (only a diagonal entry) are not aggregated
+#ifdef _OPENMP
+#pragma omp parallel for reduction(+:num_undecided) if (use_openmp)
+#endif
+    for ( i = 0; i < row; ++i ) {
+        if ( (AIA[i+1] - AIA[i]) == 1 ) {
+            mis2_key(MIS2_OUT, i, &key[i]);
+        }
+        else {
+            mis2_key(MIS2_UNDECIDED, i, &key[i]);
+            num_undecided++;
+        }
+    }
+
+    /*-------------*/
+    /*   Step 1.   */
+    /*-------------*/
+    // distance-2 maximal independent set of the undecided vertices
+    while ( num_undecided > 0 ) {
+
+        // largest key in the distance-1 neighborhood
+#ifdef _OPENMP
+#pragma omp parallel for private(j, m) if (use_openmp)
+#endif
+        for ( i = 0; i < row; ++i ) {
+            m = key[i];
+            for ( j = NIA[i]; j < NIA[i+1]; ++j ) {
+                if ( mis2_less(&m, &key[NJA[j]]) ) m = key[NJA[j]];
+            }
+            key1[i] = m;
+        }
+
+        // largest key in the distance-2 neighborhood
+#ifdef _OPENMP
+#pragma omp parallel for private(j, m) if (use_openmp)
+#endif
+        for ( i = 0; i < row; ++i ) {
+            m = key1[i];
+            for ( j = NIA[i]; j < NIA[i+1]; ++j ) {
+                if ( mis2_less(&m, &key1[NJA[j]]) ) m = key1[NJA[j]];
+            }
+            key2[i] = m;
+        }
+
+        num_undecided = 0;
+#ifdef _OPENMP
+#pragma omp parallel for reduction(+:num_undecided) if (use_openmp)
+#endif
+        for ( i = 0; i < row; ++i ) {
+            if ( MIS2_STATE(key[i]) != MIS2_UNDECIDED ) continue;
+            if ( key2[i].i == i )
+                mis2_key(MIS2_IN, i, &key[i]);
+            else if ( MIS2_STATE(key2[i]) == MIS2_IN )
+                mis2_key(MIS2_OUT, i, &key[i]);
+            else
+                num_undecided++;
+        }
+
+    }
+
+    // number the roots in the order of the vertices
+    for ( i = 0; i < row; ++i ) {
+        if ( MIS2_STATE(key[i]) == MIS2_IN )
+            vals[i] = (*NumAggregates)++;
+        else
+            vals[i] = ( (AIA[i+1] - AIA[i]) == 1 ) ? UNPT : -2;
+    }
+
+    if ( *NumAggregates < MIN_CDOF ) {
+        status = ERROR_AMG_COARSEING; goto END;
+    }
+
+    // every aggregate has its root
+    size = (INT *)fasp_arena_alloc(NULL, *NumAggregates, sizeof(INT));
+    fasp_iarray_set(*NumAggregates, size, 1);
+
+    /*-------------*/
+    /*   Step 2.   */
+    /*-------------*/
+    // join a strongly coupled root
+    fasp_iarray_cp(row, vals, temp_C);
+
+#ifdef _OPENMP
+#pragma omp parallel for private(j, k) if (use_openmp)
+#endif
+    for ( i = 0; i < row; ++i ) {
+        if ( vals[i] != -2 ) continue;
+        for ( j = NIA[i]; j < NIA[i+1]; ++j ) {
+            k = NJA[j];
+            if ( MIS2_STATE(key[k]) == MIS2_IN ) { vals[i] = vals[k]; break; }
+        }
+    }
+
+    mis2_cap(row, vals, temp_C, size, max_aggregation);
+
+    /*-------------*/
+    /*   Step 3.   */
+    /*-------------*/
+    // join a strongly coupled aggregate from Step 2 which is not full
+    fasp_iarray_cp(row, vals, temp_C);
+
+#ifdef _OPENMP
+#pragma omp parallel for private(j, k) if (use_openmp)
+#endif
+    for ( i = 0; i < row; ++i ) {
+        if ( vals[i] != -2 ) continue;
+        for ( j = NIA[i]; j < NIA[i+1]; ++j ) {
+            k = temp_C[NJA[j]];
+            if ( k > UNPT && size[k] < max_aggregation ) { vals[i] = k; break; }
+        }
+    }
+
+    mis2_cap(row, vals, temp_C, size, max_aggregation);
+
+    /*-------------*/
+    /*   Step 4.   */
+    /*-------------*/
+    // vertices left by non-symmetric couplings or full aggregates form new ones
+    for ( i = 0; i < row; ++i ) {
+        if ( vals[i] != -2 ) continue;
+        vals[i] = *NumAggregates;
+        count = 1;
+        for ( j = NIA[i]; j < NIA[i+1] && count < max_aggregation; ++j ) {
+            if ( vals[NJA[j]] == -2 ) { vals[NJA[j]] = *NumAggregates; count++; }
+        }
+        (*NumAggregates)++;
+    }
+
+END:
+    fasp_arena_release(NULL, mark);
+
+    return status;
+}
+
 /*---------------------------------*/
 /*--        End of File          --*/
 /*---------------------------------*/
@@ -36,6 +36,8 @@
  *
  * \author Zheng Li, Chensong Zhang
  * \date   12/23/2014
+ *
+ * Modified by FASP team on 10/16/2026: work space from the work arena.
  */
 static void pair_aggregate_init (const dCSRmat  *A,
                                  const SHORT     checkdd,
@@ -51,9 +53,10 @@ static void pair_aggregate_init (const dCSRmat  *A,
     REAL *val = A->val;
     REAL strong_hold, aij, aii, rowsum, absrowsum, max;
 
-    REAL *colsum = (REAL*)fasp_mem_calloc(row, sizeof(REAL));
-    REAL *colmax = (REAL*)fasp_mem_calloc(row, sizeof(REAL));
-    REAL *abscolsum = (REAL*)fasp_mem_calloc(row, sizeof(REAL));
+    const size_t mark = fasp_arena_mark(NULL);
+    REAL *colsum = (REAL*)fasp_arena_calloc(NULL, row, sizeof(REAL));
+    REAL *colmax = (REAL*)fasp_arena_calloc(NULL, row, sizeof(REAL));
+    REAL *abscolsum = (REAL*)fasp_arena_calloc(NULL, row, sizeof(REAL));
 
     strong_hold = kaptg/(kaptg - 2.0);
 
@@ -91,9 +94,8 @@ static void pair_aggregate_init (const dCSRmat  *A,
         }
     }
 
-    fasp_mem_free(colsum);    colsum    = NULL;
-    fasp_mem_free(colmax);    colmax    = NULL;
-    fasp_mem_free(abscolsum); abscolsum = NULL;
+    fasp_arena_release(NULL, mark);
+    colsum = colmax = abscolsum = NULL;
 }
 
 /**
@@ -166,6 +168,8 @@ static void pair_aggregate_init2 (const dCSRmat  *A,
  *
  * \note Refer to Artem Napov and Yvan Notay "An algebraic multigrid
  *       method with guaranteed convergence rate" 2011.
+ *
+ * Modified by FASP team on 10/16/2026: work space from the work arena.
  */
 static void form_pairwise (const dCSRmat  *A,
                            const INT       pair,
@@ -219,7 +223,8 @@ static void form_pairwise (const dCSRmat  *A,
     /* Step 2. compute row sum (off-diagonal) for each vertex  */
     /*---------------------------------------------------------*/
 
-    REAL *s = (REAL *)fasp_mem_calloc(row, sizeof(REAL));
+    const size_t mark = fasp_arena_mark(NULL);
+    REAL *s = (REAL *)fasp_arena_calloc(NULL, row, sizeof(REAL));
 
     for ( i = 0; i < row; i++ ) {
         s[i] = 0.0;
@@ -276,7 +281,7 @@ static void form_pairwise (const dCSRmat  *A,
         *NumAggregates += 1;
     }
 
-    fasp_mem_free(s); s = NULL;
+    fasp_arena_release(NULL, mark); s = NULL;
 }
 
 /**
@@ -765,6 +770,8 @@ static SHORT aggregation_quality (const dCSRmat  *A,
  *
  * \note  Refer to Yvan Notay "Aggregation-based algebraic multigrid
  *        for convection-diffusion equations" 2011.
+ *
+ * Modified by FASP team on 10/16/2026: work space from the work arena.
  */
 static void nsympair_1stpass (const dCSRmat * A,
                               const REAL      k_tg,
@@ -795,7 +802,8 @@ static void nsympair_1stpass (const dCSRmat * A,
     fasp_ivec_alloc(row, vertices);
     fasp_ivec_alloc(2*row, map);
 
-    INT *iperm = (INT *)fasp_mem_calloc(row, sizeof(INT));
+    const size_t mark = fasp_arena_mark(NULL);
+    INT *iperm = (INT *)fasp_arena_calloc(NULL, row, sizeof(INT));
 
     /*---------------------------------------------------------*/
     /* Step 2. compute row sum (off-diagonal) for each vertex  */
@@ -933,7 +941,7 @@ static void nsympair_1stpass (const dCSRmat * A,
 
     *NumAggregates = nc;
 
-    fasp_mem_free(iperm); iperm = NULL;
+    fasp_arena_release(NULL, mark); iperm = NULL;
 }
 
 /**
@@ -960,6 +968,8 @@ static void nsympair_1stpass (const dCSRmat * A,
  *
  * \note  Refer to Yvan Notay "Aggregation-based algebraic multigrid
  *        for convection-diffusion equations" 2011.
+ *
+ * Modified by FASP team on 10/16/2026: work space from the work arena.
  */
 static void nsympair_2ndpass (const dCSRmat  *A,
                               dCSRmat        *tmpA,
@@ -985,15 +995,16 @@ static void nsympair_2ndpass (const dCSRmat  *A,
     REAL mu, aii, ajj, aij, tmp, aji, vals, val = 0;
     REAL del1, del2, eta1, eta2, sig1, sig2, rsi, rsj, epsr,del12;
 
-    Tval  = (REAL*)fasp_mem_calloc(row, sizeof(REAL));
-    Tnode = (INT*)fasp_mem_calloc(row, sizeof(INT));
+    const size_t mark = fasp_arena_mark(NULL);
+    Tval  = (REAL*)fasp_arena_calloc(NULL, row, sizeof(REAL));
+    Tnode = (INT*)fasp_arena_calloc(NULL, row, sizeof(INT));
 
     fasp_ivec_alloc(2*row, map);
     fasp_ivec_alloc(row, vertices);
 
     nc = node = 0;
 
-    REAL *s = (REAL *)fasp_mem_calloc(row, sizeof(REAL));
+    REAL *s = (REAL *)fasp_arena_calloc(NULL, row, sizeof(REAL));
 
     pair_aggregate_init2(A, map1, vertices1, s1, s);
 
@@ -1169,9 +1180,8 @@ static void nsympair_2ndpass (const dCSRmat  *A,
 
     *NumAggregates = nc;
 
-    fasp_mem_free(s);      s     = NULL;
-    fasp_mem_free(Tnode);  Tnode = NULL;
-    fasp_mem_free(Tval);   Tval  = NULL;
+    fasp_arena_release(NULL, mark);
+    s = Tval = NULL; Tnode = NULL;
 }
 
 /**
@@ -1195,6 +1205,7 @@ static void nsympair_2ndpass (const dCSRmat  *A,
  *       "An algebraic multigrid method with guaranteed convergence rate", 2012
  *
  * Modified by Chensong Zhang, Zheng Li on 07/29/2014
+ * Modified by FASP team on 10/16/2026: work space from the work arena.
  */
 static SHORT aggregation_nsympair (AMG_data   *mgl,
                                    AMG_param  *param,
@@ -1214,7 +1225,8 @@ static SHORT aggregation_nsympair (AMG_data   *mgl,
     SHORT      status = FASP_SUCCESS;
 
     ivector  map1, map2;
-    REAL *s = (REAL*)fasp_mem_calloc(ptrA->row, sizeof(REAL));
+    const size_t mark = fasp_arena_mark(NULL);
+    REAL *s = (REAL*)fasp_arena_calloc(NULL, ptrA->row, sizeof(REAL));
 
     for ( i = 1; i <= pair_number; ++i ) {
 
@@ -1278,9 +1290,9 @@ static SHORT aggregation_nsympair (AMG_data   *mgl,
 
     fasp_ivec_free(&map1);
     fasp_ivec_free(&map2);
-    fasp_mem_free(s); s = NULL;
 
 END:
+    fasp_arena_release(NULL, mark); s = NULL;
     return status;
 }
 
@@ -184,9 +184,9 @@ INT fasp_amg_coarsening_cr (const INT   i_0,
                 // printf("cf[%i] = %i\n",i,cf[i]);
             }
             vertices->row=i_n;
-            if ( prtlvl >= PRINT_MORE ) printf("vertices = %i\n",vertices->row);
+            if ( prtlvl >= PRINT_MORE ) printf("vertices = " INTFMT "\n",vertices->row);
             vertices->val= cf;
-            if ( prtlvl >= PRINT_MORE ) printf("nc=%i\n",nc);
+            if ( prtlvl >= PRINT_MORE ) printf("nc=" INTFMT "\n",nc);
             break;
         }
     }
@@ -4,7 +4,7 @@
  *
  *  \note  This file contains Level-4 (Pre) functions. It requires:
  *         AuxArray.c, AuxMemory.c, AuxMessage.c, AuxThreads.c, AuxVector.c,
- *         BlaSparseCSR.c, and PreAMGCoarsenCR.c
+ *         BlaSparseCSR.c, BlaStrengthCSR.c, and PreAMGCoarsenCR.c
  *
  *  Reference:
  *         Multigrid by U. Trottenberg, C. W. Oosterlee and A. Schuller
@@ -30,17 +30,25 @@
 
 #include "PreAMGUtil.inl"
 
-static INT  cfsplitting_cls    (dCSRmat *, iCSRmat *, ivector *);
-static INT  cfsplitting_clsp   (dCSRmat *, iCSRmat *, ivector *);
-static INT  cfsplitting_agg    (dCSRmat *, iCSRmat *, ivector *, INT);
+static INT  cfsplitting_cls    (dCSRmat *, iCSRmat *, iCSRmat *, ivector *);
+static INT  cfsplitting_clsp   (dCSRmat *, iCSRmat *, iCSRmat *, ivector *);
+static INT  cfsplitting_agg    (dCSRmat *, iCSRmat *, iCSRmat *, ivector *, INT);
 static INT  cfsplitting_mis    (iCSRmat *, ivector *, ivector *);
+static INT  cfsplitting_pmis   (dCSRmat *, iCSRmat *, iCSRmat *, ivector *,
+                                 const SHORT);
 static INT  clean_ff_couplings (iCSRmat *, ivector *, INT, INT);
 static INT  compress_S         (iCSRmat *);
 
-static void strong_couplings   (dCSRmat *, iCSRmat *, AMG_param *);
 static void form_P_pattern_dir (dCSRmat *, iCSRmat *, ivector *, INT, INT);
 static void form_P_pattern_std (dCSRmat *, iCSRmat *, ivector *, INT, INT);
 static void ordering1          (iCSRmat *, ivector *);
+static void rs_first_pass_block (const iCSRmat *, const iCSRmat *, const INT,
+                                 const INT, const INT *, INT *, INT *, INT *,
+                                 INT *, INT *, INT *, const INT);
+static void bucket_insert      (const INT, const INT, INT *, INT *, INT *, INT *);
+static void bucket_remove      (const INT, const INT, INT *, INT *, INT *);
+static REAL pmis_random        (const INT);
+static SHORT pmis_greater      (const REAL *, const INT, const INT);
 
 /*---------------------------------*/
 /*--      Public Functions       --*/
@@ -69,6 +77,8 @@ static void ordering1          (iCSRmat *, ivector *);
  * Modified by Xiaozhe Hu on 04/24/2013: modify aggressive coarsening
  * Modified by Chensong Zhang on 04/28/2013: remove linked list
  * Modified by Chensong Zhang on 05/11/2013: restructure the code
+ * Modified by FASP team on 10/16/2026: PMIS and HMIS coarsening
+ * Modified by FASP team on 10/16/2026: S and its transpose from fasp_dcsr_strength
  */
 SHORT fasp_amg_coarsening_rs (dCSRmat    *A,
                               ivector    *vertices,
@@ -83,6 +93,7 @@ SHORT fasp_amg_coarsening_rs (dCSRmat    *A,
     // local variables
     SHORT       interp_type = param->interpolation_type;
     INT         col         = 0;
+    iCSRmat     ST;
     
 #if DEBUG_MODE > 0
     printf("### DEBUG: [-Begin-] %s ...\n", __FUNCTION__);
@@ -94,9 +105,19 @@ SHORT fasp_amg_coarsening_rs (dCSRmat    *A,
     
     // make sure standard interp is used for aggressive coarsening
     if ( coarse_type == COARSE_AC ) interp_type = INTERP_STD;
+
+    // PMIS and HMIS need distance-two interpolation: standard or extended
+    if ( (coarse_type == COARSE_PMIS || coarse_type == COARSE_HMIS)
+         && interp_type != INTERP_EXT && interp_type != INTERP_STD ) {
+        if ( param->print_level > PRINT_NONE )
+            printf("### WARNING: Use standard interpolation for PMIS/HMIS! [%s]\n",
+                   __FUNCTION__);
+        interp_type = INTERP_STD;
+    }
     
-    // find strong couplings and return them in S
-    strong_couplings(A, S, param);
+    // find strong couplings and return them in S, and the transpose in ST
+    fasp_dcsr_strength(A, coarse_type == COARSE_RSP ? STRENGTH_ABS : STRENGTH_CLS,
+                       param->strong_threshold, param->max_row_sum, S, &ST);
     
 #if DEBUG_MODE > 1
     printf("### DEBUG: Step 2. C/F splitting ......\n");
@@ -105,10 +126,10 @@ SHORT fasp_amg_coarsening_rs (dCSRmat    *A,
     switch ( coarse_type ) {
             
         case COARSE_RSP: // Classical coarsening with positive connections
-            col = cfsplitting_clsp(A, S, vertices); break;
+            col = cfsplitting_clsp(A, S, &ST, vertices); break;
             
         case COARSE_AC: // Aggressive coarsening
-            col = cfsplitting_agg(A, S, vertices, agg_path); break;
+            col = cfsplitting_agg(A, S, &ST, vertices, agg_path); break;
             
         case COARSE_CR: // Compatible relaxation
             col = fasp_amg_coarsening_cr(0, row-1, A, vertices, param); break;
@@ -116,18 +137,25 @@ SHORT fasp_amg_coarsening_rs (dCSRmat    *A,
         case COARSE_MIS: // Maximal independent set
         {
             ivector order = fasp_ivec_create(row);
-            compress_S(S);
             ordering1(S, &order);
             col = cfsplitting_mis(S, vertices, &order);
             fasp_ivec_free(&order);
             break;
         }
+
+        case COARSE_PMIS: // Parallel modified independent set
+            col = cfsplitting_pmis(A, S, &ST, vertices, FALSE); break;
+
+        case COARSE_HMIS: // RS first pass in thread blocks followed by PMIS
+            col = cfsplitting_pmis(A, S, &ST, vertices, TRUE); break;
             
         default: // Classical coarsening
-            col = cfsplitting_cls(A, S, vertices);
+            col = cfsplitting_cls(A, S, &ST, vertices);
             
     }
     
+    fasp_icsr_free(&ST);
+    
 #if DEBUG_MODE > 1
     printf("### DEBUG: col = %d\n", col);
 #endif
@@ -166,166 +194,6 @@ SHORT fasp_amg_coarsening_rs (dCSRmat    *A,
 /*--      Private Functions      --*/
 /*---------------------------------*/
 
-/**
- * \fn static void strong_couplings (dCSRmat *A, iCSRmat *S, AMG_param *param)
- *
- * \brief Generate the set of all strong negative couplings
- *
- * \param A          Coefficient matrix, the index starts from zero
- * \param S          Strong connection matrix
- * \param param      AMG parameters
- *
- * \author Xuehai Huang, Chensong Zhang
- * \date   09/06/2010
- *
- * \note   For flexibility, we do NOT compress S here!!! It is due to the C/F
- *         splitting routines to decide when to compress S.
- *
- * Modified by Chensong Zhang on 05/11/2013: restructure the code
- */
-static void strong_couplings (dCSRmat   *A,
-                              iCSRmat   *S,
-                              AMG_param *param )
-{
-    const SHORT coarse_type = param->coarsening_type;
-    const REAL  max_row_sum = param->max_row_sum;
-    const REAL  epsilon_str = param->strong_threshold;
-    const INT   row = A->row, col = A->col, row1 = row+1;
-    const INT   nnz = A->nnz;
-    
-    INT  *ia = A->IA, *ja = A->JA;
-    REAL *aj = A->val;
-    
-    // local variables
-    INT   i, j, begin_row, end_row;
-    REAL  row_scl, row_sum;
-    
-    SHORT nthreads = 1, use_openmp = FALSE;
-    
-#ifdef _OPENMP
-    if ( row > OPENMP_HOLDS ) {
-        use_openmp = TRUE;
-        nthreads = fasp_get_num_threads();
-    }
-#endif
-    
-    // get the diagonal entry of A: assume all connections are strong
-    dvector diag; fasp_dcsr_getdiag(0, A, &diag);
-    
-    // copy the structure of A to S
-    S->row = row; S->col = col; S->nnz = nnz; S->val = NULL;
-    S->IA = (INT *)fasp_mem_calloc(row1, sizeof(INT));
-    S->JA = (INT *)fasp_mem_calloc(nnz,  sizeof(INT));
-    fasp_iarray_cp(row1, ia, S->IA);
-    fasp_iarray_cp(nnz,  ja, S->JA);
-    
-    if ( use_openmp ) {
-        
-        // This part is still old! Need to be updated. --Chensong 09/18/2016
-        
-        INT mybegin, myend, myid;
-#ifdef _OPENMP
-#pragma omp parallel for private(myid, mybegin,myend,i,row_scl,row_sum,begin_row,end_row,j)
-#endif
-        for ( myid = 0; myid < nthreads; myid++ ) {
-            fasp_get_start_end(myid, nthreads, row, &mybegin, &myend);
-            for ( i = mybegin; i < myend; i++) {
-                
-                // Compute most negative entry in each row and row sum
-                row_scl = row_sum = 0.0;
-                begin_row = ia[i]; end_row = ia[i+1];
-                for ( j = begin_row; j < end_row; j++ ) {
-                    row_scl  = MIN(row_scl, aj[j]);
-                    row_sum += aj[j];
-                }
-                
-                // Find diagonal entries of S and remove them later
-                for ( j = begin_row; j < end_row; j++ ) {
-                    if ( ja[j] == i ) { S->JA[j] = -1; break; }
-                }
-                
-                // Mark entire row as weak couplings if strongly diagonal-dominant
-                if ( ABS(row_sum) > max_row_sum * ABS(diag.val[i]) ) {
-                    for ( j = begin_row; j < end_row; j++ ) S->JA[j] = -1;
-                }
-                else {
-                    for ( j = begin_row; j < end_row; j++) {
-                        // If a_{ij} >= \epsilon_{str} * \min a_{ij}, the connection
-                        // j->i is set to be weak; positive entries result in weak
-                        // connections
-                        if ( A->val[j] >= epsilon_str*row_scl ) S->JA[j] = -1;
-                    }
-                }
-                
-            } // end for i
-        } // end for myid
-        
-    }
-    
-    else {
-        
-        for ( i = 0; i < row; ++i ) {
-            
-            // Compute row scale and row sum
-            row_scl = row_sum = 0.0;
-            begin_row = ia[i]; end_row = ia[i+1];
-            
-            for ( j = begin_row; j < end_row; j++ ) {
-                
-                // Originally: Not consider positive entries
-                // row_sum += aj[j];
-                // Now changed to --Chensong 05/17/2013
-                row_sum += ABS(aj[j]);
-                
-                // Originally: Not consider positive entries
-                // row_scl = MAX(row_scl, -aj[j]); // smallest negative
-                // Now changed to --Chensong 06/01/2013
-                if ( ja[j] != i ) row_scl = MAX(row_scl, ABS(aj[j])); // largest abs
-                
-            }
-            
-            // Multiply by the strength threshold
-            row_scl *= epsilon_str;
-            
-            // Find diagonal entries of S and remove them later
-            for ( j = begin_row; j < end_row; j++ ) {
-                if ( ja[j] == i ) { S->JA[j] = -1; break; }
-            }
-            
-            // Mark entire row as weak couplings if strongly diagonal-dominant
-            // Originally: Not consider positive entries
-            // if ( ABS(row_sum) > max_row_sum * ABS(diag.val[i]) ) {
-            // Now changed to --Chensong 05/17/2013
-            if ( row_sum < (2 - max_row_sum) * ABS(diag.val[i]) ) {
-                
-                for ( j = begin_row; j < end_row; j++ ) S->JA[j] = -1;
-                
-            }
-            else {
-                
-                switch ( coarse_type ) {
-                        
-                    case COARSE_RSP: // consider positive off-diag as well
-                        for ( j = begin_row; j < end_row; j++ ) {
-                            if ( ABS(A->val[j]) <= row_scl ) S->JA[j] = -1;
-                        }
-                        break;
-                        
-                    default: // only consider n-couplings
-                        for ( j = begin_row; j < end_row; j++ ) {
-                            if ( -A->val[j] <= row_scl ) S->JA[j] = -1;
-                        }
-                        break;
-                        
-                }
-            }
-        } // end for i
-        
-    } // end if openmp
-    
-    fasp_dvec_free(&diag);
-}
-
 /**
  * \fn static INT compress_S (iCSRmat *S)
  *
@@ -427,12 +295,14 @@ static void rem_positive_ff (dCSRmat   *A,
 }
 
 /**
- * \fn static INT cfsplitting_cls (dCSRmat *A, iCSRmat *S, ivector *vertices)
+ * \fn static INT cfsplitting_cls (dCSRmat *A, iCSRmat *S, iCSRmat *ST,
+ *                                 ivector *vertices)
  *
  * \brief Find coarse level variables (classic C/F splitting)
  *
  * \param A            Coefficient matrix, the index starts from zero
  * \param S            Strong connection matrix
+ * \param ST           Transpose of S
  * \param vertices     Indicator vector for the C/F splitting of the variables
  *
  * \return Number of cols of P
@@ -446,9 +316,12 @@ static void rem_positive_ff (dCSRmat   *A,
  * Modified by Chensong Zhang on 07/06/2012: fix a data type bug.
  * Modified by Chensong Zhang on 05/11/2013: restructure the code.
  * Modified by Chunsheng Feng, Xiaoqiang Yue on 12/25/2013: check C1 criterion.
+ * Modified by FASP team on 10/16/2026: draw work space from the arena
+ * Modified by FASP team on 10/16/2026: S is compressed and ST is given
  */
 static INT cfsplitting_cls (dCSRmat   *A,
                             iCSRmat   *S,
+                            iCSRmat   *ST,
                             ivector   *vertices)
 {
     const INT   row = A->row;
@@ -460,7 +333,8 @@ static INT cfsplitting_cls (dCSRmat   *A,
     INT i, j, k, l;
     INT myid, mybegin, myend;
     INT *vec = vertices->val;
-    INT *work = (INT*)fasp_mem_calloc(3*row,sizeof(INT));
+    const size_t mark = fasp_arena_mark(NULL);
+    INT *work = (INT*)fasp_arena_calloc(NULL,3*row,sizeof(INT));
     INT *lists = work, *where = lists+row, *lambda = where+row;
     
 #if RS_C1
@@ -487,11 +361,8 @@ static INT cfsplitting_cls (dCSRmat   *A,
     }
 #endif
     
-    // 0. Compress S and form S_transpose
-    col = compress_S(S);
-    if ( col < 0 ) goto FINISHED; // compression failed!!!
-    
-    iCSRmat ST; fasp_icsr_trans(S, &ST);
+    // 0. S is compressed already: return if there is no strong coupling
+    if ( S->nnz <= 0 ) { col = ERROR_UNKNOWN; goto FINISHED; }
     
     // 1. Initialize lambda
     if ( use_openmp ) {
@@ -500,11 +371,11 @@ static INT cfsplitting_cls (dCSRmat   *A,
 #endif
         for ( myid = 0; myid < nthreads; myid++ ) {
             fasp_get_start_end(myid, nthreads, row, &mybegin, &myend);
-            for ( i = mybegin; i < myend; i++ ) lambda[i] = ST.IA[i+1] - ST.IA[i];
+            for ( i = mybegin; i < myend; i++ ) lambda[i] = ST->IA[i+1] - ST->IA[i];
         }
     }
     else {
-        for ( i = 0; i < row; ++i ) lambda[i] = ST.IA[i+1] - ST.IA[i];
+        for ( i = 0; i < row; ++i ) lambda[i] = ST->IA[i+1] - ST->IA[i];
     }
     
     // 2. Before C/F splitting algorithm starts, filter out the variables which
@@ -568,7 +439,7 @@ static INT cfsplitting_cls (dCSRmat   *A,
         }
         else {
             
-            if ( measure < 0 ) printf("### WARNING: Negative lambda[%d]!\n", i);
+            if ( measure < 0 ) printf("### WARNING: Negative lambda[" INTFMT "]!\n", i);
             
             // Set variables with non-positive measure as F-variables
             vec[i] = FGPT; // no strong connections, set i as fine node
@@ -611,9 +482,9 @@ static INT cfsplitting_cls (dCSRmat   *A,
         col++;
         
         // for all $j\in S_i^T\cap U: F:=F\cup\{j\}, U:=U\backslash\{j\}$
-        for ( i = ST.IA[maxnode]; i < ST.IA[maxnode+1]; ++i ) {
+        for ( i = ST->IA[maxnode]; i < ST->IA[maxnode+1]; ++i ) {
             
-            j = ST.JA[i];
+            j = ST->JA[i];
             
             if ( vec[j] != UNPT ) continue; // skip decided variables
             
@@ -724,8 +595,6 @@ static INT cfsplitting_cls (dCSRmat   *A,
     
 #endif
     
-    fasp_icsr_free(&ST);
-    
     if ( LoL_head ) {
         list_ptr = LoL_head;
         LoL_head->prev_node = NULL;
@@ -735,7 +604,7 @@ static INT cfsplitting_cls (dCSRmat   *A,
     }
     
 FINISHED:
-    fasp_mem_free(work); work = NULL;
+    fasp_arena_release(NULL,mark); work = NULL;
     
 #if DEBUG_MODE > 0
     printf("### DEBUG: [--End--] %s ...\n", __FUNCTION__);
@@ -745,12 +614,14 @@ FINISHED:
 }
 
 /**
- * \fn static INT cfsplitting_clsp (dCSRmat *A, iCSRmat *S, ivector *vertices)
+ * \fn static INT cfsplitting_clsp (dCSRmat *A, iCSRmat *S, iCSRmat *ST,
+ *                                  ivector *vertices)
  *
  * \brief Find coarse level variables (C/F splitting with positive connections)
  *
  * \param A            Coefficient matrix, the index starts from zero
  * \param S            Strong connection matrix
+ * \param ST           Transpose of S
  * \param vertices     Indicator vector for the C/F splitting of the variables
  *
  * \return Number of cols of P
@@ -762,9 +633,12 @@ FINISHED:
  *         checking strong positive couplings and pick some of them as C.
  *
  * Modified by Chensong Zhang on 06/07/2013: restructure the code
+ * Modified by FASP team on 10/16/2026: draw work space from the arena
+ * Modified by FASP team on 10/16/2026: S is compressed and ST is given
  */
 static INT cfsplitting_clsp (dCSRmat   *A,
                              iCSRmat   *S,
+                             iCSRmat   *ST,
                              ivector   *vertices)
 {
     const INT   row = A->row;
@@ -773,11 +647,12 @@ static INT cfsplitting_clsp (dCSRmat   *A,
     INT col = 0;
     INT maxmeas, maxnode, num_left = 0;
     INT measure, newmeas;
-    INT i, j, k, l;
+    INT i, j, k, l, p;
     INT myid, mybegin, myend;
     
     INT *ia = A->IA, *vec = vertices->val;
-    INT *work = (INT*)fasp_mem_calloc(3*row,sizeof(INT));
+    const size_t mark = fasp_arena_mark(NULL);
+    INT *work = (INT*)fasp_arena_calloc(NULL,3*row,sizeof(INT));
     INT *lists = work, *where = lists+row, *lambda = where+row;
     
     LinkList LoL_head = NULL, LoL_tail = NULL, list_ptr = NULL;
@@ -795,17 +670,23 @@ static INT cfsplitting_clsp (dCSRmat   *A,
     }
 #endif
     
-    // 0. Compress S and form S_transpose (not complete, just IA and JA)
+    // 0. Expand S to the structure of A, weak couplings marked as -1
     iCSRmat Stemp;
-    Stemp.row = S->row; Stemp.col = S->col; Stemp.nnz = S->nnz;
+    Stemp.row = S->row; Stemp.col = S->col; Stemp.nnz = A->nnz;
     Stemp.IA = (INT *)fasp_mem_calloc(S->row+1, sizeof(INT));
-    fasp_iarray_cp (S->row+1, S->IA, Stemp.IA);
-    Stemp.JA = (INT *)fasp_mem_calloc(S->nnz, sizeof(INT));
-    fasp_iarray_cp (S->nnz, S->JA, Stemp.JA);
+    fasp_iarray_cp (S->row+1, ia, Stemp.IA);
+    Stemp.JA = (INT *)fasp_mem_calloc(MAX(A->nnz,1), sizeof(INT));
     
-    if ( compress_S(S) < 0 ) goto FINISHED; // compression failed!!!
+    // rows of S are ordered subsequences of rows of A
+    for ( i = 0; i < row; ++i ) {
+        p = S->IA[i];
+        for ( j = ia[i]; j < ia[i+1]; ++j ) {
+            if ( p < S->IA[i+1] && S->JA[p] == A->JA[j] ) Stemp.JA[j] = S->JA[p++];
+            else Stemp.JA[j] = -1;
+        }
+    }
     
-    iCSRmat ST; fasp_icsr_trans(S, &ST);
+    if ( S->nnz <= 0 ) goto FINISHED; // no strong couplings!!!
     
     // 1. Initialize lambda
     if ( use_openmp ) {
@@ -814,11 +695,11 @@ static INT cfsplitting_clsp (dCSRmat   *A,
 #endif
         for ( myid = 0; myid < nthreads; myid++ ) {
             fasp_get_start_end(myid, nthreads, row, &mybegin, &myend);
-            for ( i = mybegin; i < myend; i++ ) lambda[i] = ST.IA[i+1] - ST.IA[i];
+            for ( i = mybegin; i < myend; i++ ) lambda[i] = ST->IA[i+1] - ST->IA[i];
         }
     }
     else {
-        for ( i = 0; i < row; ++i ) lambda[i] = ST.IA[i+1] - ST.IA[i];
+        for ( i = 0; i < row; ++i ) lambda[i] = ST->IA[i+1] - ST->IA[i];
     }
     
     // 2. Before C/F splitting algorithm starts, filter out the variables which
@@ -870,7 +751,7 @@ static INT cfsplitting_clsp (dCSRmat   *A,
         }
         else {
             
-            if ( measure < 0 ) printf("### WARNING: Negative lambda[%d]!\n", i);
+            if ( measure < 0 ) printf("### WARNING: Negative lambda[" INTFMT "]!\n", i);
             
             // Set variables with non-positive measure as F-variables
             vec[i] = FGPT; // no strong connections, set i as fine node
@@ -916,9 +797,9 @@ static INT cfsplitting_clsp (dCSRmat   *A,
         col++;
         
         // for all $j\in S_i^T\cap U: F:=F\cup\{j\}, U:=U\backslash\{j\}$
-        for ( i = ST.IA[maxnode]; i < ST.IA[maxnode+1]; ++i ) {
+        for ( i = ST->IA[maxnode]; i < ST->IA[maxnode+1]; ++i ) {
             
-            j = ST.JA[i];
+            j = ST->JA[i];
             
             if ( vec[j] != UNPT ) continue; // skip decided variables
             
@@ -971,8 +852,6 @@ static INT cfsplitting_clsp (dCSRmat   *A,
         
     } // end while
     
-    fasp_icsr_free(&ST);
-    
     if ( LoL_head ) {
         list_ptr = LoL_head;
         LoL_head->prev_node = NULL;
@@ -997,7 +876,7 @@ static INT cfsplitting_clsp (dCSRmat   *A,
     fasp_mem_free(S->JA); S->JA = Stemp.JA;
     
 FINISHED:
-    fasp_mem_free(work);  work  = NULL;
+    fasp_arena_release(NULL,mark); work = NULL;
     
 #if DEBUG_MODE > 0
     printf("### DEBUG: [--End--] %s ...\n", __FUNCTION__);
@@ -1025,6 +904,7 @@ FINISHED:
  * \date   09/06/2010
  *
  * Modified by Chensong Zhang on 05/13/2013: restructure the code
+ * Modified by FASP team on 10/16/2026: draw work space from the arena
  */
 static void strong_couplings_agg1 (dCSRmat   *A,
                                    iCSRmat   *S,
@@ -1067,7 +947,8 @@ static void strong_couplings_agg1 (dCSRmat   *A,
     Sh->IA  = (INT*)fasp_mem_calloc(Sh->row+1, sizeof(INT));
     
     // record the number of times some coarse point is visited
-    visited = (INT*)fasp_mem_calloc(num_c, sizeof(INT));
+    const size_t mark = fasp_arena_mark(NULL);
+    visited = (INT*)fasp_arena_calloc(NULL, num_c, sizeof(INT));
     fasp_iarray_set(num_c, visited, -1);
     
     /**********************************************/
@@ -1104,7 +985,7 @@ static void strong_couplings_agg1 (dCSRmat   *A,
                     ck = S->JA[k];
                     if ( vec[ck] == CGPT && ck != i ) { // it is a coarse grid point
                         if ( cp_rindex[ck] >= num_c ) {
-                            printf("### ERROR: ck=%d, num_c=%d, out of bound!\n",
+                            printf("### ERROR: ck=" INTFMT ", num_c=" INTFMT ", out of bound!\n",
                                    ck, num_c);
                             fasp_chkerr(ERROR_AMG_COARSEING, __FUNCTION__);
                         }
@@ -1175,7 +1056,7 @@ static void strong_couplings_agg1 (dCSRmat   *A,
         
     } // end for ci
     
-    fasp_mem_free(visited); visited = NULL;
+    fasp_arena_release(NULL,mark); visited = NULL;
 }
 
 /**
@@ -1203,6 +1084,7 @@ static void strong_couplings_agg1 (dCSRmat   *A,
  *         coarsening!
  *
  * Modified by Chensong Zhang on 05/13/2013: restructure the code
+ * Modified by FASP team on 10/16/2026: draw work space from the arena
  */
 static void strong_couplings_agg2 (dCSRmat   *A,
                                    iCSRmat   *S,
@@ -1245,7 +1127,8 @@ static void strong_couplings_agg2 (dCSRmat   *A,
     Sh->IA  = (INT*)fasp_mem_calloc(Sh->row+1, sizeof(INT));
     
     // record the number of times some coarse point is visited
-    visited = (INT*)fasp_mem_calloc(num_c, sizeof(INT));
+    const size_t mark = fasp_arena_mark(NULL);
+    visited = (INT*)fasp_arena_calloc(NULL, num_c, sizeof(INT));
     memset(visited, 0, sizeof(INT)*num_c);
     
     /**********************************************/
@@ -1283,7 +1166,7 @@ static void strong_couplings_agg2 (dCSRmat   *A,
                     
                     if ( vec[ck] == CGPT && ck != i ) { // coarse grid point
                         if ( cp_rindex[ck] >= num_c ) {
-                            printf("### ERROR: ck=%d, num_c=%d, out of bound!\n",
+                            printf("### ERROR: ck=" INTFMT ", num_c=" INTFMT ", out of bound!\n",
                                    ck, num_c);
                             fasp_chkerr(ERROR_AMG_COARSEING, __FUNCTION__);
                         }
@@ -1374,17 +1257,18 @@ static void strong_couplings_agg2 (dCSRmat   *A,
         
     } // end for ci
     
-    fasp_mem_free(visited); visited = NULL;
+    fasp_arena_release(NULL,mark); visited = NULL;
 }
 
 /**
- * \fn static INT cfsplitting_agg (dCSRmat *A, iCSRmat *S, ivector *vertices,
- *                                 INT aggressive_path)
+ * \fn static INT cfsplitting_agg (dCSRmat *A, iCSRmat *S, iCSRmat *ST,
+ *                                 ivector *vertices, INT aggressive_path)
  *
  * \brief Find coarse level variables (C/F splitting): aggressive
  *
  * \param A                Coefficient matrix, the index starts from zero
  * \param S                Strong connection matrix
+ * \param ST               Transpose of S
  * \param vertices         Indicator vector for the C/F splitting of the variables
  * \param aggressive_path  Aggressive path
  *
@@ -1397,9 +1281,12 @@ static void strong_couplings_agg2 (dCSRmat   *A,
  * Modified by Chunsheng Feng, Zheng Li on 10/13/2012
  * Modified by Xiaozhe Hu on 04/24/2013: modify aggressive coarsening
  * Modified by Chensong Zhang on 05/13/2013: restructure the code
+ * Modified by FASP team on 10/16/2026: draw work space from the arena
+ * Modified by FASP team on 10/16/2026: S is compressed and ST is given
  */
 static INT cfsplitting_agg (dCSRmat   *A,
                             iCSRmat   *S,
+                            iCSRmat   *ST,
                             ivector   *vertices,
                             INT        aggressive_path)
 {
@@ -1413,7 +1300,8 @@ static INT cfsplitting_agg (dCSRmat   *A,
     INT    i, j, k, l, m, ci, cj, ck, cl, num_c;
     SHORT  IS_CNEIGH;
     
-    INT   *work = (INT*)fasp_mem_calloc(3*row,sizeof(INT));
+    const size_t mark = fasp_arena_mark(NULL);
+    INT   *work = (INT*)fasp_arena_calloc(NULL,3*row,sizeof(INT));
     INT   *lists = work, *where = lists+row, *lambda = where+row;
     
     ivector  CGPT_index, CGPT_rindex;
@@ -1422,7 +1310,7 @@ static INT cfsplitting_agg (dCSRmat   *A,
     // Sh is for the strong coupling matrix between temporary CGPTs
     // ShT is the transpose of Sh
     // Snew is for combining the information from S and Sh
-    iCSRmat ST, Sh, ShT;
+    iCSRmat Sh, ShT;
     
 #if DEBUG_MODE > 0
     printf("### DEBUG: [-Begin-] %s ...\n", __FUNCTION__);
@@ -1432,8 +1320,7 @@ static INT cfsplitting_agg (dCSRmat   *A,
     /* Coarsening Phase ONE: find temporary coarse level points */
     /************************************************************/
     
-    num_c = cfsplitting_cls(A, S, vertices);
-    fasp_icsr_trans(S, &ST);
+    num_c = cfsplitting_cls(A, S, ST, vertices);
     
     /************************************************************/
     /* Coarsening Phase TWO: find real coarse level points      */
@@ -1470,7 +1357,7 @@ static INT cfsplitting_agg (dCSRmat   *A,
             num_left++;
         }
         else {
-            if ( measure < 0) printf("### WARNING: Negative lambda[%d]!\n", i);
+            if ( measure < 0) printf("### WARNING: Negative lambda[" INTFMT "]!\n", i);
             
             vec[i] = FGPT; // set i as fine node
             
@@ -1641,9 +1528,8 @@ static INT cfsplitting_agg (dCSRmat   *A,
     fasp_ivec_free(&CGPT_index);
     fasp_ivec_free(&CGPT_rindex);
     fasp_icsr_free(&Sh);
-    fasp_icsr_free(&ST);
     fasp_icsr_free(&ShT);
-    fasp_mem_free(work); work = NULL;
+    fasp_arena_release(NULL,mark); work = NULL;
     
 #if DEBUG_MODE > 0
     printf("### DEBUG: [--End--] %s ...\n", __FUNCTION__);
@@ -1674,6 +1560,7 @@ static INT cfsplitting_agg (dCSRmat   *A,
  *
  * Modified by Chunsheng Feng, Xiaoqiang Yue on 05/24/2012: add OMP support
  * Modified by Chensong Zhang on 05/12/2013: restructure the code
+ * Modified by FASP team on 10/16/2026: draw work space from the arena
  */
 static INT clean_ff_couplings (iCSRmat   *S,
                                ivector   *vertices,
@@ -1682,7 +1569,8 @@ static INT clean_ff_couplings (iCSRmat   *S,
 {
     // local variables
     INT  *vec        = vertices->val;
-    INT  *cindex     = (INT *)fasp_mem_calloc(row, sizeof(INT));
+    const size_t mark = fasp_arena_mark(NULL);
+    INT  *cindex     = (INT *)fasp_arena_calloc(NULL, row, sizeof(INT));
     INT   set_empty  = TRUE, C_i_nonempty  = FALSE;
     INT   ci_tilde   = -1,   ci_tilde_mark = -1;
     INT   ji, jj, i, j, index;
@@ -1741,7 +1629,7 @@ static INT clean_ff_couplings (iCSRmat   *S,
         
     } // end for i
     
-    fasp_mem_free(cindex); cindex = NULL;
+    fasp_arena_release(NULL,mark); cindex = NULL;
     
     return col;
 }
@@ -1876,6 +1764,7 @@ static void form_P_pattern_dir (dCSRmat   *P,
  *
  * Modified by Chunsheng Feng, Zheng Li on 10/13/2012: add OMP support
  * Modified by Chensong Zhang on 05/13/2013: restructure the code
+ * Modified by FASP team on 10/16/2026: draw work space from the arena
  */
 static void form_P_pattern_std (dCSRmat   *P,
                                 iCSRmat   *S,
@@ -1888,7 +1777,8 @@ static void form_P_pattern_std (dCSRmat   *P,
     INT *vec = vertices->val;
     
     // number of times a C-point is visited
-    INT *visited = (INT*)fasp_mem_calloc(row,sizeof(INT));
+    const size_t mark = fasp_arena_mark(NULL);
+    INT *visited = (INT*)fasp_arena_calloc(NULL,row,sizeof(INT));
     
     P->row = row; P->col = col;
     P->IA  = (INT*)fasp_mem_calloc(row+1, sizeof(INT));
@@ -1983,7 +1873,7 @@ static void form_P_pattern_std (dCSRmat   *P,
     }
     
     // clean up
-    fasp_mem_free(visited); visited = NULL;
+    fasp_arena_release(NULL,mark); visited = NULL;
 }
 
 /**
@@ -2083,6 +1973,419 @@ static void ordering1 (iCSRmat   *S,
     return;
 }
 
+/**
+ * \fn static INT cfsplitting_pmis (dCSRmat *A, iCSRmat *S, iCSRmat *ST,
+ *                                  ivector *vertices, const SHORT first_pass)
+ *
+ * \brief Find coarse level variables (C/F splitting): PMIS or HMIS
+ *
+ * \param A            Coefficient matrix, the index starts from zero
+ * \param S            Strong connection matrix
+ * \param ST           Transpose of S
+ * \param vertices     Indicator vector for the C/F splitting of the variables
+ * \param first_pass   Whether to start with RS first passes in thread blocks (HMIS)
+ *
+ * \return Number of cols of P
+ *
+ * \author FASP team
+ * \date   10/16/2026
+ *
+ * \note   The measure of a point is the number of points it strongly influences
+ *         plus a random number in [0,1). In every round, an undecided point is
+ *         chosen as C if its measure is the largest among its undecided strong
+ *         neighbors (in S or S^T), and undecided points which strongly depend on
+ *         a new C point become F. The rounds only read the states of the last
+ *         round, so they are parallel. For HMIS, the C points of RS first passes
+ *         within the thread blocks are the first independent set.
+ *
+ * \note   F points with strong couplings but without a C point within distance
+ *         two in S become C at the end, so that standard and extended
+ *         interpolations are well defined.
+ *
+ * Reference: H. De Sterck, U.M. Yang, and J.J. Heys, "Reducing complexity in
+ *            parallel algebraic multigrid preconditioners", SIMAX, 27 (2006).
+ */
+static INT cfsplitting_pmis (dCSRmat      *A,
+                             iCSRmat      *S,
+                             iCSRmat      *ST,
+                             ivector      *vertices,
+                             const SHORT   first_pass)
+{
+    const INT    row = A->row;
+    const INT   *ia  = A->IA;
+    const size_t mark = fasp_arena_mark(NULL);
+
+    // local variables
+    INT    col = 0, num_left = 0, maxst = 0, nbucket;
+    INT    i, j, k, jj, myid, mybegin, myend;
+    INT   *vec = vertices->val;
+    INT   *flag, *work;
+    REAL  *measure;
+    SHORT  select = !first_pass;
+
+    SHORT nthreads = 1;
+#ifdef _OPENMP
+    SHORT use_openmp = FALSE;
+#endif
+
+#if DEBUG_MODE > 0
+    printf("### DEBUG: [-Begin-] %s ...\n", __FUNCTION__);
+#endif
+
+#ifdef _OPENMP
+    if ( row > OPENMP_HOLDS ) {
+        use_openmp = TRUE;
+        nthreads = fasp_get_num_threads();
+    }
+#endif
+
+    // 0. S is compressed already: return if there is no strong coupling
+    if ( S->nnz <= 0 ) { col = ERROR_UNKNOWN; goto FINISHED; }
+
+    measure = (REAL *)fasp_arena_alloc(NULL, row, sizeof(REAL));
+    flag    = (INT *)fasp_arena_calloc(NULL, row, sizeof(INT));
+
+    // 1. Initialize measures and filter out isolated points and points which
+    //    do not influence any point (they are F points)
+#ifdef _OPENMP
+#pragma omp parallel for reduction(+:num_left) if (use_openmp)
+#endif
+    for ( i = 0; i < row; ++i ) {
+        measure[i] = (REAL)(ST->IA[i+1] - ST->IA[i]) + pmis_random(i);
+        if ( (ia[i+1]-ia[i]) <= 1 ) {
+            vec[i] = ISPT; // set i as an ISOLATED fine node
+        }
+        else if ( ST->IA[i+1] == ST->IA[i] ) {
+            vec[i] = FGPT; // i does not influence any point
+        }
+        else {
+            vec[i] = UNPT; // set i as a undecided node
+            num_left++;
+        }
+    }
+
+    // 2. HMIS: RS first pass in each thread block with couplings in the block
+    if ( first_pass ) {
+
+        for ( i = 0; i < row; ++i ) maxst = MAX(maxst, ST->IA[i+1] - ST->IA[i]);
+        nbucket = 2*maxst + 2;
+
+        // lambda, next, prev, local C/F marker, and buckets for each thread
+        work = (INT *)fasp_arena_alloc(NULL, (size_t)4*row + (size_t)nthreads*nbucket,
+                                       sizeof(INT));
+
+#ifdef _OPENMP
+#pragma omp parallel for private(myid, mybegin, myend) if (use_openmp)
+#endif
+        for ( myid = 0; myid < nthreads; myid++ ) {
+            fasp_get_start_end(myid, nthreads, row, &mybegin, &myend);
+            rs_first_pass_block(S, ST, mybegin, myend, vec, flag,
+                                work, work+row, work+2*row, work+3*row,
+                                work+4*row+(size_t)myid*nbucket, nbucket);
+        }
+
+    }
+
+    // 3. Main loop
+    while ( num_left > 0 ) {
+
+        // new C points: largest measure among undecided strong neighbors
+        if ( select ) {
+#ifdef _OPENMP
+#pragma omp parallel for private(j, jj) if (use_openmp)
+#endif
+            for ( i = 0; i < row; ++i ) {
+                flag[i] = FALSE;
+                if ( vec[i] != UNPT ) continue;
+                flag[i] = TRUE;
+                for ( j = S->IA[i]; j < S->IA[i+1] && flag[i]; ++j ) {
+                    jj = S->JA[j];
+                    if ( vec[jj] == UNPT && pmis_greater(measure, jj, i) ) flag[i] = FALSE;
+                }
+                for ( j = ST->IA[i]; j < ST->IA[i+1] && flag[i]; ++j ) {
+                    jj = ST->JA[j];
+                    if ( vec[jj] == UNPT && pmis_greater(measure, jj, i) ) flag[i] = FALSE;
+                }
+            }
+        }
+        select = TRUE;
+
+        // set the new C points and the undecided points depending on them as F
+        num_left = 0;
+#ifdef _OPENMP
+#pragma omp parallel for private(j) reduction(+:num_left, col) if (use_openmp)
+#endif
+        for ( i = 0; i < row; ++i ) {
+            if ( vec[i] != UNPT ) continue;
+            if ( flag[i] ) {
+                vec[i] = CGPT; col++; continue;
+            }
+            for ( j = S->IA[i]; j < S->IA[i+1]; ++j ) {
+                if ( flag[S->JA[j]] ) { vec[i] = FGPT; break; }
+            }
+            if ( vec[i] == UNPT ) num_left++;
+        }
+
+    } // end while
+
+    // 4. F points without C points within distance two become C points
+#ifdef _OPENMP
+#pragma omp parallel for private(j, jj, k) if (use_openmp)
+#endif
+    for ( i = 0; i < row; ++i ) {
+        flag[i] = FALSE;
+        if ( vec[i] != FGPT || S->IA[i+1] == S->IA[i] ) continue;
+        flag[i] = TRUE;
+        for ( j = S->IA[i]; j < S->IA[i+1] && flag[i]; ++j ) {
+            jj = S->JA[j];
+            if ( vec[jj] == CGPT ) { flag[i] = FALSE; break; }
+            if ( vec[jj] != FGPT ) continue;
+            for ( k = S->IA[jj]; k < S->IA[jj+1]; ++k ) {
+                if ( vec[S->JA[k]] == CGPT ) { flag[i] = FALSE; break; }
+            }
+        }
+    }
+
+    for ( i = 0; i < row; ++i ) {
+        if ( flag[i] ) { vec[i] = CGPT; col++; }
+    }
+
+FINISHED:
+    fasp_arena_release(NULL, mark);
+
+#if DEBUG_MODE > 0
+    printf("### DEBUG: [--End--] %s ...\n", __FUNCTION__);
+#endif
+
+    return col;
+}
+
+/**
+ * \fn static void rs_first_pass_block (const iCSRmat *S, const iCSRmat *ST,
+ *                                      const INT begin, const INT end,
+ *                                      const INT *vec, INT *flag, INT *lambda,
+ *                                      INT *next, INT *prev, INT *cfloc,
+ *                                      INT *head, const INT nbucket)
+ *
+ * \brief RS first pass restricted to the points begin, ..., end-1 (HMIS)
+ *
+ * \param S        Strong connection matrix (compressed)
+ * \param ST       Transpose of S
+ * \param begin    First point of the block
+ * \param end      Last point of the block plus one
+ * \param vec      C/F marker: only UNPT points take part in the first pass
+ * \param flag     flag[i] = TRUE if i is a C point of the first pass (output)
+ * \param lambda   Work array of measures, indexed by points
+ * \param next     Work array of next points in the buckets, indexed by points
+ * \param prev     Work array of previous points in the buckets, indexed by points
+ * \param cfloc    Work array of C/F markers of the first pass, indexed by points
+ * \param head     Work array of the first points in the buckets, size nbucket
+ * \param nbucket  Number of buckets, larger than twice max number of influences
+ *
+ * \author FASP team
+ * \date   10/16/2026
+ *
+ * \note   Only couplings inside the block are taken into account, so the blocks
+ *         can be handled by different threads. This is the first pass of
+ *         cfsplitting_cls with the linked list replaced by arrays of buckets.
+ */
+static void rs_first_pass_block (const iCSRmat  *S,
+                                 const iCSRmat  *ST,
+                                 const INT       begin,
+                                 const INT       end,
+                                 const INT      *vec,
+                                 INT            *flag,
+                                 INT            *lambda,
+                                 INT            *next,
+                                 INT            *prev,
+                                 INT            *cfloc,
+                                 INT            *head,
+                                 const INT       nbucket)
+{
+    INT i, j, k, l, m, maxnode, top = -1;
+
+    for ( m = 0; m < nbucket; ++m ) head[m] = -1;
+
+    // local measures: number of undecided points in the block i influences
+    for ( i = begin; i < end; ++i ) {
+        flag[i]   = FALSE;
+        lambda[i] = 0;
+        cfloc[i]  = ( vec[i] == UNPT ) ? UNPT : FGPT;
+        if ( cfloc[i] != UNPT ) continue;
+        for ( j = ST->IA[i]; j < ST->IA[i+1]; ++j ) {
+            k = ST->JA[j];
+            if ( k >= begin && k < end && vec[k] == UNPT ) lambda[i]++;
+        }
+    }
+
+    for ( i = begin; i < end; ++i ) {
+        if ( cfloc[i] != UNPT || lambda[i] <= 0 ) continue;
+        bucket_insert(i, lambda[i], next, prev, head, &top);
+    }
+
+    // points without local influence are F points of the first pass
+    for ( i = begin; i < end; ++i ) {
+        if ( cfloc[i] != UNPT || lambda[i] > 0 ) continue;
+        cfloc[i] = FGPT;
+        for ( l = S->IA[i]; l < S->IA[i+1]; ++l ) {
+            k = S->JA[l];
+            if ( k < begin || k >= end || cfloc[k] != UNPT ) continue;
+            if ( lambda[k] > 0 ) bucket_remove(k, lambda[k], next, prev, head);
+            bucket_insert(k, ++lambda[k], next, prev, head, &top);
+        }
+    }
+
+    while ( TRUE ) {
+
+        // pick the undecided point with max measure as C point
+        while ( top >= 0 && head[top] < 0 ) top--;
+        if ( top <= 0 ) break;
+
+        maxnode = head[top];
+        bucket_remove(maxnode, top, next, prev, head);
+        cfloc[maxnode] = CGPT;
+        flag[maxnode]  = TRUE;
+
+        // undecided points depending on maxnode become F points
+        for ( j = ST->IA[maxnode]; j < ST->IA[maxnode+1]; ++j ) {
+            i = ST->JA[j];
+            if ( i < begin || i >= end || cfloc[i] != UNPT ) continue;
+            bucket_remove(i, lambda[i], next, prev, head);
+            cfloc[i] = FGPT;
+            for ( l = S->IA[i]; l < S->IA[i+1]; ++l ) {
+                k = S->JA[l];
+                if ( k < begin || k >= end || cfloc[k] != UNPT ) continue;
+                bucket_remove(k, lambda[k], next, prev, head);
+                bucket_insert(k, ++lambda[k], next, prev, head, &top);
+            }
+        }
+
+        // undecided points influencing maxnode are less important
+        for ( j = S->IA[maxnode]; j < S->IA[maxnode+1]; ++j ) {
+            i = S->JA[j];
+            if ( i < begin || i >= end || cfloc[i] != UNPT ) continue;
+            bucket_remove(i, lambda[i], next, prev, head);
+            if ( --lambda[i] > 0 ) {
+                bucket_insert(i, lambda[i], next, prev, head, &top);
+                continue;
+            }
+            cfloc[i] = FGPT;
+            for ( l = S->IA[i]; l < S->IA[i+1]; ++l ) {
+                k = S->JA[l];
+                if ( k < begin || k >= end || cfloc[k] != UNPT ) continue;
+                bucket_remove(k, lambda[k], next, prev, head);
+                bucket_insert(k, ++lambda[k], next, prev, head, &top);
+            }
+        }
+
+    } // end while
+}
+
+/**
+ * \fn static void bucket_insert (const INT i, const INT m, INT *next, INT *prev,
+ *                                INT *head, INT *top)
+ *
+ * \brief Insert point i into the bucket of measure m
+ *
+ * \param i      Point to insert
+ * \param m      Measure of i
+ * \param next   Next points in the buckets
+ * \param prev   Previous points in the buckets
+ * \param head   First points in the buckets
+ * \param top    Largest measure of nonempty buckets (updated)
+ *
+ * \author FASP team
+ * \date   10/16/2026
+ */
+static void bucket_insert (const INT   i,
+                           const INT   m,
+                           INT        *next,
+                           INT        *prev,
+                           INT        *head,
+                           INT        *top)
+{
+    next[i] = head[m];
+    prev[i] = -1;
+    if ( head[m] >= 0 ) prev[head[m]] = i;
+    head[m] = i;
+    if ( m > *top ) *top = m;
+}
+
+/**
+ * \fn static void bucket_remove (const INT i, const INT m, INT *next, INT *prev,
+ *                                INT *head)
+ *
+ * \brief Remove point i from the bucket of measure m
+ *
+ * \param i      Point to remove
+ * \param m      Measure of i
+ * \param next   Next points in the buckets
+ * \param prev   Previous points in the buckets
+ * \param head   First points in the buckets
+ *
+ * \author FASP team
+ * \date   10/16/2026
+ */
+static void bucket_remove (const INT   i,
+                           const INT   m,
+                           INT        *next,
+                           INT        *prev,
+                           INT        *head)
+{
+    if ( prev[i] >= 0 ) next[prev[i]] = next[i];
+    else                head[m] = next[i];
+    if ( next[i] >= 0 ) prev[next[i]] = prev[i];
+}
+
+/**
+ * \fn static REAL pmis_random (const INT i)
+ *
+ * \brief Random number in [0,1) attached to point i
+ *
+ * \param i      Index of the point
+ *
+ * \return       Hash of i scaled to [0,1)
+ *
+ * \author FASP team
+ * \date   10/16/2026
+ *
+ * \note A hash of the index is used, so the splitting does not depend on the
+ *       number of threads.
+ */
+static REAL pmis_random (const INT i)
+{
+    unsigned int h = (unsigned int)i;
+
+    h = (h ^ 61) ^ (h >> 16);
+    h += h << 3;
+    h ^= h >> 4;
+    h *= 0x27d4eb2d;
+    h ^= h >> 15;
+
+    return (REAL)h / 4294967296.0;
+}
+
+/**
+ * \fn static SHORT pmis_greater (const REAL *measure, const INT j, const INT i)
+ *
+ * \brief Whether point j has a larger measure than point i (ties by index)
+ *
+ * \param measure   Measures of the points
+ * \param j         Index of the first point
+ * \param i         Index of the second point
+ *
+ * \return          TRUE if measure[j] > measure[i]; otherwise, FALSE
+ *
+ * \author FASP team
+ * \date   10/16/2026
+ */
+static SHORT pmis_greater (const REAL  *measure,
+                           const INT    j,
+                           const INT    i)
+{
+    return ( measure[j] > measure[i] || (measure[j] == measure[i] && j > i) );
+}
+
 /*---------------------------------*/
 /*--        End of File          --*/
 /*---------------------------------*/
@@ -59,6 +59,7 @@ static void amg_interp_trunc (dCSRmat *, AMG_param *);
  * Modified by Xiaozhe Hu on 05/23/2012: add S as input
  * Modified by Chensong Zhang on 09/12/2012: clean up and debug interp_RS
  * Modified by Chensong Zhang on 05/14/2013: reconstruct the code
+ * Modified by FASP team on 10/16/2026: standard interpolation for PMIS and HMIS
  */
 void fasp_amg_interp (dCSRmat    *A,
                       ivector    *vertices,
@@ -71,6 +72,12 @@ void fasp_amg_interp (dCSRmat    *A,
     
     // make sure standard interpolation is used for aggressive coarsening
     if ( coarsening_type == COARSE_AC ) interp_type = INTERP_STD;
+
+    // PMIS and HMIS need distance-two interpolation: standard or extended
+    // (the warning has been printed by fasp_amg_coarsening_rs)
+    if ( (coarsening_type == COARSE_PMIS || coarsening_type == COARSE_HMIS)
+         && interp_type != INTERP_EXT && interp_type != INTERP_STD )
+        interp_type = INTERP_STD;
     
 #if DEBUG_MODE > 0
     printf("### DEBUG: [-Begin-] %s ...\n", __FUNCTION__);
@@ -217,7 +224,7 @@ static void amg_interp_trunc (dCSRmat    *P,
     P->val = (REAL *)fasp_mem_realloc(P->val, num_nonzero*sizeof(REAL));
     
     if ( prtlvl >= PRINT_MOST ) {
-        printf("NNZ in prolongator: before truncation = %10d, after = %10d\n",
+        printf("NNZ in prolongator: before truncation = %10" INTMOD "d, after = %10" INTMOD "d\n",
                nnzold, num_nonzero);
     }
     
@@ -44,10 +44,12 @@
  * \date   04/21/2010
  *
  * Modified by Chensong Zhang on 05/10/2013: adjust the structure.
+ * Modified by FASP team on 10/16/2026: account memory to the AMG hierarchy.
  */
 SHORT fasp_amg_setup_cr (AMG_data   *mgl,
                          AMG_param  *param)
 {
+    const SHORT memtag = fasp_mem_set_tag(MEM_TAG_AMG); // charge to AMG hierarchy
     const SHORT  prtlvl   = param->print_level;
     const SHORT  min_cdof = MAX(param->coarse_dof,50);
     const INT    m        = mgl[0].A.row;
@@ -126,6 +128,8 @@ SHORT fasp_amg_setup_cr (AMG_data   *mgl,
     printf("### DEBUG: [--End--] %s ...\n", __FUNCTION__);
 #endif
     
+    fasp_mem_set_tag(memtag);
+
     return status;
 }
 
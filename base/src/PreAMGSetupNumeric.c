@@ -0,0 +1,464 @@
+/*! \file  PreAMGSetupNumeric.c
+ *
+ *  \brief AMG: numeric re-setup phase with the structure of a prior setup
+ *
+ *  \note  This file contains Level-4 (Pre) functions. It requires:
+ *         AuxMemory.c, AuxMessage.c, AuxTiming.c, BlaILUSetupCSR.c,
+ *         BlaSchwarzSetup.c, BlaSparseCSR.c, BlaSpmvCSR.c, and PreDataInit.c
+ *
+ *---------------------------------------------------------------------------------
+ *  Copyright (C) 2009--Present by the FASP team. All rights reserved.
+ *  Released under the terms of the GNU Lesser General Public License 3.0 or later.
+ *---------------------------------------------------------------------------------
+ *
+ *  \note  A full setup (fasp_amg_setup_rs, fasp_amg_setup_sa, or fasp_amg_setup_ua)
+ *         decides the C/F splitting or the aggregates, P, R, and the sparsity of
+ *         the coarse matrices. When only the values of the fine matrix change,
+ *         e.g. in a time stepping loop, these are kept and the coarse matrices
+ *         are refilled by R*A*P in their existing sparsity patterns. For the
+ *         classical AMG with direct interpolation, the values of P and R can be
+ *         computed again from the new matrix in the frozen sparsity of P.
+ */
+
+#include <string.h>
+#include <time.h>
+
+#include "fasp.h"
+#include "fasp_functs.h"
+
+/*---------------------------------*/
+/*--  Declare Private Functions  --*/
+/*---------------------------------*/
+
+static SHORT numeric_copy_values (const dCSRmat *, dCSRmat *);
+static SHORT numeric_interp_dir (AMG_data *);
+
+/*---------------------------------*/
+/*--      Public Functions       --*/
+/*---------------------------------*/
+
+/**
+ * \fn SHORT fasp_amg_setup_numeric (AMG_data *mgl, const dCSRmat *A,
+ *                                   AMG_param *param, const SHORT freeze_P)
+ *
+ * \brief Numeric re-setup of AMG for a matrix with an unchanged sparsity pattern
+ *
+ * \param mgl       Pointer to AMG data after a full setup: AMG_data
+ * \param A         Pointer to the new matrix, with the same sparsity as mgl[0].A
+ * \param param     Pointer to AMG parameters used by the full setup: AMG_param
+ * \param freeze_P  Keep the values of P and R (TRUE) or compute them again (FALSE)
+ *
+ * \return          FASP_SUCCESS if successed; otherwise, error information.
+ *
+ * \author FASP team
+ * \date   10/16/2026
+ *
+ * \note The values of A are copied to mgl[0].A, whose rows might have been
+ *       reordered by the full setup to put the diagonal entries first. On every level, the coarse matrix
+ *       is refilled by R*A*P in its sparsity pattern. If freeze_P is TRUE, the
+ *       values of P and R are kept. Otherwise, the direct interpolation weights
+ *       are computed again from the new level matrix with the C/F splitting and
+ *       the (truncated) sparsity of P, and R = P' is refilled. This is only
+ *       supported by the classical AMG with direct interpolation and without
+ *       aggressive coarsening; in other cases, P and R are kept frozen and a
+ *       warning is printed. The unit P and R of UA AMG never change. ILU and Schwarz smoothers, the coarsest level factorization,
+ *       and the spectrum bounds are set up again for the new values. SpMV plans
+ *       and compressed indices only depend on the sparsity, and they are kept.
+ *       The RAP plans of the full setup are reused if they are available. With
+ *       mixed precision, the coarse matrices are refilled in double precision
+ *       and then converted to single precision again.
+ *
+ * \note ERROR_DATA_STRUCTURE is returned if the sparsity of A differs from that
+ *       of mgl[0].A, or if R*A*P does not fit the sparsity of a coarse matrix
+ *       (e.g. for SA AMG with unsmoothed R whose coarse matrices come from the
+ *       tentative prolongations). A full setup is needed in these cases.
+ */
+SHORT fasp_amg_setup_numeric (AMG_data       *mgl,
+                              const dCSRmat  *A,
+                              AMG_param      *param,
+                              const SHORT     freeze_P)
+{
+    const SHORT memtag = fasp_mem_set_tag(MEM_TAG_AMG); // charge to AMG hierarchy
+    const SHORT prtlvl = param->print_level;
+    const SHORT csolver = param->coarse_solver;
+    const INT   nl = mgl[0].num_levels;
+
+    // local variables
+    SHORT      status = FASP_SUCCESS;
+    SHORT      update_P = !freeze_P && param->AMG_type != UA_AMG;
+    INT        lvl, k;
+    REAL      *Rval, *Pval;
+    REAL       setup_start, setup_end;
+    ILU_param  iluparam;
+    SWZ_param  swzparam;
+
+#if DEBUG_MODE > 0
+    printf("### DEBUG: [-Begin-] %s ...\n", __FUNCTION__);
+    printf("### DEBUG: nr=%d, nc=%d, nnz=%d\n", A->row, A->col, A->nnz);
+#endif
+
+    fasp_gettime(&setup_start);
+
+    // ILUtp permutes the columns of the level matrices
+    if ( param->ILU_levels > 0 && param->ILU_type == ILUtp ) {
+        printf("### ERROR: ILUtp smoother is not supported! [%s]\n", __FUNCTION__);
+        status = ERROR_INPUT_PAR; goto FINISHED;
+    }
+
+    // P can only be computed again for the direct interpolation of classical AMG
+    if ( update_P && ( param->AMG_type != CLASSIC_AMG ||
+                       param->interpolation_type != INTERP_DIR ||
+                       param->aggressive_level > 0 ||
+                       ( param->coarsening_type != COARSE_RS &&
+                         param->coarsening_type != COARSE_RSP ) ) ) {
+        if ( prtlvl > PRINT_NONE )
+            printf("### WARNING: P is kept frozen for this AMG method! [%s]\n", __FUNCTION__);
+        update_P = FALSE;
+    }
+
+    // copy the values of the new matrix if the sparsity is unchanged
+    status = numeric_copy_values(A, &mgl[0].A);
+    if ( status < 0 ) {
+        printf("### ERROR: Sparsity pattern has changed! [%s]\n", __FUNCTION__);
+        goto FINISHED;
+    }
+
+    // coarse level matrices kept in single precision are refilled in double
+    for ( lvl = 1; lvl < nl; ++lvl ) {
+        if ( mgl[lvl].Aval_sp == NULL ) continue;
+        mgl[lvl].A.val = (REAL *)fasp_mem_calloc(MAX(mgl[lvl].A.nnz,1), sizeof(REAL));
+        fasp_mem_free(mgl[lvl].Aval_sp); mgl[lvl].Aval_sp = NULL;
+    }
+
+    // Initialize ILU parameters
+    if ( param->ILU_levels > 0 ) {
+        iluparam.print_level = param->print_level;
+        iluparam.ILU_lfil    = param->ILU_lfil;
+        iluparam.ILU_droptol = param->ILU_droptol;
+        iluparam.ILU_relax   = param->ILU_relax;
+        iluparam.ILU_type    = param->ILU_type;
+    }
+
+    // Initialize Schwarz parameters
+    if ( param->SWZ_levels > 0 ) {
+        swzparam.SWZ_mmsize = param->SWZ_mmsize;
+        swzparam.SWZ_maxlvl = param->SWZ_maxlvl;
+        swzparam.SWZ_type   = param->SWZ_type;
+        swzparam.SWZ_blksolver = param->SWZ_blksolver;
+    }
+
+    for ( lvl = 0; lvl < nl-1; ++lvl ) {
+
+        /*-- Setup ILU decomposition if needed --*/
+        if ( lvl < param->ILU_levels ) {
+            fasp_ilu_data_free(&mgl[lvl].LU);
+            status = fasp_ilu_dcsr_setup(&mgl[lvl].A, &mgl[lvl].LU, &iluparam);
+            if ( status < 0 ) {
+                if ( prtlvl > PRINT_MIN ) {
+                    printf("### WARNING: ILU setup on level-" INTFMT " failed!\n", lvl);
+                    printf("### WARNING: Disable ILU for level >= " INTFMT ".\n", lvl);
+                }
+                param->ILU_levels = mgl->ILU_levels = lvl;
+                status = FASP_SUCCESS;
+            }
+        }
+
+        /*-- Setup Schwarz smoother if needed --*/
+        if ( lvl < param->SWZ_levels ) {
+            fasp_swz_data_free(&mgl[lvl].Schwarz);
+            mgl[lvl].Schwarz.A = fasp_dcsr_sympart(&mgl[lvl].A);
+            fasp_dcsr_shift(&(mgl[lvl].Schwarz.A), 1);
+            status = fasp_swz_dcsr_setup(&mgl[lvl].Schwarz, &swzparam);
+            if ( status < 0 ) {
+                if ( prtlvl > PRINT_MIN ) {
+                    printf("### WARNING: Schwarz on level-" INTFMT " failed!\n", lvl);
+                    printf("### WARNING: Disable Schwarz for level >= " INTFMT ".\n", lvl);
+                }
+                param->SWZ_levels = mgl->SWZ_levels = lvl;
+                status = FASP_SUCCESS;
+            }
+        }
+
+        /*-- Compute P and R = P' again for the new level matrix if needed --*/
+        if ( update_P ) {
+            status = numeric_interp_dir(&mgl[lvl]);
+            if ( status < 0 ) {
+                printf("### ERROR: Cannot update P on level-" INTFMT "! [%s]\n", lvl, __FUNCTION__);
+                goto FINISHED;
+            }
+        }
+
+        /*-- Refill the coarse level matrix by R*A*P --*/
+        // UA AMG forms R*A*P with unit values of R and P, see fasp_blas_dcsr_rap_agg
+        Rval = ( param->AMG_type == UA_AMG ) ? NULL : mgl[lvl].R.val;
+        Pval = ( param->AMG_type == UA_AMG ) ? NULL : mgl[lvl].P.val;
+
+        // P and R might only be kept in single precision
+        if ( Rval == NULL && mgl[lvl].Rval_sp != NULL && param->AMG_type != UA_AMG ) {
+            Rval = (REAL *)fasp_mem_calloc(MAX(mgl[lvl].R.nnz,1), sizeof(REAL));
+            for ( k = 0; k < mgl[lvl].R.nnz; ++k ) Rval[k] = mgl[lvl].Rval_sp[k];
+        }
+        if ( Pval == NULL && mgl[lvl].Pval_sp != NULL && param->AMG_type != UA_AMG ) {
+            Pval = (REAL *)fasp_mem_calloc(MAX(mgl[lvl].P.nnz,1), sizeof(REAL));
+            for ( k = 0; k < mgl[lvl].P.nnz; ++k ) Pval[k] = mgl[lvl].Pval_sp[k];
+        }
+
+        status = fasp_blas_dcsr_rap_numeric(&mgl[lvl].R, Rval, &mgl[lvl].A,
+                                            &mgl[lvl].P, Pval, mgl[lvl].RAPplan,
+                                            &mgl[lvl+1].A);
+
+        if ( Rval != mgl[lvl].R.val ) fasp_mem_free(Rval);
+        if ( Pval != mgl[lvl].P.val ) fasp_mem_free(Pval);
+
+        if ( status < 0 ) {
+            printf("### ERROR: R*A*P does not fit level-" INTFMT "! [%s]\n", lvl+1, __FUNCTION__);
+            goto FINISHED;
+        }
+
+    }
+
+    // Setup coarse level systems for direct solvers
+    lvl = nl-1;
+    switch (csolver) {
+
+#if WITH_MUMPS
+        case SOLVER_MUMPS: {
+            // Destroy and setup MUMPS direct solver on the coarsest level
+            mgl[lvl].mumps.job = 3;
+            fasp_solver_mumps_steps(&mgl[lvl].A, &mgl[lvl].b, &mgl[lvl].x, &mgl[lvl].mumps);
+            mgl[lvl].mumps.job = 1;
+            fasp_solver_mumps_steps(&mgl[lvl].A, &mgl[lvl].b, &mgl[lvl].x, &mgl[lvl].mumps);
+            break;
+        }
+#endif
+
+#if WITH_UMFPACK
+        case SOLVER_UMFPACK: {
+            // The coarsest matrix has been sorted by the full setup
+            fasp_mem_free(mgl[lvl].Numeric); mgl[lvl].Numeric = NULL;
+            mgl[lvl].Numeric = fasp_umfpack_factorize(&mgl[lvl].A, 0);
+            break;
+        }
+#endif
+
+#if WITH_PARDISO
+        case SOLVER_PARDISO: {
+            fasp_pardiso_free_internal_mem(&mgl[lvl].pdata);
+            fasp_pardiso_factorize(&mgl[lvl].A, &mgl[lvl].pdata, prtlvl);
+            break;
+        }
+#endif
+
+        default:
+            // Do nothing!
+            break;
+    }
+
+    // spectrum bounds of inv(D)*A for the poly smoother and the AMLI cycle
+    fasp_amg_data_eig_bounds(mgl, param);
+
+    // convert the coarse level matrices to single precision again
+    if ( param->mixed_precision == ON ) fasp_amg_data_mixed_precision(mgl, param);
+
+    if ( prtlvl > PRINT_NONE ) {
+        fasp_gettime(&setup_end);
+        fasp_cputime("AMG numeric setup", setup_end - setup_start);
+    }
+
+FINISHED:
+#if DEBUG_MODE > 0
+    printf("### DEBUG: [--End--] %s ...\n", __FUNCTION__);
+#endif
+
+    fasp_mem_set_tag(memtag);
+
+    return status;
+}
+
+/*---------------------------------*/
+/*--      Private Functions      --*/
+/*---------------------------------*/
+
+/**
+ * \fn static SHORT numeric_copy_values (const dCSRmat *A, dCSRmat *A0)
+ *
+ * \brief Copy the values of A to A0 if they have the same sparsity
+ *
+ * \param A    Pointer to the new matrix: dCSRmat
+ * \param A0   Pointer to the matrix of the full setup: dCSRmat
+ *
+ * \return     FASP_SUCCESS if successed; otherwise, error information.
+ *
+ * \author FASP team
+ * \date   10/16/2026
+ *
+ * \note A row of A0 either has the same order as that of A, or its diagonal
+ *       entry has been swapped to the front by fasp_dcsr_diagpref.
+ */
+static SHORT numeric_copy_values (const dCSRmat  *A,
+                                  dCSRmat        *A0)
+{
+    const INT  row = A->row;
+    const INT *ia = A->IA, *ja = A->JA;
+
+    // local variables
+    SHORT      status = FASP_SUCCESS;
+    INT        i, k, d;
+
+    if ( row != A0->row || A->col != A0->col || A->nnz != A0->nnz ||
+         memcmp(ia, A0->IA, (row+1)*sizeof(INT)) != 0 ) return ERROR_DATA_STRUCTURE;
+
+#ifdef _OPENMP
+#pragma omp parallel for private(i, k, d) if (row > OPENMP_HOLDS)
+#endif
+    for ( i = 0; i < row; ++i ) {
+
+        if ( ia[i] == ia[i+1] ) continue;
+
+        // position of the entry of A which is at the front of the row of A0
+        for ( d = ia[i]; d < ia[i+1]; ++d ) {
+            if ( ja[d] == A0->JA[ia[i]] ) break;
+        }
+        if ( d == ia[i+1] || ( d > ia[i] && ja[d] != i ) ) {
+            status = ERROR_DATA_STRUCTURE; continue;
+        }
+
+        for ( k = ia[i]; k < ia[i+1]; ++k ) {
+            // the entries at ia[i] and d are swapped
+            const INT l = ( k == ia[i] ) ? d : ( ( k == d ) ? ia[i] : k );
+            if ( A0->JA[k] != ja[l] ) { status = ERROR_DATA_STRUCTURE; break; }
+            A0->val[k] = A->val[l];
+        }
+
+    } // end for i
+
+    return status;
+}
+
+/**
+ * \fn static SHORT numeric_interp_dir (AMG_data *mgl)
+ *
+ * \brief Compute the direct interpolation weights of P and R = P' on one level
+ *        again, in the sparsity of P and with the C/F splitting of the full setup
+ *
+ * \param mgl  Pointer to AMG data of the current level: AMG_data
+ *
+ * \return     FASP_SUCCESS if successed; otherwise, error information.
+ *
+ * \author FASP team
+ * \date   10/16/2026
+ *
+ * \note The weights are the same as those of interp_DIR in PreAMGInterp.c, with
+ *       the interpolatory set given by the columns of P. As the truncation of P
+ *       only drops columns and rescales the remaining weights, the row sums are
+ *       kept in the same way. P and R are updated in single precision if their
+ *       double values have been freed by the mixed precision setup.
+ */
+static SHORT numeric_interp_dir (AMG_data *mgl)
+{
+    const dCSRmat *A = &mgl->A;
+    dCSRmat       *P = &mgl->P, *R = &mgl->R;
+    const INT      row = A->row, nc = P->col;
+    const INT     *ia = A->IA, *ja = A->JA, *vec = mgl->cfmark.val;
+    const REAL    *aj = A->val;
+
+    // local variables
+    SHORT   status = FASP_SUCCESS;
+    INT     num_pcouple, i, j, k, l, c;
+    REAL    amN, amP, apN, apP, alpha, beta, aii, aij;
+    REAL   *Pval = P->val, *Rval = R->val;
+    INT    *cindex, *next;
+
+    if ( vec == NULL || mgl->cfmark.row != row || P->row != row || R->row != nc ||
+         ( Pval == NULL && mgl->Pval_sp == NULL ) ||
+         ( Rval == NULL && mgl->Rval_sp == NULL ) ) return ERROR_DATA_STRUCTURE;
+
+    // cindex[c] is the fine index of the c-th coarse point
+    cindex = (INT *)fasp_mem_calloc(MAX(nc,1), sizeof(INT));
+    for ( c = i = 0; i < row; ++i ) {
+        if ( vec[i] != CGPT ) continue;
+        if ( c == nc ) { status = ERROR_DATA_STRUCTURE; goto FINISHED; }
+        cindex[c++] = i;
+    }
+    if ( c != nc ) { status = ERROR_DATA_STRUCTURE; goto FINISHED; }
+
+    if ( Pval == NULL ) Pval = (REAL *)fasp_mem_calloc(MAX(P->nnz,1), sizeof(REAL));
+    if ( Rval == NULL ) Rval = (REAL *)fasp_mem_calloc(MAX(R->nnz,1), sizeof(REAL));
+
+    // Step 1. Fill in the weights of the F rows; C rows have the unit weight
+#ifdef _OPENMP
+#pragma omp parallel for private(i, j, k, l, num_pcouple, amN, amP, apN, apP, \
+                                 alpha, beta, aii, aij) if (row > OPENMP_HOLDS)
+#endif
+    for ( i = 0; i < row; ++i ) {
+
+        if ( vec[i] == CGPT ) { Pval[P->IA[i]] = 1.0; continue; }
+        if ( vec[i] != FGPT ) continue; // isolated points are not interpolated
+
+        aii = amN = amP = apN = apP = 0.0; num_pcouple = 0;
+        for ( j = ia[i]; j < ia[i+1]; ++j ) {
+            if ( ja[j] == i ) { aii = aj[j]; continue; }
+            for ( k = P->IA[i]; k < P->IA[i+1]; ++k ) {
+                if ( cindex[P->JA[k]] == ja[j] ) break;
+            }
+            if ( aj[j] > 0 ) {
+                apN += aj[j];
+                if ( k < P->IA[i+1] ) { apP += aj[j]; num_pcouple++; }
+            }
+            else {
+                amN += aj[j];
+                if ( k < P->IA[i+1] ) amP += aj[j];
+            }
+        }
+
+        alpha = ( amP != 0.0 ) ? amN/amP : 0.0;
+        if ( num_pcouple > 0 ) {
+            beta = apN/apP;
+        }
+        else {
+            beta = 0.0; aii += apN;
+        }
+
+        for ( k = P->IA[i]; k < P->IA[i+1]; ++k ) {
+            aij = 0.0;
+            for ( l = ia[i]; l < ia[i+1]; ++l ) {
+                if ( ja[l] == cindex[P->JA[k]] ) { aij = aj[l]; break; }
+            }
+            Pval[k] = ( aij > 0 ) ? -beta*aij/aii : -alpha*aij/aii;
+        }
+
+    } // end for i
+
+    // Step 2. Refill R = P' in the sparsity given by fasp_dcsr_trans
+    next = (INT *)fasp_mem_calloc(MAX(nc,1), sizeof(INT));
+    memcpy(next, R->IA, nc*sizeof(INT));
+    for ( i = 0; i < row && status == FASP_SUCCESS; ++i ) {
+        for ( k = P->IA[i]; k < P->IA[i+1]; ++k ) {
+            l = next[P->JA[k]]++;
+            if ( l >= R->IA[P->JA[k]+1] || R->JA[l] != i ) {
+                status = ERROR_DATA_STRUCTURE; break;
+            }
+            Rval[l] = Pval[k];
+        }
+    }
+    fasp_mem_free(next); next = NULL;
+
+    // P and R might only be kept in single precision
+    if ( Pval != P->val ) {
+        for ( k = 0; k < P->nnz; ++k ) mgl->Pval_sp[k] = (SREAL)Pval[k];
+        fasp_mem_free(Pval); Pval = NULL;
+    }
+    if ( Rval != R->val ) {
+        for ( k = 0; k < R->nnz; ++k ) mgl->Rval_sp[k] = (SREAL)Rval[k];
+        fasp_mem_free(Rval); Rval = NULL;
+    }
+
+FINISHED:
+    fasp_mem_free(cindex); cindex = NULL;
+
+    return status;
+}
+
+/*---------------------------------*/
+/*--        End of File          --*/
+/*---------------------------------*/
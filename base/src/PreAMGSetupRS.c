@@ -47,10 +47,19 @@
  * Modified by Xiaozhe Hu on 01/23/2011: add AMLI cycle.
  * Modified by Xiaozhe Hu on 04/24/2013: aggressive coarsening.
  * Modified by Chensong Zhang on 09/23/2014: check coarse spaces.
+ * Modified by FASP team on 10/16/2026: mixed precision P and R.
+ * Modified by FASP team on 10/16/2026: compressed column indices of A.
+ * Modified by FASP team on 10/16/2026: account memory to the AMG hierarchy.
+ * Modified by FASP team on 10/16/2026: spectrum bounds of inv(D)*A.
+ * Modified by FASP team on 10/16/2026: keep the symbolic RAP plan.
+ * Modified by FASP team on 10/16/2026: keep PMIS and HMIS on all levels.
+ * Modified by FASP team on 10/16/2026: first touch of b and x with SpMV rows.
+ * Modified by FASP team on 10/16/2026: keep AMLI coefficients given by the user.
  */
 SHORT fasp_amg_setup_rs (AMG_data   *mgl,
                          AMG_param  *param)
 {
+    const SHORT memtag = fasp_mem_set_tag(MEM_TAG_AMG); // charge to AMG hierarchy
     const SHORT prtlvl     = param->print_level;
     const SHORT cycle_type = param->cycle_type;
     const SHORT csolver    = param->coarse_solver;
@@ -88,11 +97,12 @@ SHORT fasp_amg_setup_rs (AMG_data   *mgl,
         param->aggressive_level = MAX(param->aggressive_level, 1);
     }
 
-    // Initialize AMLI coefficients
-    if ( cycle_type == AMLI_CYCLE ) {
+    // Initialize AMLI coefficients, unless they are given by the user
+    if ( cycle_type == AMLI_CYCLE && param->amli_coef == NULL ) {
         const INT amlideg = param->amli_degree;
         param->amli_coef = (REAL *)fasp_mem_calloc(amlideg+1,sizeof(REAL));
         fasp_amg_amli_coef(2.0, 0.5, amlideg, param->amli_coef);
+        mgl->amli_coef_setup = TRUE;
     }
 
     // Initialize ILU parameters
@@ -132,8 +142,8 @@ SHORT fasp_amg_setup_rs (AMG_data   *mgl,
             status = fasp_ilu_dcsr_setup(&mgl[lvl].A, &mgl[lvl].LU, &iluparam);
             if ( status < 0 ) {
                 if ( prtlvl > PRINT_MIN ) {
-                    printf("### WARNING: ILU setup on level-%d failed!\n", lvl);
-                    printf("### WARNING: Disable ILU for level >= %d.\n", lvl);
+                    printf("### WARNING: ILU setup on level-" INTFMT " failed!\n", lvl);
+                    printf("### WARNING: Disable ILU for level >= " INTFMT ".\n", lvl);
                 }
                 param->ILU_levels = lvl;
             }
@@ -146,8 +156,8 @@ SHORT fasp_amg_setup_rs (AMG_data   *mgl,
             status = fasp_swz_dcsr_setup(&mgl[lvl].Schwarz, &swzparam);
             if ( status < 0 ) {
                 if ( prtlvl > PRINT_MIN ) {
-                    printf("### WARNING: Schwarz on level-%d failed!\n", lvl);
-                    printf("### WARNING: Disable Schwarz for level >= %d.\n", lvl);
+                    printf("### WARNING: Schwarz on level-" INTFMT " failed!\n", lvl);
+                    printf("### WARNING: Disable Schwarz for level >= " INTFMT ".\n", lvl);
                 }
                 param->SWZ_levels = lvl;
             }
@@ -166,7 +176,7 @@ SHORT fasp_amg_setup_rs (AMG_data   *mgl,
             // When error happens, stop at the current multigrid level!
             if ( prtlvl > PRINT_MIN ) {
                 printf("### WARNING: Could not find any C-variables!\n");
-                printf("### WARNING: Stop coarsening on level=%d!\n", lvl);
+                printf("### WARNING: Stop coarsening on level=" INTFMT "!\n", lvl);
             }
             status = FASP_SUCCESS; break;
         }
@@ -183,7 +193,7 @@ SHORT fasp_amg_setup_rs (AMG_data   *mgl,
         if ( mgl[lvl].P.row > mgl[lvl].P.col * 10.0 ) {
             if ( prtlvl > PRINT_MIN ) {
                 printf("### WARNING: Coarsening might be too aggressive!\n");
-                printf("### WARNING: Fine level = %d, coarse level = %d. Discard!\n",
+                printf("### WARNING: Fine level = " INTFMT ", coarse level = " INTFMT ". Discard!\n",
                        mgl[lvl].P.row, mgl[lvl].P.col);
             }
 
@@ -194,8 +204,10 @@ SHORT fasp_amg_setup_rs (AMG_data   *mgl,
         }
 
         /*-- Perform aggressive coarsening only up to the specified level --*/
-        if ( mgl[lvl].P.col*1.5 > mgl[lvl].A.row ) param->coarsening_type = COARSE_RS;
-        if ( lvl == param->aggressive_level ) param->coarsening_type = COARSE_RS;
+        if ( param->coarsening_type != COARSE_PMIS && param->coarsening_type != COARSE_HMIS ) {
+            if ( mgl[lvl].P.col*1.5 > mgl[lvl].A.row ) param->coarsening_type = COARSE_RS;
+            if ( lvl == param->aggressive_level ) param->coarsening_type = COARSE_RS;
+        }
 
         /*-- Store the C/F marker --*/
         {
@@ -210,7 +222,11 @@ SHORT fasp_amg_setup_rs (AMG_data   *mgl,
         /*-- Form coarse level matrix: two RAP routines available! --*/
         fasp_dcsr_trans(&mgl[lvl].P, &mgl[lvl].R);
 
-        fasp_blas_dcsr_rap(&mgl[lvl].R, &mgl[lvl].A, &mgl[lvl].P, &mgl[lvl+1].A);
+        mgl[lvl].RAPplan = fasp_blas_dcsr_rap_symbolic(&mgl[lvl].R, &mgl[lvl].A,
+                                                       &mgl[lvl].P, &mgl[lvl+1].A);
+        fasp_blas_dcsr_rap_numeric(&mgl[lvl].R, mgl[lvl].R.val, &mgl[lvl].A,
+                                   &mgl[lvl].P, mgl[lvl].P.val, mgl[lvl].RAPplan,
+                                   &mgl[lvl+1].A);
 
         /*-- Clean up Scouple generated in coarsening --*/
         fasp_mem_free(Scouple.IA); Scouple.IA = NULL;
@@ -227,7 +243,7 @@ SHORT fasp_amg_setup_rs (AMG_data   *mgl,
         if ( mgl[lvl].A.nnz / mgl[lvl].A.row > mgl[lvl].A.col * 0.2 ) {
             if ( prtlvl > PRINT_MIN ) {
                 printf("### WARNING: Coarse matrix is too dense!\n");
-                printf("### WARNING: m = n = %d, nnz = %d!\n",
+                printf("### WARNING: m = n = " INTFMT ", nnz = " INTFMT "!\n",
                        mgl[lvl].A.col, mgl[lvl].A.nnz);
             }
 
@@ -285,8 +301,8 @@ SHORT fasp_amg_setup_rs (AMG_data   *mgl,
         const INT mm        = mgl[lvl].A.row;
         
         mgl[lvl].num_levels = max_lvls;
-        mgl[lvl].b          = fasp_dvec_create(mm);
-        mgl[lvl].x          = fasp_dvec_create(mm);
+        mgl[lvl].b          = fasp_dvec_create_rows(&mgl[lvl].A);
+        mgl[lvl].x          = fasp_dvec_create_rows(&mgl[lvl].A);
 
         mgl[lvl].cycle_type = cycle_type; // initialize cycle type!
         mgl[lvl].ILU_levels = param->ILU_levels - lvl; // initialize ILU levels!
@@ -322,6 +338,17 @@ SHORT fasp_amg_setup_rs (AMG_data   *mgl,
     }
 #endif
 
+    // store P, R, and coarse level A in single precision for the cycles
+    if ( status == FASP_SUCCESS && param->mixed_precision == ON )
+        fasp_amg_data_mixed_precision(mgl, param);
+
+    // compress the column indices of A for the cycles
+    if ( status == FASP_SUCCESS && param->compress_index == ON )
+        fasp_amg_data_compress_index(mgl);
+
+    // spectrum bounds of inv(D)*A for the poly smoother and the AMLI cycle
+    if ( status == FASP_SUCCESS ) fasp_amg_data_eig_bounds(mgl, param);
+
     if ( prtlvl > PRINT_NONE ) {
         fasp_gettime(&setup_end);
         fasp_amgcomplexity(mgl, prtlvl);
@@ -332,6 +359,8 @@ SHORT fasp_amg_setup_rs (AMG_data   *mgl,
     printf("### DEBUG: [--End--] %s ...\n", __FUNCTION__);
 #endif
 
+    fasp_mem_set_tag(memtag);
+
     return status;
 }
 
@@ -59,10 +59,15 @@ static void smooth_agg (dCSRmat *, dCSRmat *, dCSRmat *, AMG_param *, dCSRmat *)
  *
  * Modified by Xiaozhe Hu on 01/23/2011: add AMLI cycle.
  * Modified by Chensong Zhang on 05/10/2013: adjust the structure.
+ * Modified by FASP team on 10/16/2026: mixed precision P and R.
+ * Modified by FASP team on 10/16/2026: compressed column indices of A.
+ * Modified by FASP team on 10/16/2026: account memory to the AMG hierarchy.
+ * Modified by FASP team on 10/16/2026: spectrum bounds of inv(D)*A.
  */
 SHORT fasp_amg_setup_sa (AMG_data   *mgl,
                          AMG_param  *param)
 {
+    const SHORT memtag = fasp_mem_set_tag(MEM_TAG_AMG); // charge to AMG hierarchy
     const SHORT prtlvl     = param->print_level;
     const SHORT smoothR    = param->smooth_restriction;
     SHORT status           = FASP_SUCCESS;
@@ -83,10 +88,23 @@ SHORT fasp_amg_setup_sa (AMG_data   *mgl,
         status = amg_setup_smoothP_unsmoothR(mgl, param);
     }
 
+    // store P, R, and coarse level A in single precision for the cycles
+    if ( status == FASP_SUCCESS && param->mixed_precision == ON )
+        fasp_amg_data_mixed_precision(mgl, param);
+
+    // compress the column indices of A for the cycles
+    if ( status == FASP_SUCCESS && param->compress_index == ON )
+        fasp_amg_data_compress_index(mgl);
+
+    // spectrum bounds of inv(D)*A for the poly smoother and the AMLI cycle
+    if ( status == FASP_SUCCESS ) fasp_amg_data_eig_bounds(mgl, param);
+
 #if DEBUG_MODE > 0
     printf("### DEBUG: [--End--] %s ...\n", __FUNCTION__);
 #endif
 
+    fasp_mem_set_tag(memtag);
+
     return status;
 }
 
@@ -250,6 +268,11 @@ static void smooth_agg (dCSRmat    *A,
  * Modified by Chensong Zhang on 05/10/2013: adjust the structure.
  * Modified by Chensong Zhang on 07/26/2014: handle coarsening errors.
  * Modified by Chensong Zhang on 09/23/2014: check coarse spaces.
+ * Modified by FASP team on 10/16/2026: keep the symbolic RAP plan.
+ * Modified by FASP team on 10/16/2026: distance-2 MIS aggregation.
+ * Modified by FASP team on 10/16/2026: work space from the work arena.
+ * Modified by FASP team on 10/16/2026: first touch of b and x with SpMV rows.
+ * Modified by FASP team on 10/16/2026: keep AMLI coefficients given by the user.
  */
 static SHORT amg_setup_smoothP_smoothR (AMG_data   *mgl,
                                         AMG_param  *param)
@@ -273,17 +296,20 @@ static SHORT amg_setup_smoothP_smoothR (AMG_data   *mgl,
 
     fasp_gettime(&setup_start);
 
+    // temporary level data is drawn from the work arena
+    const size_t mark = fasp_arena_mark(NULL);
+
     // level info (fine: 0; coarse: 1)
-    ivector *vertices = (ivector *)fasp_mem_calloc(max_levels,sizeof(ivector));
+    ivector *vertices = (ivector *)fasp_arena_calloc(NULL,max_levels,sizeof(ivector));
 
     // each elvel stores the information of the number of aggregations
-    INT *num_aggs = (INT *)fasp_mem_calloc(max_levels,sizeof(INT));
+    INT *num_aggs = (INT *)fasp_arena_calloc(NULL,max_levels,sizeof(INT));
 
     // each level stores the information of the strongly coupled neighbourhood
-    dCSRmat *Neighbor = (dCSRmat *)fasp_mem_calloc(max_levels,sizeof(dCSRmat));
+    dCSRmat *Neighbor = (dCSRmat *)fasp_arena_calloc(NULL,max_levels,sizeof(dCSRmat));
 
     // each level stores the information of the tentative prolongations
-    dCSRmat *tentp = (dCSRmat *)fasp_mem_calloc(max_levels,sizeof(dCSRmat));
+    dCSRmat *tentp = (dCSRmat *)fasp_arena_calloc(NULL,max_levels,sizeof(dCSRmat));
 
     // Initialize level information
     for ( i = 0; i < max_levels; ++i ) num_aggs[i] = 0;
@@ -315,12 +341,13 @@ static SHORT amg_setup_smoothP_smoothR (AMG_data   *mgl,
         swzparam.SWZ_blksolver = param->SWZ_blksolver;
     }
 
-    // Initialize AMLI coefficients
-    if ( cycle_type == AMLI_CYCLE ) {
+    // Initialize AMLI coefficients, unless they are given by the user
+    if ( cycle_type == AMLI_CYCLE && param->amli_coef == NULL ) {
         const INT amlideg = param->amli_degree;
         param->amli_coef = (REAL *)fasp_mem_calloc(amlideg+1,sizeof(REAL));
         REAL lambda_max = 2.0, lambda_min = lambda_max/4;
         fasp_amg_amli_coef(lambda_max, lambda_min, amlideg, param->amli_coef);
+        mgl->amli_coef_setup = TRUE;
     }
 
 #if DIAGONAL_PREF
@@ -368,8 +395,12 @@ static SHORT amg_setup_smoothP_smoothR (AMG_data   *mgl,
         }
 
         /*-- Aggregation --*/
-        status = aggregation_vmb(&mgl[lvl].A, &vertices[lvl], param, lvl+1,
-                                 &Neighbor[lvl], &num_aggs[lvl]);
+        if ( param->aggregation_type == MIS2 )
+            status = aggregation_mis2(&mgl[lvl].A, &vertices[lvl], param, lvl+1,
+                                      &Neighbor[lvl], &num_aggs[lvl]);
+        else
+            status = aggregation_vmb(&mgl[lvl].A, &vertices[lvl], param, lvl+1,
+                                     &Neighbor[lvl], &num_aggs[lvl]);
 
         // Check 1: Did coarsening step succeed?
         if ( status < 0 ) {
@@ -402,7 +433,7 @@ static SHORT amg_setup_smoothP_smoothR (AMG_data   *mgl,
         if ( mgl[lvl].P.row > mgl[lvl].P.col * MAX_CRATE ) {
             if ( prtlvl > PRINT_MIN ) {
                 printf("### WARNING: Coarsening might be too aggressive!\n");
-                printf("### WARNING: Fine level = %d, coarse level = %d. Discard!\n",
+                printf("### WARNING: Fine level = " INTFMT ", coarse level = " INTFMT ". Discard!\n",
                        mgl[lvl].P.row, mgl[lvl].P.col);
             }
             fasp_ivec_free(&vertices[lvl]);
@@ -415,7 +446,11 @@ static SHORT amg_setup_smoothP_smoothR (AMG_data   *mgl,
         fasp_dcsr_trans(&mgl[lvl].P, &mgl[lvl].R);
 
         /*-- Form coarse level stiffness matrix --*/
-        fasp_blas_dcsr_rap(&mgl[lvl].R, &mgl[lvl].A, &mgl[lvl].P, &mgl[lvl+1].A);
+        mgl[lvl].RAPplan = fasp_blas_dcsr_rap_symbolic(&mgl[lvl].R, &mgl[lvl].A,
+                                                       &mgl[lvl].P, &mgl[lvl+1].A);
+        fasp_blas_dcsr_rap_numeric(&mgl[lvl].R, mgl[lvl].R.val, &mgl[lvl].A,
+                                   &mgl[lvl].P, mgl[lvl].P.val, mgl[lvl].RAPplan,
+                                   &mgl[lvl+1].A);
 
         fasp_dcsr_free(&Neighbor[lvl]);
         fasp_dcsr_free(&tentp[lvl]);
@@ -432,7 +467,7 @@ static SHORT amg_setup_smoothP_smoothR (AMG_data   *mgl,
         if ( (REAL)mgl[lvl].P.col > mgl[lvl].P.row * MIN_CRATE ) {
             if ( prtlvl > PRINT_MIN ) {
                 printf("### WARNING: Coarsening rate is too small!\n");
-                printf("### WARNING: Fine level = %d, coarse level = %d. Discard!\n",
+                printf("### WARNING: Fine level = " INTFMT ", coarse level = " INTFMT ". Discard!\n",
                        mgl[lvl].P.row, mgl[lvl].P.col);
             }
             
@@ -489,8 +524,8 @@ static SHORT amg_setup_smoothP_smoothR (AMG_data   *mgl,
     for ( lvl = 1; lvl < max_levels; ++lvl) {
         INT mm = mgl[lvl].A.row;
         mgl[lvl].num_levels = max_levels;
-        mgl[lvl].b          = fasp_dvec_create(mm);
-        mgl[lvl].x          = fasp_dvec_create(mm);
+        mgl[lvl].b          = fasp_dvec_create_rows(&mgl[lvl].A);
+        mgl[lvl].x          = fasp_dvec_create_rows(&mgl[lvl].A);
 
         mgl[lvl].cycle_type = cycle_type; // initialize cycle type!
         mgl[lvl].ILU_levels = param->ILU_levels - lvl; // initialize ILU levels!
@@ -529,10 +564,8 @@ static SHORT amg_setup_smoothP_smoothR (AMG_data   *mgl,
         fasp_cputime("Smoothed aggregation setup", setup_end - setup_start);
     }
 
-    fasp_mem_free(vertices); vertices = NULL;
-    fasp_mem_free(num_aggs); num_aggs = NULL;
-    fasp_mem_free(Neighbor); Neighbor = NULL;
-    fasp_mem_free(tentp);    tentp    = NULL;
+    fasp_arena_release(NULL,mark);
+    vertices = NULL; num_aggs = NULL; Neighbor = NULL; tentp = NULL;
 
 #if DEBUG_MODE > 0
     printf("### DEBUG: [--End--] %s ...\n", __FUNCTION__);
@@ -555,6 +588,10 @@ static SHORT amg_setup_smoothP_smoothR (AMG_data   *mgl,
  * Modified by Chensong Zhang on 05/10/2013: adjust the structure.
  * Modified by Chensong Zhang on 07/26/2014: handle coarsening errors.
  * Modified by Chensong Zhang on 09/23/2014: check coarse spaces.
+ * Modified by FASP team on 10/16/2026: distance-2 MIS aggregation.
+ * Modified by FASP team on 10/16/2026: work space from the work arena.
+ * Modified by FASP team on 10/16/2026: first touch of b and x with SpMV rows.
+ * Modified by FASP team on 10/16/2026: keep AMLI coefficients given by the user.
  */
 static SHORT amg_setup_smoothP_unsmoothR (AMG_data   *mgl,
                                           AMG_param  *param)
@@ -578,18 +615,21 @@ static SHORT amg_setup_smoothP_unsmoothR (AMG_data   *mgl,
 
     fasp_gettime(&setup_start);
 
+    // temporary level data is drawn from the work arena
+    const size_t mark = fasp_arena_mark(NULL);
+
     // level info (fine: 0; coarse: 1)
-    ivector *vertices = (ivector *)fasp_mem_calloc(max_levels,sizeof(ivector));
+    ivector *vertices = (ivector *)fasp_arena_calloc(NULL,max_levels,sizeof(ivector));
 
     // each level stores the information of the number of aggregations
-    INT *num_aggs = (INT *)fasp_mem_calloc(max_levels,sizeof(INT));
+    INT *num_aggs = (INT *)fasp_arena_calloc(NULL,max_levels,sizeof(INT));
 
     // each level stores the information of the strongly coupled neighbourhood
-    dCSRmat *Neighbor = (dCSRmat *)fasp_mem_calloc(max_levels,sizeof(dCSRmat));
+    dCSRmat *Neighbor = (dCSRmat *)fasp_arena_calloc(NULL,max_levels,sizeof(dCSRmat));
 
     // each level stores the information of the tentative prolongations
-    dCSRmat *tentp = (dCSRmat *)fasp_mem_calloc(max_levels,sizeof(dCSRmat));
-    dCSRmat *tentr = (dCSRmat *)fasp_mem_calloc(max_levels,sizeof(dCSRmat));
+    dCSRmat *tentp = (dCSRmat *)fasp_arena_calloc(NULL,max_levels,sizeof(dCSRmat));
+    dCSRmat *tentr = (dCSRmat *)fasp_arena_calloc(NULL,max_levels,sizeof(dCSRmat));
 
     for ( i = 0; i < max_levels; ++i ) num_aggs[i] = 0;
 
@@ -620,12 +660,13 @@ static SHORT amg_setup_smoothP_unsmoothR (AMG_data   *mgl,
         swzparam.SWZ_blksolver = param->SWZ_blksolver;
     }
 
-    // Initialize AMLI coefficients
-    if ( cycle_type == AMLI_CYCLE ) {
+    // Initialize AMLI coefficients, unless they are given by the user
+    if ( cycle_type == AMLI_CYCLE && param->amli_coef == NULL ) {
         const INT amlideg = param->amli_degree;
         param->amli_coef = (REAL *)fasp_mem_calloc(amlideg+1,sizeof(REAL));
         REAL lambda_max = 2.0, lambda_min = lambda_max/4;
         fasp_amg_amli_coef(lambda_max, lambda_min, amlideg, param->amli_coef);
+        mgl->amli_coef_setup = TRUE;
     }
 
     // Main AMG setup loop
@@ -658,8 +699,12 @@ static SHORT amg_setup_smoothP_unsmoothR (AMG_data   *mgl,
         }
 
         /*-- Aggregation --*/
-        status = aggregation_vmb(&mgl[lvl].A, &vertices[lvl], param, lvl+1,
-                                 &Neighbor[lvl], &num_aggs[lvl]);
+        if ( param->aggregation_type == MIS2 )
+            status = aggregation_mis2(&mgl[lvl].A, &vertices[lvl], param, lvl+1,
+                                      &Neighbor[lvl], &num_aggs[lvl]);
+        else
+            status = aggregation_vmb(&mgl[lvl].A, &vertices[lvl], param, lvl+1,
+                                     &Neighbor[lvl], &num_aggs[lvl]);
 
         // Check 1: Did coarsening step succeeded?
         if ( status < 0 ) {
@@ -684,7 +729,7 @@ static SHORT amg_setup_smoothP_unsmoothR (AMG_data   *mgl,
         if ( mgl[lvl].P.row > mgl[lvl].P.col * MAX_CRATE ) {
             if ( prtlvl > PRINT_MIN ) {
                 printf("### WARNING: Coarsening might be too aggressive!\n");
-                printf("### WARNING: Fine level = %d, coarse level = %d. Discard!\n",
+                printf("### WARNING: Fine level = " INTFMT ", coarse level = " INTFMT ". Discard!\n",
                        mgl[lvl].P.row, mgl[lvl].P.col);
             }
             break;
@@ -694,7 +739,7 @@ static SHORT amg_setup_smoothP_unsmoothR (AMG_data   *mgl,
         if ( (REAL)mgl[lvl].P.col > mgl[lvl].P.row * MIN_CRATE ) {
             if ( prtlvl > PRINT_MIN ) {
                 printf("### WARNING: Coarsening rate is too small!\n");
-                printf("### WARNING: Fine level = %d, coarse level = %d. Discard!\n",
+                printf("### WARNING: Fine level = " INTFMT ", coarse level = " INTFMT ". Discard!\n",
                        mgl[lvl].P.row, mgl[lvl].P.col);
             }
             break;
@@ -762,8 +807,8 @@ static SHORT amg_setup_smoothP_unsmoothR (AMG_data   *mgl,
     for ( lvl = 1; lvl < max_levels; ++lvl) {
         INT mm = mgl[lvl].A.row;
         mgl[lvl].num_levels = max_levels;
-        mgl[lvl].b          = fasp_dvec_create(mm);
-        mgl[lvl].x          = fasp_dvec_create(mm);
+        mgl[lvl].b          = fasp_dvec_create_rows(&mgl[lvl].A);
+        mgl[lvl].x          = fasp_dvec_create_rows(&mgl[lvl].A);
 
         mgl[lvl].cycle_type     = cycle_type; // initialize cycle type!
         mgl[lvl].ILU_levels     = param->ILU_levels - lvl; // initialize ILU levels!
@@ -802,11 +847,8 @@ static SHORT amg_setup_smoothP_unsmoothR (AMG_data   *mgl,
         fasp_cputime("Smoothed aggregation 1/2 setup", setup_end - setup_start);
     }
 
-    fasp_mem_free(vertices); vertices = NULL;
-    fasp_mem_free(num_aggs); num_aggs = NULL;
-    fasp_mem_free(Neighbor); Neighbor = NULL;
-    fasp_mem_free(tentp);    tentp    = NULL;
-    fasp_mem_free(tentr);    tentr    = NULL;
+    fasp_arena_release(NULL,mark);
+    vertices = NULL; num_aggs = NULL; Neighbor = NULL; tentp = NULL; tentr = NULL;
 
 #if DEBUG_MODE > 0
     printf("### DEBUG: [--End--] %s ...\n", __FUNCTION__);
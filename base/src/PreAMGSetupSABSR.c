@@ -33,7 +33,6 @@
 /*--  Declare Private Functions  --*/
 /*---------------------------------*/
 
-#include "PreAMGAggregation.inl"
 #include "PreAMGAggregationBSR.inl"
 #include "PreAMGAggregationUA.inl"
 
@@ -57,20 +56,31 @@ static void smooth_agg_bsr (const dBSRmat *, dBSRmat *, dBSRmat *, const AMG_par
  *
  * \author Xiaozhe Hu
  * \date   05/26/2014
+ *
+ * Modified by FASP team on 10/16/2026: mixed precision P and R.
+ * Modified by FASP team on 10/16/2026: account memory to the AMG hierarchy.
  */
 SHORT fasp_amg_setup_sa_bsr (AMG_data_bsr  *mgl,
                              AMG_param     *param)
 {
+    const SHORT memtag = fasp_mem_set_tag(MEM_TAG_AMG); // charge to AMG hierarchy
+
 #if DEBUG_MODE > 0
     printf("### DEBUG: [-Begin-] %s ...\n", __FUNCTION__);
 #endif
 
     SHORT status = amg_setup_smoothP_smoothR_bsr(mgl, param);
 
+    // store P and R in single precision for the cycles
+    if ( status == FASP_SUCCESS && param->mixed_precision == ON )
+        fasp_amg_data_bsr_mixed_precision(mgl);
+
 #if DEBUG_MODE > 0
     printf("### DEBUG: [--End--] %s ...\n", __FUNCTION__);
 #endif
 
+    fasp_mem_set_tag(memtag);
+
     return status;
 }
 
@@ -51,10 +51,16 @@ static SHORT amg_setup_unsmoothP_unsmoothR(AMG_data *, AMG_param *);
  *
  * \author Xiaozhe Hu
  * \date   12/28/2011
+ *
+ * Modified by FASP team on 10/16/2026: mixed precision P and R.
+ * Modified by FASP team on 10/16/2026: compressed column indices of A.
+ * Modified by FASP team on 10/16/2026: account memory to the AMG hierarchy.
+ * Modified by FASP team on 10/16/2026: spectrum bounds of inv(D)*A.
  */
 SHORT fasp_amg_setup_ua (AMG_data *mgl,
                          AMG_param *param)
 {
+    const SHORT memtag = fasp_mem_set_tag(MEM_TAG_AMG); // charge to AMG hierarchy
     const SHORT prtlvl = param->print_level;
 
     // Output some info for debuging
@@ -68,10 +74,23 @@ SHORT fasp_amg_setup_ua (AMG_data *mgl,
 
     SHORT status = amg_setup_unsmoothP_unsmoothR(mgl, param);
 
+    // store P, R, and coarse level A in single precision for the cycles
+    if ( status == FASP_SUCCESS && param->mixed_precision == ON )
+        fasp_amg_data_mixed_precision(mgl, param);
+
+    // compress the column indices of A for the cycles
+    if ( status == FASP_SUCCESS && param->compress_index == ON )
+        fasp_amg_data_compress_index(mgl);
+
+    // spectrum bounds of inv(D)*A for the poly smoother and the AMLI cycle
+    if ( status == FASP_SUCCESS ) fasp_amg_data_eig_bounds(mgl, param);
+
 #if DEBUG_MODE > 0
     printf("### DEBUG: [--End--] %s ...\n", __FUNCTION__);
 #endif
 
+    fasp_mem_set_tag(memtag);
+
     return status;
 }
 
@@ -97,6 +116,11 @@ SHORT fasp_amg_setup_ua (AMG_data *mgl,
  * Modified by Zheng Li on 01/13/2015: adjust coarsening stop criterion.
  * Modified by Zheng Li on 03/22/2015: adjust coarsening ratio.
  * Modified by Chunsheng Feng on 10/17/2020: if NPAIR fail auto switch aggregation type to VBM.
+ * Modified by FASP team on 10/16/2026: keep the symbolic RAP plan.
+ * Modified by FASP team on 10/16/2026: distance-2 MIS aggregation.
+ * Modified by FASP team on 10/16/2026: work space from the work arena.
+ * Modified by FASP team on 10/16/2026: first touch of b and x with SpMV rows.
+ * Modified by FASP team on 10/16/2026: keep AMLI coefficients given by the user.
  */
 static SHORT amg_setup_unsmoothP_unsmoothR(AMG_data *mgl,
                                            AMG_param *param) {
@@ -127,14 +151,17 @@ static SHORT amg_setup_unsmoothP_unsmoothR(AMG_data *mgl,
 
     fasp_gettime(&setup_start);
 
+    // temporary level data is drawn from the work arena
+    const size_t mark = fasp_arena_mark(NULL);
+
     // level info (fine: 0; coarse: 1)
-    ivector *vertices = (ivector *) fasp_mem_calloc(max_levels, sizeof(ivector));
+    ivector *vertices = (ivector *) fasp_arena_calloc(NULL, max_levels, sizeof(ivector));
 
     // each level stores the information of the number of aggregations
-    INT *num_aggs = (INT *) fasp_mem_calloc(max_levels, sizeof(INT));
+    INT *num_aggs = (INT *) fasp_arena_calloc(NULL, max_levels, sizeof(INT));
 
     // each level stores the information of the strongly coupled neighborhoods
-    dCSRmat *Neighbor = (dCSRmat *) fasp_mem_calloc(max_levels, sizeof(dCSRmat));
+    dCSRmat *Neighbor = (dCSRmat *) fasp_arena_calloc(NULL, max_levels, sizeof(dCSRmat));
 
     // Initialize level information
     for ( i = 0; i < max_levels; ++i ) num_aggs[i] = 0;
@@ -166,12 +193,13 @@ static SHORT amg_setup_unsmoothP_unsmoothR(AMG_data *mgl,
         swzparam.SWZ_blksolver = param->SWZ_blksolver;
     }
 
-    // Initialize AMLI coefficients
-    if ( cycle_type == AMLI_CYCLE ) {
+    // Initialize AMLI coefficients, unless they are given by the user
+    if ( cycle_type == AMLI_CYCLE && param->amli_coef == NULL ) {
         const INT amlideg = param->amli_degree;
         param->amli_coef = (REAL *) fasp_mem_calloc(amlideg + 1, sizeof(REAL));
         REAL lambda_max = 2.0, lambda_min = lambda_max / 4;
         fasp_amg_amli_coef(lambda_max, lambda_min, amlideg, param->amli_coef);
+        mgl->amli_coef_setup = TRUE;
     }
 
 #if DIAGONAL_PREF
@@ -226,8 +254,13 @@ static SHORT amg_setup_unsmoothP_unsmoothR(AMG_data *mgl,
         switch ( param->aggregation_type ) {
 
             case VMB: // VMB aggregation
-                status = aggregation_vmb(&mgl[lvl].A, &vertices[lvl], param, lvl + 1,
-                                         &Neighbor[lvl], &num_aggs[lvl]);
+            case MIS2: // distance-2 MIS aggregation
+                if ( param->aggregation_type == MIS2 )
+                    status = aggregation_mis2(&mgl[lvl].A, &vertices[lvl], param, lvl + 1,
+                                              &Neighbor[lvl], &num_aggs[lvl]);
+                else
+                    status = aggregation_vmb(&mgl[lvl].A, &vertices[lvl], param, lvl + 1,
+                                             &Neighbor[lvl], &num_aggs[lvl]);
 
                 /*-- Choose strength threshold adaptively --*/
                 if ( num_aggs[lvl] * 4.0 > mgl[lvl].A.row )
@@ -285,7 +318,7 @@ static SHORT amg_setup_unsmoothP_unsmoothR(AMG_data *mgl,
         if ( mgl[lvl].P.row > mgl[lvl].P.col * MAX_CRATE ) {
             if ( prtlvl > PRINT_MIN ) {
                 printf("### WARNING: Coarsening might be too aggressive!\n");
-                printf("### WARNING: Fine level = %d, coarse level = %d. Discard!\n",
+                printf("### WARNING: Fine level = " INTFMT ", coarse level = " INTFMT ". Discard!\n",
                        mgl[lvl].P.row, mgl[lvl].P.col);
             }
             fasp_ivec_free(&vertices[lvl]);
@@ -297,8 +330,10 @@ static SHORT amg_setup_unsmoothP_unsmoothR(AMG_data *mgl,
         fasp_dcsr_trans(&mgl[lvl].P, &mgl[lvl].R);
 
         /*-- Form coarse level stiffness matrix --*/
-        fasp_blas_dcsr_rap_agg(&mgl[lvl].R, &mgl[lvl].A, &mgl[lvl].P,
-                               &mgl[lvl + 1].A);
+        mgl[lvl].RAPplan = fasp_blas_dcsr_rap_symbolic(&mgl[lvl].R, &mgl[lvl].A,
+                                                       &mgl[lvl].P, &mgl[lvl + 1].A);
+        fasp_blas_dcsr_rap_numeric(&mgl[lvl].R, NULL, &mgl[lvl].A, &mgl[lvl].P,
+                                   NULL, mgl[lvl].RAPplan, &mgl[lvl + 1].A);
 
         fasp_dcsr_free(&Neighbor[lvl]);
         fasp_ivec_free(&vertices[lvl]);
@@ -363,8 +398,8 @@ static SHORT amg_setup_unsmoothP_unsmoothR(AMG_data *mgl,
     for ( lvl = 1; lvl < max_levels; ++lvl ) {
         INT mm = mgl[lvl].A.row;
         mgl[lvl].num_levels = max_levels;
-        mgl[lvl].b = fasp_dvec_create(mm);
-        mgl[lvl].x = fasp_dvec_create(mm);
+        mgl[lvl].b = fasp_dvec_create_rows(&mgl[lvl].A);
+        mgl[lvl].x = fasp_dvec_create_rows(&mgl[lvl].A);
 
         mgl[lvl].cycle_type = cycle_type; // initialize cycle type!
         mgl[lvl].ILU_levels = param->ILU_levels - lvl; // initialize ILU levels!
@@ -416,11 +451,9 @@ static SHORT amg_setup_unsmoothP_unsmoothR(AMG_data *mgl,
         fasp_cputime("Unsmoothed aggregation setup", setup_end - setup_start);
     }
 
-    fasp_mem_free(Neighbor);
+    fasp_arena_release(NULL, mark);
     Neighbor = NULL;
-    fasp_mem_free(vertices);
     vertices = NULL;
-    fasp_mem_free(num_aggs);
     num_aggs = NULL;
 
 #if DEBUG_MODE > 0
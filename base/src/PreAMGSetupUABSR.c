@@ -51,20 +51,31 @@ static SHORT amg_setup_unsmoothP_unsmoothR_bsr (AMG_data_bsr *, AMG_param *);
  *
  * \author Xiaozhe Hu
  * \date   03/16/2012
+ *
+ * Modified by FASP team on 10/16/2026: mixed precision P and R.
+ * Modified by FASP team on 10/16/2026: account memory to the AMG hierarchy.
  */
 SHORT fasp_amg_setup_ua_bsr (AMG_data_bsr  *mgl,
                              AMG_param     *param)
 {
+    const SHORT memtag = fasp_mem_set_tag(MEM_TAG_AMG); // charge to AMG hierarchy
+
 #if DEBUG_MODE > 0
     printf("### DEBUG: [-Begin-] %s ...\n", __FUNCTION__);
 #endif
 
     SHORT status = amg_setup_unsmoothP_unsmoothR_bsr(mgl, param);
 
+    // store P and R in single precision for the cycles
+    if ( status == FASP_SUCCESS && param->mixed_precision == ON )
+        fasp_amg_data_bsr_mixed_precision(mgl);
+
 #if DEBUG_MODE > 0
     printf("### DEBUG: [--End--] %s ...\n", __FUNCTION__);
 #endif
 
+    fasp_mem_set_tag(memtag);
+
     return status;
 }
 
@@ -88,6 +99,7 @@ SHORT fasp_amg_setup_ua_bsr (AMG_data_bsr  *mgl,
  * \date   03/16/2012
  *
  * Modified by Chensong Zhang on 05/10/2013: adjust the structure.
+ * Modified by FASP team on 10/16/2026: distance-2 MIS aggregation.
  */
 static SHORT amg_setup_unsmoothP_unsmoothR_bsr (AMG_data_bsr   *mgl,
                                                 AMG_param      *param)
@@ -193,9 +205,14 @@ static SHORT amg_setup_unsmoothP_unsmoothR_bsr (AMG_data_bsr   *mgl,
         switch ( param->aggregation_type ) {
 
             case VMB: // VMB aggregation
-
-                status = aggregation_vmb (&mgl[lvl].PP, &vertices[lvl], param,
-                                          lvl+1, &Neighbor[lvl], &num_aggs[lvl]);
+            case MIS2: // distance-2 MIS aggregation
+
+                if ( param->aggregation_type == MIS2 )
+                    status = aggregation_mis2 (&mgl[lvl].PP, &vertices[lvl], param,
+                                               lvl+1, &Neighbor[lvl], &num_aggs[lvl]);
+                else
+                    status = aggregation_vmb (&mgl[lvl].PP, &vertices[lvl], param,
+                                              lvl+1, &Neighbor[lvl], &num_aggs[lvl]);
 
                 /*-- Choose strength threshold adaptively --*/
                 if ( num_aggs[lvl]*4 > mgl[lvl].PP.row )
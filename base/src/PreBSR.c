@@ -324,7 +324,7 @@ void fasp_precond_dbsr_ilu (REAL *r,
     REAL       *zz, *zr, *mult;
     
     if (iludata->nwork<memneed) {
-        printf("### ERROR: Need %d memory, only %d available!\n",
+        printf("### ERROR: Need " INTFMT " memory, only " INTFMT " available!\n",
                memneed, iludata->nwork);
         fasp_chkerr(ERROR_ALLOC_MEM, __FUNCTION__);
     }
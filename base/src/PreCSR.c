@@ -42,6 +42,8 @@
  *
  * \author Feiteng Huang
  * \date   05/18/2009
+ *
+ * Modified by FASP team on 10/16/2026: Chebyshev polynomial preconditioner
  */
 precond *fasp_precond_setup (const SHORT   precond_type,
                              AMG_param    *amgparam,
@@ -53,6 +55,7 @@ precond *fasp_precond_setup (const SHORT   precond_type,
     precond_data  *pcdata = NULL;
     ILU_data         *ILU = NULL;
     dvector         *diag = NULL;
+    precond_cheby   *cheby = NULL;
 
     INT           max_levels, nnz, m, n;
     
@@ -137,6 +140,17 @@ precond *fasp_precond_setup (const SHORT   precond_type,
             
         break;
             
+    case PREC_CHEBY: // Chebyshev polynomial preconditioner
+            
+        pc = (precond *)fasp_mem_calloc(1, sizeof(precond));
+        cheby = (precond_cheby *)fasp_mem_calloc(1, sizeof(precond_cheby));
+        fasp_cheby_data_create(A, CHEBY_DEGREE, cheby);
+            
+        pc->data = cheby;
+        pc->fct  = fasp_precond_cheby;
+            
+        break;
+
     case PREC_DIAG: // Diagonal preconditioner
             
         pc = (precond *)fasp_mem_calloc(1, sizeof(precond));
@@ -183,6 +197,69 @@ void fasp_precond_diag (REAL *r,
     }    
 }
 
+/**
+ * \fn void fasp_precond_cheby (REAL *r, REAL *z, void *data)
+ *
+ * \brief Chebyshev polynomial preconditioner z=p(inv(D)*A)*inv(D)*r
+ *
+ * \param r     Pointer to the vector needs preconditioning
+ * \param z     Pointer to preconditioned vector
+ * \param data  Pointer to precondition data
+ *
+ * \author FASP team
+ * \date   10/16/2026
+ *
+ * \note Runs degree steps of the Jacobi-preconditioned Chebyshev iteration for
+ *       A*z = r from z = 0, i.e., degree-1 products with A and no inner product.
+ *       The polynomial is fixed, so this is a linear (SPD for SPD A) operator.
+ */
+void fasp_precond_cheby (REAL *r,
+                         REAL *z,
+                         void *data)
+{
+    const precond_cheby *cheby = (precond_cheby *)data;
+    const INT    n     = cheby->diag.row;
+    const REAL  *dinv  = cheby->diag.val;
+    const REAL   theta = 0.5*(cheby->emax + cheby->emin);
+    const REAL   delta = 0.5*(cheby->emax - cheby->emin);
+    const REAL   sigma = theta/delta;
+    const size_t mark  = fasp_arena_mark(NULL);
+
+    REAL *res = (REAL *)fasp_arena_alloc(NULL, (size_t)2*n, sizeof(REAL));
+    REAL *d   = res + n;
+    REAL  rho = 1.0/sigma, rho1, a, c;
+    INT   i, k;
+
+    // z = d = inv(D)*r/theta, res = r
+#ifdef _OPENMP
+#pragma omp parallel for private(i) if(n>OPENMP_HOLDS)
+#endif
+    for ( i = 0; i < n; ++i ) {
+        res[i] = r[i];
+        z[i] = d[i] = dinv[i]*r[i]/theta;
+    }
+
+    for ( k = 1; k < cheby->degree; ++k ) {
+
+        // res = res - A*d
+        fasp_blas_dcsr_aAxpy_plan(-1.0, cheby->A, cheby->plan, d, res);
+
+        // d = rho1*rho*d + 2*rho1/delta*inv(D)*res, z = z + d
+        rho1 = 1.0/(2.0*sigma - rho);
+        a = rho1*rho; c = 2.0*rho1/delta;
+#ifdef _OPENMP
+#pragma omp parallel for private(i) if(n>OPENMP_HOLDS)
+#endif
+        for ( i = 0; i < n; ++i ) {
+            d[i] = a*d[i] + c*dinv[i]*res[i];
+            z[i] += d[i];
+        }
+        rho = rho1;
+    }
+
+    fasp_arena_release(NULL, mark);
+}
+
 /**
  * \fn void fasp_precond_ilu (REAL *r, REAL *z, void *data)
  *
@@ -243,7 +320,7 @@ void fasp_precond_ilu (REAL *r,
     return;
     
 MEMERR:
-    printf("### ERROR: Need %d memory, only %d available!\n",
+    printf("### ERROR: Need " INTFMT " memory, only " INTFMT " available!\n",
            memneed, iludata->nwork);
     fasp_chkerr(ERROR_ALLOC_MEM, __FUNCTION__);
 }
@@ -297,7 +374,7 @@ void fasp_precond_ilu_forward (REAL *r,
     return;
     
 MEMERR:
-    printf("### ERROR: Need %d memory, only %d available!",
+    printf("### ERROR: Need " INTFMT " memory, only " INTFMT " available!",
            memneed, iludata->nwork);
     fasp_chkerr(ERROR_ALLOC_MEM, __FUNCTION__);
 }
@@ -349,7 +426,7 @@ void fasp_precond_ilu_backward (REAL *r,
     return;
     
 MEMERR:
-    printf("### ERROR: Need %d memory, only %d available!",
+    printf("### ERROR: Need " INTFMT " memory, only " INTFMT " available!",
            memneed, iludata->nwork);
     fasp_chkerr(ERROR_ALLOC_MEM, __FUNCTION__);
 }
@@ -434,6 +511,38 @@ void fasp_precond_amg (REAL *r,
     fasp_darray_cp(m,mgl->x.val,z);    
 }
 
+/**
+ * \fn void fasp_precond_amg_mv (REAL *r, REAL *z, const INT nrhs, void *data)
+ *
+ * \brief AMG preconditioner for a block of vectors
+ *
+ * \param r     Pointer to the vectors need preconditioning (interleaved)
+ * \param z     Pointer to preconditioned vectors (interleaved)
+ * \param nrhs  Number of vectors
+ * \param data  Pointer to precondition data
+ *
+ * \author FASP team
+ * \date   10/16/2026
+ */
+void fasp_precond_amg_mv (REAL       *r,
+                          REAL       *z,
+                          const INT   nrhs,
+                          void       *data)
+{
+    precond_data *pcdata=(precond_data *)data;
+    const INT m=pcdata->mgl_data[0].A.row;
+    const INT maxit=pcdata->maxit;
+    INT i;
+    
+    AMG_param amgparam; fasp_param_amg_init(&amgparam);
+    fasp_param_prec_to_amg(&amgparam,pcdata);
+    
+    AMG_data *mgl = pcdata->mgl_data;
+    fasp_darray_set(m*nrhs,z,0.0);
+    
+    for ( i=maxit; i--; ) fasp_solver_mgcycle_mv(mgl,&amgparam,nrhs,r,z);
+}
+
 /**
  * \fn void fasp_precond_famg (REAL *r, REAL *z, void *data)
  *
@@ -3,7 +3,8 @@
  *  \brief Initialize important data structures
  *
  *  \note  This file contains Level-4 (Pre) functions. It requires:
- *         AuxMemory.c, AuxVector.c, BlaSparseBSR.c, and BlaSparseCSR.c
+ *         AuxMemory.c, AuxVector.c, BlaEigen.c, BlaSparseBSR.c, BlaSparseCSR.c,
+ *         BlaSpmvCSR.c, PreCSR.c, and PreMGRecurAMLI.c
  *
  *---------------------------------------------------------------------------------
  *  Copyright (C) 2009--2020 by the FASP team. All rights reserved.
@@ -60,12 +61,16 @@ void fasp_precond_data_init (precond_data *pcdata)
  *
  * \author Chensong Zhang
  * \date   2010/04/06
+ *
+ * Modified by FASP team on 10/16/2026: Account memory to the AMG hierarchy
  */
 AMG_data * fasp_amg_data_create (SHORT max_levels)
 {
     max_levels = MAX(1, max_levels); // at least allocate one level
     
+    const SHORT memtag = fasp_mem_set_tag(MEM_TAG_AMG);
     AMG_data *mgl = (AMG_data *)fasp_mem_calloc(max_levels,sizeof(AMG_data));
+    fasp_mem_set_tag(memtag);
     
     INT i;
     for ( i=0; i<max_levels; ++i ) {
@@ -97,11 +102,17 @@ AMG_data * fasp_amg_data_create (SHORT max_levels)
  * Modified by Hongxuan Zhang on 12/15/2015: Free memory for Intel MKL PARDISO
  * Modified by Chunsheng Feng on 02/12/2017: Permute A back to its origin for ILUtp
  * Modified by Chunsheng Feng on 08/11/2017: Check for max_levels == 1
+ * Modified by FASP team on 10/16/2026: Free SpMV plans
+ * Modified by FASP team on 10/16/2026: Free single precision P and R
+ * Modified by FASP team on 10/16/2026: Free compressed column indices of A
+ * Modified by FASP team on 10/16/2026: Free Galerkin product plans
+ * Modified by FASP team on 10/16/2026: Keep AMLI coefficients given by the user
  */
 void fasp_amg_data_free (AMG_data   *mgl,
                          AMG_param  *param)
 {
     const INT max_levels = MAX(1,mgl[0].num_levels);
+    const SHORT amli_coef_setup = mgl[0].amli_coef_setup;
     
     INT i;
 
@@ -149,6 +160,18 @@ void fasp_amg_data_free (AMG_data   *mgl,
         fasp_dvec_free(&mgl[i].w);
         fasp_ivec_free(&mgl[i].cfmark);
         fasp_swz_data_free(&mgl[i].Schwarz);
+        fasp_dcsr_plan_free(mgl[i].Aplan); mgl[i].Aplan = NULL;
+        fasp_dcsr_plan_free(mgl[i].Rplan); mgl[i].Rplan = NULL;
+        fasp_dcsr_plan_free(mgl[i].Pplan); mgl[i].Pplan = NULL;
+        fasp_dcsr_rap_free(mgl[i].RAPplan); mgl[i].RAPplan = NULL;
+        fasp_mem_free(mgl[i].Aval_sp); mgl[i].Aval_sp = NULL;
+        fasp_mem_free(mgl[i].Rval_sp); mgl[i].Rval_sp = NULL;
+        fasp_mem_free(mgl[i].Pval_sp); mgl[i].Pval_sp = NULL;
+        if ( mgl[i].A16 != NULL ) {
+            mgl[i].A16->IA  = NULL; // row pointers are owned by mgl[i].A
+            mgl[i].A16->val = NULL; // values are owned by mgl[i].A
+            fasp_dcsr16_free(mgl[i].A16); mgl[i].A16 = NULL;
+        }
     }
 
     for ( i=0; i<mgl->near_kernel_dim; ++i ) {
@@ -160,12 +183,219 @@ void fasp_amg_data_free (AMG_data   *mgl,
 
     if ( param == NULL ) return; // exit if no param given
 
-    if ( param->cycle_type == AMLI_CYCLE ) {
+    if ( param->cycle_type == AMLI_CYCLE && amli_coef_setup ) {
         fasp_mem_free(param->amli_coef); param->amli_coef = NULL;
     }
 
 }
 
+/**
+ * \fn void fasp_amg_data_mixed_precision (AMG_data *mgl, const AMG_param *param)
+ *
+ * \brief Convert the values of P, R, and the coarse level matrices A on all levels
+ *        to single precision
+ *
+ * \param mgl    Pointer to the AMG_data after setup
+ * \param param  Pointer to AMG parameters
+ *
+ * \author FASP team
+ * \date   10/16/2026
+ *
+ * \note The double precision values are freed and only the sparsity patterns are
+ *       kept; the multigrid cycles then apply P, R, and A with the single
+ *       precision kernels, which accumulate in double precision. P and R of
+ *       UA_AMG are applied by the agg kernels without values and are kept.
+ *
+ * \note A is converted by fasp_amg_data_sp_level on the levels between the
+ *       finest and the coarsest one. It is kept in double precision on the
+ *       finest level, which is used for the outer residual.
+ *
+ * Modified by FASP team on 10/16/2026: single precision A on coarse levels.
+ */
+void fasp_amg_data_mixed_precision (AMG_data         *mgl,
+                                    const AMG_param  *param)
+{
+    const INT nl = mgl[0].num_levels;
+    
+    INT i, k;
+    
+    for ( i = 0; i < nl-1; ++i ) {
+        
+        if ( i > 0 ) fasp_amg_data_sp_level(mgl, param, i);
+        
+        if ( param->AMG_type == UA_AMG ) continue;
+        
+        if ( mgl[i].Pval_sp == NULL && mgl[i].P.val != NULL ) {
+            mgl[i].Pval_sp = (SREAL *)fasp_mem_calloc(MAX(mgl[i].P.nnz,1), sizeof(SREAL));
+            for ( k = 0; k < mgl[i].P.nnz; ++k ) mgl[i].Pval_sp[k] = (SREAL)mgl[i].P.val[k];
+            fasp_mem_free(mgl[i].P.val); mgl[i].P.val = NULL;
+        }
+        
+        if ( mgl[i].Rval_sp == NULL && mgl[i].R.val != NULL ) {
+            mgl[i].Rval_sp = (SREAL *)fasp_mem_calloc(MAX(mgl[i].R.nnz,1), sizeof(SREAL));
+            for ( k = 0; k < mgl[i].R.nnz; ++k ) mgl[i].Rval_sp[k] = (SREAL)mgl[i].R.val[k];
+            fasp_mem_free(mgl[i].R.val); mgl[i].R.val = NULL;
+        }
+        
+    }
+}
+
+/**
+ * \fn SHORT fasp_amg_data_sp_level (AMG_data *mgl, const AMG_param *param,
+ *                                   const INT lvl)
+ *
+ * \brief Convert the values of the matrix A on one AMG level to single precision
+ *
+ * \param mgl    Pointer to the AMG_data after setup
+ * \param param  Pointer to AMG parameters
+ * \param lvl    Index of the level
+ *
+ * \return       TRUE if A of the level is kept in single precision; FALSE otherwise
+ *
+ * \author FASP team
+ * \date   10/16/2026
+ *
+ * \note The double precision values are freed and the cycles smooth with GS,
+ *       SGS, or Jacobi and form the residuals with the single precision values.
+ *       A is kept in double precision on the coarsest level for the coarse
+ *       solvers, on the ILU and Schwarz levels, and for the other smoothers, the
+ *       AMLI cycles, the coarse scaling, and the compressed column indices,
+ *       which need the double precision values.
+ */
+SHORT fasp_amg_data_sp_level (AMG_data         *mgl,
+                              const AMG_param  *param,
+                              const INT         lvl)
+{
+    const SHORT smoother = param->smoother;
+    
+    INT k;
+    
+    if ( mgl[lvl].Aval_sp != NULL ) return TRUE;
+    
+    if ( smoother != SMOOTHER_GS && smoother != SMOOTHER_SGS &&
+         smoother != SMOOTHER_JACOBI ) return FALSE;
+    
+    if ( param->cycle_type == AMLI_CYCLE || param->cycle_type == NL_AMLI_CYCLE ||
+         param->coarse_scaling == ON || param->compress_index == ON ) return FALSE;
+    
+#if MULTI_COLOR_ORDER
+    return FALSE; // the multicolor GS smoother needs mgl[lvl].A
+#endif
+    
+    if ( lvl >= mgl[0].num_levels-1 || lvl < mgl->ILU_levels ||
+         lvl < mgl->SWZ_levels || mgl[lvl].A.val == NULL ) return FALSE;
+    
+    mgl[lvl].Aval_sp = (SREAL *)fasp_mem_calloc(MAX(mgl[lvl].A.nnz,1), sizeof(SREAL));
+    for ( k = 0; k < mgl[lvl].A.nnz; ++k ) mgl[lvl].Aval_sp[k] = (SREAL)mgl[lvl].A.val[k];
+    fasp_mem_free(mgl[lvl].A.val); mgl[lvl].A.val = NULL;
+    
+    return TRUE;
+}
+
+/**
+ * \fn void fasp_amg_data_compress_index (AMG_data *mgl)
+ *
+ * \brief Build A with 16-bit column index deltas on all levels but the coarsest
+ *
+ * \param mgl    Pointer to the AMG_data after setup
+ *
+ * \author FASP team
+ * \date   10/16/2026
+ *
+ * \note mgl[i].A16 shares the row pointers and the values with mgl[i].A, so it
+ *       stays valid as long as the sparsity pattern of mgl[i].A is not changed.
+ *       It is used for the residual and the GS/SGS smoothers in the multigrid
+ *       cycle.
+ *
+ * Modified by FASP team on 10/16/2026: share the row pointers with mgl[i].A.
+ */
+void fasp_amg_data_compress_index (AMG_data *mgl)
+{
+    const INT nl = mgl[0].num_levels;
+    
+    INT i;
+    
+    for ( i = 0; i < nl-1; ++i ) {
+        if ( mgl[i].A16 != NULL ) continue;
+        mgl[i].A16 = fasp_format_dcsr_dcsr16(&mgl[i].A);
+        fasp_mem_free(mgl[i].A16->IA);  mgl[i].A16->IA  = mgl[i].A.IA;
+        fasp_mem_free(mgl[i].A16->val); mgl[i].A16->val = mgl[i].A.val;
+    }
+}
+
+/**
+ * \fn void fasp_amg_data_eig_bounds (AMG_data *mgl, AMG_param *param)
+ *
+ * \brief Estimate the spectrum bounds of inv(D)*A on the AMG levels
+ *
+ * \param mgl    Pointer to the AMG_data after setup
+ * \param param  Pointer to AMG parameters
+ *
+ * \author FASP team
+ * \date   10/16/2026
+ *
+ * \note The bounds are computed once by CHEBY_LANCZOS Lanczos steps on every
+ *       level but the coarsest. The largest Ritz value, enlarged by CHEBY_UPPER,
+ *       is cached in mgl[i].eig_max and the smallest one in mgl[i].eig_min. They
+ *       are only needed by the polynomial smoother and by the AMLI cycle, whose
+ *       coefficients are then computed on [eig_max/4, eig_max] with the largest
+ *       eig_max of the coarse levels, instead of the default interval [0.5, 2].
+ *       For M-matrices eig_max is close to 2, so the interval is about
+ *       [0.55, 2.2] with the CHEBY_UPPER factor.
+ *
+ * \note AMLI coefficients given by the user in param->amli_coef are kept; only
+ *       those set by the AMG setup (mgl[0].amli_coef_setup) are recomputed.
+ */
+void fasp_amg_data_eig_bounds (AMG_data   *mgl,
+                               AMG_param  *param)
+{
+    const INT nl = mgl[0].num_levels;
+    
+    REAL    lambda_max = 0.0;
+    dvector diag;
+    precond pc;
+    INT     i;
+    
+    const SHORT amli = ( param->cycle_type == AMLI_CYCLE && mgl[0].amli_coef_setup );
+    
+    if ( param->smoother != SMOOTHER_POLY && !amli ) return;
+    
+    pc.fct = fasp_precond_diag;
+    
+    for ( i = 0; i < nl-1; ++i ) {
+        
+        // only the coarse levels are needed by the AMLI cycle
+        if ( i == 0 && param->smoother != SMOOTHER_POLY ) continue;
+        
+        fasp_dcsr_getdiag(0, &mgl[i].A, &diag);
+        pc.data = &diag;
+        fasp_dcsr_eig_bounds(&mgl[i].A, &pc, CHEBY_LANCZOS,
+                             &mgl[i].eig_min, &mgl[i].eig_max);
+        mgl[i].eig_min  = MAX(mgl[i].eig_min, 0.0);
+        mgl[i].eig_max *= CHEBY_UPPER;
+        fasp_dvec_free(&diag);
+        
+        if ( i > 0 ) lambda_max = MAX(lambda_max, mgl[i].eig_max);
+        
+        if ( param->print_level > PRINT_SOME )
+            printf("Level %2" INTMOD "d: spectrum bounds of inv(D)*A [%e, %e]\n",
+                   i, mgl[i].eig_min, mgl[i].eig_max);
+    }
+    
+    // The lower endpoint is not taken from eig_min: the smallest Ritz value of a
+    // few Lanczos steps lies above the smallest eigenvalue and converges slowly,
+    // so low modes would fall outside the interval, where the AMLI polynomial is
+    // not bounded. The smallest eigenvalue itself goes to zero with the mesh size
+    // and would ask for a polynomial degree that grows with the condition number.
+    // The low modes are reduced by the coarse grid correction of the next level,
+    // so the polynomial only has to work on the upper part [eig_max/4, eig_max],
+    // where the smoother is effective, as in fasp_smoother_dcsr_poly_eig.
+    if ( amli && lambda_max > SMALLREAL ) {
+        fasp_amg_amli_coef(lambda_max, lambda_max/4, param->amli_degree,
+                           param->amli_coef);
+    }
+}
+
 /**
  * \fn AMG_data_bsr * fasp_amg_data_bsr_create (SHORT max_levels)
  *
@@ -177,12 +407,16 @@ void fasp_amg_data_free (AMG_data   *mgl,
  *
  * \author Xiaozhe Hu
  * \date   08/07/2011
+ *
+ * Modified by FASP team on 10/16/2026: Account memory to the AMG hierarchy
  */
 AMG_data_bsr * fasp_amg_data_bsr_create (SHORT max_levels)
 {
     max_levels = MAX(1, max_levels); // at least allocate one level
     
+    const SHORT memtag = fasp_mem_set_tag(MEM_TAG_AMG);
     AMG_data_bsr *mgl = (AMG_data_bsr *)fasp_mem_calloc(max_levels,sizeof(AMG_data_bsr));
+    fasp_mem_set_tag(memtag);
     
     INT i;
     for (i=0; i<max_levels; ++i) {
@@ -209,6 +443,7 @@ AMG_data_bsr * fasp_amg_data_bsr_create (SHORT max_levels)
  * \date   2013/02/13
  *
  * Modified by Chensong Zhang on 08/14/2017: Check for max_levels == 1
+ * Modified by FASP team on 10/16/2026: Free single precision P and R
  */
 void fasp_amg_data_bsr_free (AMG_data_bsr *mgl)
 {
@@ -239,6 +474,8 @@ void fasp_amg_data_bsr_free (AMG_data_bsr *mgl)
 
         fasp_mem_free(mgl[i].pw); mgl[i].pw = NULL;
         fasp_mem_free(mgl[i].sw); mgl[i].sw = NULL;
+        fasp_mem_free(mgl[i].Rval_sp); mgl[i].Rval_sp = NULL;
+        fasp_mem_free(mgl[i].Pval_sp); mgl[i].Pval_sp = NULL;
     }
     
     for ( i = 0; i < mgl->near_kernel_dim; ++i ) {
@@ -248,6 +485,44 @@ void fasp_amg_data_bsr_free (AMG_data_bsr *mgl)
     fasp_mem_free(mgl); mgl = NULL;
 }
 
+/**
+ * \fn void fasp_amg_data_bsr_mixed_precision (AMG_data_bsr *mgl)
+ *
+ * \brief Convert the values of P and R on all levels to single precision (BSR format)
+ *
+ * \param mgl    Pointer to the AMG_data_bsr after setup
+ *
+ * \author FASP team
+ * \date   10/16/2026
+ *
+ * \note See fasp_amg_data_mixed_precision. The BSR cycles apply P and R with the
+ *       general kernels for all AMG types, so all of them are converted.
+ */
+void fasp_amg_data_bsr_mixed_precision (AMG_data_bsr *mgl)
+{
+    const INT nl = mgl[0].num_levels;
+    
+    INT i, k, nnz;
+    
+    for ( i = 0; i < nl-1; ++i ) {
+        
+        if ( mgl[i].Pval_sp == NULL && mgl[i].P.val != NULL ) {
+            nnz = mgl[i].P.NNZ*mgl[i].P.nb*mgl[i].P.nb;
+            mgl[i].Pval_sp = (SREAL *)fasp_mem_calloc(MAX(nnz,1), sizeof(SREAL));
+            for ( k = 0; k < nnz; ++k ) mgl[i].Pval_sp[k] = (SREAL)mgl[i].P.val[k];
+            fasp_mem_free(mgl[i].P.val); mgl[i].P.val = NULL;
+        }
+        
+        if ( mgl[i].Rval_sp == NULL && mgl[i].R.val != NULL ) {
+            nnz = mgl[i].R.NNZ*mgl[i].R.nb*mgl[i].R.nb;
+            mgl[i].Rval_sp = (SREAL *)fasp_mem_calloc(MAX(nnz,1), sizeof(SREAL));
+            for ( k = 0; k < nnz; ++k ) mgl[i].Rval_sp[k] = (SREAL)mgl[i].R.val[k];
+            fasp_mem_free(mgl[i].R.val); mgl[i].R.val = NULL;
+        }
+        
+    }
+}
+
 /**
  * \fn void fasp_ilu_data_create (const INT iwk, const INT nwork, ILU_data *iludata)
  *
@@ -261,6 +536,7 @@ void fasp_amg_data_bsr_free (AMG_data_bsr *mgl)
  * \date   2010/04/06
  *
  * Modified by Chunsheng Feng on 02/12/2017: add iperm array for ILUtp
+ * Modified by FASP team on 10/16/2026: Account memory to ILU factors
  */
 void fasp_ilu_data_create (const INT   iwk,
                            const INT   nwork,
@@ -271,6 +547,8 @@ void fasp_ilu_data_create (const INT   iwk,
     printf("### DEBUG: iwk=%d, nwork=%d \n", iwk, nwork);
 #endif
     
+    const SHORT memtag = fasp_mem_set_tag(MEM_TAG_ILU);
+    
     iludata->ijlu=(INT*)fasp_mem_calloc(iwk, sizeof(INT));
     
     if (iludata->type == ILUtp) iludata->iperm=(INT*)fasp_mem_calloc(iludata->row*2, sizeof(INT));
@@ -278,6 +556,8 @@ void fasp_ilu_data_create (const INT   iwk,
     iludata->luval=(REAL*)fasp_mem_calloc(iwk, sizeof(REAL));
     
     iludata->work=(REAL*)fasp_mem_calloc(nwork, sizeof(REAL));
+    
+    fasp_mem_set_tag(memtag);
 #if DEBUG_MODE > 0
     printf("### DEBUG: %s ...... %d [End]\n", __FUNCTION__,__LINE__);
 #endif
@@ -367,6 +647,69 @@ void fasp_swz_data_free (SWZ_data *swzdata)
 #endif
 }
 
+/**
+ * \fn void fasp_cheby_data_create (dCSRmat *A, const INT degree,
+ *                                  precond_cheby *chebydata)
+ *
+ * \brief Setup the Chebyshev polynomial preconditioner of inv(D)*A
+ *
+ * \param A          Pointer to the coefficient matrix
+ * \param degree     Degree of the polynomial
+ * \param chebydata  Pointer to precond_cheby
+ *
+ * \author FASP team
+ * \date   10/16/2026
+ *
+ * \note The spectrum bounds of inv(D)*A come from CHEBY_LANCZOS Lanczos steps,
+ *       the upper one is enlarged by CHEBY_UPPER.
+ */
+void fasp_cheby_data_create (dCSRmat        *A,
+                             const INT       degree,
+                             precond_cheby  *chebydata)
+{
+    precond pc;
+    INT     i;
+
+    chebydata->A      = A;
+    chebydata->plan   = fasp_dcsr_plan_create(A);
+    chebydata->degree = MAX(degree, 1);
+
+    // spectrum bounds of inv(D)*A
+    fasp_dcsr_getdiag(0, A, &chebydata->diag);
+    pc.data = &chebydata->diag;
+    pc.fct  = fasp_precond_diag;
+    fasp_dcsr_eig_bounds(A, &pc, CHEBY_LANCZOS, &chebydata->emin, &chebydata->emax);
+    chebydata->emax *= CHEBY_UPPER;
+    chebydata->emin  = MAX(chebydata->emin, 0.0);
+
+    // store the inverse of the diagonal as fasp_precond_diag uses it
+    for ( i = 0; i < chebydata->diag.row; i++ ) {
+        if ( ABS(chebydata->diag.val[i]) > SMALLREAL )
+            chebydata->diag.val[i] = 1.0/chebydata->diag.val[i];
+        else
+            chebydata->diag.val[i] = 1.0;
+    }
+}
+
+/**
+ * \fn void fasp_cheby_data_free (precond_cheby *chebydata)
+ *
+ * \brief Free precond_cheby data memeory space
+ *
+ * \param chebydata  Pointer to precond_cheby
+ *
+ * \author FASP team
+ * \date   10/16/2026
+ */
+void fasp_cheby_data_free (precond_cheby *chebydata)
+{
+    if ( chebydata == NULL ) return; // There is nothing to do!
+
+    fasp_dcsr_plan_free(chebydata->plan); chebydata->plan = NULL;
+    fasp_dvec_free(&chebydata->diag);
+    chebydata->A = NULL;
+}
+
 /*---------------------------------*/
 /*--        End of File          --*/
 /*---------------------------------*/
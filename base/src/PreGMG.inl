@@ -1381,7 +1381,7 @@ static INT pcg1d (REAL        *u,
         resid = normr / normb;
         factor = normr / normr1;
         if ( prtlvl > PRINT_SOME ){
-            printf("%6d | %13.6e   | %13.6e  | %10.4f\n",k+1,resid,normr,factor);
+            printf("%6" INTMOD "d | %13.6e   | %13.6e  | %10.4f\n",k+1,resid,normr,factor);
         }
         normr1 = normr;
         if ((resid) <= rtol) break;
@@ -1403,7 +1403,7 @@ static INT pcg1d (REAL        *u,
             printf("### WARNING: V-cycle failed to converge.\n");
         }
         else {
-            printf("Num of Iter's: %d, Relative Residual = %e.\n", k+1, normr);
+            printf("Num of Iter's: " INTFMT ", Relative Residual = %e.\n", k+1, normr);
         }
     }
     
@@ -1501,7 +1501,7 @@ static INT pcg2d (REAL        *u,
         resid = normr / normb;
         factor = normr / normr1;
         if ( prtlvl > PRINT_SOME ){
-            printf("%6d | %13.6e   | %13.6e  | %10.4f\n",k+1,resid,normr,factor);
+            printf("%6" INTMOD "d | %13.6e   | %13.6e  | %10.4f\n",k+1,resid,normr,factor);
         }
         normr1 = normr;
         if (resid <= rtol) break;
@@ -1523,7 +1523,7 @@ static INT pcg2d (REAL        *u,
             printf("### WARNING: V-cycle failed to converge.\n");
         }
         else {
-            printf("Num of Iter's: %d, Relative Residual = %e.\n", k+1, normr);
+            printf("Num of Iter's: " INTFMT ", Relative Residual = %e.\n", k+1, normr);
         }
     }
     
@@ -1624,7 +1624,7 @@ static INT pcg3d (REAL        *u,
         resid = normr / normb;
         factor = normr / normr1;
         if ( prtlvl > PRINT_SOME ) {
-            printf("%6d | %13.6e   | %13.6e  | %10.4f\n",k+1,resid,normr,factor);
+            printf("%6" INTMOD "d | %13.6e   | %13.6e  | %10.4f\n",k+1,resid,normr,factor);
         }
         normr1 = normr;
         if (resid <= rtol) break;
@@ -1646,7 +1646,7 @@ static INT pcg3d (REAL        *u,
             printf("### WARNING: V-cycle failed to converge.\n");
         }
         else {
-            printf("Num of Iter's: %d, Relative Residual = %e.\n", k+1, normr);
+            printf("Num of Iter's: " INTFMT ", Relative Residual = %e.\n", k+1, normr);
         }
     }
     
@@ -5,8 +5,8 @@
  *  \note  This file contains Level-4 (Pre) functions. It requires:
  *         AuxArray.c, AuxMessage.c, AuxVector.c, BlaArray.c, BlaSchwarzSetup.c,
  *         BlaSpmvBSR.c, BlaSpmvCSR.c, ItrSmootherBSR.c, ItrSmootherCSR.c,
- *         ItrSmootherCSRpoly.c, KryPcg.c, KryPvgmres.c, KrySPcg.c,
- *         and KrySPvgmres.c
+ *         ItrSmootherCSR16.c, ItrSmootherCSRpoly.c, ItrSmootherCSRsp.c, KryPcg.c,
+ *         KryPvgmres.c, KrySPcg.c, and KrySPvgmres.c
  *
  *---------------------------------------------------------------------------------
  *  Copyright (C) 2009--2020 by the FASP team. All rights reserved.
@@ -27,6 +27,15 @@
 #include "PreMGUtil.inl"
 #include "PreMGSmoother.inl"
 
+static void mgcycle_coarse_solve(AMG_data *, const SHORT, const REAL, const SHORT);
+static SHORT mgcycle_mv_supported(const AMG_data *, const AMG_param *);
+static void mgcycle_smoothing_mv(const SHORT, dCSRmat *, const INT, const REAL *,
+                                 REAL *, const INT, const INT, const REAL,
+                                 const SHORT, INT *);
+static SHORT mgcycle_smoothing_csr16(const SHORT, const dCSR16mat *, dvector *,
+                                     dvector *, const INT, const INT, const SHORT,
+                                     INT *);
+
 /*---------------------------------*/
 /*--      Public Functions       --*/
 /*---------------------------------*/
@@ -44,6 +53,13 @@
  *
  * Modified by Chensong Zhang on 02/27/2013: update direct solvers.
  * Modified by Chensong Zhang on 12/30/2014: update Schwarz smoothers.
+ * Modified by FASP team on 10/16/2026: use SpMV plans for A, R, and P.
+ * Modified by FASP team on 10/16/2026: single precision R and P.
+ * Modified by FASP team on 10/16/2026: compressed column indices of A.
+ * Modified by FASP team on 10/16/2026: move coarsest level solve to a function.
+ * Modified by FASP team on 10/16/2026: cached spectrum bound for poly smoother.
+ * Modified by FASP team on 10/16/2026: GS and SGS smoothing with compressed indices.
+ * Modified by FASP team on 10/16/2026: single precision A on coarse levels.
  */
 void fasp_solver_mgcycle (AMG_data   *mgl,
                           AMG_param  *param)
@@ -93,6 +109,17 @@ void fasp_solver_mgcycle (AMG_data   *mgl,
     printf("### DEBUG: AMG_level = %d, ILU_level = %d\n", nl, mgl->ILU_levels);
 #endif
 
+    // build SpMV plans at the first cycle; they are kept until fasp_amg_data_free
+    for ( i = 0; i < nl-1; ++i ) {
+        if ( mgl[i].Aplan == NULL && mgl[i].A16 == NULL && mgl[i].Aval_sp == NULL )
+            mgl[i].Aplan = fasp_dcsr_plan_create(&mgl[i].A);
+        if ( amg_type == UA_AMG ) continue; // R and P are applied by the agg kernels
+        if ( mgl[i].Rplan == NULL && mgl[i].Rval_sp == NULL )
+            mgl[i].Rplan = fasp_dcsr_plan_create(&mgl[i].R);
+        if ( mgl[i].Pplan == NULL && mgl[i].Pval_sp == NULL )
+            mgl[i].Pplan = fasp_dcsr_plan_create(&mgl[i].P);
+    }
+
 ForwardSweep:
     while ( l < nl-1 ) {
 
@@ -122,15 +149,28 @@ ForwardSweep:
             // printf("fasp_smoother_dcsr_gs_multicolor, %s, %d\n",  __FUNCTION__, __LINE__);
             fasp_smoother_dcsr_gs_multicolor (&mgl[l].x, &mgl[l].A, &mgl[l].b, param->presmooth_iter,1);
 #else            
-            fasp_dcsr_presmoothing(smoother, &mgl[l].A, &mgl[l].b, &mgl[l].x,
-                                   param->presmooth_iter, 0, mgl[l].A.row-1, 1,
-                                   relax, ndeg, smooth_order, mgl[l].cfmark.val);
+            if ( mgl[l].Aval_sp != NULL )
+                fasp_dcsr_smoothing_sp(smoother, &mgl[l].A, mgl[l].Aval_sp, &mgl[l].b,
+                                       &mgl[l].x, param->presmooth_iter, 1, relax,
+                                       smooth_order, mgl[l].cfmark.val);
+            else if ( mgl[l].A16 == NULL ||
+                      !mgcycle_smoothing_csr16(smoother, mgl[l].A16, &mgl[l].b, &mgl[l].x,
+                                               param->presmooth_iter, 1, smooth_order,
+                                               mgl[l].cfmark.val) )
+                fasp_dcsr_presmoothing(smoother, &mgl[l].A, &mgl[l].b, &mgl[l].x,
+                                       param->presmooth_iter, 0, mgl[l].A.row-1, 1,
+                                       relax, ndeg, mgl[l].eig_max, smooth_order,
+                                       mgl[l].cfmark.val);
 #endif             
         }
 
         // form residual r = b - A x
         fasp_darray_cp(mgl[l].A.row, mgl[l].b.val, mgl[l].w.val);
-        fasp_blas_dcsr_aAxpy(-1.0, &mgl[l].A, mgl[l].x.val, mgl[l].w.val);
+        if ( mgl[l].A16 != NULL )
+            fasp_blas_dcsr16_aAxpy(-1.0, mgl[l].A16, mgl[l].x.val, mgl[l].w.val);
+        else
+            fasp_mg_dcsr_aAxpy(-1.0, &mgl[l].A, mgl[l].Aplan, mgl[l].Aval_sp,
+                               mgl[l].x.val, mgl[l].w.val);
 
         // restriction r1 = R*r0
         switch ( amg_type ) {
@@ -138,7 +178,8 @@ ForwardSweep:
                 fasp_blas_dcsr_mxv_agg(&mgl[l].R, mgl[l].w.val, mgl[l+1].b.val);
                 break;
             default:
-                fasp_blas_dcsr_mxv(&mgl[l].R, mgl[l].w.val, mgl[l+1].b.val);
+                fasp_mg_dcsr_mxv(&mgl[l].R, mgl[l].Rplan, mgl[l].Rval_sp,
+                                 mgl[l].w.val, mgl[l+1].b.val);
                 break;
         }
 
@@ -149,46 +190,7 @@ ForwardSweep:
 
     // If AMG only has one level or we have arrived at the coarsest level,
     // call the coarse space solver:
-    switch ( coarse_solver ) {
-
-#if WITH_PARDISO
-        case SOLVER_PARDISO: {
-            /* use Intel MKL PARDISO direct solver on the coarsest level */
-            fasp_pardiso_solve(&mgl[nl-1].A, &mgl[nl-1].b, &mgl[nl-1].x, &mgl[nl-1].pdata, 0);
-            break;
-        }
-#endif
-
-#if WITH_MUMPS
-        case SOLVER_MUMPS: {
-            // use MUMPS direct solver on the coarsest level
-            mgl[nl-1].mumps.job = 2;
-            fasp_solver_mumps_steps(&mgl[nl-1].A, &mgl[nl-1].b, &mgl[nl-1].x, &mgl[nl-1].mumps);
-            break;
-        }
-#endif
-
-#if WITH_UMFPACK
-        case SOLVER_UMFPACK: {
-            // use UMFPACK direct solver on the coarsest level
-            fasp_umfpack_solve(&mgl[nl-1].A, &mgl[nl-1].b, &mgl[nl-1].x, mgl[nl-1].Numeric, 0);
-            break;
-        }
-#endif
-
-#if WITH_SuperLU
-        case SOLVER_SUPERLU: {
-            // use SuperLU direct solver on the coarsest level
-            fasp_solver_superlu(&mgl[nl-1].A, &mgl[nl-1].b, &mgl[nl-1].x, 0);
-            break;
-        }
-#endif
-
-        default:
-            // use iterative solver on the coarsest level
-            fasp_coarse_itsolver(&mgl[nl-1].A, &mgl[nl-1].b, &mgl[nl-1].x, tol, prtlvl);
-
-    }
+    mgcycle_coarse_solve(&mgl[nl-1], coarse_solver, tol, prtlvl);
 
     // BackwardSweep:
     while ( l > 0 ) {
@@ -208,7 +210,8 @@ ForwardSweep:
                 fasp_blas_dcsr_aAxpy_agg(alpha, &mgl[l].P, mgl[l+1].x.val, mgl[l].x.val);
                 break;
             default:
-                fasp_blas_dcsr_aAxpy(alpha, &mgl[l].P, mgl[l+1].x.val, mgl[l].x.val);
+                fasp_mg_dcsr_aAxpy(alpha, &mgl[l].P, mgl[l].Pplan, mgl[l].Pval_sp,
+                                   mgl[l+1].x.val, mgl[l].x.val);
                 break;
         }
 
@@ -235,9 +238,18 @@ ForwardSweep:
 #if MULTI_COLOR_ORDER
 	        fasp_smoother_dcsr_gs_multicolor (&mgl[l].x, &mgl[l].A, &mgl[l].b, param->postsmooth_iter,-1);
 #else
-            fasp_dcsr_postsmoothing(smoother, &mgl[l].A, &mgl[l].b, &mgl[l].x,
-                                    param->postsmooth_iter, 0, mgl[l].A.row-1, -1,
-                                    relax, ndeg, smooth_order, mgl[l].cfmark.val);
+            if ( mgl[l].Aval_sp != NULL )
+                fasp_dcsr_smoothing_sp(smoother, &mgl[l].A, mgl[l].Aval_sp, &mgl[l].b,
+                                       &mgl[l].x, param->postsmooth_iter, -1, relax,
+                                       smooth_order, mgl[l].cfmark.val);
+            else if ( mgl[l].A16 == NULL ||
+                      !mgcycle_smoothing_csr16(smoother, mgl[l].A16, &mgl[l].b, &mgl[l].x,
+                                               param->postsmooth_iter, -1, smooth_order,
+                                               mgl[l].cfmark.val) )
+                fasp_dcsr_postsmoothing(smoother, &mgl[l].A, &mgl[l].b, &mgl[l].x,
+                                        param->postsmooth_iter, 0, mgl[l].A.row-1, -1,
+                                        relax, ndeg, mgl[l].eig_max, smooth_order,
+                                        mgl[l].cfmark.val);
 #endif             
         }
 
@@ -254,6 +266,164 @@ ForwardSweep:
 
 }
 
+/**
+ * \fn void fasp_solver_mgcycle_mv (AMG_data *mgl, AMG_param *param,
+ *                                  const INT nrhs, REAL *b, REAL *x)
+ *
+ * \brief Solve AX=B with non-recursive multigrid cycle for a block of vectors
+ *
+ * \param mgl    Pointer to AMG data: AMG_data
+ * \param param  Pointer to AMG parameters: AMG_param
+ * \param nrhs   Number of right-hand sides
+ * \param b      Pointer to the right-hand sides B (n*nrhs, interleaved)
+ * \param x      Pointer to the approximations X (n*nrhs, interleaved)
+ *
+ * \author FASP team
+ * \date   10/16/2026
+ *
+ * \note Entry i of vector j is x[i*nrhs+j]. Smoothing, residual, restriction and
+ *       prolongation read each matrix once for all vectors; the coarsest level
+ *       is solved vector by vector. Settings without a block version (ILU or
+ *       Schwarz levels, coarse scaling, smoothers other than GS, SGS and Jacobi)
+ *       apply fasp_solver_mgcycle to each vector instead.
+ */
+void fasp_solver_mgcycle_mv (AMG_data   *mgl,
+                             AMG_param  *param,
+                             const INT   nrhs,
+                             REAL       *b,
+                             REAL       *x)
+{
+    const SHORT  prtlvl = param->print_level;
+    const SHORT  amg_type = param->AMG_type;
+    const SHORT  smoother = param->smoother;
+    const SHORT  smooth_order = param->smooth_order;
+    const SHORT  cycle_type = param->cycle_type;
+    const SHORT  coarse_solver = param->coarse_solver;
+    const SHORT  nl = mgl[0].num_levels;
+    const REAL   relax = param->relaxation;
+    const REAL   tol = param->tol * 1e-4;
+
+    // local variables
+    INT    num_lvl[MAX_AMG_LVL] = {0}, l = 0;
+    INT    ncycles[MAX_AMG_LVL] = {1};
+    INT    i, j, m;
+    REAL  *B[MAX_AMG_LVL], *X[MAX_AMG_LVL], *W[MAX_AMG_LVL];
+
+    if ( !mgcycle_mv_supported(mgl, param) ) {
+        const INT n = mgl[0].A.row;
+        for ( j = 0; j < nrhs; ++j ) {
+            for ( i = 0; i < n; ++i ) {
+                mgl[0].b.val[i] = b[(size_t)i*nrhs+j];
+                mgl[0].x.val[i] = x[(size_t)i*nrhs+j];
+            }
+            fasp_solver_mgcycle(mgl, param);
+            for ( i = 0; i < n; ++i ) x[(size_t)i*nrhs+j] = mgl[0].x.val[i];
+        }
+        return;
+    }
+
+    for ( i = 0; i < MAX_AMG_LVL; ++i ) ncycles[i] = 1; // initially V-cycle
+    switch(cycle_type) {
+        case 12:
+            for ( i = MAX_AMG_LVL-2; i > 0; i -= 2 ) ncycles[i] = 2;
+            break;
+        case 21:
+            for ( i = MAX_AMG_LVL-1; i > 0; i -= 2 ) ncycles[i] = 2;
+            break;
+        default:
+            for ( i = 0; i < MAX_AMG_LVL; i += 1 ) ncycles[i] = cycle_type;
+    }
+
+#if DEBUG_MODE > 0
+    printf("### DEBUG: [-Begin-] %s ...\n", __FUNCTION__);
+    printf("### DEBUG: n=%d, nnz=%d, nrhs=%d\n", mgl[0].A.row, mgl[0].A.nnz, nrhs);
+#endif
+
+    // block vectors on all levels from the work arena
+    const size_t mark = fasp_arena_mark(NULL);
+    B[0] = b; X[0] = x;
+    for ( i = 0; i < nl; ++i ) {
+        m = mgl[i].A.row;
+        if ( i > 0 ) {
+            B[i] = (REAL *)fasp_arena_alloc(NULL, (size_t)m*nrhs, sizeof(REAL));
+            X[i] = (REAL *)fasp_arena_alloc(NULL, (size_t)m*nrhs, sizeof(REAL));
+        }
+        W[i] = (REAL *)fasp_arena_alloc(NULL, (size_t)m*nrhs, sizeof(REAL));
+    }
+
+ForwardSweep:
+    while ( l < nl-1 ) {
+
+        num_lvl[l]++;
+        m = mgl[l].A.row;
+
+        // pre-smoothing with standard smoother
+        mgcycle_smoothing_mv(smoother, &mgl[l].A, nrhs, B[l], X[l],
+                             param->presmooth_iter, 1, relax, smooth_order,
+                             mgl[l].cfmark.val);
+
+        // form residual R = B - A X
+        fasp_darray_cp(m*nrhs, B[l], W[l]);
+        fasp_blas_dcsr_aAxpy_dense(-1.0, &mgl[l].A, nrhs, X[l], W[l]);
+
+        // restriction R1 = R*R0
+        if ( amg_type == UA_AMG )
+            fasp_blas_dcsr_mxm_dense_agg(&mgl[l].R, nrhs, W[l], B[l+1]);
+        else if ( mgl[l].Rval_sp != NULL )
+            fasp_blas_dcsr_mxm_dense_sp(&mgl[l].R, mgl[l].Rval_sp, nrhs, W[l], B[l+1]);
+        else
+            fasp_blas_dcsr_mxm_dense(&mgl[l].R, nrhs, W[l], B[l+1]);
+
+        // prepare for the next level
+        ++l; fasp_darray_set(mgl[l].A.row*nrhs, X[l], 0.0);
+
+    }
+
+    // call the coarse space solver for each vector
+    m = mgl[nl-1].A.row;
+    for ( j = 0; j < nrhs; ++j ) {
+        for ( i = 0; i < m; ++i ) {
+            mgl[nl-1].b.val[i] = B[nl-1][(size_t)i*nrhs+j];
+            mgl[nl-1].x.val[i] = X[nl-1][(size_t)i*nrhs+j];
+        }
+        mgcycle_coarse_solve(&mgl[nl-1], coarse_solver, tol, prtlvl);
+        for ( i = 0; i < m; ++i ) X[nl-1][(size_t)i*nrhs+j] = mgl[nl-1].x.val[i];
+    }
+
+    // BackwardSweep:
+    while ( l > 0 ) {
+
+        --l;
+
+        // prolongation U = U + P*E1
+        if ( amg_type == UA_AMG )
+            fasp_blas_dcsr_aAxpy_dense_agg(1.0, &mgl[l].P, nrhs, X[l+1], X[l]);
+        else if ( mgl[l].Pval_sp != NULL )
+            fasp_blas_dcsr_aAxpy_dense_sp(1.0, &mgl[l].P, mgl[l].Pval_sp, nrhs,
+                                          X[l+1], X[l]);
+        else
+            fasp_blas_dcsr_aAxpy_dense(1.0, &mgl[l].P, nrhs, X[l+1], X[l]);
+
+        // post-smoothing with standard methods
+        mgcycle_smoothing_mv(smoother, &mgl[l].A, nrhs, B[l], X[l],
+                             param->postsmooth_iter, -1, relax, smooth_order,
+                             mgl[l].cfmark.val);
+
+        // General cycling on each level
+        if ( num_lvl[l] < ncycles[l] ) break;
+        else num_lvl[l] = 0;
+    }
+
+    if ( l > 0 ) goto ForwardSweep;
+
+    fasp_arena_release(NULL, mark);
+
+#if DEBUG_MODE > 0
+    printf("### DEBUG: [--End--] %s ...\n", __FUNCTION__);
+#endif
+
+}
+
 /**
  * \fn void fasp_solver_mgcycle_bsr (AMG_data_bsr *mgl, AMG_param *param)
  *
@@ -264,6 +434,8 @@ ForwardSweep:
  *
  * \author Xiaozhe Hu
  * \date   08/07/2011
+ *
+ * Modified by FASP team on 10/16/2026: single precision R and P.
  */
 void fasp_solver_mgcycle_bsr (AMG_data_bsr  *mgl,
                               AMG_param     *param)
@@ -375,7 +547,7 @@ ForwardSweep:
         fasp_blas_dbsr_aAxpy(-1.0,&mgl[l].A, mgl[l].x.val, mgl[l].w.val);
 
         // restriction r1 = R*r0
-        fasp_blas_dbsr_mxv(&mgl[l].R, mgl[l].w.val, mgl[l+1].b.val);
+        fasp_mg_dbsr_mxv(&mgl[l].R, mgl[l].Rval_sp, mgl[l].w.val, mgl[l+1].b.val);
 
         // prepare for the next level
         ++l; fasp_dvec_set(mgl[l].A.ROW*mgl[l].A.nb, &mgl[l].x, 0.0);
@@ -425,7 +597,7 @@ ForwardSweep:
                                           NULL,ctol,cmaxit,25,1,0) < 0 ) {
                 if ( prtlvl > PRINT_MIN ) {
                     printf("### WARNING: Coarse level solver did not converge!\n");
-                    printf("### WARNING: Consider to increase maxit to %d!\n", 2*cmaxit);
+                    printf("### WARNING: Consider to increase maxit to " INTFMT "!\n", 2*cmaxit);
                 }
             }
         }
@@ -442,7 +614,7 @@ ForwardSweep:
             PeH.val = mgl[l].w.val + mgl[l].b.row;
             Aeh.val = PeH.val + mgl[l].b.row;
 
-            fasp_blas_dbsr_mxv (&mgl[l].P, mgl[l+1].x.val,  PeH.val);
+            fasp_mg_dbsr_mxv (&mgl[l].P, mgl[l].Pval_sp, mgl[l+1].x.val, PeH.val);
             fasp_blas_dbsr_mxv (&mgl[l].A, PeH.val, Aeh.val);
 
             alpha = (fasp_blas_darray_dotprod (mgl[l].b.row, Aeh.val, mgl[l].w.val))
@@ -451,7 +623,8 @@ ForwardSweep:
             fasp_blas_darray_axpy (mgl[l].b.row, alpha, PeH.val, mgl[l].x.val);
         }
         else {
-            fasp_blas_dbsr_aAxpy(alpha, &mgl[l].P, mgl[l+1].x.val, mgl[l].x.val);
+            fasp_mg_dbsr_aAxpy(alpha, &mgl[l].P, mgl[l].Pval_sp, mgl[l+1].x.val,
+                               mgl[l].x.val);
         }
 
         // extra kernel solve
@@ -536,6 +709,230 @@ ForwardSweep:
 
 }
 
+/*---------------------------------*/
+/*--      Private Functions      --*/
+/*---------------------------------*/
+
+/**
+ * \fn static void mgcycle_coarse_solve (AMG_data *mgc, const SHORT coarse_solver,
+ *                                       const REAL tol, const SHORT prtlvl)
+ *
+ * \brief Solve the coarsest level problem of the multigrid cycle
+ *
+ * \param mgc            Pointer to AMG data of the coarsest level
+ * \param coarse_solver  Coarsest level solver type
+ * \param tol            Tolerance for the iterative coarse solver
+ * \param prtlvl         Level of output
+ *
+ * \author FASP team
+ * \date   10/16/2026
+ */
+static void mgcycle_coarse_solve (AMG_data     *mgc,
+                                  const SHORT   coarse_solver,
+                                  const REAL    tol,
+                                  const SHORT   prtlvl)
+{
+    switch ( coarse_solver ) {
+
+#if WITH_PARDISO
+        case SOLVER_PARDISO: {
+            /* use Intel MKL PARDISO direct solver on the coarsest level */
+            fasp_pardiso_solve(&mgc->A, &mgc->b, &mgc->x, &mgc->pdata, 0);
+            break;
+        }
+#endif
+
+#if WITH_MUMPS
+        case SOLVER_MUMPS: {
+            // use MUMPS direct solver on the coarsest level
+            mgc->mumps.job = 2;
+            fasp_solver_mumps_steps(&mgc->A, &mgc->b, &mgc->x, &mgc->mumps);
+            break;
+        }
+#endif
+
+#if WITH_UMFPACK
+        case SOLVER_UMFPACK: {
+            // use UMFPACK direct solver on the coarsest level
+            fasp_umfpack_solve(&mgc->A, &mgc->b, &mgc->x, mgc->Numeric, 0);
+            break;
+        }
+#endif
+
+#if WITH_SuperLU
+        case SOLVER_SUPERLU: {
+            // use SuperLU direct solver on the coarsest level
+            fasp_solver_superlu(&mgc->A, &mgc->b, &mgc->x, 0);
+            break;
+        }
+#endif
+
+        default:
+            // use iterative solver on the coarsest level
+            fasp_coarse_itsolver(&mgc->A, &mgc->b, &mgc->x, tol, prtlvl);
+
+    }
+}
+
+/**
+ * \fn static SHORT mgcycle_mv_supported (const AMG_data *mgl,
+ *                                        const AMG_param *param)
+ *
+ * \brief Check whether the multigrid cycle has a block version for AMG settings
+ *
+ * \param mgl    Pointer to AMG data: AMG_data
+ * \param param  Pointer to AMG parameters: AMG_param
+ *
+ * \return       TRUE if fasp_solver_mgcycle_mv can treat all vectors together
+ *
+ * \author FASP team
+ * \date   10/16/2026
+ */
+static SHORT mgcycle_mv_supported (const AMG_data   *mgl,
+                                   const AMG_param  *param)
+{
+#if MULTI_COLOR_ORDER
+    return FALSE;
+#endif
+
+    INT l;
+
+    if ( mgl->ILU_levels > 0 || mgl->SWZ_levels > 0 ) return FALSE;
+    if ( param->coarse_scaling == ON ) return FALSE;
+
+    // the block kernels need the double precision values of A
+    for ( l = 0; l < mgl[0].num_levels; ++l ) {
+        if ( mgl[l].Aval_sp != NULL ) return FALSE;
+    }
+
+    switch ( param->smoother ) {
+        case SMOOTHER_GS:
+        case SMOOTHER_SGS:
+        case SMOOTHER_JACOBI:
+            return TRUE;
+        default:
+            return FALSE;
+    }
+}
+
+/**
+ * \fn static void mgcycle_smoothing_mv (const SHORT smoother, dCSRmat *A,
+ *                                       const INT nrhs, const REAL *b, REAL *x,
+ *                                       const INT nsweeps, const INT dir,
+ *                                       const REAL relax, const SHORT order,
+ *                                       INT *ordering)
+ *
+ * \brief Multigrid pre- or post-smoothing for a block of vectors
+ *
+ * \param  smoother  type of smoother
+ * \param  A         pointer to matrix data
+ * \param  nrhs      number of vectors
+ * \param  b         pointer to rhs data (interleaved)
+ * \param  x         pointer to sol data (interleaved)
+ * \param  nsweeps   number of smoothing sweeps
+ * \param  dir       presmoothing (1) or postsmoothing (-1)
+ * \param  relax     relaxation parameter or weight for smoothers
+ * \param  order     order for smoothing sweeps
+ * \param  ordering  user defined ordering
+ *
+ * \author FASP team
+ * \date   10/16/2026
+ *
+ * \note Same sweeps as fasp_dcsr_presmoothing and fasp_dcsr_postsmoothing.
+ */
+static void mgcycle_smoothing_mv (const SHORT   smoother,
+                                  dCSRmat      *A,
+                                  const INT     nrhs,
+                                  const REAL   *b,
+                                  REAL         *x,
+                                  const INT     nsweeps,
+                                  const INT     dir,
+                                  const REAL    relax,
+                                  const SHORT   order,
+                                  INT          *ordering)
+{
+    INT i;
+
+    switch (smoother) {
+
+        case SMOOTHER_GS:
+            fasp_smoother_dcsr_gs_mv(nrhs, x, A, b, nsweeps,
+                                     order == CF_ORDER ? ordering : NULL, dir);
+            break;
+
+        case SMOOTHER_SGS:
+            for ( i = 0; i < nsweeps; ++i ) {
+                fasp_smoother_dcsr_gs_mv(nrhs, x, A, b, 1, NULL,  1);
+                fasp_smoother_dcsr_gs_mv(nrhs, x, A, b, 1, NULL, -1);
+            }
+            break;
+
+        case SMOOTHER_JACOBI:
+            fasp_smoother_dcsr_jacobi_mv(nrhs, x, A, b, nsweeps, relax);
+            break;
+
+        default:
+            printf("### ERROR: Unknown smoother type %d!\n", smoother);
+            fasp_chkerr(ERROR_INPUT_PAR, __FUNCTION__);
+    }
+}
+
+/**
+ * \fn static SHORT mgcycle_smoothing_csr16 (const SHORT smoother,
+ *                                          const dCSR16mat *A, dvector *b,
+ *                                          dvector *x, const INT nsweeps,
+ *                                          const INT dir, const SHORT order,
+ *                                          INT *ordering)
+ *
+ * \brief Multigrid pre- or post-smoothing with the compressed column indices
+ *
+ * \param  smoother  type of smoother
+ * \param  A         pointer to matrix data in CSR16 format
+ * \param  b         pointer to rhs data
+ * \param  x         pointer to sol data
+ * \param  nsweeps   number of smoothing sweeps
+ * \param  dir       presmoothing (1) or postsmoothing (-1)
+ * \param  order     order for smoothing sweeps
+ * \param  ordering  user defined ordering
+ *
+ * \return           TRUE if smoothed; FALSE if the smoother needs dCSRmat
+ *
+ * \author FASP team
+ * \date   10/16/2026
+ *
+ * \note Same sweeps as fasp_dcsr_presmoothing and fasp_dcsr_postsmoothing.
+ */
+static SHORT mgcycle_smoothing_csr16 (const SHORT       smoother,
+                                      const dCSR16mat  *A,
+                                      dvector          *b,
+                                      dvector          *x,
+                                      const INT         nsweeps,
+                                      const INT         dir,
+                                      const SHORT       order,
+                                      INT              *ordering)
+{
+    const INT n = A->row;
+
+    switch (smoother) {
+
+        case SMOOTHER_GS:
+            if ( order == NO_ORDER || ordering == NULL ) {
+                if ( dir > 0 ) fasp_smoother_dcsr16_gs(x, 0, n-1, 1, A, b, nsweeps);
+                else fasp_smoother_dcsr16_gs(x, n-1, 0, -1, A, b, nsweeps);
+            }
+            else if ( order == CF_ORDER )
+                fasp_smoother_dcsr16_gs_cf(x, A, b, nsweeps, ordering, dir);
+            return TRUE;
+
+        case SMOOTHER_SGS:
+            fasp_smoother_dcsr16_sgs(x, A, b, nsweeps);
+            return TRUE;
+
+        default:
+            return FALSE;
+    }
+}
+
 /*---------------------------------*/
 /*--        End of File          --*/
 /*---------------------------------*/
@@ -5,7 +5,7 @@
  *  \note  This file contains Level-4 (Pre) functions. It requires:
  *         AuxArray.c, AuxMessage.c, AuxVector.c, BlaSchwarzSetup.c, BlaArray.c,
  *         BlaSpmvCSR.c, BlaVector.c, ItrSmootherCSR.c, ItrSmootherCSRpoly.c, 
- *         KryPcg.c, KrySPcg.c, and KrySPvgmres.c
+ *         ItrSmootherCSRsp.c, KryPcg.c, KrySPcg.c, and KrySPvgmres.c
  *
  *---------------------------------------------------------------------------------
  *  Copyright (C) 2009--Present by the FASP team. All rights reserved.
@@ -43,6 +43,9 @@
  *
  * Modified by Chensong Zhang on 06/01/2012: fix a bug when there is only one level.
  * Modified by Hongxuan Zhang on 12/15/2015: update direct solvers.
+ * Modified by FASP team on 10/16/2026: single precision R and P.
+ * Modified by FASP team on 10/16/2026: cached spectrum bound for poly smoother.
+ * Modified by FASP team on 10/16/2026: single precision A on coarse levels.
  */
 void fasp_solver_fmgcycle (AMG_data   *mgl,
                            AMG_param  *param)
@@ -87,7 +90,8 @@ void fasp_solver_fmgcycle (AMG_data   *mgl,
 
         default:
             for (l=0;l<nl-1;l++)
-                fasp_blas_dcsr_mxv(&mgl[l].R, mgl[l].b.val, mgl[l+1].b.val);
+                fasp_mg_dcsr_mxv(&mgl[l].R, NULL, mgl[l].Rval_sp, mgl[l].b.val,
+                                 mgl[l+1].b.val);
             break;
 
     }
@@ -196,7 +200,8 @@ void fasp_solver_fmgcycle (AMG_data   *mgl,
                 case UA_AMG:
                     fasp_blas_dcsr_aAxpy_agg(alpha, &mgl[l].P, mgl[l+1].x.val, mgl[l].x.val); break;
                 default:
-                    fasp_blas_dcsr_aAxpy(alpha, &mgl[l].P, mgl[l+1].x.val, mgl[l].x.val); break;
+                    fasp_mg_dcsr_aAxpy(alpha, &mgl[l].P, NULL, mgl[l].Pval_sp,
+                                       mgl[l+1].x.val, mgl[l].x.val); break;
             }
         }
 
@@ -209,7 +214,8 @@ void fasp_solver_fmgcycle (AMG_data   *mgl,
 
             // form residual r = b - A x
             fasp_darray_cp(mgl[l].A.row, mgl[l].b.val, mgl[l].w.val);
-            fasp_blas_dcsr_aAxpy(-1.0,&mgl[l].A, mgl[l].x.val, mgl[l].w.val);
+            fasp_mg_dcsr_aAxpy(-1.0, &mgl[l].A, NULL, mgl[l].Aval_sp,
+                               mgl[l].x.val, mgl[l].w.val);
             relerr = fasp_blas_dvec_norm2(&mgl[l].w) / fasp_blas_dvec_norm2(&mgl[l].b);
 
             // Forward Sweep
@@ -231,14 +237,20 @@ void fasp_solver_fmgcycle (AMG_data   *mgl,
                     }
                 }
 
+                else if (mgl[l].Aval_sp != NULL) {
+                    fasp_dcsr_smoothing_sp(smoother,&mgl[l].A,mgl[l].Aval_sp,&mgl[l].b,&mgl[l].x,
+                                           param->presmooth_iter,1,relax,smooth_order,mgl[l].cfmark.val);
+                }
+
                 else {
                     fasp_dcsr_presmoothing(smoother,&mgl[l].A,&mgl[l].b,&mgl[l].x,param->presmooth_iter,
-                                           0,mgl[l].A.row-1,1,relax,ndeg,smooth_order,mgl[l].cfmark.val);
+                                           0,mgl[l].A.row-1,1,relax,ndeg,mgl[l].eig_max,smooth_order,mgl[l].cfmark.val);
                 }
 
                 // form residual r = b - A x
                 fasp_darray_cp(mgl[l].A.row, mgl[l].b.val, mgl[l].w.val);
-                fasp_blas_dcsr_aAxpy(-1.0,&mgl[l].A, mgl[l].x.val, mgl[l].w.val);
+                fasp_mg_dcsr_aAxpy(-1.0, &mgl[l].A, NULL, mgl[l].Aval_sp,
+                                   mgl[l].x.val, mgl[l].w.val);
 
                 // restriction r1 = R*r0
                 switch (amg_type) {
@@ -246,7 +258,8 @@ void fasp_solver_fmgcycle (AMG_data   *mgl,
                         fasp_blas_dcsr_mxv_agg(&mgl[l].R, mgl[l].w.val, mgl[l+1].b.val);
                         break;
                     default:
-                        fasp_blas_dcsr_mxv(&mgl[l].R, mgl[l].w.val, mgl[l+1].b.val);
+                        fasp_mg_dcsr_mxv(&mgl[l].R, NULL, mgl[l].Rval_sp,
+                                         mgl[l].w.val, mgl[l+1].b.val);
                         break;
                 }
 
@@ -315,7 +328,8 @@ void fasp_solver_fmgcycle (AMG_data   *mgl,
                         fasp_blas_dcsr_aAxpy_agg(alpha, &mgl[l].P, mgl[l+1].x.val, mgl[l].x.val);
                         break;
                     default:
-                        fasp_blas_dcsr_aAxpy(alpha, &mgl[l].P, mgl[l+1].x.val, mgl[l].x.val);
+                        fasp_mg_dcsr_aAxpy(alpha, &mgl[l].P, NULL, mgl[l].Pval_sp,
+                                           mgl[l+1].x.val, mgl[l].x.val);
                         break;
                 }
 
@@ -335,9 +349,14 @@ void fasp_solver_fmgcycle (AMG_data   *mgl,
                     }
                 }
 
+                else if (mgl[l].Aval_sp != NULL) {
+                    fasp_dcsr_smoothing_sp(smoother,&mgl[l].A,mgl[l].Aval_sp,&mgl[l].b,&mgl[l].x,
+                                           param->postsmooth_iter,-1,relax,smooth_order,mgl[l].cfmark.val);
+                }
+
                 else {
                     fasp_dcsr_postsmoothing(smoother,&mgl[l].A,&mgl[l].b,&mgl[l].x,param->postsmooth_iter,
-                                            0,mgl[l].A.row-1,-1,relax,ndeg,smooth_order,mgl[l].cfmark.val);
+                                            0,mgl[l].A.row-1,-1,relax,ndeg,mgl[l].eig_max,smooth_order,mgl[l].cfmark.val);
                 }
 
             } // end while
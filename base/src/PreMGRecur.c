@@ -4,7 +4,8 @@
  *
  *  \note  This file contains Level-4 (Pre) functions. It requires:
  *         AuxArray.c, AuxMessage.c, AuxVector.c, BlaSpmvCSR.c, ItrSmootherCSR.c,
- *         ItrSmootherCSRpoly.c, KryPcg.c, KrySPcg.c, and KrySPvgmres.c
+ *         ItrSmootherCSRpoly.c, ItrSmootherCSRsp.c, KryPcg.c, KrySPcg.c, and
+ *         KrySPvgmres.c
  *
  *  \warning Not used any more! Deprecated in the future versions.
  *
@@ -43,6 +44,9 @@
  * \date   04/06/2010
  *
  * Modified by Chensong Zhang on 02/27/2013: update direct solvers.
+ * Modified by FASP team on 10/16/2026: single precision R and P.
+ * Modified by FASP team on 10/16/2026: cached spectrum bound for poly smoother.
+ * Modified by FASP team on 10/16/2026: single precision A on coarse levels.
  */
 void fasp_solver_mgrecur (AMG_data   *mgl,
                           AMG_param  *param,
@@ -74,7 +78,7 @@ void fasp_solver_mgrecur (AMG_data   *mgl,
 #endif
     
     if ( prtlvl >= PRINT_MOST )
-        printf("AMG level %d, smoother %d.\n", level, smoother);
+        printf("AMG level " INTFMT ", smoother %d.\n", level, smoother);
     
     if ( level < mgl[level].num_levels-1 ) {
         
@@ -82,17 +86,21 @@ void fasp_solver_mgrecur (AMG_data   *mgl,
         if ( level < mgl[level].ILU_levels ) {
             fasp_smoother_dcsr_ilu(A0, b0, e0, LU_level);
         }
+        else if ( mgl[level].Aval_sp != NULL ) {
+            fasp_dcsr_smoothing_sp(smoother,A0,mgl[level].Aval_sp,b0,e0,param->presmooth_iter,
+                                   1,relax,smooth_order,ordering);
+        }
         else {
             fasp_dcsr_presmoothing(smoother,A0,b0,e0,param->presmooth_iter,
-                                   0,m0-1,1,relax,ndeg,smooth_order,ordering);
+                                   0,m0-1,1,relax,ndeg,mgl[level].eig_max,smooth_order,ordering);
         }
         
         // form residual r = b - A x
         fasp_darray_cp(m0,b0->val,r);
-        fasp_blas_dcsr_aAxpy(-1.0,A0,e0->val,r);
+        fasp_mg_dcsr_aAxpy(-1.0, A0, NULL, mgl[level].Aval_sp, e0->val, r);
         
         // restriction r1 = R*r0
-        fasp_blas_dcsr_mxv(&mgl[level].R, r, b1->val);
+        fasp_mg_dcsr_mxv(&mgl[level].R, NULL, mgl[level].Rval_sp, r, b1->val);
         
         { // call MG recursively: type = 1 for V cycle, type = 2 for W cycle
             SHORT i;
@@ -101,15 +109,20 @@ void fasp_solver_mgrecur (AMG_data   *mgl,
         }
         
         // prolongation e0 = e0 + P*e1
-        fasp_blas_dcsr_aAxpy(1.0, &mgl[level].P, e1->val, e0->val);
+        fasp_mg_dcsr_aAxpy(1.0, &mgl[level].P, NULL, mgl[level].Pval_sp, e1->val,
+                           e0->val);
         
         // post smoothing
         if ( level < mgl[level].ILU_levels ) {
             fasp_smoother_dcsr_ilu(A0, b0, e0, LU_level);
         }
+        else if ( mgl[level].Aval_sp != NULL ) {
+            fasp_dcsr_smoothing_sp(smoother,A0,mgl[level].Aval_sp,b0,e0,param->postsmooth_iter,
+                                   -1,relax,smooth_order,ordering);
+        }
         else {
             fasp_dcsr_postsmoothing(smoother,A0,b0,e0,param->postsmooth_iter,
-                                    0,m0-1,-1,relax,ndeg,smooth_order,ordering);
+                                    0,m0-1,-1,relax,ndeg,mgl[level].eig_max,smooth_order,ordering);
         }
         
     }
@@ -54,6 +54,8 @@
  * Modified by Chensong Zhang on 02/27/2013: update direct solvers.
  * Modified by Zheng Li on 11/10/2014: update direct solvers.
  * Modified by Hongxuan Zhang on 12/15/2015: update direct solvers.
+ * Modified by FASP team on 10/16/2026: single precision R and P.
+ * Modified by FASP team on 10/16/2026: cached spectrum bound for poly smoother.
  */
 void fasp_solver_amli (AMG_data   *mgl,
                        AMG_param  *param,
@@ -98,7 +100,7 @@ void fasp_solver_amli (AMG_data   *mgl,
 #endif
     
     if ( prtlvl >= PRINT_MOST )
-        printf("AMLI level %d, smoother %d.\n", l, smoother);
+        printf("AMLI level " INTFMT ", smoother %d.\n", l, smoother);
     
     if ( l < mgl[l].num_levels-1 ) {
         
@@ -128,7 +130,7 @@ void fasp_solver_amli (AMG_data   *mgl,
             fasp_smoother_dcsr_gs_multicolor (&mgl[l].x, &mgl[l].A, &mgl[l].b, param->presmooth_iter,1);
 #else            
             fasp_dcsr_presmoothing(smoother,A0,b0,e0,param->presmooth_iter,
-                                   0,m0-1,1,relax,ndeg,smooth_order,ordering);
+                                   0,m0-1,1,relax,ndeg,mgl[l].eig_max,smooth_order,ordering);
 #endif             
         }
         
@@ -141,7 +143,7 @@ void fasp_solver_amli (AMG_data   *mgl,
             case UA_AMG:
                 fasp_blas_dcsr_mxv_agg(&mgl[l].R, r, b1->val); break;
             default:
-                fasp_blas_dcsr_mxv(&mgl[l].R, r, b1->val); break;
+                fasp_mg_dcsr_mxv(&mgl[l].R, NULL, mgl[l].Rval_sp, r, b1->val); break;
         }
         
         // coarse grid correction
@@ -179,7 +181,8 @@ void fasp_solver_amli (AMG_data   *mgl,
                 fasp_blas_dcsr_aAxpy_agg(alpha, &mgl[l].P, e1->val, e0->val);
                 break;
             default:
-                fasp_blas_dcsr_aAxpy(alpha, &mgl[l].P, e1->val, e0->val);
+                fasp_mg_dcsr_aAxpy(alpha, &mgl[l].P, NULL, mgl[l].Pval_sp, e1->val,
+                                   e0->val);
                 break;
         }
         
@@ -208,7 +211,7 @@ void fasp_solver_amli (AMG_data   *mgl,
 	        fasp_smoother_dcsr_gs_multicolor (&mgl[l].x, &mgl[l].A, &mgl[l].b, param->postsmooth_iter,-1);
 #else
             fasp_dcsr_postsmoothing(smoother,A0,b0,e0,param->postsmooth_iter,
-                                    0,m0-1,-1,relax,ndeg,smooth_order,ordering);
+                                    0,m0-1,-1,relax,ndeg,mgl[l].eig_max,smooth_order,ordering);
 #endif 	
         }
         
@@ -280,6 +283,8 @@ void fasp_solver_amli (AMG_data   *mgl,
  * Modified by Chensong Zhang on 02/27/2013: update direct solvers.
  * Modified by Zheng Li on 11/10/2014: update direct solvers.
  * Modified by Hongxuan Zhang on 12/15/2015: update direct solvers.
+ * Modified by FASP team on 10/16/2026: single precision R and P.
+ * Modified by FASP team on 10/16/2026: cached spectrum bound for poly smoother.
  */
 void fasp_solver_namli (AMG_data   *mgl,
                         AMG_param  *param,
@@ -321,7 +326,7 @@ void fasp_solver_namli (AMG_data   *mgl,
 #endif
     
     if ( prtlvl >= PRINT_MOST )
-        printf("Nonlinear AMLI level %d, smoother %d.\n", num_levels, smoother);
+        printf("Nonlinear AMLI level " INTFMT ", smoother %d.\n", num_levels, smoother);
     
     if ( l < num_levels-1 ) {
         
@@ -351,7 +356,7 @@ void fasp_solver_namli (AMG_data   *mgl,
             fasp_smoother_dcsr_gs_multicolor (&mgl[l].x, &mgl[l].A, &mgl[l].b, param->presmooth_iter,1);
 #else            
             fasp_dcsr_presmoothing(smoother,A0,b0,e0,param->presmooth_iter,
-                                   0,m0-1,1,relax,ndeg,smooth_order,ordering);
+                                   0,m0-1,1,relax,ndeg,mgl[l].eig_max,smooth_order,ordering);
 #endif            
         }
         
@@ -365,7 +370,7 @@ void fasp_solver_namli (AMG_data   *mgl,
                 fasp_blas_dcsr_mxv_agg(&mgl[l].R, r, b1->val);
                 break;
             default:
-                fasp_blas_dcsr_mxv(&mgl[l].R, r, b1->val);
+                fasp_mg_dcsr_mxv(&mgl[l].R, NULL, mgl[l].Rval_sp, r, b1->val);
         }
         
         // call nonlinear AMLI-cycle recursively
@@ -413,7 +418,8 @@ void fasp_solver_namli (AMG_data   *mgl,
                 fasp_blas_dcsr_aAxpy_agg(1.0, &mgl[l].P, e1->val, e0->val);
                 break;
             default:
-                fasp_blas_dcsr_aAxpy(1.0, &mgl[l].P, e1->val, e0->val);
+                fasp_mg_dcsr_aAxpy(1.0, &mgl[l].P, NULL, mgl[l].Pval_sp, e1->val,
+                                   e0->val);
         }
         
         // post smoothing
@@ -440,7 +446,7 @@ void fasp_solver_namli (AMG_data   *mgl,
 	        fasp_smoother_dcsr_gs_multicolor (&mgl[l].x, &mgl[l].A, &mgl[l].b, param->postsmooth_iter,-1);
 #else
             fasp_dcsr_postsmoothing(smoother,A0,b0,e0,param->postsmooth_iter,
-                                    0,m0-1,-1,relax,ndeg,smooth_order,ordering);
+                                    0,m0-1,-1,relax,ndeg,mgl[l].eig_max,smooth_order,ordering);
 #endif             
         }
         
@@ -513,6 +519,7 @@ void fasp_solver_namli (AMG_data   *mgl,
  *
  * Modified by Chensong Zhang on 02/27/2013: update direct solvers.
  * Modified by Hongxuan Zhang on 12/15/2015: update direct solvers.
+ * Modified by FASP team on 10/16/2026: single precision R and P.
  */
 void fasp_solver_namli_bsr (AMG_data_bsr  *mgl,
                             AMG_param     *param,
@@ -546,7 +553,7 @@ void fasp_solver_namli_bsr (AMG_data_bsr  *mgl,
 #endif
     
     if (prtlvl>=PRINT_MOST)
-        printf("Nonlinear AMLI: level %d, smoother %d.\n", l, smoother);
+        printf("Nonlinear AMLI: level " INTFMT ", smoother %d.\n", l, smoother);
     
     if (l < num_levels-1) {
         
@@ -582,7 +589,7 @@ void fasp_solver_namli_bsr (AMG_data_bsr  *mgl,
         fasp_darray_cp(m0,b0->val,r);
         fasp_blas_dbsr_aAxpy(-1.0,A0,e0->val,r);
         
-        fasp_blas_dbsr_mxv(&mgl[l].R, r, b1->val);
+        fasp_mg_dbsr_mxv(&mgl[l].R, mgl[l].Rval_sp, r, b1->val);
         
         // call nonlinear AMLI-cycle recursively
         {
@@ -619,7 +626,7 @@ void fasp_solver_namli_bsr (AMG_data_bsr  *mgl,
             
         }
         
-        fasp_blas_dbsr_aAxpy(1.0, &mgl[l].P, e1->val, e0->val);
+        fasp_mg_dbsr_aAxpy(1.0, &mgl[l].P, mgl[l].Pval_sp, e1->val, e0->val);
         
         // post smoothing
         if (l < param->ILU_levels) {
@@ -763,7 +770,7 @@ void fasp_amg_amli_coef (const REAL  lambda_max,
     }
     
     else {
-        printf("### ERROR: Wrong AMLI degree %d!\n", degree);
+        printf("### ERROR: Wrong AMLI degree " INTFMT "!\n", degree);
         fasp_chkerr(ERROR_INPUT_PAR, __FUNCTION__);
     }
     
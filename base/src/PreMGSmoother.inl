@@ -23,7 +23,8 @@
  *                                         const INT nsweeps, const INT istart,
  *                                         const INT iend, const INT istep,
  *                                         const REAL relax, const SHORT ndeg,
- *                                         const SHORT order, INT *ordering)
+ *                                         const REAL emax, const SHORT order,
+ *                                         INT *ordering)
  *
  * \brief Multigrid presmoothing
  *
@@ -37,6 +38,7 @@
  * \param  istep     step size
  * \param  relax     relaxation parameter or weight for smoothers
  * \param  ndeg      degree of the polynomial smoother
+ * \param  emax      upper spectrum bound of inv(D)*A for polynomial smoother
  * \param  order     order for smoothing sweeps
  * \param  ordering  user defined ordering
  *
@@ -45,6 +47,7 @@
  *
  * Modified by Xiaozhe on 06/04/2012: add ndeg as input
  * Modified by Chensong on 02/16/2013: GS -> SMOOTHER_GS, etc
+ * Modified by FASP team on 10/16/2026: add emax as input
  */
 static void fasp_dcsr_presmoothing (const SHORT  smoother,
                                     dCSRmat     *A,
@@ -56,6 +59,7 @@ static void fasp_dcsr_presmoothing (const SHORT  smoother,
                                     const INT    istep,
                                     const REAL   relax,
                                     const SHORT  ndeg,
+                                    const REAL   emax,
                                     const SHORT  order,
                                     INT         *ordering)
 {
@@ -81,7 +85,7 @@ static void fasp_dcsr_presmoothing (const SHORT  smoother,
             break;
 
         case SMOOTHER_POLY:
-            fasp_smoother_dcsr_poly(A, b, x, iend+1, ndeg, nsweeps);
+            fasp_smoother_dcsr_poly_eig(A, b, x, iend+1, ndeg, nsweeps, emax);
             break;
 
         case SMOOTHER_SOR:
@@ -121,7 +125,8 @@ static void fasp_dcsr_presmoothing (const SHORT  smoother,
  *                                          const INT nsweeps, const INT istart,
  *                                          const INT iend, const INT istep,
  *                                          const REAL relax, const SHORT ndeg,
- *                                          const SHORT order, INT *ordering)
+ *                                          const REAL emax, const SHORT order,
+ *                                          INT *ordering)
  *
  * \brief Multigrid presmoothing
  *
@@ -135,6 +140,7 @@ static void fasp_dcsr_presmoothing (const SHORT  smoother,
  * \param  istep     step size
  * \param  relax     relaxation parameter or weight for smoothers
  * \param  ndeg      degree of the polynomial smoother
+ * \param  emax      upper spectrum bound of inv(D)*A for polynomial smoother
  * \param  order     order for smoothing sweeps
  * \param  ordering  user defined ordering
  *
@@ -143,6 +149,7 @@ static void fasp_dcsr_presmoothing (const SHORT  smoother,
  *
  * Modified by Xiaozhe Hu on 06/04/2012: add ndeg as input
  * Modified by Chensong on 02/16/2013: GS -> SMOOTHER_GS, etc
+ * Modified by FASP team on 10/16/2026: add emax as input
  */
 static void fasp_dcsr_postsmoothing (const SHORT  smoother,
                                      dCSRmat     *A,
@@ -154,6 +161,7 @@ static void fasp_dcsr_postsmoothing (const SHORT  smoother,
                                      const INT    istep,
                                      const REAL   relax,
                                      const SHORT  ndeg,
+                                     const REAL   emax,
                                      const SHORT  order,
                                      INT         *ordering)
 {
@@ -180,7 +188,7 @@ static void fasp_dcsr_postsmoothing (const SHORT  smoother,
             break;
 
         case SMOOTHER_POLY:
-            fasp_smoother_dcsr_poly(A, b, x, iend+1, ndeg, nsweeps);
+            fasp_smoother_dcsr_poly_eig(A, b, x, iend+1, ndeg, nsweeps, emax);
             break;
 
         case SMOOTHER_SOR:
@@ -214,6 +222,72 @@ static void fasp_dcsr_postsmoothing (const SHORT  smoother,
     }
 }
 
+/**
+ * \fn static inline void fasp_dcsr_smoothing_sp (const SHORT smoother,
+ *                                                const dCSRmat *A,
+ *                                                const SREAL *val_sp, dvector *b,
+ *                                                dvector *x, const INT nsweeps,
+ *                                                const INT dir, const REAL relax,
+ *                                                const SHORT order, INT *ordering)
+ *
+ * \brief Multigrid pre- or post-smoothing with single precision values of A
+ *
+ * \param  smoother  type of smoother: SMOOTHER_GS, SMOOTHER_SGS, or SMOOTHER_JACOBI
+ * \param  A         pointer to matrix data (only the sparsity pattern is used)
+ * \param  val_sp    single precision values of A
+ * \param  b         pointer to rhs data
+ * \param  x         pointer to sol data
+ * \param  nsweeps   number of smoothing sweeps
+ * \param  dir       presmoothing (1) or postsmoothing (-1)
+ * \param  relax     relaxation parameter or weight for smoothers
+ * \param  order     order for smoothing sweeps
+ * \param  ordering  user defined ordering
+ *
+ * \author FASP team
+ * \date   10/16/2026
+ *
+ * \note Same sweeps as fasp_dcsr_presmoothing and fasp_dcsr_postsmoothing. A is
+ *       only stored in single precision for these smoothers, see
+ *       fasp_amg_data_mixed_precision.
+ */
+static inline void fasp_dcsr_smoothing_sp (const SHORT     smoother,
+                                           const dCSRmat  *A,
+                                           const SREAL    *val_sp,
+                                           dvector        *b,
+                                           dvector        *x,
+                                           const INT       nsweeps,
+                                           const INT       dir,
+                                           const REAL      relax,
+                                           const SHORT     order,
+                                           INT            *ordering)
+{
+    const INT n = A->row;
+
+    switch (smoother) {
+
+        case SMOOTHER_GS:
+            if ( order == NO_ORDER || ordering == NULL ) {
+                if ( dir > 0 ) fasp_smoother_dcsr_gs_sp(x, 0, n-1, 1, A, val_sp, b, nsweeps);
+                else fasp_smoother_dcsr_gs_sp(x, n-1, 0, -1, A, val_sp, b, nsweeps);
+            }
+            else if ( order == CF_ORDER )
+                fasp_smoother_dcsr_gs_cf_sp(x, A, val_sp, b, nsweeps, ordering, dir);
+            break;
+
+        case SMOOTHER_SGS:
+            fasp_smoother_dcsr_sgs_sp(x, A, val_sp, b, nsweeps);
+            break;
+
+        case SMOOTHER_JACOBI:
+            fasp_smoother_dcsr_jacobi_sp(x, 0, n-1, 1, A, val_sp, b, nsweeps, relax);
+            break;
+
+        default:
+            printf("### ERROR: Smoother %d needs double precision A!\n", smoother);
+            fasp_chkerr(ERROR_INPUT_PAR, __FUNCTION__);
+    }
+}
+
 /*---------------------------------*/
 /*--        End of File          --*/
 /*---------------------------------*/
@@ -1,6 +1,6 @@
 /*! \file  PreMGUtil.inl
  *
- *  \brief Routines for multigrid coarsest level solver
+ *  \brief Routines for multigrid coarsest level solver and transfer operators
  *
  *  \note  This file contains Level-4 (Pre) functions, which are used in:
  *         PreBSR.c, PreCSR.c, PreMGCycle.c, PreMGCycleFull.c, PreMGRecur.c,
@@ -53,10 +53,116 @@ static inline void fasp_coarse_itsolver (const dCSRmat  *A,
     
     if ( status < 0 && PrtLvl >= PRINT_MORE ) {
         printf("### WARNING: Coarse level solver did not converge!\n");
-        printf("### WARNING: Consider to increase maxit to %d!\n", 2*maxit);
+        printf("### WARNING: Consider to increase maxit to " INTFMT "!\n", 2*maxit);
     }
 }
 
+/**
+ * \fn static inline void fasp_mg_dcsr_mxv (const dCSRmat *A, const dCSRplan *plan,
+ *                                          const SREAL *val_sp, const REAL *x,
+ *                                          REAL *y)
+ *
+ * \brief Apply a transfer operator y = A*x of multigrid methods
+ *
+ * \param  A         pointer to matrix data
+ * \param  plan      SpMV plan of A (or NULL)
+ * \param  val_sp    single precision values of A (or NULL)
+ * \param  x         pointer to array x
+ * \param  y         pointer to array y
+ *
+ * \author FASP team
+ * \date   10/16/2026
+ *
+ * \note If A is stored in single precision, A->val is not available.
+ */
+static inline void fasp_mg_dcsr_mxv (const dCSRmat   *A,
+                                     const dCSRplan  *plan,
+                                     const SREAL     *val_sp,
+                                     const REAL      *x,
+                                     REAL            *y)
+{
+    if ( val_sp != NULL ) fasp_blas_dcsr_mxv_sp(A, val_sp, x, y);
+    else                  fasp_blas_dcsr_mxv_plan(A, plan, x, y);
+}
+
+/**
+ * \fn static inline void fasp_mg_dcsr_aAxpy (const REAL alpha, const dCSRmat *A,
+ *                                            const dCSRplan *plan,
+ *                                            const SREAL *val_sp, const REAL *x,
+ *                                            REAL *y)
+ *
+ * \brief Apply a transfer operator y = alpha*A*x + y of multigrid methods
+ *
+ * \param  alpha     REAL factor alpha
+ * \param  A         pointer to matrix data
+ * \param  plan      SpMV plan of A (or NULL)
+ * \param  val_sp    single precision values of A (or NULL)
+ * \param  x         pointer to array x
+ * \param  y         pointer to array y
+ *
+ * \author FASP team
+ * \date   10/16/2026
+ */
+static inline void fasp_mg_dcsr_aAxpy (const REAL       alpha,
+                                       const dCSRmat   *A,
+                                       const dCSRplan  *plan,
+                                       const SREAL     *val_sp,
+                                       const REAL      *x,
+                                       REAL            *y)
+{
+    if ( val_sp != NULL ) fasp_blas_dcsr_aAxpy_sp(alpha, A, val_sp, x, y);
+    else                  fasp_blas_dcsr_aAxpy_plan(alpha, A, plan, x, y);
+}
+
+/**
+ * \fn static inline void fasp_mg_dbsr_mxv (const dBSRmat *A, const SREAL *val_sp,
+ *                                          const REAL *x, REAL *y)
+ *
+ * \brief Apply a transfer operator y = A*x of multigrid methods (BSR format)
+ *
+ * \param  A         pointer to matrix data
+ * \param  val_sp    single precision values of A (or NULL)
+ * \param  x         pointer to array x
+ * \param  y         pointer to array y
+ *
+ * \author FASP team
+ * \date   10/16/2026
+ */
+static inline void fasp_mg_dbsr_mxv (const dBSRmat  *A,
+                                     const SREAL    *val_sp,
+                                     const REAL     *x,
+                                     REAL           *y)
+{
+    if ( val_sp != NULL ) fasp_blas_dbsr_mxv_sp(A, val_sp, x, y);
+    else                  fasp_blas_dbsr_mxv(A, x, y);
+}
+
+/**
+ * \fn static inline void fasp_mg_dbsr_aAxpy (const REAL alpha, const dBSRmat *A,
+ *                                            const SREAL *val_sp, const REAL *x,
+ *                                            REAL *y)
+ *
+ * \brief Apply a transfer operator y = alpha*A*x + y of multigrid methods (BSR format)
+ *
+ * \param  alpha     REAL factor alpha
+ * \param  A         pointer to matrix data
+ * \param  val_sp    single precision values of A (or NULL)
+ * \param  x         pointer to array x
+ * \param  y         pointer to array y
+ *
+ * \author FASP team
+ * \date   10/16/2026
+ */
+static inline void fasp_mg_dbsr_aAxpy (const REAL      alpha,
+                                       const dBSRmat  *A,
+                                       const SREAL    *val_sp,
+                                       const REAL     *x,
+                                       REAL           *y)
+{
+    if ( val_sp != NULL ) fasp_blas_dbsr_aAxpy_sp(alpha, A, val_sp, x, y);
+    else                  fasp_blas_dbsr_aAxpy(alpha, A, x, y);
+}
+
 /*---------------------------------*/
 /*--        End of File          --*/
 /*---------------------------------*/
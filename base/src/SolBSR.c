@@ -5,8 +5,8 @@
  *  \note  This file contains Level-5 (Sol) functions. It requires:
  *         AuxMemory.c, AuxMessage.c, AuxThreads.c, AuxTiming.c, AuxVector.c,
  *         BlaSmallMatInv.c, BlaILUSetupBSR.c, BlaSparseBSR.c, BlaSparseCheck.c,
- *         KryPbcgs.c, KryPcg.c, KryPgmres.c, KryPvfgmres.c, KryPvgmres.c, 
- *         PreAMGSetupSA.c, PreAMGSetupUA.c, PreBSR.c, and PreDataInit.c
+ *         KryPbcgs.c, KryPbcgsl.c, KryPcg.c, KryPgmres.c, KryPvfgmres.c,
+ *         KryPvgmres.c, PreAMGSetupSA.c, PreAMGSetupUA.c, PreBSR.c, and PreDataInit.c
  *
  *---------------------------------------------------------------------------------
  *  Copyright (C) 2009--2020 by the FASP team. All rights reserved.
@@ -51,6 +51,7 @@
  * \date   10/26/2010
  *
  * Modified by Chunsheng Feng on 03/04/2016: add VBiCGstab solver
+ * Modified by FASP team on 10/16/2026: BiCGstab(l)
  */
 INT fasp_solver_dbsr_itsolver (dBSRmat    *A,
                                dvector    *b,
@@ -89,6 +90,10 @@ INT fasp_solver_dbsr_itsolver (dBSRmat    *A,
             iter = fasp_solver_dbsr_pbcgs(A, b, x, pc, tol, MaxIt, stop_type, prtlvl);
             break;
             
+        case SOLVER_BiCGstabL:
+            iter = fasp_solver_dbsr_pbcgsl(A, b, x, pc, tol, MaxIt, itparam->ell, stop_type, prtlvl);
+            break;
+            
         case SOLVER_GMRES:
             iter = fasp_solver_dbsr_pgmres(A, b, x, pc, tol, MaxIt, restart, stop_type, prtlvl);
             break;
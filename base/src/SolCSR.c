@@ -5,9 +5,11 @@
  *  \note  This file contains Level-5 (Sol) functions. It requires:
  *         AuxMemory.c, AuxMessage.c, AuxParam.c, AuxTiming.c, AuxVector.c,
  *         BlaILUSetupCSR.c, BlaSchwarzSetup.c, BlaSparseCheck.c, BlaSparseCSR.c,
- *         KryPbcgs.c, KryPcg.c, KryPgcg.c, KryPgcr.c, KryPgmres.c, KryPminres.c,
+ *         BlaSpmvCSR.c, BlaVector.c, KryPbcg.c, KryPbcgs.c, KryPbcgsl.c,
+ *         KryPbgmres.c, KryPcagmres.c, KryPcg.c, KryPcheby.c, KryPgcg.c,
+ *         KryPgcr.c, KryPgcrodr.c, KryPgmres.c, KryPminres.c, KryPpipecg.c,
  *         KryPvfgmres.c, KryPvgmres.c, PreAMGSetupRS.c, PreAMGSetupSA.c,
- *         PreAMGSetupUA.c, PreCSR.c, and PreDataInit.c
+ *         PreAMGSetupUA.c, PreCSR.c, PreDataInit.c, and SolMatFree.c
  *
  *---------------------------------------------------------------------------------
  *  Copyright (C) 2009--2020 by the FASP team. All rights reserved.
@@ -30,6 +32,30 @@
 
 #include "KryUtil.inl"
 
+/**
+ * \struct mxv_csr_sp
+ * \brief  CSR matrix with single precision values for matrix-free Krylov methods
+ */
+typedef struct {
+    dCSRmat *A;   /**< sparsity pattern of the matrix */
+    SREAL   *val; /**< single precision values of the matrix */
+} mxv_csr_sp;
+
+/**
+ * \struct ir_inner_data
+ * \brief  Inner solver of iterative refinement used as a preconditioner
+ */
+typedef struct {
+    mxv_matfree *mf;      /**< single precision matrix of the inner solves */
+    precond     *pc;      /**< AMG preconditioner of the inner solves */
+    ITS_param   *itparam; /**< parameters of the inner solves */
+    INT          n;       /**< size of the vectors */
+    INT          iter;    /**< total number of inner iterations */
+} ir_inner_data;
+
+static void dcsr_mxv_sp (const void *, const REAL *, REAL *);
+static void ir_inner_solve (REAL *, REAL *, void *);
+
 /*---------------------------------*/
 /*--      Public Functions       --*/
 /*---------------------------------*/
@@ -52,6 +78,9 @@
  *
  * \author Chensong Zhang
  * \date   09/25/2009
+ *
+ * Modified by FASP team on 10/16/2026: BiCGstab(l)
+ * Modified by FASP team on 10/16/2026: Chebyshev iteration
  */
 INT fasp_solver_dcsr_itsolver (dCSRmat    *A,
                                dvector    *b,
@@ -116,6 +145,26 @@ INT fasp_solver_dcsr_itsolver (dCSRmat    *A,
         case SOLVER_GCR:
             iter = fasp_solver_dcsr_pgcr(A, b, x, pc, tol, MaxIt, restart, stop_type, prtlvl);
             break;
+
+        case SOLVER_PipeCG:
+            iter = fasp_solver_dcsr_ppipecg(A, b, x, pc, tol, MaxIt, stop_type, prtlvl);
+            break;
+
+        case SOLVER_CAGMRES:
+            iter = fasp_solver_dcsr_pcagmres(A, b, x, pc, tol, MaxIt, restart, stop_type, prtlvl);
+            break;
+
+        case SOLVER_GCRODR:
+            iter = fasp_solver_dcsr_pgcrodr(A, b, x, pc, tol, MaxIt, restart, NULL, stop_type, prtlvl);
+            break;
+
+        case SOLVER_BiCGstabL:
+            iter = fasp_solver_dcsr_pbcgsl(A, b, x, pc, tol, MaxIt, itparam->ell, stop_type, prtlvl);
+            break;
+
+        case SOLVER_CHEBY:
+            iter = fasp_solver_dcsr_pcheby(A, b, x, pc, tol, MaxIt, stop_type, prtlvl);
+            break;
             
         default:
             printf("### ERROR: Unknown iterative solver type %d! [%s]\n",
@@ -383,6 +432,72 @@ INT fasp_solver_dcsr_krylov_diag (dCSRmat    *A,
     return status;
 }
 
+/**
+ * \fn INT fasp_solver_dcsr_krylov_cheby (dCSRmat *A, dvector *b, dvector *x,
+ *                                        ITS_param *itparam)
+ *
+ * \brief Solve Ax=b by Chebyshev polynomial preconditioned Krylov methods
+ *
+ * \param A        Pointer to the coeff matrix in dCSRmat format
+ * \param b        Pointer to the right hand side in dvector format
+ * \param x        Pointer to the approx solution in dvector format
+ * \param itparam  Pointer to parameters for iterative solvers
+ *
+ * \return         Iteration number if converges; ERROR otherwise.
+ *
+ * \author FASP team
+ * \date   10/16/2026
+ *
+ * \note The polynomial in inv(D)*A has degree CHEBY_DEGREE.
+ */
+INT fasp_solver_dcsr_krylov_cheby (dCSRmat    *A,
+                                   dvector    *b,
+                                   dvector    *x,
+                                   ITS_param  *itparam)
+{
+    const SHORT prtlvl = itparam->print_level;
+    
+    /* Local Variables */
+    INT       status = FASP_SUCCESS;
+    REAL      solve_start, solve_end;
+    
+#if DEBUG_MODE > 0
+    printf("### DEBUG: [-Begin-] %s ...\n", __FUNCTION__);
+    printf("### DEBUG: matrix size: %d %d %d\n", A->row, A->col, A->nnz);
+    printf("### DEBUG: rhs/sol size: %d %d\n", b->row, x->row);
+#endif
+    
+    fasp_gettime(&solve_start);
+    
+    // setup preconditioner
+    precond_cheby cheby;
+    fasp_cheby_data_create(A, CHEBY_DEGREE, &cheby);
+    
+    if ( prtlvl >= PRINT_MORE )
+        printf("Chebyshev preconditioner of degree " INTFMT " on [%e, %e]\n",
+               cheby.degree, cheby.emin, cheby.emax);
+    
+    precond pc;
+    pc.data = &cheby;
+    pc.fct  = fasp_precond_cheby;
+    
+    // call iterative solver
+    status = fasp_solver_dcsr_itsolver(A,b,x,&pc,itparam);
+    
+    if ( prtlvl >= PRINT_MIN ) {
+        fasp_gettime(&solve_end);
+        fasp_cputime("Cheby_Krylov method totally", solve_end - solve_start);
+    }
+    
+    fasp_cheby_data_free(&cheby);
+    
+#if DEBUG_MODE > 0
+    printf("### DEBUG: [--End--] %s ...\n", __FUNCTION__);
+#endif
+    
+    return status;
+}
+
 /**
  * \fn INT fasp_solver_dcsr_krylov_swz (dCSRmat *A, dvector *b, dvector *x,
  *                                      ITS_param *itparam, SWZ_param *schparam)
@@ -573,6 +688,276 @@ FINISHED:
     return status;
 }
 
+/**
+ * \fn INT fasp_solver_dcsr_krylov_amg_ir (dCSRmat *A, dvector *b, dvector *x,
+ *                                         ITS_param *itparam, AMG_param *amgparam)
+ *
+ * \brief Solve Ax=b by iterative refinement with AMG preconditioned Krylov methods
+ *        on single precision matrices as inner solvers
+ *
+ * \param A         Pointer to the coeff matrix in dCSRmat format
+ * \param b         Pointer to the right hand side in dvector format
+ * \param x         Pointer to the approx solution in dvector format
+ * \param itparam   Pointer to parameters for iterative solvers
+ * \param amgparam  Pointer to parameters for AMG methods
+ *
+ * \return          Total number of inner iterations if converges; ERROR otherwise.
+ *
+ * \author FASP team
+ * \date   10/16/2026
+ *
+ * \note The outer loop is flexible GMRES in double precision, and each of its
+ *       preconditioning steps solves A*z = r to the relative tolerance
+ *       IR_INNER_TOL by the Krylov method of itparam, preconditioned by AMG. The
+ *       inner solves read the matrices in single precision: A for the SpMV and
+ *       the fine level smoother, the coarse level matrices, P, and R (see
+ *       fasp_amg_data_mixed_precision). Only the coarsest level and the levels
+ *       or smoothers which need double precision matrices are kept in double.
+ *       The vectors and all arithmetic stay in double precision, so this is not
+ *       a single precision solver: it halves the matrix data moved by the inner
+ *       solves. The solve stops when ||b-A*x||/||b|| < itparam->tol or after
+ *       IR_MAXIT outer steps; each inner solve takes at most itparam->maxit
+ *       iterations.
+ *
+ * \note A plain refinement loop x = x + d is only guaranteed to reduce the
+ *       residual when the perturbation of A by the rounding, about cond(A)*1e-7,
+ *       is well below one. FGMRES contains the plain refinement step in its
+ *       search space and does not need this, at the cost of two vectors per
+ *       outer step. Neither goes below the accuracy of a double precision solve.
+ *
+ * \note The AMG setup uses a copy of amgparam with mixed_precision on, and
+ *       amgparam itself is not changed.
+ */
+INT fasp_solver_dcsr_krylov_amg_ir (dCSRmat    *A,
+                                    dvector    *b,
+                                    dvector    *x,
+                                    ITS_param  *itparam,
+                                    AMG_param  *amgparam)
+{
+    const SHORT prtlvl = itparam->print_level;
+    const SHORT max_levels = amgparam->max_levels;
+    const INT nnz = A->nnz, m = A->row, n = A->col;
+    
+    /* Local Variables */
+    INT      status = FASP_SUCCESS, k;
+    REAL     solve_start, solve_end;
+    ITS_param  inparam = *itparam;
+    AMG_param  mgparam = *amgparam;
+    mxv_csr_sp Adata;
+    mxv_matfree mf;
+    ir_inner_data inner;
+    precond  pcir;
+    SREAL   *Aval = NULL;
+    
+#if DEBUG_MODE > 0
+    printf("### DEBUG: [-Begin-] %s ...\n", __FUNCTION__);
+    printf("### DEBUG: matrix size: %d %d %d\n", A->row, A->col, A->nnz);
+    printf("### DEBUG: rhs/sol size: %d %d\n", b->row, x->row);
+#endif
+    
+    fasp_gettime(&solve_start);
+    
+    // initialize A, b, x for mgl[0]
+    AMG_data *mgl=fasp_amg_data_create(max_levels);
+    mgl[0].A=fasp_dcsr_create(m,n,nnz); fasp_dcsr_cp(A,&mgl[0].A);
+    mgl[0].b=fasp_dvec_create(n); mgl[0].x=fasp_dvec_create(n);
+    
+    // setup preconditioner with single precision P, R, and coarse level A
+    mgparam.mixed_precision = ON;
+    switch (mgparam.AMG_type) {
+            
+        case SA_AMG: // Smoothed Aggregation AMG
+            status = fasp_amg_setup_sa(mgl, &mgparam); break;
+            
+        case UA_AMG: // Unsmoothed Aggregation AMG
+            status = fasp_amg_setup_ua(mgl, &mgparam); break;
+            
+        default: // Classical AMG
+            status = fasp_amg_setup_rs(mgl, &mgparam);
+            
+    }
+    
+    if (status < 0) goto FINISHED;
+    
+    // the inner SpMV shares the single precision fine level matrix of AMG if the
+    // smoother can use it; otherwise a single precision copy of A is made
+    if ( fasp_amg_data_sp_level(mgl, &mgparam, 0) ) {
+        Adata.A   = &mgl[0].A;
+        Adata.val = mgl[0].Aval_sp;
+    }
+    else {
+        Aval = (SREAL *)fasp_mem_calloc(MAX(nnz,1), sizeof(SREAL));
+        for ( k = 0; k < nnz; ++k ) Aval[k] = (SREAL)A->val[k];
+        Adata.A   = A;
+        Adata.val = Aval;
+    }
+    mf.data = &Adata;
+    mf.fct  = dcsr_mxv_sp;
+    
+    precond_data pcdata;
+    fasp_param_amg_to_prec(&pcdata,&mgparam);
+    pcdata.max_levels = mgl[0].num_levels;
+    pcdata.mgl_data = mgl;
+    
+    precond pc; pc.data = &pcdata;
+    
+    if (itparam->precond_type == PREC_FMG) {
+        pc.fct = fasp_precond_famg; // Full AMG
+    }
+    else {
+        switch (mgparam.cycle_type) {
+            case AMLI_CYCLE: // AMLI cycle
+                pc.fct = fasp_precond_amli; break;
+            case NL_AMLI_CYCLE: // Nonlinear AMLI
+                pc.fct = fasp_precond_namli; break;
+            default: // V,W-cycles or hybrid cycles
+                pc.fct = fasp_precond_amg;
+        }
+    }
+    
+    // inner solves: relative residual to IR_INNER_TOL
+    inparam.tol         = MAX(IR_INNER_TOL, itparam->tol);
+    inparam.maxit       = itparam->maxit;
+    inparam.stop_type   = STOP_REL_RES;
+    inparam.print_level = PRINT_NONE;
+    
+    inner.mf      = &mf;
+    inner.pc      = &pc;
+    inner.itparam = &inparam;
+    inner.n       = n;
+    inner.iter    = 0;
+    
+    pcir.data = &inner;
+    pcir.fct  = ir_inner_solve;
+    
+    // outer FGMRES in double precision with the inner solves as preconditioner
+    status = fasp_solver_dcsr_pvfgmres(A, b, x, &pcir, itparam->tol, IR_MAXIT,
+                                       MIN(itparam->restart, IR_MAXIT),
+                                       STOP_REL_RES, prtlvl);
+    
+    if ( prtlvl > PRINT_SOME )
+        printf("Number of outer steps = %" INTMOD "d, inner iterations = %" INTMOD "d\n",
+               status, inner.iter);
+    
+    if ( status >= 0 ) status = inner.iter;
+    
+    if ( prtlvl >= PRINT_MIN ) {
+        fasp_gettime(&solve_end);
+        fasp_cputime("AMG_Krylov iterative refinement totally",
+                     solve_end - solve_start);
+    }
+    
+FINISHED:
+    fasp_amg_data_free(mgl, &mgparam);
+    fasp_mem_free(Aval); Aval = NULL;
+    
+#if DEBUG_MODE > 0
+    printf("### DEBUG: [--End--] %s ...\n", __FUNCTION__);
+#endif
+    
+    return status;
+}
+
+/**
+ * \fn INT fasp_solver_dcsr_krylov_amg_mrhs (dCSRmat *A, dvector *b, dvector *x,
+ *                                           const INT nrhs, ITS_param *itparam,
+ *                                           AMG_param *amgparam)
+ *
+ * \brief Solve AX=B with several right hand sides by AMG preconditioned block
+ *        Krylov methods
+ *
+ * \param A         Pointer to the coeff matrix in dCSRmat format
+ * \param b         Pointer to the right hand sides (A->row*nrhs, interleaved)
+ * \param x         Pointer to the approx solutions (A->row*nrhs, interleaved)
+ * \param nrhs      Number of right hand sides
+ * \param itparam   Pointer to parameters for iterative solvers
+ * \param amgparam  Pointer to parameters for AMG methods
+ *
+ * \return          Iteration number if converges; ERROR otherwise.
+ *
+ * \author FASP team
+ * \date   10/16/2026
+ *
+ * \note Entry i of vector j is b[i*nrhs+j]. Block CG is used if itsolver_type is
+ *       SOLVER_CG and block GMRES otherwise. The AMG hierarchy is set up once and
+ *       the V-cycle is applied to all vectors together.
+ */
+INT fasp_solver_dcsr_krylov_amg_mrhs (dCSRmat    *A,
+                                      dvector    *b,
+                                      dvector    *x,
+                                      const INT   nrhs,
+                                      ITS_param  *itparam,
+                                      AMG_param  *amgparam)
+{
+    const SHORT prtlvl = itparam->print_level;
+    const SHORT max_levels = amgparam->max_levels;
+    const INT nnz = A->nnz, m = A->row, n = A->col;
+    
+    /* Local Variables */
+    INT      status = FASP_SUCCESS;
+    REAL     solve_start, solve_end;
+
+#if DEBUG_MODE > 0
+    printf("### DEBUG: [-Begin-] %s ...\n", __FUNCTION__);
+    printf("### DEBUG: matrix size: %d %d %d\n", A->row, A->col, A->nnz);
+    printf("### DEBUG: rhs/sol size: %d %d, nrhs: %d\n", b->row, x->row, nrhs);
+#endif
+    
+    fasp_gettime(&solve_start);
+    
+    // initialize A, b, x for mgl[0]
+    AMG_data *mgl=fasp_amg_data_create(max_levels);
+    mgl[0].A=fasp_dcsr_create(m,n,nnz); fasp_dcsr_cp(A,&mgl[0].A);
+    mgl[0].b=fasp_dvec_create(n); mgl[0].x=fasp_dvec_create(n);
+    
+    // setup preconditioner
+    switch (amgparam->AMG_type) {
+            
+        case SA_AMG: // Smoothed Aggregation AMG
+            status = fasp_amg_setup_sa(mgl, amgparam); break;
+            
+        case UA_AMG: // Unsmoothed Aggregation AMG
+            status = fasp_amg_setup_ua(mgl, amgparam); break;
+            
+        default: // Classical AMG
+            status = fasp_amg_setup_rs(mgl, amgparam);
+            
+    }
+    
+    if (status < 0) goto FINISHED;
+    
+    // setup preconditioner
+    precond_data pcdata;
+    fasp_param_amg_to_prec(&pcdata,amgparam);
+    pcdata.max_levels = mgl[0].num_levels;
+    pcdata.mgl_data = mgl;
+    
+    precond_mv pc; pc.data = &pcdata; pc.fct = fasp_precond_amg_mv;
+    
+    // call block iterative solver
+    if ( itparam->itsolver_type == SOLVER_CG )
+        status = fasp_solver_dcsr_pbcg(A, b, x, nrhs, &pc, itparam->tol,
+                                       itparam->maxit, itparam->stop_type, prtlvl);
+    else
+        status = fasp_solver_dcsr_pbgmres(A, b, x, nrhs, &pc, itparam->tol,
+                                          itparam->maxit, itparam->restart,
+                                          itparam->stop_type, prtlvl);
+    
+    if ( prtlvl >= PRINT_MIN ) {
+        fasp_gettime(&solve_end);
+        fasp_cputime("AMG_Block_Krylov method totally", solve_end - solve_start);
+    }
+    
+FINISHED:
+    fasp_amg_data_free(mgl, amgparam);
+    
+#if DEBUG_MODE > 0
+    printf("### DEBUG: [--End--] %s ...\n", __FUNCTION__);
+#endif
+    
+    return status;
+}
+
 /**
  * \fn INT fasp_solver_dcsr_krylov_ilu (dCSRmat *A, dvector *b, dvector *x,
  *                                      ITS_param *itparam, ILU_param *iluparam)
@@ -860,6 +1245,61 @@ FINISHED:
     return status;
 }
 
+/*---------------------------------*/
+/*--      Private Functions      --*/
+/*---------------------------------*/
+
+/**
+ * \fn static void dcsr_mxv_sp (const void *data, const REAL *x, REAL *y)
+ *
+ * \brief Matrix-vector multiplication y = A*x with single precision values of A
+ *
+ * \param data   Pointer to mxv_csr_sp
+ * \param x      Pointer to the input vector
+ * \param y      Pointer to the output vector
+ *
+ * \author FASP team
+ * \date   10/16/2026
+ */
+static void dcsr_mxv_sp (const void  *data,
+                         const REAL  *x,
+                         REAL        *y)
+{
+    const mxv_csr_sp *Adata = (const mxv_csr_sp *)data;
+    fasp_blas_dcsr_mxv_sp(Adata->A, Adata->val, x, y);
+}
+
+/**
+ * \fn static void ir_inner_solve (REAL *r, REAL *z, void *data)
+ *
+ * \brief Solve A*z = r approximately by the inner solver of iterative refinement
+ *
+ * \param r      Pointer to the residual
+ * \param z      Pointer to the correction
+ * \param data   Pointer to ir_inner_data
+ *
+ * \author FASP team
+ * \date   10/16/2026
+ *
+ * \note The residuals passed by FGMRES have unit norm, so the absolute stopping
+ *       tests of the Krylov methods do not end the inner solves early.
+ */
+static void ir_inner_solve (REAL  *r,
+                            REAL  *z,
+                            void  *data)
+{
+    ir_inner_data *inner = (ir_inner_data *)data;
+    dvector rr, zz;
+    INT     iter;
+    
+    rr.row = zz.row = inner->n;
+    rr.val = r; zz.val = z;
+    
+    fasp_darray_set(inner->n, z, 0.0);
+    iter = fasp_solver_itsolver(inner->mf, &rr, &zz, inner->pc, inner->itparam);
+    inner->iter += ( iter < 0 ) ? inner->itparam->maxit : iter;
+}
+
 /*---------------------------------*/
 /*--        End of File          --*/
 /*---------------------------------*/
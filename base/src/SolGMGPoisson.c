@@ -67,7 +67,7 @@ INT fasp_poisson_gmg1d (REAL         *u,
     
     if ( prtlvl > PRINT_NONE ) {
         fasp_gettime(&AMG_start);
-        printf("Num of DOF's: %d\n", nx+1);
+        printf("Num of DOF's: " INTFMT "\n", nx+1);
     }
     
     // set level
@@ -113,7 +113,7 @@ INT fasp_poisson_gmg1d (REAL         *u,
         error = norm_r / norm_r0;
         norm_r1 = norm_r;
         if ( prtlvl > PRINT_SOME ){
-            printf("%6d | %13.6e   | %13.6e  | %10.4f\n",count,error,norm_r,factor);
+            printf("%6" INTMOD "d | %13.6e   | %13.6e  | %10.4f\n",count,error,norm_r,factor);
         }
         if (error < rtol || norm_r < atol) break;
     }
@@ -123,7 +123,7 @@ INT fasp_poisson_gmg1d (REAL         *u,
             printf("### WARNING: V-cycle failed to converge.\n");
         }
         else {
-            printf("Num of V-cycle's: %d, Relative Residual = %e.\n", count, error);
+            printf("Num of V-cycle's: " INTFMT ", Relative Residual = %e.\n", count, error);
         }
     }
     
@@ -192,7 +192,7 @@ INT fasp_poisson_gmg2d (REAL         *u,
     
     if ( prtlvl > PRINT_NONE ) {
         fasp_gettime(&AMG_start);
-        printf("Num of DOF's: %d\n", (nx+1)*(ny+1));
+        printf("Num of DOF's: " INTFMT "\n", (nx+1)*(ny+1));
     }
     
     // set nxk, nyk
@@ -246,7 +246,7 @@ INT fasp_poisson_gmg2d (REAL         *u,
         factor = norm_r/norm_r1;
         norm_r1 = norm_r;
         if ( prtlvl > PRINT_SOME ){
-            printf("%6d | %13.6e   | %13.6e  | %10.4f\n",count,error,norm_r,factor);
+            printf("%6" INTMOD "d | %13.6e   | %13.6e  | %10.4f\n",count,error,norm_r,factor);
         }
         if ( error < rtol || norm_r < atol ) break;
     }
@@ -256,7 +256,7 @@ INT fasp_poisson_gmg2d (REAL         *u,
             printf("### WARNING: V-cycle failed to converge.\n");
         }
         else {
-            printf("Num of V-cycle's: %d, Relative Residual = %e.\n", count, error);
+            printf("Num of V-cycle's: " INTFMT ", Relative Residual = %e.\n", count, error);
         }
     }
     
@@ -330,7 +330,7 @@ INT fasp_poisson_gmg3d (REAL         *u,
     
     if ( prtlvl > PRINT_NONE ) {
         fasp_gettime(&AMG_start);
-        printf("Num of DOF's: %d\n", (nx+1)*(ny+1)*(nz+1));
+        printf("Num of DOF's: " INTFMT "\n", (nx+1)*(ny+1)*(nz+1));
     }
     
     // set nxk, nyk, nzk
@@ -384,7 +384,7 @@ INT fasp_poisson_gmg3d (REAL         *u,
         error = norm_r / norm_r0;
         norm_r1 = norm_r;
         if ( prtlvl > PRINT_SOME ){
-            printf("%6d | %13.6e   | %13.6e  | %10.4f\n",count,error,norm_r,factor);
+            printf("%6" INTMOD "d | %13.6e   | %13.6e  | %10.4f\n",count,error,norm_r,factor);
         }
         if (error < rtol || norm_r < atol) break;
     }
@@ -394,7 +394,7 @@ INT fasp_poisson_gmg3d (REAL         *u,
             printf("### WARNING: V-cycle failed to converge.\n");
         }
         else {
-            printf("Num of V-cycle's: %d, Relative Residual = %e.\n", count, error);
+            printf("Num of V-cycle's: " INTFMT ", Relative Residual = %e.\n", count, error);
         }
     }
     
@@ -460,7 +460,7 @@ void fasp_poisson_fgmg1d (REAL         *u,
     
     if ( prtlvl > PRINT_NONE ) {
         fasp_gettime(&AMG_start);
-        printf("Num of DOF's: %d\n", (nx+1));
+        printf("Num of DOF's: " INTFMT "\n", (nx+1));
     }
     
     // set level
@@ -555,7 +555,7 @@ void fasp_poisson_fgmg2d (REAL         *u,
     
     if ( prtlvl > PRINT_NONE ) {
         fasp_gettime(&AMG_start);
-        printf("Num of DOF's: %d\n", (nx+1)*(ny+1));
+        printf("Num of DOF's: " INTFMT "\n", (nx+1)*(ny+1));
     }
     
     // set nxk, nyk
@@ -665,7 +665,7 @@ void fasp_poisson_fgmg3d (REAL         *u,
     
     if ( prtlvl > PRINT_NONE ) {
         fasp_gettime(&AMG_start);
-        printf("Num of DOF's: %d\n", (nx+1)*(ny+1)*(nz+1));
+        printf("Num of DOF's: " INTFMT "\n", (nx+1)*(ny+1)*(nz+1));
     }
     // set nxk, nyk, nzk
     nxk = (INT *)malloc(maxlevel*sizeof(INT));
@@ -774,7 +774,7 @@ INT fasp_poisson_gmgcg1d (REAL         *u,
     
     if ( prtlvl > PRINT_NONE ) {
         fasp_gettime(&AMG_start);
-        printf("Num of DOF's: %d\n", (nx+1));
+        printf("Num of DOF's: " INTFMT "\n", (nx+1));
     }
     // set level
     level = (INT *)malloc((maxlevel+2)*sizeof(INT));
@@ -870,7 +870,7 @@ INT fasp_poisson_gmgcg2d (REAL         *u,
     
     if ( prtlvl > PRINT_NONE ) {
         fasp_gettime(&AMG_start);
-        printf("Num of DOF's: %d\n", (nx+1)*(ny+1));
+        printf("Num of DOF's: " INTFMT "\n", (nx+1)*(ny+1));
     }
     // set nxk, nyk
     nxk = (INT *)malloc(maxlevel*sizeof(INT));
@@ -982,7 +982,7 @@ INT fasp_poisson_gmgcg3d (REAL         *u,
     
     if ( prtlvl > PRINT_NONE ) {
         fasp_gettime(&AMG_start);
-        printf("Num of DOF's: %d\n", (nx+1)*(ny+1)*(nz+1));
+        printf("Num of DOF's: " INTFMT "\n", (nx+1)*(ny+1)*(nz+1));
     }
     
     // set nxk, nyk, nzk
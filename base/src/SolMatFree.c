@@ -4,8 +4,9 @@
  *
  *  \note  This file contains Level-5 (Sol) functions. It requires:
  *         AuxMessage.c, AuxTiming.c, BlaSpmvBLC.c, BlaSpmvBSR.c, BlaSpmvCSR.c,
- *         BlaSpmvCSRL.c, BlaSpmvSTR.c, KryPbcgs.c, KryPcg.c, KryPgcg.c,
- *         KryPgmres.c, KryPminres.c, KryPvfgmres.c, and KryPvgmres.c
+ *         BlaSpmvCSRL.c, BlaSpmvSELL.c, BlaSpmvSTR.c, KryPbcgs.c, KryPbcgsl.c,
+ *         KryPcg.c, KryPgcg.c, KryPgmres.c, KryPminres.c, KryPvfgmres.c, and
+ *         KryPvgmres.c
  *
  *---------------------------------------------------------------------------------
  *  Copyright (C) 2009--2020 by the FASP team. All rights reserved.
@@ -54,6 +55,7 @@
  * \date   09/25/2009
  *
  * Modified by Feiteng Huang on 09/19/2012: matrix free
+ * Modified by FASP team on 10/16/2026: BiCGstab(l)
  */
 INT fasp_solver_itsolver (mxv_matfree  *mf,
                           dvector      *b,
@@ -93,6 +95,10 @@ INT fasp_solver_itsolver (mxv_matfree  *mf,
             iter = fasp_solver_pbcgs(mf, b, x, pc, tol, MaxIt, stop_type, prtlvl);
             break;
             
+        case SOLVER_BiCGstabL:
+            iter = fasp_solver_pbcgsl(mf, b, x, pc, tol, MaxIt, itparam->ell, stop_type, prtlvl);
+            break;
+            
         case SOLVER_MinRes:
             iter = fasp_solver_pminres(mf, b, x, pc, tol, MaxIt, stop_type, prtlvl);
             break;
@@ -197,6 +203,9 @@ INT fasp_solver_krylov (mxv_matfree  *mf,
  * \date   09/18/2012
  *
  * Modified by Chensong Zhang on 05/10/2013: Change interface of mat-free mv
+ * Modified by FASP team on 10/16/2026: Add SELL format
+ * Modified by FASP team on 10/16/2026: Add SymCSR format
+ * Modified by FASP team on 10/16/2026: Add CSR16 format
  */
 void fasp_solver_matfree_init (INT           matrix_format,
                                mxv_matfree  *mf,
@@ -224,8 +233,20 @@ void fasp_solver_matfree_init (INT           matrix_format,
             mf->fct = fasp_blas_mxv_csrl;
             break;
             
+        case MAT_SELL:
+            mf->fct = fasp_blas_mxv_sell;
+            break;
+            
+        case MAT_SymCSR:
+            mf->fct = fasp_blas_mxv_symcsr;
+            break;
+            
+        case MAT_CSR16:
+            mf->fct = fasp_blas_mxv_csr16;
+            break;
+            
         default:
-            printf("### ERROR: Unknown matrix format %d!\n", matrix_format);
+            printf("### ERROR: Unknown matrix format " INTFMT "!\n", matrix_format);
             exit(ERROR_DATA_STRUCTURE);
             
     }
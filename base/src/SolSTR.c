@@ -276,7 +276,7 @@ INT fasp_solver_dstr_krylov_ilu (dSTRmat    *A,
     setup_time = setup_end - setup_start;
     
     if ( prtlvl > PRINT_NONE )
-        printf("Structrued ILU(%d) setup costs %f seconds.\n", ILU_lfil, setup_time);
+        printf("Structrued ILU(" INTFMT ") setup costs %f seconds.\n", ILU_lfil, setup_time);
     
     precond pc; pc.data=&LU;
     if (ILU_lfil == 0) {
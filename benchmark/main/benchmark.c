@@ -90,9 +90,9 @@ int main (int argc, const char * argv[])
         return -1;
     }
     
-    printf("Start ID of test problem = %d\n", startID);
-    printf("Ending ID of test problem = %d\n", endID);
-    printf("Test problem size larger than %d\n", MinProbSize);
+    printf("Start ID of test problem = " INTFMT "\n", startID);
+    printf("Ending ID of test problem = " INTFMT "\n", endID);
+    printf("Test problem size larger than " INTFMT "\n", MinProbSize);
 
     //-----------------------------//
     //     Read input.dat file     //
@@ -106,7 +106,7 @@ int main (int argc, const char * argv[])
     //--------------------------------------------//
     lMVU = ComputeLMVUFromBaseline(blp_dir, bl);
 
-    sprintf(logname, "./BenchmarkResults-%d-%d.log", startID, endID);
+    sprintf(logname, "./BenchmarkResults-" INTFMT "-" INTFMT ".log", startID, endID);
     FILE *fp = fopen(logname, "w"); // save results
     fprintf(fp, "Tests performed at %s", asctime(localtime(&lt)));
     fprintf(fp, "lMVU of this computer is %.4e\n", lMVU);
@@ -135,7 +135,7 @@ int main (int argc, const char * argv[])
 
         if (indp < startID || indp > endID) continue;
         printf("\n=====================================================\n");
-        printf("Test Problem ID:      %d\n", indp);
+        printf("Test Problem ID:      " INTFMT "\n", indp);
         printf("Name of Problem:      %s\n", pb->prob[indp-1]);
 
         // Check if the file exists
@@ -164,7 +164,7 @@ int main (int argc, const char * argv[])
 
         // Filter small matrix
         if (A.row < MinProbSize) {
-            printf("### WARNING: Skip matrices of size less than %d!\n", MinProbSize);
+            printf("### WARNING: Skip matrices of size less than " INTFMT "!\n", MinProbSize);
             continue;
         }
 
@@ -181,11 +181,11 @@ int main (int argc, const char * argv[])
             fasp_blas_dcsr_mxv(&A, sol.val, b.val);
         }
 
-        printf("Problem Size:         %d\n", A.row);
+        printf("Problem Size:         " INTFMT "\n", A.row);
         printf("=====================================================\n");
 
         fprintf(fp, "======================================================================\n");
-        fprintf(fp, "Test Problem %3d: %12s, matrix size is %6d\n", indp, pb->prob[indp-1], A.row);
+        fprintf(fp, "Test Problem %3" INTMOD "d: %12s, matrix size is %6" INTMOD "d\n", indp, pb->prob[indp-1], A.row);
         fprintf(fp, "======================================================================\n");
 
         /*****************************/
@@ -303,7 +303,7 @@ int main (int argc, const char * argv[])
             Score = (Timer1 - Timer0) / b.row / lMVU;
             // printf("Total cost is \033[31;43m%.4e\033[0m (lMVU).\n", Score);
             printf("Total cost is %.4e (lMVU).\n", Score);
-            fprintf(fp, "%20s scores ............... %.4e (lMVU), iteration is %5d, status is %5d.\n", ag->para[i], \
+            fprintf(fp, "%20s scores ............... %.4e (lMVU), iteration is %5" INTMOD "d, status is %5d.\n", ag->para[i], \
                     Score, status > 0 ? status: inipar.itsolver_maxit, status);
         }
 
@@ -392,7 +392,7 @@ static double ComputeLMVUFromBaseline(char *workdir, Baseline bl)
         itspar.maxit         = 1000;
         itspar.tol           = 1e-20;
 
-        printf("Matrix size is %d\n", b.row);
+        printf("Matrix size is " INTFMT "\n", b.row);
         for (callnum = 0; callnum < bl->callnums[i]; callnum++)
         {
             printf("Number of calls: %d\n", callnum + 1);
@@ -407,7 +407,7 @@ static double ComputeLMVUFromBaseline(char *workdir, Baseline bl)
             }
             else {
                 lMVU = (Timer1 - Timer0) / b.row / itspar.maxit;
-                printf("\tIt costs %d iterations or %.4e seconds.\n", itspar.maxit, Timer1-Timer0);
+                printf("\tIt costs " INTFMT " iterations or %.4e seconds.\n", itspar.maxit, Timer1-Timer0);
             }
             printf("\tLocal stencil spMV Unit (lMVU) of this computer is %.4e.\n", lMVU);
             TotlMVU += lMVU;
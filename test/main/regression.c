@@ -35,6 +35,64 @@ static void check_solu(dvector *x, dvector *sol, double tol)
     }   
 }
 
+/**
+ * \fn static void check_solu_mrhs(dvector *x, dvector *sol, INT nrhs, INT j,
+ *                                 double tol)
+ *
+ * \brief This function compares column j of interleaved x and sol to a given
+ *        tolerance tol.
+ *
+ * \author FASP team
+ * \date   10/16/2026
+ */
+static void check_solu_mrhs(dvector *x, dvector *sol, INT nrhs, INT j, double tol)
+{
+    dvector xj = fasp_dvec_create(sol->row);
+    INT     i;
+
+    for ( i = 0; i < sol->row; ++i ) xj.val[i] = x->val[i*nrhs+j];
+    check_solu(&xj, sol, tol);
+    fasp_dvec_free(&xj);
+}
+
+/**
+ * \fn static void check_recycle(dCSRmat *A, recycle_data *rec, double tol)
+ *
+ * \brief This function checks that the recycled space of GCRO-DR is not empty
+ *        and that C = A*U has orthonormal columns, i.e., A*U = C and C'*C = I.
+ *
+ * \author FASP team
+ * \date   10/16/2026
+ */
+static void check_recycle(dCSRmat *A, recycle_data *rec, double tol)
+{
+    const INT n = rec->n, k = rec->k;
+    REAL     *C = NULL, diff = 0.0, cij;
+    INT       i, j;
+
+    ntest++;
+
+    if ( k > 0 ) {
+        C = (REAL *)fasp_mem_calloc((size_t)k*n, sizeof(REAL));
+        for ( j = 0; j < k; ++j ) fasp_blas_dcsr_mxv(A, rec->U+(size_t)j*n, C+(size_t)j*n);
+        for ( i = 0; i < k; ++i ) {
+            for ( j = 0; j <= i; ++j ) {
+                cij  = fasp_blas_darray_dotprod(n, C+(size_t)i*n, C+(size_t)j*n);
+                diff = MAX(diff, ABS(cij - (i == j ? 1.0 : 0.0)));
+            }
+        }
+        fasp_mem_free(C); C = NULL;
+    }
+
+    if ( k > 0 && diff < tol ) {
+        printf("Recycled space of " INTFMT " vectors, ||C'*C-I|| %.4e......... [PASS]\n", k, diff);
+    }
+    else {
+        nfail++;
+        printf("### WARNING: Recycled space of " INTFMT " vectors, ||C'*C-I|| %.4e [ATTENTION!!!]\n", k, diff);
+    }
+}
+
 /**
  * \fn int main (int argc, const char * argv[])
  * 
@@ -48,6 +106,11 @@ static void check_solu(dvector *x, dvector *sol, double tol)
  * Modified by Chensong Zhang on 03/20/2012
  * Modified by Chunsheng Feng on 03/04/2016
  * Modified by Chensong Zhang on 01/22/2017
+ * Modified by FASP team on 10/16/2026: mixed precision AMG
+ * Modified by FASP team on 10/16/2026: AMG with 16-bit column indices
+ * Modified by FASP team on 10/16/2026: block Krylov for multiple rhs
+ * Modified by FASP team on 10/16/2026: check the recycled space of GCRO-DR
+ * Modified by FASP team on 10/16/2026: AMLI coefficients given by the user
  */
 int main (int argc, const char * argv[]) 
 {
@@ -77,7 +140,7 @@ int main (int argc, const char * argv[])
         /* Step 1. Get matrix and right-hand side  */
         /*******************************************/
         printf("\n=====================================================\n");
-        printf("Test Problem Number %d ...\n", indp);   
+        printf("Test Problem Number " INTFMT " ...\n", indp);   
         
         switch (indp) {
                 
@@ -173,6 +236,40 @@ int main (int argc, const char * argv[])
             check_solu(&x, &sol, tolerance);
         }
         
+        if ( indp==1 || indp==2 || indp==3 ) {
+            /* AMG V-cycle with PMIS coarsening as a solver */
+            printf("------------------------------------------------------------------\n");
+            printf("Classical AMG (PMIS coarsening) V-cycle as iterative solver ...\n");
+
+            fasp_dvec_set(b.row, &x, 0.0); // reset initial guess
+            fasp_param_amg_init(&amgparam);
+            amgparam.coarsening_type    = COARSE_PMIS;
+            amgparam.interpolation_type = INTERP_EXT;
+            amgparam.maxit       = 100;
+            amgparam.tol         = 1e-10;
+            amgparam.print_level = print_level;
+            fasp_solver_amg(&A, &b, &x, &amgparam);
+
+            check_solu(&x, &sol, tolerance);
+        }
+
+        if ( indp==1 || indp==2 || indp==3 ) {
+            /* AMG V-cycle with HMIS coarsening as a solver */
+            printf("------------------------------------------------------------------\n");
+            printf("Classical AMG (HMIS coarsening) V-cycle as iterative solver ...\n");
+
+            fasp_dvec_set(b.row, &x, 0.0); // reset initial guess
+            fasp_param_amg_init(&amgparam);
+            amgparam.coarsening_type    = COARSE_HMIS;
+            amgparam.interpolation_type = INTERP_STD;
+            amgparam.maxit       = 100;
+            amgparam.tol         = 1e-10;
+            amgparam.print_level = print_level;
+            fasp_solver_amg(&A, &b, &x, &amgparam);
+
+            check_solu(&x, &sol, tolerance);
+        }
+
         if ( indp==1 || indp==2 || indp==3 ) {
             /* AMG V-cycle (EM interpolation) with GS smoother as a solver */           
             printf("------------------------------------------------------------------\n");
@@ -190,6 +287,61 @@ int main (int argc, const char * argv[])
             check_solu(&x, &sol, tolerance);
         }
         
+        if ( indp==1 || indp==2 || indp==3 ) {
+            /* AMG V-cycles with numeric re-setup for new values of A */
+            const SHORT amg_type[4] = {CLASSIC_AMG, CLASSIC_AMG, SA_AMG, UA_AMG};
+            const SHORT freeze_P[4] = {TRUE, FALSE, TRUE, TRUE};
+            const char *amg_name[4] = {"Classical AMG (frozen P)", "Classical AMG",
+                                       "SA AMG", "UA AMG"};
+            dCSRmat     A2 = fasp_dcsr_create(A.row, A.col, A.nnz);
+            INT         i, k, t;
+            
+            // same sparsity, doubled diagonal: A2 = A + D
+            fasp_dcsr_cp(&A, &A2);
+            for ( i = 0; i < A2.row; ++i ) {
+                for ( k = A2.IA[i]; k < A2.IA[i+1]; ++k ) {
+                    if ( A2.JA[k] == i ) A2.val[k] *= 2.0;
+                }
+            }
+            
+            for ( t = 0; t < 4; ++t ) {
+                printf("------------------------------------------------------------------\n");
+                printf("%s V-cycle with numeric re-setup as iterative solver ...\n",
+                       amg_name[t]);
+                
+                fasp_param_amg_init(&amgparam);
+                amgparam.AMG_type    = amg_type[t];
+                amgparam.maxit       = 20;
+                amgparam.tol         = 1e-10;
+                amgparam.print_level = print_level;
+                if ( amg_type[t] == UA_AMG ) amgparam.maxit = 100;
+                
+                AMG_data *mgl = fasp_amg_data_create(amgparam.max_levels);
+                
+                mgl[0].A = fasp_dcsr_create(A.row, A.col, A.nnz);
+                fasp_dcsr_cp(&A, &mgl[0].A);
+                mgl[0].b = fasp_dvec_create(A.row);
+                mgl[0].x = fasp_dvec_create(A.col);
+                switch ( amg_type[t] ) {
+                    case SA_AMG: fasp_amg_setup_sa(mgl, &amgparam); break;
+                    case UA_AMG: fasp_amg_setup_ua(mgl, &amgparam); break;
+                    default:     fasp_amg_setup_rs(mgl, &amgparam); break;
+                }
+                
+                fasp_amg_setup_numeric(mgl, &A2, &amgparam, freeze_P[t]);
+                
+                fasp_blas_dcsr_mxv(&A2, sol.val, mgl[0].b.val);
+                fasp_dvec_set(A.col, &mgl[0].x, 0.0);
+                fasp_amg_solve(mgl, &amgparam);
+                
+                check_solu(&mgl[0].x, &sol, tolerance);
+                
+                fasp_amg_data_free(mgl, &amgparam);
+            }
+            
+            fasp_dcsr_free(&A2);
+        }
+        
         if ( indp==1 || indp==2 || indp==3 ) {
             /* FMG V-cycle (Direct interpolation) with GS smoother as a solver */           
             printf("------------------------------------------------------------------\n");
@@ -239,6 +391,31 @@ int main (int argc, const char * argv[])
             check_solu(&x, &sol, tolerance);
         }
         
+        if ( indp==1 || indp==2 || indp==3 ) {
+            /* AMG AMLI-cycle with the AMLI coefficients given by the user */
+            printf("------------------------------------------------------------------\n");
+            printf("Classical AMG AMLI-cycle with given coefficients ...\n");
+            
+            REAL coef[4], coef0[4];
+            dvector c = {4, coef}, c0 = {4, coef0};
+            
+            fasp_amg_amli_coef(2.0, 0.5, 3, coef0);
+            fasp_darray_cp(4, coef0, coef);
+            
+            fasp_dvec_set(b.row, &x, 0.0); // reset initial guess
+            fasp_param_amg_init(&amgparam);
+            amgparam.maxit       = 20;
+            amgparam.tol         = 1e-10;
+            amgparam.cycle_type  = AMLI_CYCLE;
+            amgparam.amli_degree = 3;
+            amgparam.amli_coef   = coef;
+            amgparam.print_level = print_level;
+            fasp_solver_amg(&A, &b, &x, &amgparam);
+            
+            check_solu(&x, &sol, tolerance);
+            check_solu(&c, &c0, 1e-14); // the given coefficients are kept
+        }
+        
         if ( indp==1 || indp==2 || indp==3 ) {
             /* AMG Nonlinear AMLI-cycle with GS smoother as a solver */         
             printf("------------------------------------------------------------------\n");
@@ -256,6 +433,22 @@ int main (int argc, const char * argv[])
             check_solu(&x, &sol, tolerance);
         }
         
+        if ( indp==1 || indp==2 || indp==3 ) {
+            /* AMG V-cycle with polynomial smoother as a solver */
+            printf("------------------------------------------------------------------\n");
+            printf("Classical AMG V-cycle with polynomial smoother as iterative solver ...\n");
+            
+            fasp_dvec_set(b.row, &x, 0.0); // reset initial guess
+            fasp_param_amg_init(&amgparam);
+            amgparam.maxit       = 20;
+            amgparam.tol         = 1e-10;
+            amgparam.smoother    = SMOOTHER_POLY;
+            amgparam.print_level = print_level;
+            fasp_solver_amg(&A, &b, &x, &amgparam);
+            
+            check_solu(&x, &sol, tolerance);
+        }
+        
         if ( indp==1 || indp==2 || indp==3 ) {
             /* AMG V-cycle with SGS smoother as a solver */         
             printf("------------------------------------------------------------------\n");
@@ -337,6 +530,24 @@ int main (int argc, const char * argv[])
             
             check_solu(&x, &sol, tolerance);
         }
+
+        if ( indp==1 || indp==2 || indp==3 ) {
+            /* UA AMG V-cycle with distance-2 MIS aggregation as a solver */
+            printf("------------------------------------------------------------------\n");
+            printf("UA AMG V-cycle with MIS2 aggregation as iterative solver ...\n");
+
+            fasp_dvec_set(b.row, &x, 0.0); // reset initial guess
+            fasp_param_amg_init(&amgparam);
+            amgparam.maxit            = 500;
+            amgparam.tol              = 1e-10;
+            amgparam.AMG_type         = UA_AMG;
+            amgparam.aggregation_type = MIS2;
+            amgparam.smoother         = SMOOTHER_GS;
+            amgparam.print_level      = print_level;
+            fasp_solver_amg(&A, &b, &x, &amgparam);
+
+            check_solu(&x, &sol, tolerance);
+        }
         
         if ( indp==1 || indp==2 || indp==3 ) {
             /* CG */
@@ -539,6 +750,155 @@ int main (int argc, const char * argv[])
             check_solu(&x, &sol, tolerance);
         }
 
+        if ( indp==1 || indp==2 ) {
+            /* Pipelined CG */
+            printf("------------------------------------------------------------------\n");
+            printf("Pipelined CG solver ...\n");
+            
+            fasp_dvec_set(b.row, &x, 0.0); // reset initial guess
+            fasp_param_solver_init(&itparam);
+            itparam.precond_type  = PREC_NULL;
+            itparam.itsolver_type = SOLVER_PipeCG;
+            itparam.maxit         = 5000;
+            itparam.tol           = 1e-12;
+            itparam.print_level   = print_level;
+            fasp_solver_dcsr_krylov(&A, &b, &x, &itparam);
+            
+            check_solu(&x, &sol, tolerance);
+        }
+
+        if ( indp==1 || indp==2 ) {
+            /* s-step GMRES */
+            printf("------------------------------------------------------------------\n");
+            printf("s-step GMRES solver ...\n");
+            
+            fasp_dvec_set(b.row, &x, 0.0); // reset initial guess
+            fasp_param_solver_init(&itparam);
+            itparam.precond_type  = PREC_NULL;
+            itparam.itsolver_type = SOLVER_CAGMRES;
+            itparam.maxit         = 5000;
+            itparam.tol           = 1e-12;
+            itparam.print_level   = print_level;
+            fasp_solver_dcsr_krylov(&A, &b, &x, &itparam);
+            
+            check_solu(&x, &sol, tolerance);
+        }
+
+        if ( indp==1 || indp==2 ) {
+            /* GCRO-DR, the second solve recycles the space of the first one */
+            recycle_data rec;
+            INT          i;
+
+            fasp_recycle_init(&rec, 10);
+
+            for ( i = 0; i < 2; i++ ) {
+                printf("------------------------------------------------------------------\n");
+                printf("GCRO-DR solver (solve " INTFMT " with recycling) ...\n", i+1);
+
+                fasp_dvec_set(b.row, &x, 0.0); // reset initial guess
+                fasp_solver_dcsr_pgcrodr(&A, &b, &x, NULL, 1e-12, 5000, 30, &rec,
+                                         STOP_REL_RES, print_level);
+
+                check_solu(&x, &sol, tolerance);
+                check_recycle(&A, &rec, 1e-8);
+            }
+
+            fasp_recycle_free(&rec);
+        }
+
+        if ( indp==1 || indp==2 ) {
+            /* BiCGstab(l) */
+            printf("------------------------------------------------------------------\n");
+            printf("BiCGstab(l) solver ...\n");
+            
+            fasp_dvec_set(b.row, &x, 0.0); // reset initial guess
+            fasp_param_solver_init(&itparam);
+            itparam.precond_type  = PREC_NULL;
+            itparam.itsolver_type = SOLVER_BiCGstabL;
+            itparam.ell           = 4;
+            itparam.maxit         = 5000;
+            itparam.tol           = 1e-12;
+            itparam.print_level   = print_level;
+            fasp_solver_dcsr_krylov(&A, &b, &x, &itparam);
+            
+            check_solu(&x, &sol, tolerance);
+        }
+
+        if ( indp==1 || indp==2 ) {
+            /* Chebyshev iteration with diagonal preconditioner */
+            printf("------------------------------------------------------------------\n");
+            printf("Diagonal preconditioned Chebyshev solver ...\n");
+            
+            fasp_dvec_set(b.row, &x, 0.0); // reset initial guess
+            fasp_param_solver_init(&itparam);
+            itparam.precond_type  = PREC_DIAG;
+            itparam.itsolver_type = SOLVER_CHEBY;
+            itparam.maxit         = 5000;
+            itparam.tol           = 1e-12;
+            itparam.print_level   = print_level;
+            fasp_solver_dcsr_krylov_diag(&A, &b, &x, &itparam);
+            
+            check_solu(&x, &sol, tolerance);
+        }
+
+        if ( indp==1 || indp==2 ) {
+            /* CG with Chebyshev polynomial preconditioner */
+            printf("------------------------------------------------------------------\n");
+            printf("Chebyshev polynomial preconditioned CG solver ...\n");
+            
+            fasp_dvec_set(b.row, &x, 0.0); // reset initial guess
+            fasp_param_solver_init(&itparam);
+            itparam.precond_type  = PREC_CHEBY;
+            itparam.itsolver_type = SOLVER_CG;
+            itparam.maxit         = 5000;
+            itparam.tol           = 1e-12;
+            itparam.print_level   = print_level;
+            fasp_solver_dcsr_krylov_cheby(&A, &b, &x, &itparam);
+            
+            check_solu(&x, &sol, tolerance);
+        }
+
+        if ( indp==1 || indp==2 ) {
+            /* Block CG and block GMRES for three rhs: b, A*1, b */
+            const INT nrhs = 3;
+            dvector   one  = fasp_dvec_create(b.row);
+            dvector   B    = fasp_dvec_create(b.row*nrhs);
+            dvector   X    = fasp_dvec_create(b.row*nrhs);
+            INT       i, j;
+
+            fasp_dvec_set(b.row, &one, 1.0);
+            fasp_blas_dcsr_mxv(&A, one.val, x.val);
+            for ( i = 0; i < b.row; ++i ) {
+                B.val[i*nrhs+0] = b.val[i];
+                B.val[i*nrhs+1] = x.val[i];
+                B.val[i*nrhs+2] = b.val[i];
+            }
+
+            for ( j = 0; j < 2; ++j ) {
+                printf("------------------------------------------------------------------\n");
+                printf("Block %s solver with AMG preconditioner for " INTFMT " rhs ...\n",
+                       j == 0 ? "CG" : "GMRES", nrhs);
+
+                fasp_dvec_set(X.row, &X, 0.0); // reset initial guess
+                fasp_param_solver_init(&itparam);
+                fasp_param_amg_init(&amgparam);
+                itparam.precond_type  = PREC_AMG;
+                itparam.itsolver_type = ( j == 0 ) ? SOLVER_CG : SOLVER_GMRES;
+                itparam.maxit         = 500;
+                itparam.tol           = 1e-10;
+                itparam.print_level   = print_level;
+                fasp_solver_dcsr_krylov_amg_mrhs(&A, &B, &X, nrhs, &itparam, &amgparam);
+
+                check_solu_mrhs(&X, &sol, nrhs, 0, tolerance);
+                check_solu_mrhs(&X, &one, nrhs, 1, tolerance);
+                check_solu_mrhs(&X, &sol, nrhs, 2, tolerance);
+            }
+
+            fasp_dvec_free(&one);
+            fasp_dvec_free(&B);
+            fasp_dvec_free(&X);
+        }
+
         if ( indp==1 || indp==2 ) {
             /* CG in BSR */
             dBSRmat A_bsr = fasp_format_dcsr_dbsr (&A, 1);
@@ -578,6 +938,26 @@ int main (int argc, const char * argv[])
 
             check_solu(&x, &sol, tolerance);            
         }
+
+        if ( indp==1 || indp==2 ) {
+            /* BiCGstab(l) in BSR */
+            dBSRmat A_bsr = fasp_format_dcsr_dbsr (&A, 1);
+            
+            printf("------------------------------------------------------------------\n");
+            printf("BiCGstab(l) solver in BSR format ...\n");
+            
+            fasp_dvec_set(b.row, &x, 0.0); // reset initial guess
+            fasp_param_solver_init(&itparam);
+            itparam.precond_type  = PREC_NULL;
+            itparam.itsolver_type = SOLVER_BiCGstabL;
+            itparam.maxit         = 500;
+            itparam.tol           = 1e-12;
+            itparam.print_level   = print_level;
+            fasp_solver_dbsr_krylov(&A_bsr, &b, &x, &itparam);
+            fasp_dbsr_free(&A_bsr);
+
+            check_solu(&x, &sol, tolerance);
+        }
         
         if ( indp==1 || indp==2 ) {
             /* GMRES in BSR */
@@ -670,6 +1050,69 @@ int main (int argc, const char * argv[])
             check_solu(&x, &sol, tolerance);
         }
         
+        if ( indp==1 || indp==2 || indp==3 ) {
+            /* Using classical AMG as preconditioner for Chebyshev iteration */
+            printf("------------------------------------------------------------------\n");
+            printf("AMG preconditioned Chebyshev solver ...\n");
+            fasp_dvec_set(b.row,&x,0.0);
+            fasp_param_solver_init(&itparam);
+            fasp_param_amg_init(&amgparam);
+            itparam.itsolver_type = SOLVER_CHEBY;
+            itparam.maxit         = 500;
+            itparam.tol           = 1e-10;
+            itparam.print_level   = print_level;
+            fasp_solver_dcsr_krylov_amg(&A, &b, &x, &itparam, &amgparam);
+            
+            check_solu(&x, &sol, tolerance);
+        }
+        
+        if ( indp==1 || indp==2 || indp==3 ) {
+            /* Using classical AMG with single precision P, R, and A as preconditioner */
+            printf("------------------------------------------------------------------\n");
+            printf("AMG (single precision P, R, and A) preconditioned CG solver ...\n");
+            fasp_dvec_set(b.row,&x,0.0);
+            fasp_param_solver_init(&itparam);
+            fasp_param_amg_init(&amgparam);
+            amgparam.mixed_precision = ON;
+            itparam.maxit         = 500;
+            itparam.tol           = 1e-10;
+            itparam.print_level   = print_level;
+            fasp_solver_dcsr_krylov_amg(&A, &b, &x, &itparam, &amgparam);
+            
+            check_solu(&x, &sol, tolerance);
+        }
+        
+        if ( indp==1 || indp==2 || indp==3 ) {
+            /* Iterative refinement with single precision AMG and CG */
+            printf("------------------------------------------------------------------\n");
+            printf("Iterative refinement with single precision AMG and CG solver ...\n");
+            fasp_dvec_set(b.row,&x,0.0);
+            fasp_param_solver_init(&itparam);
+            fasp_param_amg_init(&amgparam);
+            itparam.maxit         = 500;
+            itparam.tol           = 1e-10;
+            itparam.print_level   = print_level;
+            fasp_solver_dcsr_krylov_amg_ir(&A, &b, &x, &itparam, &amgparam);
+            
+            check_solu(&x, &sol, tolerance);
+        }
+        
+        if ( indp==1 || indp==2 || indp==3 ) {
+            /* Using classical AMG with 16-bit column indices as preconditioner */
+            printf("------------------------------------------------------------------\n");
+            printf("AMG (16-bit column indices) preconditioned CG solver ...\n");
+            fasp_dvec_set(b.row,&x,0.0);
+            fasp_param_solver_init(&itparam);
+            fasp_param_amg_init(&amgparam);
+            amgparam.compress_index = ON;
+            itparam.maxit         = 500;
+            itparam.tol           = 1e-10;
+            itparam.print_level   = print_level;
+            fasp_solver_dcsr_krylov_amg(&A, &b, &x, &itparam, &amgparam);
+            
+            check_solu(&x, &sol, tolerance);
+        }
+        
         if ( indp==1 || indp==2 || indp==3 ) {
             /* Using classical AMG as preconditioner for BiCGstab */
             printf("------------------------------------------------------------------\n");
@@ -35,6 +35,117 @@ static void check_solu(dvector *x, dvector *sol, double tol)
     }
 }
 
+/**
+ * \fn static void check_arena(void)
+ *
+ * This function checks that memory drawn from the default work arena is aligned
+ * to ARENA_ALIGN, that it is reused after a release, that it is returned to the
+ * system after the outermost release, and that each thread has its own arena.
+ */
+static void check_arena(void)
+{
+    const size_t live = fasp_mem_live(MEM_TAG_WORK);
+    size_t       mark, inner, i;
+    INT          nbad = 0;
+    char        *p, *q;
+    
+    ntest++;
+    
+    // two scopes: the second one gets a single block of the peak size
+    for ( i = 0; i < 2; ++i ) {
+        mark = fasp_arena_mark(NULL);
+        for ( inner = 1; inner < 100; inner += 7 ) {
+            p = (char *)fasp_arena_alloc(NULL, inner, sizeof(char));
+            if ( (size_t)p % ARENA_ALIGN != 0 ) nbad++;
+        }
+        inner = fasp_arena_mark(NULL);
+        p = (char *)fasp_arena_alloc(NULL, 1000, sizeof(REAL));
+        fasp_arena_release(NULL, inner);
+        q = (char *)fasp_arena_alloc(NULL, 1000, sizeof(REAL));
+        if ( i == 1 && p != q ) nbad++;
+        fasp_arena_release(NULL, mark);
+    }
+    
+    if ( fasp_mem_live(MEM_TAG_WORK) != live ) nbad++;
+    
+#ifdef _OPENMP
+#pragma omp parallel private(p) reduction(+:nbad)
+    {
+        if ( fasp_arena_mark(NULL) != 0 ) nbad++;
+        p = (char *)fasp_arena_alloc(NULL, 3*ARENA_ALIGN, sizeof(char));
+        if ( (size_t)p % ARENA_ALIGN != 0 ) nbad++;
+        if ( fasp_arena_mark(NULL) != 3*ARENA_ALIGN ) nbad++;
+        fasp_arena_release(NULL, 0);
+    }
+#endif
+    
+    if ( nbad == 0 ) {
+        printf("Work arena aligned, reused, and released................. [PASS]\n");
+    }
+    else {
+        nfail++;
+        printf("### WARNING: Work arena failed " INTFMT " checks........... [ATTENTION!!!]\n", nbad);
+    }
+}
+
+/**
+ * \fn static void check_str_spmm(void)
+ *
+ * This function compares the multi-vector products of dSTRmat matrices with
+ * fasp_blas_dstr_mxv applied to each vector, for 2D and 3D grids and different
+ * block sizes. The grids are large enough for the OpenMP paths.
+ */
+static void check_str_spmm(void)
+{
+    const INT  nrhs  = 3;
+    const REAL alpha = -2.0;
+    const INT  grid[3][4] = {{50,50,1,1}, {50,50,1,3}, {14,14,14,2}}; // nx,ny,nz,nc
+    
+    INT     i, j, k, l, n, nband, offsets[6];
+    dSTRmat A;
+    dvector x, y, z, w;
+    
+    for ( k = 0; k < 3; ++k ) {
+        nband = ( grid[k][2] == 1 ) ? 4 : 6;
+        offsets[0] = -1; offsets[1] = 1;
+        offsets[2] = -grid[k][0]; offsets[3] = grid[k][0];
+        offsets[4] = -grid[k][0]*grid[k][1]; offsets[5] = grid[k][0]*grid[k][1];
+        
+        A = fasp_dstr_create(grid[k][0], grid[k][1], grid[k][2], grid[k][3],
+                             nband, offsets);
+        n = A.ngrid*A.nc;
+        
+        for ( i = 0; i < A.ngrid*A.nc*A.nc; ++i ) A.diag[i] = 4.0 + (i % 5);
+        for ( j = 0; j < nband; ++j ) {
+            for ( i = 0; i < (A.ngrid-ABS(offsets[j]))*A.nc*A.nc; ++i )
+                A.offdiag[j][i] = -1.0 + 0.1*((i+j) % 7);
+        }
+        
+        x = fasp_dvec_create(n*nrhs); y = fasp_dvec_create(n*nrhs);
+        z = fasp_dvec_create(n);      w = fasp_dvec_create(n);
+        fasp_dvec_rand(n*nrhs, &x);
+        fasp_dvec_set(n*nrhs, &y, 1.0);
+        
+        // Y = A*X and Y = alpha*A*X + Y against A*x_j for each vector
+        for ( j = 0; j < 2; ++j ) {
+            if ( j == 0 ) fasp_blas_dstr_mxm_dense(&A, nrhs, x.val, y.val);
+            else fasp_blas_dstr_aAxpy_dense(alpha, &A, nrhs, x.val, y.val);
+            
+            for ( i = 0; i < nrhs; ++i ) {
+                for ( l = 0; l < n; ++l ) w.val[l] = x.val[l*nrhs+i];
+                fasp_blas_dstr_mxv(&A, w.val, z.val);
+                for ( l = 0; l < n; ++l ) w.val[l] = y.val[l*nrhs+i];
+                if ( j == 1 ) fasp_blas_darray_ax(n, 1.0/(1+alpha), w.val);
+                check_solu(&w, &z, 1e-10);
+            }
+        }
+        
+        fasp_dstr_free(&A);
+        fasp_dvec_free(&x); fasp_dvec_free(&y);
+        fasp_dvec_free(&z); fasp_dvec_free(&w);
+    }
+}
+
 /**
  * \fn int main (int argc, const char * argv[])
  *
@@ -48,6 +159,14 @@ static void check_solu(dvector *x, dvector *sol, double tol)
  * Modified by Chensong Zhang on 03/20/2012
  * Modified by Feiteng Huang on 09/19/2012
  * Modified by Chunsheng Feng on 03/04/2016
+ * Modified by FASP team on 10/16/2026: add SELL format
+ * Modified by FASP team on 10/16/2026: add SymCSR format
+ * Modified by FASP team on 10/16/2026: add CSR16 format
+ * Modified by FASP team on 10/16/2026: check SymCSR SpMV and smoothers
+ * Modified by FASP team on 10/16/2026: check CSR16 smoothers
+ * Modified by FASP team on 10/16/2026: check the work arena
+ * Modified by FASP team on 10/16/2026: check first touch with the SpMV rows
+ * Modified by FASP team on 10/16/2026: check multi-vector products of STR
  */
 int main (int argc, const char * argv[])
 {
@@ -60,6 +179,7 @@ int main (int argc, const char * argv[])
     dCSRmat     A;            // coefficient matrix
     dvector     b, x, sol;    // rhs, numerical sol, exact sol
     INT         indp;         // index for test problems
+    INT         i;
     
     time_t      lt  = time(NULL);
     
@@ -70,13 +190,23 @@ int main (int argc, const char * argv[])
     
     ntest = nfail = 0;
     
+    printf("\n=====================================================\n");
+    printf("Memory arena for temporary work space");
+    printf("\n=====================================================\n");
+    check_arena();
+    
+    printf("\n=====================================================\n");
+    printf("Multi-vector products of STR matrices");
+    printf("\n=====================================================\n");
+    check_str_spmm();
+    
     /*******************************************/
     /* Step 1. Get matrix and right-hand side  */
     /*******************************************/
     for ( indp = 1; indp <= num_prob; indp++ ) {
         
         printf("\n=====================================================\n");
-        printf("Test Problem Number %d ...\n", indp);
+        printf("Test Problem Number " INTFMT " ...\n", indp);
         
         switch (indp) {
                 
@@ -121,6 +251,9 @@ int main (int argc, const char * argv[])
         fasp_dvec_alloc(b.row, &x);  // allocate mem for numerical solution
         
         dBSRmat A_bsr = fasp_format_dcsr_dbsr (&A, 1);
+        dSELLmat *A_sell = fasp_format_dcsr_dsell (&A, SELL_CHUNK, SELL_SIGMA);
+        dSymCSRmat *A_sym = fasp_format_dcsr_dsymcsr (&A);
+        dCSR16mat *A_c16 = fasp_format_dcsr_dcsr16 (&A);
         
         if ( indp==1 || indp==2 || indp==3 ) {
             /* CG */
@@ -173,6 +306,172 @@ int main (int argc, const char * argv[])
             check_solu(&x, &sol, tolerance);
         }
         
+        if ( indp==1 || indp==2 || indp==3 ) {
+            /* Matrix-free CG for SELL */
+            printf("------------------------------------------------------------------\n");
+            printf("Matrix-free CG solver for SELL ...\n");
+            
+            fasp_dvec_set(b.row, &x, 0.0); // reset initial guess
+            fasp_param_solver_init(&itparam);
+            itparam.precond_type  = PREC_NULL;
+            itparam.itsolver_type = SOLVER_CG;
+            itparam.maxit         = 5000;
+            itparam.tol           = 1e-12;
+            itparam.print_level   = print_level;
+            mxv_matfree mf;
+            fasp_solver_matfree_init(MAT_SELL, &mf, A_sell);
+            fasp_solver_krylov(&mf, &b, &x, &itparam);
+            
+            check_solu(&x, &sol, tolerance);
+        }
+        
+        if ( indp==1 || indp==2 || indp==3 ) {
+            /* Matrix-free CG for SymCSR */
+            printf("------------------------------------------------------------------\n");
+            printf("Matrix-free CG solver for SymCSR ...\n");
+            
+            fasp_dvec_set(b.row, &x, 0.0); // reset initial guess
+            fasp_param_solver_init(&itparam);
+            itparam.precond_type  = PREC_NULL;
+            itparam.itsolver_type = SOLVER_CG;
+            itparam.maxit         = 5000;
+            itparam.tol           = 1e-12;
+            itparam.print_level   = print_level;
+            mxv_matfree mf;
+            fasp_solver_matfree_init(MAT_SymCSR, &mf, A_sym);
+            fasp_solver_krylov(&mf, &b, &x, &itparam);
+            
+            check_solu(&x, &sol, tolerance);
+        }
+        
+        if ( indp==1 || indp==2 || indp==3 ) {
+            /* SymCSR SpMV and smoothers against CSR */
+            printf("------------------------------------------------------------------\n");
+            printf("SymCSR SpMV and smoothers against CSR ...\n");
+            
+            dvector   y1 = fasp_dvec_create(b.row), y2 = fasp_dvec_create(b.row);
+            ILU_param iluparam;
+            ILU_data  LU1, LU2;
+            
+            // SpMV: twice to reuse the threaded partition kept in A_sym
+            fasp_blas_dcsr_mxv(&A, b.val, y1.val);
+            fasp_blas_dsymcsr_mxv(A_sym, b.val, y2.val);
+            fasp_blas_dsymcsr_mxv(A_sym, b.val, y2.val);
+            check_solu(&y2, &y1, 1e-10);
+            
+            // GS and SGS: the CSR smoothers are only sequential for small sizes
+            if ( b.row <= OPENMP_HOLDS ) {
+                fasp_dvec_set(b.row, &y1, 0.0); fasp_dvec_set(b.row, &y2, 0.0);
+                fasp_smoother_dcsr_gs(&y1, 0, b.row-1, 1, &A, &b, 3);
+                fasp_smoother_dsymcsr_gs(&y2, ASCEND, A_sym, &b, 3);
+                check_solu(&y2, &y1, 1e-10);
+                
+                fasp_dvec_set(b.row, &y1, 0.0); fasp_dvec_set(b.row, &y2, 0.0);
+                fasp_smoother_dcsr_gs(&y1, b.row-1, 0, -1, &A, &b, 3);
+                fasp_smoother_dsymcsr_gs(&y2, DESCEND, A_sym, &b, 3);
+                check_solu(&y2, &y1, 1e-10);
+                
+                fasp_dvec_set(b.row, &y1, 0.0); fasp_dvec_set(b.row, &y2, 0.0);
+                fasp_smoother_dcsr_sgs(&y1, &A, &b, 3);
+                fasp_smoother_dsymcsr_sgs(&y2, A_sym, &b, 3);
+                check_solu(&y2, &y1, 1e-10);
+            }
+            
+            // ILU smoother with the same ILUk factorization
+            fasp_param_ilu_init(&iluparam);
+            iluparam.ILU_type    = ILUk;
+            iluparam.print_level = PRINT_NONE;
+            fasp_ilu_dcsr_setup(&A, &LU1, &iluparam);
+            fasp_ilu_dsymcsr_setup(A_sym, &LU2, &iluparam);
+            
+            fasp_dvec_set(b.row, &y1, 0.0); fasp_dvec_set(b.row, &y2, 0.0);
+            fasp_smoother_dcsr_ilu(&A, &b, &y1, &LU1);
+            fasp_smoother_dsymcsr_ilu(A_sym, &b, &y2, &LU2);
+            check_solu(&y2, &y1, 1e-10);
+            
+            fasp_ilu_data_free(&LU1);
+            fasp_ilu_data_free(&LU2);
+            fasp_dvec_free(&y1);
+            fasp_dvec_free(&y2);
+        }
+        
+        if ( indp==1 || indp==2 || indp==3 ) {
+            /* Matrix-free CG for CSR16 */
+            printf("------------------------------------------------------------------\n");
+            printf("Matrix-free CG solver for CSR16 ...\n");
+            
+            fasp_dvec_set(b.row, &x, 0.0); // reset initial guess
+            fasp_param_solver_init(&itparam);
+            itparam.precond_type  = PREC_NULL;
+            itparam.itsolver_type = SOLVER_CG;
+            itparam.maxit         = 5000;
+            itparam.tol           = 1e-12;
+            itparam.print_level   = print_level;
+            mxv_matfree mf;
+            fasp_solver_matfree_init(MAT_CSR16, &mf, A_c16);
+            fasp_solver_krylov(&mf, &b, &x, &itparam);
+            
+            check_solu(&x, &sol, tolerance);
+        }
+        
+        if ( b.row <= OPENMP_HOLDS ) {
+            /* CSR16 smoothers against CSR: only sequential for small sizes */
+            printf("------------------------------------------------------------------\n");
+            printf("CSR16 smoothers against CSR ...\n");
+            
+            dvector y1 = fasp_dvec_create(b.row), y2 = fasp_dvec_create(b.row);
+            ivector cf = fasp_ivec_create(b.row);
+            
+            for ( i = 0; i < b.row; ++i ) cf.val[i] = ( i % 3 == 0 ) ? 1 : 0;
+            
+            fasp_dvec_set(b.row, &y1, 0.0); fasp_dvec_set(b.row, &y2, 0.0);
+            fasp_smoother_dcsr_gs(&y1, b.row-1, 0, -1, &A, &b, 3);
+            fasp_smoother_dcsr16_gs(&y2, b.row-1, 0, -1, A_c16, &b, 3);
+            check_solu(&y2, &y1, 1e-10);
+            
+            fasp_dvec_set(b.row, &y1, 0.0); fasp_dvec_set(b.row, &y2, 0.0);
+            fasp_smoother_dcsr_gs_cf(&y1, &A, &b, 3, cf.val, FPFIRST);
+            fasp_smoother_dcsr16_gs_cf(&y2, A_c16, &b, 3, cf.val, FPFIRST);
+            check_solu(&y2, &y1, 1e-10);
+            
+            fasp_dvec_set(b.row, &y1, 0.0); fasp_dvec_set(b.row, &y2, 0.0);
+            fasp_smoother_dcsr_sgs(&y1, &A, &b, 3);
+            fasp_smoother_dcsr16_sgs(&y2, A_c16, &b, 3);
+            check_solu(&y2, &y1, 1e-10);
+            
+            fasp_ivec_free(&cf);
+            fasp_dvec_free(&y1);
+            fasp_dvec_free(&y2);
+        }
+        
+        if ( indp==1 || indp==2 || indp==3 ) {
+            /* First touch with the row partition of SpMV */
+            printf("------------------------------------------------------------------\n");
+            printf("First touch with the SpMV rows ...\n");
+            
+            const SHORT ft = fasp_mem_set_first_touch(ON);
+            dvector y1 = fasp_dvec_create_rows(&A), y2 = fasp_dvec_create(b.row);
+            REAL *val = (REAL *)fasp_mem_calloc_numa_nnz(A.row, A.IA, sizeof(REAL)), *tmp;
+            
+            // the new vector and values are set to zero
+            fasp_dvec_set(b.row, &y2, 0.0);
+            for ( i = 0; i < A.nnz; ++i ) y2.val[0] += ABS(val[i]);
+            check_solu(&y1, &y2, 1e-14);
+            
+            // SpMV with the values copied to the new array
+            fasp_darray_cp(A.nnz, A.val, val);
+            fasp_blas_dcsr_mxv(&A, sol.val, y2.val);
+            tmp = A.val; A.val = val;
+            fasp_blas_dcsr_mxv(&A, sol.val, y1.val);
+            A.val = tmp;
+            check_solu(&y1, &y2, 1e-14);
+            
+            fasp_mem_set_first_touch(ft);
+            fasp_mem_free(val); val = NULL;
+            fasp_dvec_free(&y1);
+            fasp_dvec_free(&y2);
+        }
+        
         if ( indp==1 || indp==2 || indp==3 ) {
             /* BiCGstab */
             printf("------------------------------------------------------------------\n");
@@ -338,6 +637,25 @@ int main (int argc, const char * argv[])
             check_solu(&x, &sol, tolerance);
         }
         
+        if ( indp==1 || indp==2 || indp==3 ) {
+            /* Matrix-free GMRES for SELL */
+            printf("------------------------------------------------------------------\n");
+            printf("Matrix-free GMRES solver for SELL ...\n");
+            
+            fasp_dvec_set(b.row, &x, 0.0); // reset initial guess
+            fasp_param_solver_init(&itparam);
+            itparam.precond_type  = PREC_NULL;
+            itparam.itsolver_type = SOLVER_GMRES;
+            itparam.maxit         = 5000;
+            itparam.tol           = 1e-12;
+            itparam.print_level   = print_level;
+            mxv_matfree mf;
+            fasp_solver_matfree_init(MAT_SELL, &mf, A_sell);
+            fasp_solver_krylov(&mf, &b, &x, &itparam);
+            
+            check_solu(&x, &sol, tolerance);
+        }
+        
         if ( indp==1 || indp==2 || indp==3 ) {
             /* VGMRES */
             printf("------------------------------------------------------------------\n");
@@ -506,6 +824,9 @@ int main (int argc, const char * argv[])
         /* clean up memory */
         fasp_dcsr_free(&A);
         fasp_dbsr_free(&A_bsr);
+        fasp_dsell_free(A_sell);
+        fasp_dsymcsr_free(A_sym);
+        fasp_dcsr16_free(A_c16);
         fasp_dvec_free(&b);
         fasp_dvec_free(&x);
         fasp_dvec_free(&sol);
@@ -117,7 +117,7 @@ int main (int argc, const char * argv[])
                 printf("MatrixMarket Driven cavity E05R0500\n");
                 printf("||  Condition Number:      4.8e+6   ||\n");
                 printf("||        Unsymmetric               ||\n");
-                printf("|| row:%5d, col:%5d, nnz:%6d ||\n", A.row, A.col, A.nnz);
+                printf("|| row:%5" INTMOD "d, col:%5" INTMOD "d, nnz:%6" INTMOD "d ||\n", A.row, A.col, A.nnz);
                 printf("==================================================================\n");
                 
                 // Generate an exact solution randomly
@@ -141,7 +141,7 @@ int main (int argc, const char * argv[])
                 printf("MatrixMarket Finite element analysis of cylindrical shells\n");
                 printf("||  Condition Number:     1.15e+8   ||\n");
                 printf("||   Symmetric positive definite    ||\n");
-                printf("|| row:%5d, col:%5d, nnz:%6d ||\n", A.row, A.col, A.nnz);
+                printf("|| row:%5" INTMOD "d, col:%5" INTMOD "d, nnz:%6" INTMOD "d ||\n", A.row, A.col, A.nnz);
                 printf("==================================================================\n");
                 
                 // Generate an exact solution randomly
@@ -164,7 +164,7 @@ int main (int argc, const char * argv[])
                 printf("MatrixMarket Oil reservoir simulation - generated problems\n");
                 printf("||  Condition Number:        1e+2   ||\n");
                 printf("||          Unsymmetric             ||\n");
-                printf("|| row:%5d, col:%5d, nnz:%6d ||\n", A.row, A.col, A.nnz);
+                printf("|| row:%5" INTMOD "d, col:%5" INTMOD "d, nnz:%6" INTMOD "d ||\n", A.row, A.col, A.nnz);
                 printf("==================================================================\n");
                 
                 // Generate an exact solution randomly
@@ -187,7 +187,7 @@ int main (int argc, const char * argv[])
                 printf("MatrixMarket Enhanced oil recovery\n");
                 printf("||  Condition Number:      3.5e+6   ||\n");
                 printf("||          Unsymmetric             ||\n");
-                printf("|| row:%5d, col:%5d, nnz:%6d ||\n", A.row, A.col, A.nnz);
+                printf("|| row:%5" INTMOD "d, col:%5" INTMOD "d, nnz:%6" INTMOD "d ||\n", A.row, A.col, A.nnz);
                 printf("==================================================================\n");
                 
                 // Generate an exact solution randomly
@@ -210,7 +210,7 @@ int main (int argc, const char * argv[])
                 printf("MatrixMarket BCS Structural Engineering Matrices\n");
                 printf("||  Condition Number:          65   ||\n");
                 printf("||   Symmetric positive definite    ||\n");
-                printf("|| row:%5d, col:%5d, nnz:%6d ||\n", A.row, A.col, A.nnz);
+                printf("|| row:%5" INTMOD "d, col:%5" INTMOD "d, nnz:%6" INTMOD "d ||\n", A.row, A.col, A.nnz);
                 printf("==================================================================\n");
                 
                 // Generate an exact solution randomly
@@ -233,7 +233,7 @@ int main (int argc, const char * argv[])
                 printf("MatrixMarket Circuit physics modeling\n");
                 printf("||  Condition Number:      7.3e+2   ||\n");
                 printf("||          Unsymmetric             ||\n");
-                printf("|| row:%5d, col:%5d, nnz:%6d ||\n", A.row, A.col, A.nnz);
+                printf("|| row:%5" INTMOD "d, col:%5" INTMOD "d, nnz:%6" INTMOD "d ||\n", A.row, A.col, A.nnz);
                 printf("==================================================================\n");
                 
                 // Generate an exact solution randomly
@@ -255,7 +255,7 @@ int main (int argc, const char * argv[])
                 printf("MatrixMarket Simulation of computer systems\n");
                 printf("||  Condition Number:      1.5e+2   ||\n");
                 printf("||          Unsymmetric             ||\n");
-                printf("|| row:%5d, col:%5d, nnz:%6d ||\n", A.row, A.col, A.nnz);
+                printf("|| row:%5" INTMOD "d, col:%5" INTMOD "d, nnz:%6" INTMOD "d ||\n", A.row, A.col, A.nnz);
                 printf("==================================================================\n");
                 
                 // Generate an exact solution randomly
@@ -278,7 +278,7 @@ int main (int argc, const char * argv[])
                 printf("MatrixMarket Computer component design\n");
                 printf("||  Condition Number:     2.14e+2   ||\n");
                 printf("||          Unsymmetric             ||\n");
-                printf("|| row:%5d, col:%5d, nnz:%6d ||\n", A.row, A.col, A.nnz);
+                printf("|| row:%5" INTMOD "d, col:%5" INTMOD "d, nnz:%6" INTMOD "d ||\n", A.row, A.col, A.nnz);
                 printf("==================================================================\n");
                 
                 // Generate an exact solution randomly
@@ -301,7 +301,7 @@ int main (int argc, const char * argv[])
                 printf("MatrixMarket Oil reservoir simulation challenge matrics\n");
                 printf("||  Condition Number:      2.3e+4   ||\n");
                 printf("||            Symmetric             ||\n");
-                printf("|| row:%5d, col:%5d, nnz:%6d ||\n", A.row, A.col, A.nnz);
+                printf("|| row:%5" INTMOD "d, col:%5" INTMOD "d, nnz:%6" INTMOD "d ||\n", A.row, A.col, A.nnz);
                 printf("==================================================================\n");
                 
                 // Generate an exact solution randomly
@@ -323,7 +323,7 @@ int main (int argc, const char * argv[])
                 printf("MatrixMarket Petroleum engineering\n");
                 printf("||  Condition Number:     5.38e+9   ||\n");
                 printf("||          Unsymmetric             ||\n");
-                printf("|| row:%5d, col:%5d, nnz:%6d ||\n", A.row, A.col, A.nnz);
+                printf("|| row:%5" INTMOD "d, col:%5" INTMOD "d, nnz:%6" INTMOD "d ||\n", A.row, A.col, A.nnz);
                 printf("==================================================================\n");
                 
                 // Generate an exact solution randomly
@@ -219,8 +219,8 @@ int main (int argc, const char * argv[])
     
     // Print problem size
     if (print_level > PRINT_NONE) {
-        printf("A: m = %d, n = %d, nnz = %d\n", A.row, A.col, A.nnz);
-        printf("b: n = %d\n", b.row);
+        printf("A: m = " INTFMT ", n = " INTFMT ", nnz = " INTFMT "\n", A.row, A.col, A.nnz);
+        printf("b: n = " INTFMT "\n", b.row);
     }
     
     // Print out solver parameters
@@ -265,6 +265,11 @@ int main (int argc, const char * argv[])
             status = fasp_solver_dcsr_krylov_swz(&A, &b, &x, &itspar, &swzpar);
         }
         
+        // Using Chebyshev polynomial as preconditioner for Krylov iterative methods
+        else if (precond_type == PREC_CHEBY) {
+            status = fasp_solver_dcsr_krylov_cheby(&A, &b, &x, &itspar);
+        }
+        
         else {
             printf("### ERROR: Unknown preconditioner type %d!!!\n", precond_type);       
             status = ERROR_SOLVER_PRECTYPE;
@@ -293,8 +293,8 @@ int main (int argc, const char * argv[])
     
     // Print problem size
     if (print_level>PRINT_NONE) {
-        printf("A: m = %d, n = %d, nnz = %d\n", Absr.ROW, Absr.COL, Absr.NNZ);
-        printf("b: n = %d\n", b.row);
+        printf("A: m = " INTFMT ", n = " INTFMT ", nnz = " INTFMT "\n", Absr.ROW, Absr.COL, Absr.NNZ);
+        printf("b: n = " INTFMT "\n", b.row);
     }
     
     // Step 2. Solve the system
@@ -102,7 +102,7 @@ int main (int argc, const char * argv[])
         fasp_ivec_alloc(row, &n_idx);
         fasp_ivec_alloc(row, &p_idx);
         
-        printf("row = %d\n",row);
+        printf("row = " INTFMT "\n",row);
         for (i=0; i<row; i++){
             phi_idx.val[i] = 3*i;
             n_idx.val[i] = 3*i+1;
@@ -1760,7 +1760,7 @@ int main (int argc, const char * argv[])
                 status = fasp_solver_dblc_krylov_block4(&Ablc, &b, &uh, &itpar, &amgpar, A_diag);
             }
             else {
-                printf("### ERROR: Block size %d is not known!!!\n", Ablc.brow);
+                printf("### ERROR: Block size " INTFMT " is not known!!!\n", Ablc.brow);
             }
         }
         
@@ -209,7 +209,7 @@ int main (int argc, const char *argv[])
     
     printf("Enter spatial dimension (1, 2 or 3):   ");
     
-    if ( scanf("%d", &dim) > 1 ) {
+    if ( scanf(INTFMT, &dim) > 1 ) {
         printf("### ERROR: Did not get a valid input !!!\n");
         return ERROR_INPUT_PAR;
     }
@@ -221,7 +221,7 @@ int main (int argc, const char *argv[])
     
     printf("Choosing solver (V-cycle=1, FMG=2, PCG=3):   ");
     
-    if ( scanf("%d", &method) > 1 ) {
+    if ( scanf(INTFMT, &method) > 1 ) {
         printf("### ERROR: Did not get a valid input !!!\n");
         return ERROR_INPUT_PAR;
     }
@@ -232,7 +232,7 @@ int main (int argc, const char *argv[])
     }
     
     printf("Enter the desired number of levels:   ");
-    if ( scanf("%d", &maxlevel) > 1 ) {
+    if ( scanf(INTFMT, &maxlevel) > 1 ) {
         printf("### ERROR: Did not get a valid input !!!\n");
         return ERROR_INPUT_PAR;
     }
@@ -110,8 +110,8 @@ int main (int argc, const char * argv[])
     
     // Print problem size
     if (print_level > PRINT_NONE) {
-        printf("A: m = %d, n = %d, nnz = %d\n", A.row, A.col, A.nnz);
-        printf("b: n = %d\n", b.row);
+        printf("A: m = " INTFMT ", n = " INTFMT ", nnz = " INTFMT "\n", A.row, A.col, A.nnz);
+        printf("b: n = " INTFMT "\n", b.row);
     }
 
     // Set initial guess
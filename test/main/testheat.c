@@ -132,8 +132,8 @@ int main (int argc, const char * argv[])
                                   &(bdinfo.bd), &(bdinfo.dof), &(bdinfo.idx), &uh);
         
         // Print problem size
-        printf("A: m = %d, n = %d, nnz = %d\n", A.row, A.col, A.nnz);
-        printf("b: n = %d\n", b.row);
+        printf("A: m = " INTFMT ", n = " INTFMT ", nnz = " INTFMT "\n", A.row, A.col, A.nnz);
+        printf("b: n = " INTFMT "\n", b.row);
         
         // Solve A x = b with AMG 
         {
@@ -35,8 +35,8 @@ int main (int argc, const char * argv[])
     fasp_dcsrvec_read2(datafile1, datafile2, &A, &b);
 
     // Print problem size
-    printf("A: m = %d, n = %d, nnz = %d\n", A.row, A.col, A.nnz);
-    printf("b: n = %d\n", b.row);
+    printf("A: m = " INTFMT ", n = " INTFMT ", nnz = " INTFMT "\n", A.row, A.col, A.nnz);
+    printf("b: n = " INTFMT "\n", b.row);
 
     //--------------------------//
     // Step 2. Solve the system //
@@ -39,7 +39,7 @@ int mesh_init (Mesh *mesh, const char *filename)
     }
     
     // get the node' coordinates
-    if ( fscanf(inputFile, "%d %d", &num_node, &dim_node) > 0 ) {
+    if ( fscanf(inputFile, INTFMT " " INTFMT, &num_node, &dim_node) > 0 ) {
         mesh->node.row = num_node;
         mesh->node.col = dim_node;
     }
@@ -62,7 +62,7 @@ int mesh_init (Mesh *mesh, const char *filename)
     }
     
     // get triangular grid
-    if ( fscanf(inputFile, "%d %d", &num_elem, &dim_elem) > 0 ) {
+    if ( fscanf(inputFile, INTFMT " " INTFMT, &num_elem, &dim_elem) > 0 ) {
         mesh->elem.row = num_elem;
         mesh->elem.col = dim_elem;
     }
@@ -80,7 +80,7 @@ int mesh_init (Mesh *mesh, const char *filename)
         // re-point to the val
         mesh->elem.val[i] = &tmp_elem[dim_elem*i];
         for (j=0;j<dim_elem;++j) {
-            status = fscanf(inputFile, "%d", &mesh->elem.val[i][j]);
+            status = fscanf(inputFile, INTFMT, &mesh->elem.val[i][j]);
             mesh->elem.val[i][j]--;
         }
     }
@@ -125,7 +125,7 @@ int mesh_init_pro (Mesh *mesh, const char *filename)
     }
     
     // get the node' coordinates
-    if ( fscanf(inputFile, "%d %d", &num_node, &dim_node) > 0 ) {
+    if ( fscanf(inputFile, INTFMT " " INTFMT, &num_node, &dim_node) > 0 ) {
         mesh->node.row = num_node;
         mesh->node.col = dim_node;
     }
@@ -148,7 +148,7 @@ int mesh_init_pro (Mesh *mesh, const char *filename)
     }
     
     // get triangular grid
-    if ( fscanf(inputFile, "%d %d", &num_elem, &dim_elem) > 0 ) {
+    if ( fscanf(inputFile, INTFMT " " INTFMT, &num_elem, &dim_elem) > 0 ) {
         mesh->elem.row = num_elem;
         mesh->elem.col = dim_elem;
     }
@@ -166,13 +166,13 @@ int mesh_init_pro (Mesh *mesh, const char *filename)
         // re-point to the val
         mesh->elem.val[i]=&tmp_elem[dim_elem*i];
         for (j=0;j<dim_elem;++j) {
-            status = fscanf(inputFile, "%d", &mesh->elem.val[i][j]);
+            status = fscanf(inputFile, INTFMT, &mesh->elem.val[i][j]);
             mesh->elem.val[i][j]--;
         }
     }
     
     // get node boundary flag
-    if ( fscanf(inputFile, "%d", &num_elem) > 0 ) {
+    if ( fscanf(inputFile, INTFMT, &num_elem) > 0 ) {
         mesh->node_bd.row = num_node;
     }
     else {
@@ -182,7 +182,7 @@ int mesh_init_pro (Mesh *mesh, const char *filename)
     
     mesh->node_bd.val = (INT *)fasp_mem_calloc(num_node, sizeof(INT));
     for (i=0;i<num_node;++i) {
-        status = fscanf(inputFile, "%d", &mesh->node_bd.val[i]);
+        status = fscanf(inputFile, INTFMT, &mesh->node_bd.val[i]);
     }
     
     fclose(inputFile);
@@ -216,7 +216,7 @@ int mesh_aux_init (Mesh *mesh, Mesh_aux *mesh_aux, const char *filename)
     }
     
     // get the edge info
-    if ( fscanf(inputFile, "%d %d", &num_edge, &dim_edge) > 0 ) {
+    if ( fscanf(inputFile, INTFMT " " INTFMT, &num_edge, &dim_edge) > 0 ) {
         mesh_aux->edge.row = num_edge;
         mesh_aux->edge.col = dim_edge;
     }
@@ -234,13 +234,13 @@ int mesh_aux_init (Mesh *mesh, Mesh_aux *mesh_aux, const char *filename)
         // re-point to the val
         mesh_aux->edge.val[i]=&tmp_edge[dim_edge*i];
         for (j=0;j<dim_edge;++j) {
-            status = fscanf(inputFile, "%d", &mesh_aux->edge.val[i][j]);
+            status = fscanf(inputFile, INTFMT, &mesh_aux->edge.val[i][j]);
             mesh_aux->edge.val[i][j]--;
         }
     }
     
     // get elem's edge info
-    if ( fscanf(inputFile, "%d %d", &num_elem2edge, &dim_elem2edge) > 0 ) {
+    if ( fscanf(inputFile, INTFMT " " INTFMT, &num_elem2edge, &dim_elem2edge) > 0 ) {
         mesh_aux->elem2edge.row=num_elem2edge;
         mesh_aux->elem2edge.col=dim_elem2edge;
     }
@@ -258,7 +258,7 @@ int mesh_aux_init (Mesh *mesh, Mesh_aux *mesh_aux, const char *filename)
         // re-point to the val
         mesh_aux->elem2edge.val[i] = &tmp_elem[dim_elem2edge*i];
         for (j=0;j<dim_elem2edge;++j) {
-            status = fscanf(inputFile, "%d", &mesh_aux->elem2edge.val[i][j]);
+            status = fscanf(inputFile, INTFMT, &mesh_aux->elem2edge.val[i][j]);
             mesh_aux->elem2edge.val[i][j]--;
         }
     }
@@ -312,7 +312,7 @@ int mesh_aux_init_pro (Mesh *mesh, Mesh_aux *mesh_aux, const char *filename)
     }
     
     // get the edge info
-    if ( fscanf(inputFile, "%d %d", &num_edge, &dim_edge) > 0 ) {
+    if ( fscanf(inputFile, INTFMT " " INTFMT, &num_edge, &dim_edge) > 0 ) {
         mesh_aux->edge.row=num_edge;
         mesh_aux->edge.col=dim_edge;
     }
@@ -330,13 +330,13 @@ int mesh_aux_init_pro (Mesh *mesh, Mesh_aux *mesh_aux, const char *filename)
         // re-point to the val
         mesh_aux->edge.val[i]=&tmp_edge[dim_edge*i];
         for (j=0;j<dim_edge;++j) {
-            status = fscanf(inputFile, "%d", &mesh_aux->edge.val[i][j]);
+            status = fscanf(inputFile, INTFMT, &mesh_aux->edge.val[i][j]);
             mesh_aux->edge.val[i][j]--;
         }
     }
     
     // get elem's edge info
-    if ( fscanf(inputFile, "%d %d", &num_elem2edge, &dim_elem2edge) > 0 ) {
+    if ( fscanf(inputFile, INTFMT " " INTFMT, &num_elem2edge, &dim_elem2edge) > 0 ) {
         mesh_aux->elem2edge.row=num_elem2edge;
         mesh_aux->elem2edge.col=dim_elem2edge;
     }
@@ -354,13 +354,13 @@ int mesh_aux_init_pro (Mesh *mesh, Mesh_aux *mesh_aux, const char *filename)
         // re-point to the val
         mesh_aux->elem2edge.val[i]=&tmp_elem[dim_elem2edge*i];
         for (j=0;j<dim_elem2edge;++j) {
-            status = fscanf(inputFile, "%d", &mesh_aux->elem2edge.val[i][j]);
+            status = fscanf(inputFile, INTFMT, &mesh_aux->elem2edge.val[i][j]);
             mesh_aux->elem2edge.val[i][j]--;
         }
     }
     
     // get edge boundary flag
-    if ( fscanf(inputFile, "%d", &num_edge) > 0 ) {
+    if ( fscanf(inputFile, INTFMT, &num_edge) > 0 ) {
         mesh_aux->edge_bd.row = num_edge;
         mesh_aux->edge_bd.val = (INT *)fasp_mem_calloc(num_edge, sizeof(INT));
     }
@@ -370,7 +370,7 @@ int mesh_aux_init_pro (Mesh *mesh, Mesh_aux *mesh_aux, const char *filename)
     }
     
     for (i=0;i<num_edge;++i) {
-        status = fscanf(inputFile, "%d", &mesh_aux->edge_bd.val[i]);
+        status = fscanf(inputFile, INTFMT, &mesh_aux->edge_bd.val[i]);
     }
     
     fclose(inputFile);
@@ -562,7 +562,7 @@ int mesh_write (Mesh *mesh, const char *filename)
         exit(ERROR_OPEN_FILE);
     }
     
-    fprintf(outputFile, "%d %d\n", num_node, dim_node);
+    fprintf(outputFile, INTFMT " " INTFMT "\n", num_node, dim_node);
     
     for (i=0;i<num_node;++i) {
         for (j=0;j<dim_node;++j) {
@@ -571,11 +571,11 @@ int mesh_write (Mesh *mesh, const char *filename)
         fprintf(outputFile, "\n");
     }
     
-    fprintf(outputFile, "%d %d\n", num_elem, dim_elem);
+    fprintf(outputFile, INTFMT " " INTFMT "\n", num_elem, dim_elem);
     
     for (i=0;i<num_elem;++i) {
         for (j=0;j<dim_elem;++j) {
-            fprintf(outputFile, "%d ", mesh->elem.val[i][j]+1);
+            fprintf(outputFile, INTFMT " ", mesh->elem.val[i][j]+1);
         }
         fprintf(outputFile, "\n");
     }
@@ -612,7 +612,7 @@ int mesh_write_pro (Mesh *mesh, const char *filename)
         exit(ERROR_OPEN_FILE);
     }
     
-    fprintf(outputFile, "%d %d\n", num_node, dim_node);
+    fprintf(outputFile, INTFMT " " INTFMT "\n", num_node, dim_node);
     
     for (i=0;i<num_node;++i) {
         for (j=0;j<dim_node;++j) {
@@ -621,18 +621,18 @@ int mesh_write_pro (Mesh *mesh, const char *filename)
         fprintf(outputFile, "\n");
     }
     
-    fprintf(outputFile, "%d %d\n", num_elem, dim_elem);
+    fprintf(outputFile, INTFMT " " INTFMT "\n", num_elem, dim_elem);
     
     for (i=0;i<num_elem;++i) {
         for (j=0;j<dim_elem;++j) {
-            fprintf(outputFile, "%d ", mesh->elem.val[i][j]+1);
+            fprintf(outputFile, INTFMT " ", mesh->elem.val[i][j]+1);
         }
         fprintf(outputFile, "\n");
     }
     
-    fprintf(outputFile, "%d\n", num_node);
+    fprintf(outputFile, INTFMT "\n", num_node);
     for (i=0;i<num_node;++i) {
-        fprintf(outputFile, "%d\n", mesh->node_bd.val[i]);
+        fprintf(outputFile, INTFMT "\n", mesh->node_bd.val[i]);
     }
     
     fclose(outputFile);
@@ -667,20 +667,20 @@ int mesh_aux_write (Mesh_aux *mesh_aux, const char *filename)
         exit(ERROR_OPEN_FILE);
     }
     
-    fprintf(outputFile, "%d %d\n", num_edge, dim_edge);
+    fprintf(outputFile, INTFMT " " INTFMT "\n", num_edge, dim_edge);
     
     for (i=0;i<num_edge;++i) {
         for (j=0;j<dim_edge;++j) {
-            fprintf(outputFile, "%d ", mesh_aux->edge.val[i][j]+1);
+            fprintf(outputFile, INTFMT " ", mesh_aux->edge.val[i][j]+1);
         }
         fprintf(outputFile, "\n");
     }
     
-    fprintf(outputFile, "%d %d\n", num_elem2edge, dim_elem2edge);
+    fprintf(outputFile, INTFMT " " INTFMT "\n", num_elem2edge, dim_elem2edge);
     
     for (i=0;i<num_elem2edge;++i) {
         for (j=0;j<dim_elem2edge;++j) {
-            fprintf(outputFile, "%d ", mesh_aux->elem2edge.val[i][j]+1);
+            fprintf(outputFile, INTFMT " ", mesh_aux->elem2edge.val[i][j]+1);
         }
         fprintf(outputFile, "\n");
     }
@@ -718,28 +718,28 @@ int mesh_aux_write_pro (Mesh_aux *mesh_aux, const char *filename)
         exit(ERROR_OPEN_FILE);
     }
     
-    fprintf(outputFile, "%d %d\n", num_edge, dim_edge);
+    fprintf(outputFile, INTFMT " " INTFMT "\n", num_edge, dim_edge);
     
     for (i=0;i<num_edge;++i) {
         for (j=0;j<dim_edge;++j) {
-            fprintf(outputFile, "%d ", mesh_aux->edge.val[i][j]+1);
+            fprintf(outputFile, INTFMT " ", mesh_aux->edge.val[i][j]+1);
         }
         fprintf(outputFile, "\n");
     }
     
-    fprintf(outputFile, "%d %d\n", num_elem2edge, dim_elem2edge);
+    fprintf(outputFile, INTFMT " " INTFMT "\n", num_elem2edge, dim_elem2edge);
     
     for (i=0;i<num_elem2edge;++i) {
         for (j=0;j<dim_elem2edge;++j) {
-            fprintf(outputFile, "%d ", mesh_aux->elem2edge.val[i][j]+1);
+            fprintf(outputFile, INTFMT " ", mesh_aux->elem2edge.val[i][j]+1);
         }
         fprintf(outputFile, "\n");
     }
     
-    fprintf(outputFile, "%d\n", num_edge);
+    fprintf(outputFile, INTFMT "\n", num_edge);
     
     for (i=0;i<num_edge;++i) {
-        fprintf(outputFile, "%d\n", mesh_aux->edge_bd.val[i]);
+        fprintf(outputFile, INTFMT "\n", mesh_aux->edge_bd.val[i]);
     }
     
     fclose(outputFile);
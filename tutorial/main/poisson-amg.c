@@ -61,8 +61,8 @@ int main (int argc, const char * argv[])
     
     // Step 2. Print problem size and AMG parameters
     if (print_level>PRINT_NONE) {
-        printf("A: m = %d, n = %d, nnz = %d\n", A.row, A.col, A.nnz);
-        printf("b: n = %d\n", b.row);
+        printf("A: m = " INTFMT ", n = " INTFMT ", nnz = " INTFMT "\n", A.row, A.col, A.nnz);
+        printf("b: n = " INTFMT "\n", b.row);
         fasp_param_amg_print(&amgparam);
     }
     
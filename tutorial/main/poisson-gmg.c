@@ -93,7 +93,7 @@ int main (int argc, const char *argv[])
     
     // Step 0. Set number of levels for GMG
     printf("Enter the desired number of levels:   ");
-    if ( scanf("%d", &maxlevel) > 1 ) {
+    if ( scanf(INTFMT, &maxlevel) > 1 ) {
         printf("### ERROR: Did not get a valid input !!!\n");
         return ERROR_INPUT_PAR;
     }
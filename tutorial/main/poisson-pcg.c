@@ -68,8 +68,8 @@ int main (int argc, const char * argv[])
     
     // Step 2. Print problem size and PCG parameters
     if (print_level>PRINT_NONE) {
-        printf("A: m = %d, n = %d, nnz = %d\n", A.row, A.col, A.nnz);
-        printf("b: n = %d\n", b.row);
+        printf("A: m = " INTFMT ", n = " INTFMT ", nnz = " INTFMT "\n", A.row, A.col, A.nnz);
+        printf("b: n = " INTFMT "\n", b.row);
         fasp_param_solver_print(&itparam);
     }
     
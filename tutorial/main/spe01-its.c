@@ -65,8 +65,8 @@ int main (int argc, const char * argv[])
     
     // Step 2. Print problem size and ITS_bsr parameters
     if (print_level>PRINT_NONE) {
-        printf("A: m = %d, n = %d, nnz = %d\n", A.ROW, A.COL, A.NNZ);
-        printf("b: n = %d\n", b.row);
+        printf("A: m = " INTFMT ", n = " INTFMT ", nnz = " INTFMT "\n", A.ROW, A.COL, A.NNZ);
+        printf("b: n = " INTFMT "\n", b.row);
         fasp_param_solver_print(&itparam);
         fasp_param_ilu_print(&iluparam);
     }
@@ -14,6 +14,12 @@
 # modified by Chensong Zhang to update output format ( 01/31/2017 )
 # modified by Chensong Zhang to update copyright info ( 03/18/2018 )
 # modified by Chensong Zhang to add DLL export ( 02/28/2021 )
+# modified by FASP team to add SELL format ( 10/16/2026 )
+# modified by FASP team to add CSR SpMV plan ( 10/16/2026 )
+# modified by FASP team to add SymCSR format ( 10/16/2026 )
+# modified by FASP team to add CSR16 format ( 10/16/2026 )
+# modified by FASP team to add memory arena ( 10/16/2026 )
+# modified by FASP team to add RAP plan ( 10/16/2026 )
 
 BEGIN {
   inheader=0;
@@ -67,7 +73,7 @@ BEGIN {
   next;
 }
 
-!/^INT|^SHORT|^LONG|^REAL|^FILE|^OFF_T|^size_t|^off_t|^pid_t|^unsigned|^mode_t|^DIR|^user|^int|^short|^long|^char|^uint|^struct|^BOOL|^void|^double|^time|^dCSRmat|^dCOOmat|^dvector|^iCSRmat|^ivector|^AMG_data|^ILU_data|^dSTRmat|^dBSRmat|^dCSRLmat|^precond|^cudvector|^cuivector|^Mumps_data|^cudCSRmat/ {
+!/^INT|^SHORT|^LONG|^REAL|^FILE|^OFF_T|^size_t|^off_t|^pid_t|^unsigned|^mode_t|^DIR|^user|^int|^short|^long|^char|^uint|^struct|^BOOL|^void|^double|^time|^dCSRmat|^dCOOmat|^dvector|^iCSRmat|^ivector|^AMG_data|^ILU_data|^dSTRmat|^dBSRmat|^dCSRLmat|^dSELLmat|^dSymCSRmat|^dCSRplan|^dCSRrap|^dCSR16mat|^Arena_data|^precond|^cudvector|^cuivector|^Mumps_data|^cudCSRmat/ {
   next;
 }
 